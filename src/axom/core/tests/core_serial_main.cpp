@@ -40,6 +40,7 @@
 #include "utils_nvtx_settings.hpp"
 #include "utils_stringUtilities.hpp"
 #include "utils_system.hpp"
+#include "utils_textParsing.hpp"
 #include "utils_Timer.hpp"
 #include "utils_utilities.hpp"
 
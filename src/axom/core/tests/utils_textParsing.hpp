@@ -0,0 +1,272 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "gtest/gtest.h"
+
+#include "axom/core/utilities/TextParsing.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace text = axom::utilities::text;
+
+namespace
+{
+double parse_double(const std::string& str)
+{
+  double value = -1.;
+  const char* first = str.c_str();
+  const char* next = text::parseNumber(first, first + str.size(), value);
+  EXPECT_EQ(first + str.size(), next) << "Did not parse all of " << str;
+  return value;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+TEST(utils_textParsing, parse_doubles)
+{
+  const std::vector<std::string> numbers = {"0",
+                                            "1",
+                                            "-1",
+                                            "+2.5",
+                                            ".5",
+                                            "5.",
+                                            "3.14159265358979",
+                                            "-0.000123",
+                                            "1e10",
+                                            "1.5E-7",
+                                            "-2.75e+3",
+                                            "6.02214076e23",
+                                            "1e-300",
+                                            "1.7976931348623157e308",
+                                            "0.1234567890123456789012345",
+                                            "12345678901234567890123"};
+
+  for(const auto& str : numbers)
+  {
+    EXPECT_EQ(std::strtod(str.c_str(), nullptr), parse_double(str)) << str;
+  }
+
+  EXPECT_TRUE(std::isinf(parse_double("inf")));
+  EXPECT_TRUE(std::isnan(parse_double("nan")));
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_textParsing, parse_invalid)
+{
+  const std::vector<std::string> invalid = {"", "-", ".", "e5", "abc", " 1"};
+
+  for(const auto& str : invalid)
+  {
+    double value = 42.;
+    const char* first = str.c_str();
+    EXPECT_EQ(first, text::parseNumber(first, first + str.size(), value))
+      << str;
+    EXPECT_EQ(42., value);
+  }
+
+  // The exponent is optional; a trailing 'e' is not part of the number
+  double value = 0.;
+  const std::string str = "2.5e";
+  const char* first = str.c_str();
+  EXPECT_EQ(first + 3, text::parseNumber(first, first + str.size(), value));
+  EXPECT_EQ(2.5, value);
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_textParsing, parse_integers)
+{
+  const std::string str = "-123 456 2147483648 -2147483648";
+  text::TextCursor cursor(str.c_str(), str.c_str() + str.size());
+
+  int i = 0;
+  EXPECT_TRUE(cursor.read(i));
+  EXPECT_EQ(-123, i);
+  EXPECT_TRUE(cursor.read(i));
+  EXPECT_EQ(456, i);
+
+  // Overflows an int, but not a 64-bit integer
+  text::TextCursor copy = cursor;
+  EXPECT_FALSE(copy.read(i));
+  std::int64_t big = 0;
+  EXPECT_TRUE(cursor.read(big));
+  EXPECT_EQ(2147483648LL, big);
+
+  EXPECT_TRUE(cursor.read(i));
+  EXPECT_EQ(-2147483647 - 1, i);
+  EXPECT_FALSE(cursor.read(i));
+  EXPECT_TRUE(cursor.atEnd());
+
+  // A decimal number is not an integer
+  const std::string decimal = "1.5";
+  text::TextCursor decimalCursor(decimal.c_str(),
+                                 decimal.c_str() + decimal.size());
+  EXPECT_FALSE(decimalCursor.read(i));
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_textParsing, cursor)
+{
+  const std::string str =
+    "solid cube\n"
+    "  vertex 1 2.5 -3e1\r\n"
+    "\n"
+    "endsolid";
+  text::TextCursor cursor(str.c_str(), str.c_str() + str.size());
+
+  EXPECT_FALSE(cursor.matchWord("sol"));
+  EXPECT_TRUE(cursor.matchWord("solid"));
+  std::string name;
+  EXPECT_TRUE(cursor.readWord(name));
+  EXPECT_EQ("cube", name);
+
+  text::TextCursor line = cursor.nextLine();
+  EXPECT_TRUE(line.atEnd());
+
+  line = cursor.nextLine();
+  EXPECT_TRUE(line.matchWord("vertex"));
+  double xyz[3];
+  for(double& coord : xyz)
+  {
+    EXPECT_TRUE(line.read(coord));
+  }
+  EXPECT_EQ(1., xyz[0]);
+  EXPECT_EQ(2.5, xyz[1]);
+  EXPECT_EQ(-30., xyz[2]);
+
+  // The carriage return is whitespace
+  line.skipWhitespace();
+  EXPECT_TRUE(line.atEnd());
+
+  EXPECT_FALSE(text::NonBlankLine {}(cursor.nextLine()));
+  line = cursor.nextLine();
+  EXPECT_TRUE(line.matchWord("endsolid"));
+  EXPECT_TRUE(cursor.atEnd());
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_textParsing, for_each_line)
+{
+  // Enough lines to be split into several parts
+  const int NUM_LINES = 200000;
+  std::string str = "# header\n";
+  for(int i = 0; i < NUM_LINES; ++i)
+  {
+    str += std::to_string(i) + " " + std::to_string(0.5 * i) + "\n";
+    if(i % 1000 == 0)
+    {
+      str += "\n";
+    }
+  }
+  str += "trailer";
+
+  const char* begin = str.c_str();
+  const char* end = begin + str.size();
+  begin = std::strchr(begin, '\n') + 1;
+
+  auto isDataLine = [](text::TextCursor line) {
+    int id;
+    return line.read(id);
+  };
+  EXPECT_EQ(NUM_LINES, text::countLines(begin, end, isDataLine));
+
+  // Process part of the lines, then the rest
+  std::vector<double> values(NUM_LINES, -1.);
+  double* valuesPtr = values.data();
+  auto readLine = [=](axom::IndexType i, text::TextCursor& line) {
+    int id;
+    return line.read(id) && id == i && line.read(valuesPtr[i]);
+  };
+
+  const int FIRST_LINES = 123456;
+  EXPECT_EQ(FIRST_LINES, text::forEachLine(begin, end, FIRST_LINES, readLine));
+  EXPECT_EQ(std::to_string(FIRST_LINES),
+            std::string(begin, begin + std::to_string(FIRST_LINES).size()));
+
+  auto readRest = [=](axom::IndexType i, text::TextCursor& line) {
+    return readLine(i + FIRST_LINES, line);
+  };
+  EXPECT_EQ(NUM_LINES - FIRST_LINES,
+            text::forEachLine(begin,
+                              end,
+                              NUM_LINES - FIRST_LINES,
+                              isDataLine,
+                              readRest));
+
+  for(int i = 0; i < NUM_LINES; ++i)
+  {
+    EXPECT_EQ(0.5 * i, values[i]);
+  }
+
+  // Parsing failures are reported
+  begin = str.c_str();
+  EXPECT_EQ(-1, text::forEachLine(begin, end, NUM_LINES, readLine));
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_textParsing, chunked_reader)
+{
+  const std::string fileName = "utils_textParsing_chunked.txt";
+  const int NUM_LINES = 1000;
+  {
+    std::ofstream ofs(fileName);
+    for(int i = 0; i < NUM_LINES; ++i)
+    {
+      ofs << i << " " << 0.25 * i << "\n";
+    }
+    ofs << NUM_LINES << " " << 0.25 * NUM_LINES;  // no final line break
+  }
+
+  // Use a tiny chunk size, so lines straddle the chunk boundaries
+  text::ChunkedFileReader reader(fileName, 7);
+  ASSERT_TRUE(reader.isOpen());
+
+  int numLines = 0;
+  while(reader.nextChunk())
+  {
+    text::TextCursor cursor = reader.cursor();
+    while(!cursor.atEnd())
+    {
+      text::TextCursor line = cursor.nextLine();
+      int id;
+      double value;
+      EXPECT_TRUE(line.read(id));
+      EXPECT_TRUE(line.read(value));
+      EXPECT_EQ(numLines, id);
+      EXPECT_EQ(0.25 * numLines, value);
+      ++numLines;
+    }
+  }
+  EXPECT_EQ(NUM_LINES + 1, numLines);
+
+  // Keep the unprocessed text of a chunk for the next one
+  text::ChunkedFileReader keepReader(fileName, 64);
+  numLines = 0;
+  const char* pos = nullptr;
+  while(keepReader.nextChunk(pos))
+  {
+    // Parse only the first line of each chunk
+    text::TextCursor cursor = keepReader.cursor();
+    text::TextCursor line = cursor.nextLine();
+    int id;
+    EXPECT_TRUE(line.read(id));
+    EXPECT_EQ(numLines, id);
+    ++numLines;
+    pos = cursor.position();
+  }
+  EXPECT_EQ(NUM_LINES + 1, numLines);
+
+  text::ChunkedFileReader missing("utils_textParsing_missing.txt");
+  EXPECT_FALSE(missing.isOpen());
+  EXPECT_FALSE(missing.nextChunk());
+
+  std::remove(fileName.c_str());
+}
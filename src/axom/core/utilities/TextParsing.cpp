@@ -0,0 +1,266 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/core/utilities/TextParsing.hpp"
+
+#include <algorithm>
+#include <clocale>
+#include <cstdlib>
+
+namespace axom
+{
+namespace utilities
+{
+namespace text
+{
+namespace
+{
+/// Powers of ten that are exactly representable as doubles
+constexpr double EXACT_POWERS_OF_TEN[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                          1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                          1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                          1e18, 1e19, 1e20, 1e21, 1e22};
+
+constexpr int MAX_EXACT_POWER = 22;
+
+/// Mantissas below this are exactly representable as doubles
+constexpr std::uint64_t MAX_EXACT_MANTISSA = std::uint64_t(1) << 53;
+
+/// Converts the number at the start of [first, last) with std::strtod
+const char* parseWithStrtod(const char* first, const char* last, double& value)
+{
+  // Copy the token, since strtod expects a null-terminated string and
+  // uses the decimal point of the C locale
+  const char* tokenEnd = first;
+  while(tokenEnd < last && !isSpace(*tokenEnd))
+  {
+    ++tokenEnd;
+  }
+
+  std::string token(first, tokenEnd);
+  const char localePoint = *std::localeconv()->decimal_point;
+  if(localePoint != '.')
+  {
+    std::replace(token.begin(), token.end(), '.', localePoint);
+  }
+
+  char* parsedEnd = nullptr;
+  const double parsed = std::strtod(token.c_str(), &parsedEnd);
+  if(parsedEnd == token.c_str())
+  {
+    return first;
+  }
+
+  value = parsed;
+  return first + (parsedEnd - token.c_str());
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+const char* parseNumber(const char* first, const char* last, double& value)
+{
+  const char* pos = first;
+  const bool negative = (pos < last && *pos == '-');
+  if(pos < last && (*pos == '-' || *pos == '+'))
+  {
+    ++pos;
+  }
+
+  // Accumulate up to 19 significant digits; more go to the slow path
+  std::uint64_t mantissa = 0;
+  int numDigits = 0;
+  int exponent = 0;
+  bool truncated = false;
+
+  const char* digitsBegin = pos;
+  for(; pos < last && *pos >= '0' && *pos <= '9'; ++pos)
+  {
+    if(numDigits < 19)
+    {
+      mantissa = mantissa * 10 + (*pos - '0');
+      numDigits += (mantissa > 0) ? 1 : 0;
+    }
+    else
+    {
+      truncated = true;
+    }
+  }
+  bool hasDigits = (pos > digitsBegin);
+
+  if(pos < last && *pos == '.')
+  {
+    ++pos;
+    const char* fractionBegin = pos;
+    for(; pos < last && *pos >= '0' && *pos <= '9'; ++pos)
+    {
+      if(numDigits < 19)
+      {
+        mantissa = mantissa * 10 + (*pos - '0');
+        numDigits += (mantissa > 0) ? 1 : 0;
+        --exponent;
+      }
+      else
+      {
+        truncated = true;
+      }
+    }
+    hasDigits = hasDigits || (pos > fractionBegin);
+  }
+
+  if(!hasDigits)
+  {
+    // Not a decimal number, but possibly "inf" or "nan"
+    return parseWithStrtod(first, last, value);
+  }
+
+  if(pos < last && (*pos == 'e' || *pos == 'E'))
+  {
+    int exponentValue = 0;
+    const char* exponentEnd = parseNumber(pos + 1, last, exponentValue);
+    if(exponentEnd != pos + 1)
+    {
+      exponent += exponentValue;
+      pos = exponentEnd;
+    }
+  }
+
+  // Fast path: the mantissa and the power of ten are both exact, so the
+  // single multiplication or division is correctly rounded
+  if(!truncated && mantissa < MAX_EXACT_MANTISSA &&
+     exponent >= -MAX_EXACT_POWER && exponent <= MAX_EXACT_POWER)
+  {
+    const double m = static_cast<double>(mantissa);
+    const double result = (exponent < 0) ? m / EXACT_POWERS_OF_TEN[-exponent]
+                                         : m * EXACT_POWERS_OF_TEN[exponent];
+    value = negative ? -result : result;
+    return pos;
+  }
+
+  return parseWithStrtod(first, last, value);
+}
+
+//------------------------------------------------------------------------------
+const char* parseNumber(const char* first, const char* last, float& value)
+{
+  double parsed = 0.;
+  const char* next = parseNumber(first, last, parsed);
+  if(next != first)
+  {
+    value = static_cast<float>(parsed);
+  }
+  return next;
+}
+
+//------------------------------------------------------------------------------
+constexpr std::size_t ChunkedFileReader::DEFAULT_CHUNK_SIZE;
+
+//------------------------------------------------------------------------------
+ChunkedFileReader::ChunkedFileReader(const std::string& fileName,
+                                     std::size_t chunkSize)
+  : m_ifs(fileName.c_str(), std::ios::in | std::ios::binary)
+  , m_readSize(std::max(chunkSize, std::size_t(1)))
+{
+  // Avoid allocating a full chunk for a small file
+  if(m_ifs.is_open())
+  {
+    m_ifs.seekg(0, std::ios::end);
+    const std::streamoff fileSize = m_ifs.tellg();
+    m_ifs.seekg(0, std::ios::beg);
+    if(fileSize >= 0)
+    {
+      m_readSize =
+        std::min(m_readSize, static_cast<std::size_t>(fileSize) + 1);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+bool ChunkedFileReader::nextChunk(const char* keepFrom)
+{
+  // Move the kept text and the partial line after the chunk to the front
+  const std::size_t keepBegin = (keepFrom != nullptr)
+    ? static_cast<std::size_t>(keepFrom - m_buffer.data())
+    : m_chunkSize;
+  if(keepBegin > 0 && m_dataSize > keepBegin)
+  {
+    std::memmove(m_buffer.data(),
+                 m_buffer.data() + keepBegin,
+                 m_dataSize - keepBegin);
+  }
+  m_dataSize -= keepBegin;
+  const std::size_t keptSize = m_dataSize;
+  m_chunkSize = 0;
+
+  // Read until the new text has a line break or the file ends
+  while(true)
+  {
+    m_atEndOfFile = m_atEndOfFile || !m_ifs.is_open();
+    if(!m_atEndOfFile)
+    {
+      m_buffer.resize(m_dataSize + m_readSize);
+      m_ifs.read(m_buffer.data() + m_dataSize, m_readSize);
+      const std::size_t count = static_cast<std::size_t>(m_ifs.gcount());
+      m_dataSize += count;
+      m_bytesRead += count;
+      m_atEndOfFile = (count < m_readSize);
+    }
+
+    if(m_atEndOfFile)
+    {
+      m_chunkSize = m_dataSize;
+      break;
+    }
+
+    // End the chunk after the last line break of the new text
+    const char* data = m_buffer.data();
+    std::size_t pos = m_dataSize;
+    while(pos > keptSize && data[pos - 1] != '\n')
+    {
+      --pos;
+    }
+    if(pos > keptSize)
+    {
+      m_chunkSize = pos;
+      break;
+    }
+  }
+
+  return m_chunkSize > 0;
+}
+
+//------------------------------------------------------------------------------
+std::vector<const char*> internal::splitAtLines(const char* begin,
+                                                const char* end)
+{
+  std::vector<const char*> parts;
+  parts.push_back(begin);
+
+  const std::size_t size = static_cast<std::size_t>(end - begin);
+  const char* pos = begin;
+  for(std::size_t target = LINE_PART_SIZE; target < size;
+      target += LINE_PART_SIZE)
+  {
+    if(begin + target <= pos)
+    {
+      continue;
+    }
+
+    TextCursor cursor(begin + target, end);
+    cursor.skipLine();
+    pos = cursor.position();
+    if(pos < end)
+    {
+      parts.push_back(pos);
+    }
+  }
+
+  parts.push_back(end);
+  return parts;
+}
+
+}  // namespace text
+}  // namespace utilities
+}  // namespace axom
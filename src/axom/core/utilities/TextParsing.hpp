@@ -0,0 +1,563 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file TextParsing.hpp
+ *
+ * \brief Fast, locale-independent scanning of ascii text files
+ *
+ * The functions in this file parse numbers directly from character buffers
+ * and read files in large chunks that end at line boundaries.  Files whose
+ * records are one per line can have the lines of each chunk parsed in
+ * parallel with forEachLine().
+ */
+
+#ifndef AXOM_CORE_TEXT_PARSING_HPP_
+#define AXOM_CORE_TEXT_PARSING_HPP_
+
+#include "axom/config.hpp"
+#include "axom/core/Macros.hpp"
+#include "axom/core/Types.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/core/execution/runtime_policy.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace axom
+{
+namespace utilities
+{
+namespace text
+{
+/// Predicate for the whitespace characters: space, \\t, \\n, \\v, \\f and \\r
+inline bool isSpace(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+/*!
+ * \brief Parses a floating point number at the start of [first, last)
+ *
+ * Accepts an optional sign, digits with an optional decimal point, and an
+ * optional exponent, and is independent of the locale.  Numbers with up to
+ * 15 significant digits and small exponents, which covers most mesh files,
+ * are converted without calling the C library.  Others, and "inf" or "nan",
+ * are converted with std::strtod.
+ *
+ * \param [in] first pointer to the first character
+ * \param [in] last pointer past the last character
+ * \param [out] value the parsed value
+ * \return Pointer past the parsed characters, or \a first if there is no
+ *  number at \a first
+ */
+const char* parseNumber(const char* first, const char* last, double& value);
+
+/// \overload
+const char* parseNumber(const char* first, const char* last, float& value);
+
+/*!
+ * \brief Parses an integer, with an optional sign, at the start of
+ *  [first, last)
+ *
+ * \return Pointer past the parsed characters, or \a first if there is no
+ *  integer at \a first or it overflows \a IntType
+ */
+template <typename IntType>
+typename std::enable_if<std::is_integral<IntType>::value, const char*>::type
+parseNumber(const char* first, const char* last, IntType& value)
+{
+  using UnsignedType = typename std::make_unsigned<IntType>::type;
+
+  const char* pos = first;
+  bool negative = false;
+  if(pos < last && (*pos == '-' || *pos == '+'))
+  {
+    negative = (*pos == '-');
+    if(negative && !std::is_signed<IntType>::value)
+    {
+      return first;
+    }
+    ++pos;
+  }
+
+  const UnsignedType maxMagnitude = negative
+    ? UnsignedType(std::numeric_limits<IntType>::max()) + 1
+    : UnsignedType(std::numeric_limits<IntType>::max());
+
+  const char* digits = pos;
+  UnsignedType magnitude = 0;
+  for(; pos < last && *pos >= '0' && *pos <= '9'; ++pos)
+  {
+    const UnsignedType digit = static_cast<UnsignedType>(*pos - '0');
+    if(magnitude > (maxMagnitude - digit) / 10)
+    {
+      return first;
+    }
+    magnitude = magnitude * 10 + digit;
+  }
+
+  if(pos == digits)
+  {
+    return first;
+  }
+
+  value = negative ? static_cast<IntType>(0 - magnitude)
+                   : static_cast<IntType>(magnitude);
+  return pos;
+}
+
+/*!
+ * \class TextCursor
+ *
+ * \brief Scans whitespace-separated tokens from a range of characters
+ *
+ * The cursor does not own its characters.
+ */
+class TextCursor
+{
+public:
+  TextCursor() = default;
+
+  TextCursor(const char* begin, const char* end) : m_pos(begin), m_end(end)
+  { }
+
+  /// Returns the current position of the cursor
+  const char* position() const { return m_pos; }
+
+  /// Returns the end of the cursor's range
+  const char* end() const { return m_end; }
+
+  /// Returns true when there are no characters left
+  bool atEnd() const { return m_pos >= m_end; }
+
+  /// Returns the next character, or '\\0' at the end
+  char peek() const { return atEnd() ? '\0' : *m_pos; }
+
+  /// Skips whitespace, including line breaks
+  void skipWhitespace()
+  {
+    while(m_pos < m_end && isSpace(*m_pos))
+    {
+      ++m_pos;
+    }
+  }
+
+  /// Moves the cursor to the start of the next line
+  void skipLine() { nextLine(); }
+
+  /*!
+   * \brief Returns a cursor over the rest of the current line, without its
+   *  line break, and moves this cursor to the start of the next line
+   */
+  TextCursor nextLine()
+  {
+    const char* lineBegin = m_pos;
+    const void* newline = std::memchr(m_pos, '\n', m_end - m_pos);
+    const char* lineEnd =
+      (newline != nullptr) ? static_cast<const char*>(newline) : m_end;
+    m_pos = (lineEnd < m_end) ? lineEnd + 1 : m_end;
+    return TextCursor(lineBegin, lineEnd);
+  }
+
+  /*!
+   * \brief Reads the next token as a number
+   *
+   * \param [out] value the parsed number
+   * \return True if the next token is a number of the requested type.
+   *  Otherwise, returns false and the cursor is only moved past whitespace.
+   */
+  template <typename T>
+  bool read(T& value)
+  {
+    skipWhitespace();
+    const char* next = parseNumber(m_pos, m_end, value);
+    if(next == m_pos || (next < m_end && !isSpace(*next)))
+    {
+      return false;
+    }
+    m_pos = next;
+    return true;
+  }
+
+  /*!
+   * \brief Reads the next whitespace-separated token
+   *
+   * \param [out] word pointer to the token's first character
+   * \param [out] length the number of characters in the token
+   * \return True if there was a token
+   */
+  bool readWord(const char*& word, std::size_t& length)
+  {
+    skipWhitespace();
+    word = m_pos;
+    while(m_pos < m_end && !isSpace(*m_pos))
+    {
+      ++m_pos;
+    }
+    length = static_cast<std::size_t>(m_pos - word);
+    return length > 0;
+  }
+
+  /// \overload
+  bool readWord(std::string& word)
+  {
+    const char* w = nullptr;
+    std::size_t length = 0;
+    const bool found = readWord(w, length);
+    word.assign(w, length);
+    return found;
+  }
+
+  /*!
+   * \brief Consumes the next token if it equals \a word
+   * \return True if the token matched
+   */
+  bool matchWord(const char* word)
+  {
+    skipWhitespace();
+    const std::size_t length = std::strlen(word);
+    const bool matches = static_cast<std::size_t>(m_end - m_pos) >= length &&
+      std::memcmp(m_pos, word, length) == 0 &&
+      (m_pos + length == m_end || isSpace(m_pos[length]));
+    if(matches)
+    {
+      m_pos += length;
+    }
+    return matches;
+  }
+
+private:
+  const char* m_pos {nullptr};
+  const char* m_end {nullptr};
+};
+
+/*!
+ * \class ChunkedFileReader
+ *
+ * \brief Reads a text file in large chunks that end at line boundaries
+ *
+ * Each chunk holds whole lines, except that the last chunk of a file that
+ * does not end with a line break ends with a partial line.  A chunk grows
+ * past the requested size when it would not otherwise hold a whole line.
+ */
+class ChunkedFileReader
+{
+public:
+  /// The default number of bytes read for each chunk
+  static constexpr std::size_t DEFAULT_CHUNK_SIZE = std::size_t(1) << 26;
+
+  /*!
+   * \brief Opens \a fileName for reading
+   * \param [in] fileName the file to read
+   * \param [in] chunkSize the number of bytes to read for each chunk
+   */
+  explicit ChunkedFileReader(const std::string& fileName,
+                             std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+  /// Returns true if the file was opened
+  bool isOpen() const { return m_ifs.is_open(); }
+
+  /*!
+   * \brief Reads the next chunk of the file
+   *
+   * \param [in] keepFrom optional position in the current chunk; the text
+   *  from this position on is kept at the start of the next chunk
+   * \return False when there is no text left
+   */
+  bool nextChunk(const char* keepFrom = nullptr);
+
+  /// Returns the start of the current chunk
+  const char* begin() const { return m_buffer.data(); }
+
+  /// Returns the end of the current chunk
+  const char* end() const { return m_buffer.data() + m_chunkSize; }
+
+  /// Returns a cursor over the current chunk
+  TextCursor cursor() const { return TextCursor(begin(), end()); }
+
+  /// Returns the number of bytes read from the file so far
+  std::uint64_t bytesRead() const { return m_bytesRead; }
+
+private:
+  std::ifstream m_ifs;
+  std::size_t m_readSize;
+  std::vector<char> m_buffer;
+  std::size_t m_chunkSize {0};  // bytes in the current chunk
+  std::size_t m_dataSize {0};   // bytes in the buffer, including a partial line
+  std::uint64_t m_bytesRead {0};
+  bool m_atEndOfFile {false};
+
+  DISABLE_COPY_AND_ASSIGNMENT(ChunkedFileReader);
+  DISABLE_MOVE_AND_ASSIGNMENT(ChunkedFileReader);
+};
+
+/*!
+ * \brief Reads the next line of a file, reading the next chunk as needed
+ *
+ * \param [in,out] reader the file reader
+ * \param [in,out] pos the position in the reader's current chunk, or nullptr
+ *  before the first chunk; moved to the start of the following line
+ * \param [out] line a cursor over the line, without its line break, which is
+ *  valid until the reader reads its next chunk
+ * \return False at the end of the file
+ */
+inline bool readLine(ChunkedFileReader& reader,
+                     const char*& pos,
+                     TextCursor& line)
+{
+  if(pos == nullptr || pos >= reader.end())
+  {
+    if(!reader.nextChunk())
+    {
+      return false;
+    }
+    pos = reader.begin();
+  }
+
+  TextCursor cursor(pos, reader.end());
+  line = cursor.nextLine();
+  pos = cursor.position();
+  return true;
+}
+
+/// Line predicate that accepts lines that are not empty or whitespace
+struct NonBlankLine
+{
+  bool operator()(TextCursor line) const
+  {
+    line.skipWhitespace();
+    return !line.atEnd();
+  }
+};
+
+namespace internal
+{
+#ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+using TextExecSpace = axom::OMP_EXEC;
+#else
+using TextExecSpace = axom::SEQ_EXEC;
+#endif
+
+/// Approximate number of bytes in each part of a parallel line loop
+constexpr std::size_t LINE_PART_SIZE = std::size_t(1) << 20;
+
+/*!
+ * \brief Splits [begin, end) into parts of about LINE_PART_SIZE bytes that
+ *  start at line boundaries
+ * \return The start of each part, followed by \a end
+ */
+std::vector<const char*> splitAtLines(const char* begin, const char* end);
+
+}  // namespace internal
+
+/*!
+ * \brief Counts the lines of [begin, end) that satisfy \a pred, in parallel
+ *
+ * \param [in] pred predicate called with a TextCursor over each line
+ */
+template <typename LinePredicate>
+axom::IndexType countLines(const char* begin,
+                           const char* end,
+                           LinePredicate pred)
+{
+  const std::vector<const char*> parts = internal::splitAtLines(begin, end);
+  const axom::IndexType numParts =
+    static_cast<axom::IndexType>(parts.size()) - 1;
+
+  std::vector<axom::IndexType> counts(numParts, 0);
+  const char* const* partsPtr = parts.data();
+  axom::IndexType* countsPtr = counts.data();
+  axom::for_all<internal::TextExecSpace>(numParts, [=](axom::IndexType p) {
+    TextCursor cursor(partsPtr[p], partsPtr[p + 1]);
+    while(!cursor.atEnd())
+    {
+      countsPtr[p] += pred(cursor.nextLine()) ? 1 : 0;
+    }
+  });
+
+  axom::IndexType total = 0;
+  for(axom::IndexType count : counts)
+  {
+    total += count;
+  }
+  return total;
+}
+
+/*!
+ * \brief Calls \a lineFunc for the first \a maxLines lines of [begin, end)
+ *  that satisfy \a pred, in parallel
+ *
+ * \param [in,out] begin the start of the text; moved past the processed lines
+ * \param [in] end the end of the text
+ * \param [in] maxLines the maximum number of lines to process
+ * \param [in] pred predicate called with a TextCursor over each line
+ * \param [in] lineFunc function called as lineFunc(i, line) for the i-th
+ *  line that satisfies \a pred, where line is a TextCursor over the line.
+ *  Returns false if the line could not be parsed.
+ *
+ * The text is split into parts at line boundaries.  The lines of each part
+ * are counted, and then the parts are processed concurrently, so
+ * \a lineFunc must be safe to call from several threads.
+ *
+ * \return The number of lines processed, or -1 if \a lineFunc failed on
+ *  any line
+ */
+template <typename LinePredicate, typename LineFunc>
+axom::IndexType forEachLine(const char*& begin,
+                            const char* end,
+                            axom::IndexType maxLines,
+                            LinePredicate pred,
+                            LineFunc lineFunc)
+{
+  const std::vector<const char*> parts = internal::splitAtLines(begin, end);
+  const axom::IndexType numParts =
+    static_cast<axom::IndexType>(parts.size()) - 1;
+
+  // Count the lines of each part to find the index of its first line
+  std::vector<axom::IndexType> counts(numParts, 0);
+  std::vector<axom::IndexType> offsets(numParts, 0);
+  std::vector<int> failed(numParts, 0);
+  const char* const* partsPtr = parts.data();
+  axom::IndexType* countsPtr = counts.data();
+  axom::for_all<internal::TextExecSpace>(numParts, [=](axom::IndexType p) {
+    TextCursor cursor(partsPtr[p], partsPtr[p + 1]);
+    while(!cursor.atEnd())
+    {
+      countsPtr[p] += pred(cursor.nextLine()) ? 1 : 0;
+    }
+  });
+
+  axom::IndexType total = 0;
+  for(axom::IndexType p = 0; p < numParts; ++p)
+  {
+    offsets[p] = total;
+    total += counts[p];
+  }
+  const axom::IndexType numLines = (total < maxLines) ? total : maxLines;
+
+  // Process the lines
+  const axom::IndexType* offsetsPtr = offsets.data();
+  int* failedPtr = failed.data();
+  axom::for_all<internal::TextExecSpace>(numParts, [=](axom::IndexType p) {
+    TextCursor cursor(partsPtr[p], partsPtr[p + 1]);
+    for(axom::IndexType i = offsetsPtr[p]; i < numLines && !cursor.atEnd();)
+    {
+      TextCursor line = cursor.nextLine();
+      if(pred(line))
+      {
+        if(!lineFunc(i, line))
+        {
+          failedPtr[p] = 1;
+        }
+        ++i;
+      }
+    }
+  });
+
+  // Move past the processed lines
+  if(numLines == total)
+  {
+    begin = end;
+  }
+  else
+  {
+    axom::IndexType p = 0;
+    while(offsets[p] + counts[p] < numLines)
+    {
+      ++p;
+    }
+    TextCursor cursor(parts[p], parts[p + 1]);
+    for(axom::IndexType i = offsets[p]; i < numLines;)
+    {
+      i += pred(cursor.nextLine()) ? 1 : 0;
+    }
+    begin = cursor.position();
+  }
+
+  for(int f : failed)
+  {
+    if(f)
+    {
+      return -1;
+    }
+  }
+  return numLines;
+}
+
+/// \overload Processes the first \a maxLines lines that are not blank
+template <typename LineFunc>
+axom::IndexType forEachLine(const char*& begin,
+                            const char* end,
+                            axom::IndexType maxLines,
+                            LineFunc lineFunc)
+{
+  return forEachLine(begin, end, maxLines, NonBlankLine {}, lineFunc);
+}
+
+/*!
+ * \brief Calls \a lineFunc for the next \a maxLines lines of a file that
+ *  satisfy \a pred, reading further chunks of the file as needed
+ *
+ * \param [in,out] reader the file reader
+ * \param [in,out] pos the position in the reader's current chunk, or nullptr
+ *  before the first chunk; moved past the processed lines
+ * \param [in] maxLines the maximum number of lines to process
+ * \param [in] pred predicate called with a TextCursor over each line
+ * \param [in] lineFunc function called as lineFunc(i, line) for the i-th
+ *  line that satisfies \a pred
+ *
+ * \return The number of lines processed, which is less than \a maxLines if
+ *  the file ends first, or -1 if \a lineFunc failed on any line
+ *
+ * \see forEachLine(const char*&, const char*, axom::IndexType, LinePredicate,
+ *  LineFunc)
+ */
+template <typename LinePredicate, typename LineFunc>
+axom::IndexType forEachLine(ChunkedFileReader& reader,
+                            const char*& pos,
+                            axom::IndexType maxLines,
+                            LinePredicate pred,
+                            LineFunc lineFunc)
+{
+  axom::IndexType numProcessed = 0;
+  while(numProcessed < maxLines)
+  {
+    if(pos == nullptr || pos >= reader.end())
+    {
+      if(!reader.nextChunk())
+      {
+        break;
+      }
+      pos = reader.begin();
+    }
+
+    const axom::IndexType offset = numProcessed;
+    const axom::IndexType count = forEachLine(
+      pos,
+      reader.end(),
+      maxLines - numProcessed,
+      pred,
+      [=](axom::IndexType i, TextCursor& line) {
+        return lineFunc(offset + i, line);
+      });
+    if(count < 0)
+    {
+      return -1;
+    }
+    numProcessed += count;
+  }
+
+  return numProcessed;
+}
+
+}  // namespace text
+}  // namespace utilities
+}  // namespace axom
+
+#endif  // AXOM_CORE_TEXT_PARSING_HPP_
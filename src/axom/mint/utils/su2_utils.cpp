@@ -5,12 +5,14 @@
 
 #include "axom/mint/utils/su2_utils.hpp"
 
+#include "axom/core/utilities/TextParsing.hpp"
 #include "axom/mint/mesh/Mesh.hpp"             /* for Mesh base class */
 #include "axom/mint/mesh/UnstructuredMesh.hpp" /* for UnstructuredMesh */
 #include "axom/mint/mesh/CellTypes.hpp"
 
 // C/C++ includes
-#include <fstream>  // for std::ifstream
+#include <cstring>  // for std::memcmp
+#include <fstream>  // for std::ofstream
 
 namespace axom
 {
@@ -21,6 +23,8 @@ namespace mint
 //------------------------------------------------------------------------------
 namespace
 {
+namespace text = axom::utilities::text;
+
 constexpr int SU2_LINE = 3;
 constexpr int SU2_TRIANGLE = 5;
 constexpr int SU2_QUAD = 9;
@@ -100,72 +104,123 @@ int getSU2CellType(mint::CellType mint_type)
 }
 
 //------------------------------------------------------------------------------
-void read_points(double* points, int npoin, int ndime, std::ifstream& ifs)
+bool is_data_line(text::TextCursor line)
 {
-  SLIC_ASSERT(points != nullptr);
+  // skip empty lines and comments
+  line.skipWhitespace();
+  return !line.atEnd() && line.peek() != '%';
+}
 
-  if(npoin <= 0)
+//------------------------------------------------------------------------------
+bool match_keyword(text::TextCursor& line, const char* keyword)
+{
+  const std::size_t length = std::strlen(keyword);
+  const char* pos = line.position();
+  if(static_cast<std::size_t>(line.end() - pos) < length ||
+     std::memcmp(pos, keyword, length) != 0)
   {
-    return;
+    return false;
   }
 
-  std::string line = "";
-  for(int ipoint = 0; ipoint < npoin; ++ipoint)
-  {
-    const int offset = ipoint * ndime;
-    for(int idim = 0; idim < ndime; ++idim)
-    {
-      ifs >> points[offset + idim];
-    }
+  line = text::TextCursor(pos + length, line.end());
+  return true;
+}
 
-    std::getline(ifs, line);
+//------------------------------------------------------------------------------
+bool read_points(double* points,
+                 int npoin,
+                 int ndime,
+                 text::ChunkedFileReader& reader,
+                 const char*& pos)
+{
+  SLIC_ASSERT(points != nullptr);
 
-  }  // END for all points
+  if(npoin <= 0)
+  {
+    return true;
+  }
+
+  const axom::IndexType numRead = text::forEachLine(
+    reader,
+    pos,
+    npoin,
+    is_data_line,
+    [=](axom::IndexType ipoint, text::TextCursor& line) {
+      const axom::IndexType offset = ipoint * ndime;
+      for(int idim = 0; idim < ndime; ++idim)
+      {
+        if(!line.read(points[offset + idim]))
+        {
+          return false;
+        }
+      }
+      return true;
+    });
+
+  return numRead == npoin;
 }
 
 //------------------------------------------------------------------------------
-void read_connectivity(axom::IndexType* connectivity,
+bool read_connectivity(axom::IndexType* connectivity,
                        mint::CellType* cellTypes,
                        int nelem,
                        bool& isMixed,
-                       std::ifstream& ifs)
+                       text::ChunkedFileReader& reader,
+                       const char*& pos)
 {
   SLIC_ASSERT(cellTypes != nullptr);
   SLIC_ASSERT(connectivity != nullptr);
 
   if(nelem <= 0)
   {
-    return;
+    return true;
   }
 
-  std::string line = "";
-  int ctype;
-  for(int icell = 0; icell < nelem; ++icell)
+  const axom::IndexType numRead = text::forEachLine(
+    reader,
+    pos,
+    nelem,
+    is_data_line,
+    [=](axom::IndexType icell, text::TextCursor& line) {
+      int ctype;
+      if(!line.read(ctype))
+      {
+        return false;
+      }
+
+      mint::CellType c = getMintCellType(ctype);
+      cellTypes[icell] = c;
+      if(c == mint::UNDEFINED_CELL)
+      {
+        return false;
+      }
+
+      const axom::IndexType offset = icell * mint::MAX_CELL_NODES;
+      const int numNodes = mint::getCellInfo(c).num_nodes;
+      for(int inode = 0; inode < numNodes; ++inode)
+      {
+        if(!line.read(connectivity[offset + inode]))
+        {
+          return false;
+        }
+      }
+      return true;
+    });
+
+  if(numRead != nelem)
   {
-    ifs >> ctype;
-    mint::CellType c = getMintCellType(ctype);
-    SLIC_ASSERT(c != mint::UNDEFINED_CELL);
-    cellTypes[icell] = c;
-
-    if(!isMixed)
-    {
-      isMixed = ((icell > 0) && (cellTypes[icell - 1] != c)) ? true : false;
-    }
-
-    const int offset = icell * mint::MAX_CELL_NODES;
-    const int numNodes = mint::getCellInfo(c).num_nodes;
-    for(int inode = 0; inode < numNodes; ++inode)
-    {
-      ifs >> connectivity[offset + inode];
-    }
-
-    std::getline(ifs, line);
+    return false;
+  }
 
-  }  // END for all cells
+  for(int icell = 1; !isMixed && icell < nelem; ++icell)
+  {
+    isMixed = (cellTypes[icell] != cellTypes[0]);
+  }
+  return true;
 }
 
 //------------------------------------------------------------------------------
-void read_data(std::ifstream& ifs,
+void read_data(text::ChunkedFileReader& reader,
                int& ndime,
                int& nelem,
                int& npoin,
@@ -179,41 +234,44 @@ void read_data(std::ifstream& ifs,
   SLIC_ASSERT(connectivity == nullptr);
   SLIC_ASSERT(cellTypes == nullptr);
 
-  std::string line = "";
-  while(std::getline(ifs, line))
+  const char* pos = nullptr;
+  text::TextCursor line;
+  while(text::readLine(reader, pos, line))
   {
-    if(line.substr(0, 1) == "%" || line.length() == 0)
+    if(!is_data_line(line))
     {
-      // skip empty lines and comments
       continue;
     }
 
-    if(line.substr(0, 6) == "NDIME=")
+    if(match_keyword(line, "NDIME="))
     {
-      ndime = std::stoi(line.substr(6, line.length()));
+      SLIC_ERROR_IF(!line.read(ndime), "could not parse the mesh dimension!");
       SLIC_ERROR_IF((ndime < 2) || (ndime > 3),
                     "mesh dimension must be 2 or 3!");
     }
-    else if(line.substr(0, 6) == "NPOIN=")
+    else if(match_keyword(line, "NPOIN="))
     {
       SLIC_ERROR_IF(ndime == -1,
                     "dimension must be set prior to parsing the mesh points!");
 
-      npoin = std::stoi(line.substr(6, line.length()));
+      SLIC_ERROR_IF(!line.read(npoin), "could not parse the number of points!");
       points = axom::allocate<double>(npoin * ndime);
-      read_points(points, npoin, ndime, ifs);
+      SLIC_ERROR_IF(!read_points(points, npoin, ndime, reader, pos),
+                    "could not parse the mesh points!");
     }
-    else if(line.substr(0, 6) == "NELEM=")
+    else if(match_keyword(line, "NELEM="))
     {
       SLIC_ERROR_IF(
         ndime == -1,
         "dimension must be set prior to parsing mesh connectivity!");
 
-      nelem = std::stoi(line.substr(6, line.length()));
+      SLIC_ERROR_IF(!line.read(nelem), "could not parse the number of cells!");
       connectivity =
         axom::allocate<axom::IndexType>(nelem * mint::MAX_CELL_NODES);
       cellTypes = axom::allocate<mint::CellType>(nelem);
-      read_connectivity(connectivity, cellTypes, nelem, isMixed, ifs);
+      const bool valid =
+        read_connectivity(connectivity, cellTypes, nelem, isMixed, reader, pos);
+      SLIC_ERROR_IF(!valid, "could not parse the mesh connectivity!");
     }
 
   }  // END while
@@ -232,8 +290,8 @@ int read_su2(const std::string& file, Mesh*& mesh)
   SLIC_ERROR_IF(file.length() <= 0, "No SU2 file was supplied!");
   SLIC_ERROR_IF(mesh != nullptr, "supplied mesh pointer should be a nullptr");
 
-  std::ifstream ifs(file.c_str());
-  if(!ifs.is_open())
+  text::ChunkedFileReader reader(file);
+  if(!reader.isOpen())
   {
     SLIC_WARNING("cannot read from file [" << file << "]");
     return -1;
@@ -249,7 +307,14 @@ int read_su2(const std::string& file, Mesh*& mesh)
   mint::CellType* cellTypes = nullptr;
   bool isMixed = false;
 
-  read_data(ifs, ndime, nelem, npoin, isMixed, points, connectivity, cellTypes);
+  read_data(reader,
+            ndime,
+            nelem,
+            npoin,
+            isMixed,
+            points,
+            connectivity,
+            cellTypes);
   SLIC_ERROR_IF(ndime < 2 || ndime > 3, "mesh dimension must be 2 or 3!");
   SLIC_ERROR_IF(nelem <= 0, "mesh has zero cells!");
   SLIC_ERROR_IF(npoin <= 0, "mesh has zero nodes!");
@@ -258,8 +323,6 @@ int read_su2(const std::string& file, Mesh*& mesh)
   SLIC_ASSERT(connectivity != nullptr);
   SLIC_ASSERT(cellTypes != nullptr);
 
-  ifs.close();
-
   // STEP 1: construct a mint mesh object
   if(isMixed)
   {
@@ -0,0 +1,166 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file primal_closest_point.cpp
+ *
+ * \brief Compares the cost of the batched closest_point() and
+ *  squared_distance() overloads for a point and a set of triangles, with
+ *  4, 8 and 16 triangles per group, against a loop over the scalar overloads.
+ */
+
+#include "benchmark/benchmark_api.h"
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Triangle.hpp"
+#include "axom/primal/operators/closest_point.hpp"
+#include "axom/primal/operators/squared_distance.hpp"
+#include "axom/primal/utils/ZipTriangle.hpp"
+
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace
+{
+namespace primal = axom::primal;
+
+using PointType = primal::Point<double, 3>;
+using TriangleType = primal::Triangle<double, 3>;
+
+const int NUM_TRIANGLES = 1024;
+
+/// Random triangles, stored as a structure of arrays
+struct TriangleArrays
+{
+  std::vector<double> coords[3][3];
+
+  TriangleArrays()
+  {
+    for(int v = 0; v < 3; ++v)
+    {
+      for(int d = 0; d < 3; ++d)
+      {
+        coords[v][d].resize(NUM_TRIANGLES);
+        for(int i = 0; i < NUM_TRIANGLES; ++i)
+        {
+          coords[v][d][i] = axom::utilities::random_real(-1., 1.);
+        }
+      }
+    }
+  }
+
+  primal::ZipIndexable<TriangleType> zip() const
+  {
+    const double* a[3] = {coords[0][0].data(),
+                          coords[0][1].data(),
+                          coords[0][2].data()};
+    const double* b[3] = {coords[1][0].data(),
+                          coords[1][1].data(),
+                          coords[1][2].data()};
+    const double* c[3] = {coords[2][0].data(),
+                          coords[2][1].data(),
+                          coords[2][2].data()};
+    return primal::ZipIndexable<TriangleType> {a, b, c};
+  }
+};
+
+const TriangleArrays& randomTriangles()
+{
+  static TriangleArrays tris;
+  return tris;
+}
+
+const PointType queryPoint {0.1, -0.2, 0.3};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+void closest_point_scalar(benchmark::State& state)
+{
+  const auto tris = randomTriangles().zip();
+  std::vector<PointType> cps(NUM_TRIANGLES);
+  std::vector<int> locs(NUM_TRIANGLES);
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i < NUM_TRIANGLES; ++i)
+    {
+      cps[i] = primal::closest_point(queryPoint, tris[i], &locs[i]);
+    }
+    benchmark::DoNotOptimize(cps.data());
+    benchmark::DoNotOptimize(locs.data());
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_TRIANGLES);
+}
+BENCHMARK(closest_point_scalar);
+
+template <int LANES>
+void closest_point_batched(benchmark::State& state)
+{
+  const auto tris = randomTriangles().zip();
+  std::vector<PointType> cps(NUM_TRIANGLES);
+  std::vector<int> locs(NUM_TRIANGLES);
+  while(state.KeepRunning())
+  {
+    primal::closest_point<LANES>(queryPoint,
+                                 tris,
+                                 NUM_TRIANGLES,
+                                 cps.data(),
+                                 locs.data());
+    benchmark::DoNotOptimize(cps.data());
+    benchmark::DoNotOptimize(locs.data());
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_TRIANGLES);
+}
+BENCHMARK_TEMPLATE(closest_point_batched, 4);
+BENCHMARK_TEMPLATE(closest_point_batched, 8);
+BENCHMARK_TEMPLATE(closest_point_batched, 16);
+
+//------------------------------------------------------------------------------
+void squared_distance_scalar(benchmark::State& state)
+{
+  const auto tris = randomTriangles().zip();
+  std::vector<double> dists(NUM_TRIANGLES);
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i < NUM_TRIANGLES; ++i)
+    {
+      dists[i] = primal::squared_distance(queryPoint, tris[i]);
+    }
+    benchmark::DoNotOptimize(dists.data());
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_TRIANGLES);
+}
+BENCHMARK(squared_distance_scalar);
+
+template <int LANES>
+void squared_distance_batched(benchmark::State& state)
+{
+  const auto tris = randomTriangles().zip();
+  std::vector<double> dists(NUM_TRIANGLES);
+  while(state.KeepRunning())
+  {
+    primal::squared_distance<LANES>(queryPoint,
+                                    tris,
+                                    NUM_TRIANGLES,
+                                    dists.data());
+    benchmark::DoNotOptimize(dists.data());
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_TRIANGLES);
+}
+BENCHMARK_TEMPLATE(squared_distance_batched, 4);
+BENCHMARK_TEMPLATE(squared_distance_batched, 8);
+BENCHMARK_TEMPLATE(squared_distance_batched, 16);
+
+int main(int argc, char* argv[])
+{
+  axom::slic::SimpleLogger logger;  // create & initialize test logger,
+
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -0,0 +1,341 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file primal_exact_predicates.cpp
+ *
+ * \brief Compares the cost of the filtered exact predicates against the plain
+ *  floating point determinants on random (well-conditioned) inputs, where the
+ *  filter should almost always succeed, and on nearly degenerate inputs,
+ *  where the exact fallback is exercised.
+ */
+
+#include "benchmark/benchmark_api.h"
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/operators/exact_predicates.hpp"
+#include "axom/primal/operators/in_sphere.hpp"
+#include "axom/primal/operators/orientation.hpp"
+
+#include <cmath>
+#include <vector>
+
+//------------------------------------------------------------------------------
+namespace
+{
+namespace primal = axom::primal;
+
+using Point2 = primal::Point<double, 2>;
+using Point3 = primal::Point<double, 3>;
+
+const int NUM_POINTS = 4096;
+
+const std::vector<Point2>& randomPoints2D()
+{
+  static std::vector<Point2> pts;
+  if(pts.empty())
+  {
+    for(int i = 0; i < NUM_POINTS; ++i)
+    {
+      pts.push_back(Point2 {axom::utilities::random_real(-1., 1.),
+                            axom::utilities::random_real(-1., 1.)});
+    }
+  }
+  return pts;
+}
+
+const std::vector<Point3>& randomPoints3D()
+{
+  static std::vector<Point3> pts;
+  if(pts.empty())
+  {
+    for(int i = 0; i < NUM_POINTS; ++i)
+    {
+      pts.push_back(Point3 {axom::utilities::random_real(-1., 1.),
+                            axom::utilities::random_real(-1., 1.),
+                            axom::utilities::random_real(-1., 1.)});
+    }
+  }
+  return pts;
+}
+
+/// Points within a few units in the last place of the line y = x
+const std::vector<Point2>& nearCollinearPoints()
+{
+  static std::vector<Point2> pts;
+  if(pts.empty())
+  {
+    for(int i = 0; i < NUM_POINTS; ++i)
+    {
+      double x = 0.5, y = 0.5;
+      for(int k = 0; k < i % 8; ++k)
+      {
+        x = std::nextafter(x, 1.);
+      }
+      for(int k = 0; k < (i / 8) % 8; ++k)
+      {
+        y = std::nextafter(y, 1.);
+      }
+      pts.push_back(Point2 {x, y});
+    }
+  }
+  return pts;
+}
+
+/// Plain floating point version of orient3d(), for comparison
+double orient3dFloat(const Point3& a,
+                     const Point3& b,
+                     const Point3& c,
+                     const Point3& d)
+{
+  const auto ad = a - d;
+  const auto bd = b - d;
+  const auto cd = c - d;
+
+  // clang-format off
+  return axom::numerics::determinant(ad[0], ad[1], ad[2],
+                                     bd[0], bd[1], bd[2],
+                                     cd[0], cd[1], cd[2]);
+  // clang-format on
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+void orient2d_float_random(benchmark::State& state)
+{
+  const auto& pts = randomPoints2D();
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i + 2 < NUM_POINTS; ++i)
+    {
+      const auto& a = pts[i];
+      const auto& b = pts[i + 1];
+      const auto& c = pts[i + 2];
+      double det =
+        (a[0] - c[0]) * (b[1] - c[1]) - (a[1] - c[1]) * (b[0] - c[0]);
+      benchmark::DoNotOptimize(det);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (NUM_POINTS - 2));
+}
+BENCHMARK(orient2d_float_random);
+
+void orient2d_exact_random(benchmark::State& state)
+{
+  const auto& pts = randomPoints2D();
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i + 2 < NUM_POINTS; ++i)
+    {
+      double det = primal::orient2d(pts[i], pts[i + 1], pts[i + 2]);
+      benchmark::DoNotOptimize(det);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (NUM_POINTS - 2));
+}
+BENCHMARK(orient2d_exact_random);
+
+void orient2d_exact_near_collinear(benchmark::State& state)
+{
+  const auto& pts = nearCollinearPoints();
+  const Point2 b {12., 12.};
+  const Point2 c {24., 24.};
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i < NUM_POINTS; ++i)
+    {
+      double det = primal::orient2d(pts[i], b, c);
+      benchmark::DoNotOptimize(det);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_POINTS);
+}
+BENCHMARK(orient2d_exact_near_collinear);
+
+//------------------------------------------------------------------------------
+void orient3d_float_random(benchmark::State& state)
+{
+  const auto& pts = randomPoints3D();
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i + 3 < NUM_POINTS; ++i)
+    {
+      double det = orient3dFloat(pts[i], pts[i + 1], pts[i + 2], pts[i + 3]);
+      benchmark::DoNotOptimize(det);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (NUM_POINTS - 3));
+}
+BENCHMARK(orient3d_float_random);
+
+void orient3d_orientation_random(benchmark::State& state)
+{
+  const auto& pts = randomPoints3D();
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i + 3 < NUM_POINTS; ++i)
+    {
+      primal::Triangle<double, 3> tri(pts[i], pts[i + 1], pts[i + 2]);
+      int orient = primal::orientation(pts[i + 3], tri);
+      benchmark::DoNotOptimize(orient);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (NUM_POINTS - 3));
+}
+BENCHMARK(orient3d_orientation_random);
+
+void orient3d_exact_random(benchmark::State& state)
+{
+  const auto& pts = randomPoints3D();
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i + 3 < NUM_POINTS; ++i)
+    {
+      double det = primal::orient3d(pts[i], pts[i + 1], pts[i + 2], pts[i + 3]);
+      benchmark::DoNotOptimize(det);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (NUM_POINTS - 3));
+}
+BENCHMARK(orient3d_exact_random);
+
+void orient3d_exact_near_coplanar(benchmark::State& state)
+{
+  const auto& pts = nearCollinearPoints();
+  const Point3 a {12., 12., 0.};
+  const Point3 b {24., 24., 0.};
+  const Point3 c {1., 1., 1.};
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i < NUM_POINTS; ++i)
+    {
+      const Point3 d {pts[i][0], pts[i][1], 0.};
+      double det = primal::orient3d(a, b, c, d);
+      benchmark::DoNotOptimize(det);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_POINTS);
+}
+BENCHMARK(orient3d_exact_near_coplanar);
+
+//------------------------------------------------------------------------------
+void incircle_in_sphere_random(benchmark::State& state)
+{
+  const auto& pts = randomPoints2D();
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i + 3 < NUM_POINTS; ++i)
+    {
+      bool inside =
+        primal::in_sphere(pts[i + 3], pts[i], pts[i + 1], pts[i + 2], 0.);
+      benchmark::DoNotOptimize(inside);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (NUM_POINTS - 3));
+}
+BENCHMARK(incircle_in_sphere_random);
+
+void incircle_exact_random(benchmark::State& state)
+{
+  const auto& pts = randomPoints2D();
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i + 3 < NUM_POINTS; ++i)
+    {
+      double det = primal::incircle(pts[i], pts[i + 1], pts[i + 2], pts[i + 3]);
+      benchmark::DoNotOptimize(det);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (NUM_POINTS - 3));
+}
+BENCHMARK(incircle_exact_random);
+
+void incircle_exact_cocircular(benchmark::State& state)
+{
+  // Points on the circle of radius 5, translated away from the origin
+  const double off = 1 << 20;
+  const Point2 a {off + 5., off + 0.};
+  const Point2 b {off + 3., off + 4.};
+  const Point2 c {off + 0., off + 5.};
+  const Point2 d {off - 4., off + 3.};
+  while(state.KeepRunning())
+  {
+    double det = primal::incircle(a, b, c, d);
+    benchmark::DoNotOptimize(det);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(incircle_exact_cocircular);
+
+//------------------------------------------------------------------------------
+void insphere_in_sphere_random(benchmark::State& state)
+{
+  const auto& pts = randomPoints3D();
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i + 4 < NUM_POINTS; ++i)
+    {
+      bool inside = primal::in_sphere(pts[i + 4],
+                                      pts[i],
+                                      pts[i + 1],
+                                      pts[i + 2],
+                                      pts[i + 3],
+                                      0.);
+      benchmark::DoNotOptimize(inside);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (NUM_POINTS - 4));
+}
+BENCHMARK(insphere_in_sphere_random);
+
+void insphere_exact_random(benchmark::State& state)
+{
+  const auto& pts = randomPoints3D();
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i + 4 < NUM_POINTS; ++i)
+    {
+      double det = primal::insphere(pts[i],
+                                    pts[i + 1],
+                                    pts[i + 2],
+                                    pts[i + 3],
+                                    pts[i + 4]);
+      benchmark::DoNotOptimize(det);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (NUM_POINTS - 4));
+}
+BENCHMARK(insphere_exact_random);
+
+void insphere_exact_cospherical(benchmark::State& state)
+{
+  // Points on the sphere of radius 3, translated away from the origin
+  const double off = 1 << 20;
+  const Point3 a {off + 3., off + 0., off + 0.};
+  const Point3 b {off + 0., off + 3., off + 0.};
+  const Point3 c {off + 0., off + 0., off + 3.};
+  const Point3 d {off + 2., off - 2., off + 1.};
+  const Point3 e {off - 1., off + 2., off + 2.};
+  while(state.KeepRunning())
+  {
+    double det = primal::insphere(a, b, c, d, e);
+    benchmark::DoNotOptimize(det);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(insphere_exact_cospherical);
+
+int main(int argc, char* argv[])
+{
+  axom::slic::SimpleLogger logger;  // create & initialize test logger,
+
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
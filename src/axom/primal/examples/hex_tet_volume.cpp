@@ -7,8 +7,12 @@
  * \file hex_tet_volume.cpp
  *
  * Example that demonstrates use of Primal's intersection_volume operator to find
- * the volume of intersection between hexahedra and tetrahedra. Supports host
- * and device execution using RAJA.
+ * the volume of intersection between hexahedra and tetrahedra or octahedra.
+ * Supports host and device execution using RAJA.
+ *
+ * The example times clipping each hexahedron directly against the shapes, and
+ * clipping the shapes against the 24 tetrahedra of each hexahedron, and
+ * reports the difference between the two intersection volumes.
  *
  * \note This example requires RAJA and Umpire.
  */
@@ -26,6 +30,7 @@
 using HexahedronType = typename axom::primal::Hexahedron<double>;
 using PointType = typename axom::primal::Point<double, 3>;
 using TetrahedronType = typename axom::primal::Tetrahedron<double, 3>;
+using OctahedronType = typename axom::primal::Octahedron<double, 3>;
 
 /// Choose runtime policy for RAJA
 enum class RuntimePolicy
@@ -47,6 +52,7 @@ struct Input
 public:
   int hexResolution {5};
   int tetResolution {5};
+  bool useOctahedra {false};
   RuntimePolicy policy {RuntimePolicy::seq};
 
   void parse(int argc, char** argv, axom::CLI::App& app)
@@ -80,6 +86,12 @@ public:
       ->capture_default_str()
       ->check(axom::CLI::PositiveNumber);
 
+    app.add_flag("-o,--octahedra", useOctahedra)
+      ->description(
+        "Replace each tetrahedron with the octahedron through the midpoints "
+        "of its edges")
+      ->capture_default_str();
+
     app.get_formatter()->column_width(80);
 
     app.parse(argc, argv);
@@ -119,6 +131,123 @@ HexahedronType generateCube(const PointType& point, double length)
     PointType {point[0] + length, point[1] + length, point[2]});
 }
 
+// Returns the octahedron whose vertices are the midpoints of the edges of tet.
+// Opposite vertices of the octahedron are on opposite edges of tet.
+AXOM_HOST_DEVICE OctahedronType midpointOctahedron(const TetrahedronType& tet)
+{
+  return OctahedronType(PointType::midpoint(tet[0], tet[1]),
+                        PointType::midpoint(tet[0], tet[2]),
+                        PointType::midpoint(tet[0], tet[3]),
+                        PointType::midpoint(tet[2], tet[3]),
+                        PointType::midpoint(tet[1], tet[3]),
+                        PointType::midpoint(tet[1], tet[2]));
+}
+
+// Returns the volume of a tetrahedron or octahedron
+AXOM_HOST_DEVICE double shapeVolume(const TetrahedronType& tet)
+{
+  return tet.volume();
+}
+
+AXOM_HOST_DEVICE double shapeVolume(const OctahedronType& oct)
+{
+  using PolyhedronType = axom::primal::Polyhedron<double, 3>;
+  return PolyhedronType::from_primitive(oct, true).volume();
+}
+
+// Clips the shapes directly against the hexahedra, then against the
+// tetrahedra of the hexahedra, and compares the intersection volumes
+template <typename ExecSpace, typename ShapeType>
+void compare_intersection_volumes(axom::ArrayView<HexahedronType> hexes_view,
+                                  axom::ArrayView<ShapeType> shapes_view)
+{
+  using REDUCE_POL = typename axom::execution_space<ExecSpace>::reduce_policy;
+  constexpr int NUM_TETS_PER_HEX = HexahedronType::NUM_TRIANGULATE;
+  constexpr double EPS = 1e-10;
+  constexpr bool tryFixOrientation = true;
+
+  const int NUM_HEXES = hexes_view.size();
+  const int NUM_SHAPES = shapes_view.size();
+
+  RAJA::ReduceSum<REDUCE_POL, double> total_shape_vol(0.0);
+  axom::for_all<ExecSpace>(
+    NUM_SHAPES,
+    AXOM_LAMBDA(axom::IndexType i) {
+      total_shape_vol += shapeVolume(shapes_view[i]);
+    });
+
+  SLIC_INFO(
+    axom::fmt::format("{:-^80}",
+                      axom::fmt::format("Total volume of all shapes is {} ",
+                                        total_shape_vol.get())));
+
+  // Calculate intersection volume for each hexahedron and shape pair.
+  // Typically, a spatial index (e.g. Bounding Volume Hierarchy) can be used to
+  // reduce the number of operations.
+  axom::utilities::Timer timer(true);
+  RAJA::ReduceSum<REDUCE_POL, double> total_intersect_vol(0.0);
+  axom::for_all<ExecSpace>(
+    NUM_HEXES * NUM_SHAPES,
+    AXOM_LAMBDA(axom::IndexType i) {
+      total_intersect_vol += intersection_volume(hexes_view[i / NUM_SHAPES],
+                                                 shapes_view[i % NUM_SHAPES],
+                                                 EPS,
+                                                 tryFixOrientation);
+    });
+  const double direct_vol = total_intersect_vol.get();
+  timer.stop();
+  const double direct_time = timer.elapsedTimeInSec();
+
+  // Clip each shape against the tetrahedra of each hexahedron
+  timer.start();
+  axom::Array<TetrahedronType> tets(NUM_HEXES * NUM_TETS_PER_HEX,
+                                    NUM_HEXES * NUM_TETS_PER_HEX);
+  const auto tets_view = tets.view();
+  axom::for_all<ExecSpace>(
+    NUM_HEXES,
+    AXOM_LAMBDA(axom::IndexType i) {
+      axom::StackArray<TetrahedronType, NUM_TETS_PER_HEX> hex_tets;
+      hexes_view[i].triangulate(hex_tets);
+      for(int j = 0; j < NUM_TETS_PER_HEX; ++j)
+      {
+        tets_view[i * NUM_TETS_PER_HEX + j] = hex_tets[j];
+      }
+    });
+
+  RAJA::ReduceSum<REDUCE_POL, double> total_decomposed_vol(0.0);
+  axom::for_all<ExecSpace>(
+    NUM_HEXES * NUM_TETS_PER_HEX * NUM_SHAPES,
+    AXOM_LAMBDA(axom::IndexType i) {
+      total_decomposed_vol += clip(shapes_view[i % NUM_SHAPES],
+                                   tets_view[i / NUM_SHAPES],
+                                   EPS,
+                                   tryFixOrientation)
+                                .volume();
+    });
+  const double decomposed_vol = total_decomposed_vol.get();
+  timer.stop();
+  const double decomposed_time = timer.elapsedTimeInSec();
+
+  SLIC_INFO(axom::fmt::format(
+    "{:-^80}",
+    axom::fmt::format("Total intersect volume between all hexahedra "
+                      "and shapes is {} ",
+                      direct_vol)));
+
+  SLIC_INFO(axom::fmt::format(
+    "{:-^80}",
+    axom::fmt::format("Difference between sums is {}",
+                      std::abs(direct_vol - total_shape_vol.get()))));
+
+  SLIC_INFO(axom::fmt::format(
+    "Clipping hexahedra directly took {:.4f} s; clipping against their "
+    "tetrahedra took {:.4f} s ({:.1f}x). The volumes differ by {}",
+    direct_time,
+    decomposed_time,
+    decomposed_time / direct_time,
+    std::abs(direct_vol - decomposed_vol)));
+}
+
 // Function to check intersection volumes of generated hexahedra and tetrahedra
 template <typename ExecSpace>
 void check_intersection_volumes(const Input& params)
@@ -220,63 +349,23 @@ void check_intersection_volumes(const Input& params)
     }
   }
 
-  // Calculate expected sum of all tetrahedra volume
-  using REDUCE_POL = typename axom::execution_space<ExecSpace>::reduce_policy;
-
-  RAJA::ReduceSum<REDUCE_POL, double> total_tet_vol(0.0);
-
-  axom::for_all<ExecSpace>(
-    NUM_TETS,
-    AXOM_LAMBDA(axom::IndexType i) { total_tet_vol += tets_view[i].volume(); });
-
-  SLIC_INFO(
-    axom::fmt::format("{:-^80}",
-                      axom::fmt::format("Total volume of all tetrahedra is {} ",
-                                        total_tet_vol.get())));
-
-  // Calculate intersection volume for each hexahedra and tetrahedra pair.
-  // Typically, a spatial index (e.g. Bounding Volume Hierarchy) can be used to
-  // reduce the number of operations.
-  RAJA::ReduceSum<REDUCE_POL, double> total_intersect_vol(0.0);
-  constexpr double EPS = 1e-10;
-  constexpr bool tryFixOrientation = true;
-
-  // The lower of the two sizes (NUM_HEXES, NUM_TETS) is used to factor out
-  // every pair of hexahedron and tetrahedron indices.
-  if(NUM_HEXES > NUM_TETS)
+  if(params.useOctahedra)
   {
+    axom::Array<OctahedronType> octs(NUM_TETS, NUM_TETS);
+    const auto octs_view = octs.view();
     axom::for_all<ExecSpace>(
-      NUM_HEXES * NUM_TETS,
+      NUM_TETS,
       AXOM_LAMBDA(axom::IndexType i) {
-        total_intersect_vol += intersection_volume(hexes_view[i / NUM_TETS],
-                                                   tets_view[i % NUM_TETS],
-                                                   EPS,
-                                                   tryFixOrientation);
+        octs_view[i] = midpointOctahedron(tets_view[i]);
       });
+
+    compare_intersection_volumes<ExecSpace>(hexes_view, octs_view);
   }
   else
   {
-    axom::for_all<ExecSpace>(
-      NUM_HEXES * NUM_TETS,
-      AXOM_LAMBDA(axom::IndexType i) {
-        total_intersect_vol += intersection_volume(hexes_view[i % NUM_HEXES],
-                                                   tets_view[i / NUM_HEXES],
-                                                   EPS,
-                                                   tryFixOrientation);
-      });
+    compare_intersection_volumes<ExecSpace>(hexes_view, tets_view);
   }
 
-  SLIC_INFO(axom::fmt::format(
-    "{:-^80}",
-    axom::fmt::format("Total intersect volume between all hexahedra "
-                      "and tetrahedra is {} ",
-                      total_intersect_vol.get())));
-
-  SLIC_INFO(axom::fmt::format(
-    "{:-^80}",
-    axom::fmt::format("Difference between sums is {}",
-                      std::abs(total_intersect_vol.get() - total_tet_vol.get()))));
-
   // Reset default allocator
   axom::setDefaultAllocator(current_allocator);
 }
@@ -289,7 +378,8 @@ int main(int argc, char** argv)
   // Set up and parse command line arguments
   Input params;
   axom::CLI::App app {
-    "Example of intersection volume between hexahedra and tetrahedra"};
+    "Example of intersection volume between hexahedra and tetrahedra or "
+    "octahedra"};
 
   try
   {
@@ -23,6 +23,7 @@
 #include "axom/primal/geometry/OrientedBoundingBox.hpp"
 
 #include "axom/primal/operators/squared_distance.hpp"
+#include "axom/primal/operators/detail/bernstein_impl.hpp"
 
 #include <vector>
 #include <ostream>
@@ -394,6 +395,44 @@ public:
     }
   }
 
+  /*!
+   * \brief Evaluates a Bezier curve at an array of parameter values
+   *
+   * Each point is the product of the row of Bernstein basis values at its
+   * parameter with the control points, so the cost is linear in the order
+   * of the curve for each parameter, and there are no allocations per point.
+   *
+   * \param [in] ts the parameter values at which to evaluate
+   * \param [out] pts the values of the Bezier curve at each of \a ts
+   *
+   * \pre pts.size() >= ts.size()
+   * \note The results agree with evaluate() up to rounding
+   */
+  void evaluate(axom::ArrayView<const T> ts,
+                axom::ArrayView<PointType> pts) const
+  {
+    SLIC_ASSERT(pts.size() >= ts.size());
+
+    const int ord = getOrder();
+    const bool rational = isRational();
+    axom::Array<T> basis(ord + 1);
+
+    for(IndexType j = 0; j < ts.size(); ++j)
+    {
+      detail::bernstein_basis(ord, ts[j], basis.data());
+
+      NumericArray<T, NDIMS> sum;
+      T wsum = T(0);
+      for(int p = 0; p <= ord; ++p)
+      {
+        const T b = rational ? basis[p] * m_weights[p] : basis[p];
+        sum += b * m_controlPoints[p].array();
+        wsum += b;
+      }
+      pts[j] = PointType(rational ? sum / wsum : sum);
+    }
+  }
+
   /*!
    * \brief Computes the 0th and 1st derivative of a Bezier curve
    *
@@ -478,6 +517,63 @@ public:
     }
   }
 
+  /*!
+   * \brief Computes the 0th and 1st derivative of a Bezier curve at an array
+   *  of parameter values
+   *
+   * \param [in] ts the parameter values at which to evaluate
+   * \param [out] evals the values of the curve at each of \a ts
+   * \param [out] tangents the tangent vectors of the curve at each of \a ts
+   *
+   * \pre evals.size() >= ts.size() and tangents.size() >= ts.size()
+   * \note The results agree with evaluate_first_derivative() up to rounding
+   */
+  void evaluate_first_derivative(axom::ArrayView<const T> ts,
+                                 axom::ArrayView<PointType> evals,
+                                 axom::ArrayView<VectorType> tangents) const
+  {
+    SLIC_ASSERT(evals.size() >= ts.size());
+    SLIC_ASSERT(tangents.size() >= ts.size());
+
+    const int ord = getOrder();
+    const bool rational = isRational();
+    axom::Array<T> basis(ord + 1);
+    axom::Array<T> dbasis(utilities::max(ord, 1));
+
+    for(IndexType j = 0; j < ts.size(); ++j)
+    {
+      detail::bernstein_basis(ord, ts[j], basis.data());
+
+      // The homogeneous point and weight, and their derivatives, which
+      // use the basis of one lower order and the differences of the
+      // (weighted) control points
+      NumericArray<T, NDIMS> P, P_t;
+      T W = T(0), W_t = T(0);
+      for(int p = 0; p <= ord; ++p)
+      {
+        const T w = rational ? m_weights[p] : T(1);
+        P += (basis[p] * w) * m_controlPoints[p].array();
+        W += basis[p] * w;
+      }
+      if(ord > 0)
+      {
+        detail::bernstein_basis(ord - 1, ts[j], dbasis.data());
+        for(int p = 0; p < ord; ++p)
+        {
+          const T w0 = rational ? m_weights[p] : T(1);
+          const T w1 = rational ? m_weights[p + 1] : T(1);
+          P_t += (ord * dbasis[p]) *
+            (w1 * m_controlPoints[p + 1].array() -
+             w0 * m_controlPoints[p].array());
+          W_t += ord * dbasis[p] * (w1 - w0);
+        }
+      }
+
+      evals[j] = PointType(P / W);
+      tangents[j] = VectorType((P_t - evals[j].array() * W_t) / W);
+    }
+  }
+
   /*!
    * \brief Computes the tangent of a Bezier curve at a particular parameter value \a t
    *
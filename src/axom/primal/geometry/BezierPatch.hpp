@@ -24,6 +24,7 @@
 #include "axom/primal/geometry/OrientedBoundingBox.hpp"
 
 #include "axom/primal/operators/squared_distance.hpp"
+#include "axom/primal/operators/detail/bernstein_impl.hpp"
 
 #include <ostream>
 
@@ -809,6 +810,52 @@ public:
     }
   }
 
+  /*!
+   * \brief Evaluates a Bezier patch at an array of parameter pairs
+   *
+   * Each point is the tensor product of the rows of Bernstein basis values
+   * at its parameters with the control points, so no isocurves are built.
+   *
+   * \param [in] us the parameter values on the first axis
+   * \param [in] vs the parameter values on the second axis
+   * \param [out] pts the values of the Bezier patch at each (us[i], vs[i])
+   *
+   * \pre vs.size() == us.size() and pts.size() >= us.size()
+   * \note The results agree with evaluate() up to rounding
+   */
+  void evaluate(axom::ArrayView<const T> us,
+                axom::ArrayView<const T> vs,
+                axom::ArrayView<PointType> pts) const
+  {
+    SLIC_ASSERT(vs.size() == us.size());
+    SLIC_ASSERT(pts.size() >= us.size());
+
+    const int ord_u = getOrder_u();
+    const int ord_v = getOrder_v();
+    const bool rational = isRational();
+    axom::Array<T> basis_u(ord_u + 1), basis_v(ord_v + 1);
+
+    for(IndexType j = 0; j < us.size(); ++j)
+    {
+      detail::bernstein_basis(ord_u, us[j], basis_u.data());
+      detail::bernstein_basis(ord_v, vs[j], basis_v.data());
+
+      NumericArray<T, NDIMS> sum;
+      T wsum = T(0);
+      for(int p = 0; p <= ord_u; ++p)
+      {
+        for(int q = 0; q <= ord_v; ++q)
+        {
+          const T b = rational ? basis_u[p] * basis_v[q] * m_weights(p, q)
+                               : basis_u[p] * basis_v[q];
+          sum += b * m_controlPoints(p, q).array();
+          wsum += b;
+        }
+      }
+      pts[j] = PointType(rational ? sum / wsum : sum);
+    }
+  }
+
   /*!
    * \brief Evaluates all first derivatives Bezier patch at (\a u, \a v)
    *
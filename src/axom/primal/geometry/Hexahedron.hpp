@@ -235,6 +235,44 @@ public:
   AXOM_HOST_DEVICE
   double volume() const { return axom::utilities::abs(signedVolume()); }
 
+  /*!
+   * \brief Tests whether each of the six quadrilateral faces of the
+   *        hexahedron is planar, within a relative tolerance
+   *
+   * A face with vertices a, b, c, d is planar when its edge ab is
+   * orthogonal to the cross product of its diagonals ac and bd.
+   *
+   * \param [in] eps Tolerance on the sine of the angle between the edge and
+   *  the plane of the diagonals
+   *
+   * \note Clipping a polyhedron with planar faces gives the same volumes as
+   *  clipping the tetrahedra of triangulate()
+   */
+  AXOM_HOST_DEVICE
+  bool hasPlanarFaces(double eps = 1.e-8) const
+  {
+    constexpr int faces[6][4] = {{0, 1, 2, 3},
+                                 {0, 1, 5, 4},
+                                 {0, 3, 7, 4},
+                                 {1, 2, 6, 5},
+                                 {2, 3, 7, 6},
+                                 {4, 5, 6, 7}};
+
+    for(const auto& f : faces)
+    {
+      const VectorType normal =
+        VectorType::cross_product(VectorType(m_points[f[0]], m_points[f[2]]),
+                                  VectorType(m_points[f[1]], m_points[f[3]]));
+      const VectorType edge(m_points[f[0]], m_points[f[1]]);
+      if(axom::utilities::abs(normal.dot(edge)) >
+         eps * normal.norm() * edge.norm())
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
   /**
    * \brief Method to decompose a Hexahedron
    *        into 24 Tetrahedrons.
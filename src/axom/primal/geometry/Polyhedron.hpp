@@ -21,38 +21,57 @@
 #include "axom/primal/geometry/Tetrahedron.hpp"
 #include "axom/primal/geometry/Vector.hpp"
 
+#include <cstdint>
 #include <ostream>
+#include <type_traits>
 
 namespace axom
 {
 namespace primal
 {
 // Forward declare the templated classes and operator functions
-template <typename T, int NDIMS>
+template <typename T, int NDIMS, int MAX_VERTS>
 class Polyhedron;
 
 /*! \brief Overloaded output operator for polyhedrons */
-template <typename T, int NDIMS>
-std::ostream& operator<<(std::ostream& os, const Polyhedron<T, NDIMS>& poly);
+template <typename T, int NDIMS, int MAX_VERTS>
+std::ostream& operator<<(std::ostream& os,
+                         const Polyhedron<T, NDIMS, MAX_VERTS>& poly);
 
 /*!
- * \class NeighborCollection
+ * \class BasicNeighborCollection
  *
  * \brief Represents a collection of neighbor relations between vertices.
+ *
+ * \tparam MAX_VERTS_ the maximum number of vertices
+ * \tparam MAX_NBRS_PER_VERT_ the maximum number of neighbors of a vertex
+ *
+ * Vertex indices are stored in the smallest signed integer type that can
+ * hold them, so the collection stays small enough to live on the stack.
  */
-class NeighborCollection
+template <int MAX_VERTS_, int MAX_NBRS_PER_VERT_>
+class BasicNeighborCollection
 {
 public:
-  static constexpr int MAX_VERTS = 32;
-  static constexpr int MAX_NBRS_PER_VERT = 8;
+  static constexpr int MAX_VERTS = MAX_VERTS_;
+  static constexpr int MAX_NBRS_PER_VERT = MAX_NBRS_PER_VERT_;
+
+  /// The type of a vertex index; -1 marks a removed neighbor
+  using VertexIndex =
+    typename std::conditional<(MAX_VERTS <= INT8_MAX),
+                              std::int8_t,
+                              std::int16_t>::type;
 
-  using VertexNbrs = axom::StackArray<std::int8_t, MAX_NBRS_PER_VERT>;
+  using VertexNbrs = axom::StackArray<VertexIndex, MAX_NBRS_PER_VERT>;
+
+  AXOM_STATIC_ASSERT_MSG(MAX_VERTS > 0 && MAX_VERTS <= INT16_MAX,
+                         "Unsupported maximum number of vertices");
 
 public:
   /*!
-   * \brief Constructs an empty NeighborCollection.
+   * \brief Constructs an empty BasicNeighborCollection.
    */
-  AXOM_HOST_DEVICE NeighborCollection() : num_nbrs {0} { }
+  AXOM_HOST_DEVICE BasicNeighborCollection() : num_nbrs {0} { }
 
   /*!
    * \brief Clears the set of neighbors.
@@ -121,12 +140,12 @@ public:
    *
    * \pre vtx < MAX_VERTS
    */
-  AXOM_HOST_DEVICE void addNeighbors(std::int8_t vtx,
-                                     std::initializer_list<std::int8_t> nbrIds)
+  AXOM_HOST_DEVICE void addNeighbors(VertexIndex vtx,
+                                     std::initializer_list<VertexIndex> nbrIds)
   {
     SLIC_ASSERT(num_nbrs[vtx] + nbrIds.size() <= MAX_NBRS_PER_VERT);
     SLIC_ASSERT(vtx >= 0 && vtx < MAX_VERTS);
-    for(std::int8_t nbr : nbrIds)
+    for(VertexIndex nbr : nbrIds)
     {
       std::int8_t idx_insert = num_nbrs[vtx];
       nbrs[vtx][idx_insert] = nbr;
@@ -142,7 +161,7 @@ public:
    *
    * \pre vtx < MAX_VERTS
    */
-  AXOM_HOST_DEVICE void addNeighbors(std::int8_t vtx, std::int8_t nbrId)
+  AXOM_HOST_DEVICE void addNeighbors(VertexIndex vtx, VertexIndex nbrId)
   {
     SLIC_ASSERT(num_nbrs[vtx] + 1 <= MAX_NBRS_PER_VERT);
     SLIC_ASSERT(vtx >= 0 && vtx < MAX_VERTS);
@@ -162,14 +181,14 @@ public:
    * \pre vtx < MAX_VERTS
    * \pre pos <= num_nbrs[vtx]
    */
-  AXOM_HOST_DEVICE void insertNeighborAtPos(std::int8_t vtx,
-                                            std::int8_t nbr,
+  AXOM_HOST_DEVICE void insertNeighborAtPos(VertexIndex vtx,
+                                            VertexIndex nbr,
                                             std::int8_t pos)
   {
     SLIC_ASSERT(num_nbrs[vtx] + 1 <= MAX_NBRS_PER_VERT);
     SLIC_ASSERT(vtx >= 0 && vtx < MAX_VERTS);
     SLIC_ASSERT(pos <= num_nbrs[vtx]);
-    std::uint8_t old_nbrs[MAX_NBRS_PER_VERT];
+    VertexIndex old_nbrs[MAX_NBRS_PER_VERT];
     // copy elements from [pos, nnbrs)
     for(int ip = pos; ip < num_nbrs[vtx]; ip++)
     {
@@ -204,11 +223,50 @@ public:
     }
   }
 
+  /*!
+   * \brief Moves the neighbors of each vertex to a new vertex index and
+   *  renumbers the neighbors accordingly.
+   *
+   * \param [in] newIndices the new index of each vertex, or -1 for vertices
+   *  that are removed
+   * \param [in] numVerts the number of vertices before renumbering
+   *
+   * \pre newIndices[i] <= i for all kept vertices, i.e. kept vertices keep
+   *  their relative order, and no kept vertex has a removed neighbor
+   */
+  AXOM_HOST_DEVICE void renumber(const VertexIndex* newIndices, int numVerts)
+  {
+    int numKept = 0;
+    for(int iv = 0; iv < numVerts; iv++)
+    {
+      const int nv = newIndices[iv];
+      if(nv < 0)
+      {
+        continue;
+      }
+      SLIC_ASSERT(nv <= iv);
+      for(int inbr = 0; inbr < num_nbrs[iv]; inbr++)
+      {
+        SLIC_ASSERT(newIndices[nbrs[iv][inbr]] >= 0);
+        nbrs[nv][inbr] = newIndices[nbrs[iv][inbr]];
+      }
+      num_nbrs[nv] = num_nbrs[iv];
+      numKept++;
+    }
+    for(int iv = numKept; iv < numVerts; iv++)
+    {
+      num_nbrs[iv] = 0;
+    }
+  }
+
 private:
   std::int8_t num_nbrs[MAX_VERTS];
   VertexNbrs nbrs[MAX_VERTS];
 };
 
+/// The neighbor collection of a Polyhedron with the default capacity
+using NeighborCollection = BasicNeighborCollection<32, 8>;
+
 /*!
  * \class Polyhedron
  *
@@ -218,6 +276,11 @@ private:
  *
  * \tparam T the coordinate type, e.g., double, float, etc.
  * \tparam NDIMS the number of dimensions
+ * \tparam MAX_VERTS the maximum number of vertices. The vertices and their
+ *  neighbors are stored in fixed size arrays, so the polyhedron can be used
+ *  on the device. Clipping adds vertices where the edges cross the plane,
+ *  so polyhedra that are clipped by many planes may need a larger capacity
+ *  than the default.
  *
  * \note The Polyhedron functions do not check that points defining a face are
  *       coplanar. It is the responsibility of the caller to pass a
@@ -247,7 +310,7 @@ private:
  *       counter clockwise. It is the responsibility of the caller to pass a
  *       valid neighbors ordering.
  */
-template <typename T, int NDIMS = 3>
+template <typename T, int NDIMS = 3, int MAX_VERTS_ = 32>
 class Polyhedron
 {
 public:
@@ -255,11 +318,15 @@ public:
   using VectorType = Vector<T, NDIMS>;
   using NumArrayType = NumericArray<T, NDIMS>;
 
-  constexpr static int MAX_VERTS = NeighborCollection::MAX_VERTS;
+  constexpr static int MAX_VERTS = MAX_VERTS_;
+  constexpr static int MAX_NBRS_PER_VERT = 8;
+
+  using NeighborsType = BasicNeighborCollection<MAX_VERTS, MAX_NBRS_PER_VERT>;
+  using VertexIndex = typename NeighborsType::VertexIndex;
 
 private:
   using Coords = StackArray<PointType, MAX_VERTS>;
-  using Neighbors = NeighborCollection;
+  using Neighbors = NeighborsType;
 
 public:
   /*! Default constructor for an empty polyhedron   */
@@ -275,7 +342,7 @@ public:
    */
   AXOM_HOST_DEVICE int addVertex(const PointType& pt)
   {
-    SLIC_ASSERT(m_num_vertices + 1 < MAX_VERTS);
+    SLIC_ASSERT(m_num_vertices < MAX_VERTS);
     m_vertices[m_num_vertices] = pt;
     m_num_vertices++;
     return m_num_vertices - 1;
@@ -292,7 +359,8 @@ public:
    * \param [in] nbrs The neighbors to add to the list of neighbors
    */
   AXOM_HOST_DEVICE
-  void addNeighbors(const PointType& pt, std::initializer_list<std::int8_t> nbrs)
+  void addNeighbors(const PointType& pt,
+                    std::initializer_list<VertexIndex> nbrs)
   {
     for(int i = 0; i < m_num_vertices; i++)
     {
@@ -315,7 +383,7 @@ public:
    * \pre vtxId < getVertices()
    */
   AXOM_HOST_DEVICE
-  void addNeighbors(int vtxId, std::initializer_list<std::int8_t> nbrs)
+  void addNeighbors(int vtxId, std::initializer_list<VertexIndex> nbrs)
   {
     m_neighbors.addNeighbors(vtxId, nbrs);
   }
@@ -344,6 +412,37 @@ public:
     m_neighbors.clear();
   }
 
+  /*!
+   * \brief Removes a set of vertices, compacting the remaining vertices and
+   *        their neighbors in place.
+   *
+   * The remaining vertices keep their relative order.
+   *
+   * \param [in] removed flags for each vertex, true if the vertex is removed
+   *
+   * \pre No remaining vertex has a removed vertex as a neighbor
+   */
+  AXOM_HOST_DEVICE void removeVertices(const bool* removed)
+  {
+    VertexIndex newIndices[MAX_VERTS];
+    int curIndex = 0;
+    for(int i = 0; i < m_num_vertices; i++)
+    {
+      if(removed[i])
+      {
+        newIndices[i] = -1;
+      }
+      else
+      {
+        newIndices[i] = curIndex;
+        m_vertices[curIndex++] = m_vertices[i];
+      }
+    }
+
+    m_neighbors.renumber(newIndices, m_num_vertices);
+    m_num_vertices = curIndex;
+  }
+
   /*! Retrieves the vertices */
   Coords& getVertices() { return m_vertices; }
 
@@ -423,11 +522,11 @@ public:
   AXOM_HOST_DEVICE
   void getFaces(int* faces, int* face_size, int* face_offset, int& face_count) const
   {
-    std::int8_t curFaceIndex = 0;
-    std::int8_t checkedSize = 0;
-    std::int8_t facesAdded = 0;
-    // # edges * (# vertices per edge) * (# orientation per edge)
-    std::int8_t checkedEdges[MAX_VERTS * 2 * 2] = {0};
+    int curFaceIndex = 0;
+    int checkedSize = 0;
+    int facesAdded = 0;
+    // (# directed edges) * (# vertices per edge)
+    VertexIndex checkedEdges[MAX_VERTS * MAX_NBRS_PER_VERT * 2] = {0};
 
     // Check each vertex
     for(int i = 0; i < numVertices(); ++i)
@@ -455,10 +554,10 @@ public:
         {
           face_offset[facesAdded] = curFaceIndex;
           faces[curFaceIndex++] = i;
-          std::int8_t curFaceSize = 1;
-          std::int8_t vstart = i;
-          std::int8_t vnext = ni;
-          std::int8_t vprev = i;
+          int curFaceSize = 1;
+          VertexIndex vstart = i;
+          VertexIndex vnext = ni;
+          VertexIndex vprev = i;
 
           // Add neighboring vertices until we reach the starting vertex.
           while(vnext != vstart)
@@ -532,7 +631,7 @@ public:
         "Polyhedron::signedVolume() is only valid with vertex neighbors.");
 
       // faces is an overestimation
-      int faces[MAX_VERTS * MAX_VERTS];
+      int faces[MAX_VERTS * MAX_NBRS_PER_VERT];
       int face_size[MAX_VERTS * 2];
       int face_offset[MAX_VERTS * 2];
       int face_count;
@@ -713,7 +812,7 @@ public:
                                    bool tryFixOrientation = false)
   {
     // Initialize our polyhedron to return
-    Polyhedron<T, NDIMS> poly;
+    Polyhedron poly;
 
     poly.addVertex(hex[0]);
     poly.addVertex(hex[1]);
@@ -793,7 +892,7 @@ public:
                                    bool tryFixOrientation = false)
   {
     // Initialize our polyhedron to return
-    Polyhedron<T, NDIMS> poly;
+    Polyhedron poly;
 
     poly.addVertex(oct[0]);
     poly.addVertex(oct[1]);
@@ -868,7 +967,7 @@ public:
                                    bool tryFixOrientation = false)
   {
     // Initialize our polyhedron to return
-    Polyhedron<T, NDIMS> poly;
+    Polyhedron poly;
 
     poly.addVertex(tet[0]);
     poly.addVertex(tet[1]);
@@ -901,8 +1000,9 @@ private:
 //------------------------------------------------------------------------------
 /// Free functions implementing Polyhedron's operators
 //------------------------------------------------------------------------------
-template <typename T, int NDIMS>
-std::ostream& operator<<(std::ostream& os, const Polyhedron<T, NDIMS>& poly)
+template <typename T, int NDIMS, int MAX_VERTS>
+std::ostream& operator<<(std::ostream& os,
+                         const Polyhedron<T, NDIMS, MAX_VERTS>& poly)
 {
   poly.print(os);
   return os;
@@ -912,8 +1012,9 @@ std::ostream& operator<<(std::ostream& os, const Polyhedron<T, NDIMS>& poly)
 }  // namespace axom
 
 /// Overload to format a primal::Polyhedron using fmt
-template <typename T, int NDIMS>
-struct axom::fmt::formatter<axom::primal::Polyhedron<T, NDIMS>> : ostream_formatter
+template <typename T, int NDIMS, int MAX_VERTS>
+struct axom::fmt::formatter<axom::primal::Polyhedron<T, NDIMS, MAX_VERTS>>
+  : ostream_formatter
 { };
 
 #endif  // AXOM_PRIMAL_POLYHEDRON_HPP_
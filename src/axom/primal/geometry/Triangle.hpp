@@ -45,6 +45,7 @@ template <typename T, int NDIMS>
 class Triangle
 {
 public:
+  using CoordType = T;
   using PointType = Point<T, NDIMS>;
   using VectorType = Vector<T, NDIMS>;
   using SphereType = Sphere<T, NDIMS>;
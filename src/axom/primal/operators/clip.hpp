@@ -146,6 +146,44 @@ AXOM_HOST_DEVICE Polyhedron<T, 3> clip(const Hexahedron<T, 3>& hex,
   return detail::clipHexahedron(hex, tet, eps, tryFixOrientation);
 }
 
+/*!
+ * \brief Clips a 3D hexahedron against the half-spaces defined by an array
+ *        of planes, returning the part of the hexahedron above all of the
+ *        planes as a polyhedron
+ *
+ *  The planes are applied one after the other. Each plane can add a vertex
+ *  for each edge of the polyhedron that crosses it, so the capacity of the
+ *  returned polyhedron can be raised for cuts by many planes.
+ *
+ * \tparam MAX_VERTS the maximum number of vertices of the returned polyhedron
+ *
+ * \param [in] hex The hexahedron to clip
+ * \param [in] planes The planes to clip against
+ * \param [in] eps The epsilon value
+ * \param [in] tryFixOrientation If true and the hexahedron has a negative
+ *             signed volume, swaps the order of some of its vertices to try
+ *             to obtain a nonnegative signed volume. Defaults to false.
+ *
+ * \return A polyhedron of the hexahedron clipped against the planes.
+ *
+ * \pre The clipped polyhedron has at most MAX_VERTS vertices after each plane
+ *
+ * \note Function is based off clipPolyhedron() in Mike Owen's PolyClipper.
+ */
+template <int MAX_VERTS = 32, typename T>
+AXOM_HOST_DEVICE Polyhedron<T, 3, MAX_VERTS> clip(
+  const Hexahedron<T, 3>& hex,
+  axom::ArrayView<Plane<T, 3>> planes,
+  double eps = 1.e-10,
+  bool tryFixOrientation = false)
+{
+  using PolyhedronType = Polyhedron<T, 3, MAX_VERTS>;
+
+  PolyhedronType poly = PolyhedronType::from_primitive(hex, tryFixOrientation);
+  detail::clipPolyhedron(poly, planes, eps);
+  return poly;
+}
+
 /*!
  * \brief Clips a 3D hexahedron against a tetrahedron in 3D, returning
  *        the geometric intersection of the hexahedron and the tetrahedron
@@ -15,10 +15,14 @@
 #define AXOM_PRIMAL_CLOSEST_POINT_HPP_
 
 #include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Segment.hpp"
 #include "axom/primal/geometry/Triangle.hpp"
 #include "axom/primal/geometry/Sphere.hpp"
 #include "axom/primal/geometry/OrientedBoundingBox.hpp"
 #include "axom/primal/operators/detail/intersect_impl.hpp"
+#include "axom/primal/operators/detail/closest_point_impl.hpp"
+#include "axom/primal/utils/ZipTriangle.hpp"
+
 namespace axom
 {
 namespace primal
@@ -188,6 +192,101 @@ AXOM_HOST_DEVICE inline Point<T, NDIMS> closest_point(const Point<T, NDIMS>& P,
   return A + N;
 }
 
+/*!
+ * \brief Computes the closest points from a point, P, to a batch of triangles
+ *  stored as a structure of arrays.
+ *
+ * \param [in] P the query point
+ * \param [in] tris the triangles, whose vertex coordinates are stored in
+ *  separate arrays (see ZipIndexable)
+ * \param [in] ntris the number of triangles in \a tris
+ * \param [out] cps array of at least \a ntris closest points
+ * \param [out] locs array of at least \a ntris locations of the closest
+ *  points (optional), encoded as in the single triangle closest_point()
+ * \param [in] EPS tolerance used to classify the closest points
+ *
+ * \tparam LANES the number of triangles processed together, one of 4, 8
+ *  or 16. The kernel is branch-free within a group of triangles, so that the
+ *  compiler can vectorize it across the group.
+ *
+ * \note The results agree with calling closest_point() on each triangle, up
+ *  to rounding.
+ */
+template <int LANES = 8, typename T, int NDIMS>
+AXOM_HOST_DEVICE inline void closest_point(
+  const Point<T, NDIMS>& P,
+  const ZipIndexable<Triangle<T, NDIMS>>& tris,
+  IndexType ntris,
+  Point<T, NDIMS>* cps,
+  int* locs = nullptr,
+  double EPS = 1E-8)
+{
+  detail::TriangleLanes<T, NDIMS, LANES> lanes;
+  T cp[NDIMS][LANES];
+  int loc[LANES];
+
+  for(IndexType first = 0; first < ntris; first += LANES)
+  {
+    const int n =
+      static_cast<int>(ntris - first < LANES ? ntris - first : LANES);
+    detail::gatherTriangleLanes(tris, first, n, lanes);
+    detail::closestPointLanes(P, lanes, cp, loc, EPS);
+
+    for(int l = 0; l < n; ++l)
+    {
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        cps[first + l][d] = cp[d][l];
+      }
+      if(locs != nullptr)
+      {
+        locs[first + l] = loc[l];
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Computes the closest point from a point, P, to a given segment.
+ *
+ * \param [in] P the query point
+ * \param [in] seg user-supplied segment
+ * \param [out] t double pointer to store the parametric coordinate of the
+ *  closest point along \a seg (optional)
+ * \return cp the closest point from a point P and a segment
+ *
+ * \note If the optional pointer \a t is supplied, the closest point is
+ *  \a seg.at(*t), with \f$ t \in [0,1] \f$ and \f$ t = 0 \f$ at the
+ *  segment's source.  For a degenerate segment, \a t is 0.
+ */
+template <typename T, int NDIMS>
+AXOM_HOST_DEVICE inline Point<T, NDIMS> closest_point(const Point<T, NDIMS>& P,
+                                                      const Segment<T, NDIMS>& seg,
+                                                      double* t = nullptr)
+{
+  using VectorType = Vector<T, NDIMS>;
+
+  const VectorType ab(seg.source(), seg.target());
+  const VectorType ap(seg.source(), P);
+
+  const T e = VectorType::dot_product(ap, ab);
+  const T f = ab.squared_norm();
+
+  // Project P onto the line through the segment and clamp to its endpoints
+  double param = 0.;
+  if(e > 0. && f > 0.)
+  {
+    param = e >= f ? 1. : e / f;
+  }
+
+  if(t != nullptr)
+  {
+    *t = param;
+  }
+
+  return seg.at(param);
+}
+
 /*!
  * \brief Computes the closest point from a point to a given OBB.
  *
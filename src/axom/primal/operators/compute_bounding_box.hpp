@@ -165,9 +165,9 @@ AXOM_HOST_DEVICE BoundingBox<T, NDIMS> compute_bounding_box(
  *
  * \param [in] poly The Polyhedron
  */
-template <typename T, int NDIMS>
+template <typename T, int NDIMS, int MAX_VERTS>
 AXOM_HOST_DEVICE BoundingBox<T, NDIMS> compute_bounding_box(
-  const Polyhedron<T, NDIMS> &poly)
+  const Polyhedron<T, NDIMS, MAX_VERTS> &poly)
 {
   BoundingBox<T, NDIMS> res(poly[0]);
   for(int i = 1; i < poly.numVertices(); i++)
@@ -0,0 +1,65 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file bernstein_impl.hpp
+ *
+ * \brief Helpers for evaluating the Bernstein basis polynomials, used by the
+ *  batched evaluation routines of BezierCurve and BezierPatch.
+ */
+
+#ifndef AXOM_PRIMAL_BERNSTEIN_IMPL_HPP_
+#define AXOM_PRIMAL_BERNSTEIN_IMPL_HPP_
+
+#include "axom/core/Macros.hpp"
+
+namespace axom
+{
+namespace primal
+{
+namespace detail
+{
+/*!
+ * \brief Evaluates the Bernstein basis polynomials of order \a ord at \a t
+ *
+ * Computes basis[i] = (ord choose i) t^i (1-t)^(ord-i) for 0 <= i <= ord.
+ * All terms are products of nonnegative factors when \a t is in [0, 1],
+ * so there is no cancellation.
+ *
+ * \param [in] ord the order of the basis
+ * \param [in] t the parameter value
+ * \param [out] basis a buffer with room for ord+1 values
+ *
+ * \pre ord >= 0
+ */
+template <typename T>
+AXOM_HOST_DEVICE inline void bernstein_basis(int ord, T t, T* basis)
+{
+  const T s = T(1) - t;
+
+  // Powers of t, increasing with i
+  T tpow = T(1);
+  for(int i = 0; i <= ord; ++i)
+  {
+    basis[i] = tpow;
+    tpow *= t;
+  }
+
+  // Powers of (1-t) and binomial coefficients, increasing with ord-i
+  T spow = T(1);
+  T binom = T(1);
+  for(int i = ord; i >= 0; --i)
+  {
+    basis[i] *= binom * spow;
+    spow *= s;
+    binom = binom * i / (ord - i + 1);
+  }
+}
+
+}  // namespace detail
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_BERNSTEIN_IMPL_HPP_
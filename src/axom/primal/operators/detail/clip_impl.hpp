@@ -196,17 +196,18 @@ void clipAxisPlane(const Polygon<T, NDIMS>* prevPoly,
   }
 }
 
-template <typename T, int NDIMS>
-AXOM_HOST_DEVICE void poly_clip_vertices(Polyhedron<T, NDIMS>& poly,
+template <typename T, int NDIMS, int MAX_VERTS>
+AXOM_HOST_DEVICE void poly_clip_vertices(Polyhedron<T, NDIMS, MAX_VERTS>& poly,
                                          const Plane<T, NDIMS>& plane,
                                          const double eps,
-                                         unsigned int& out_clipped)
+                                         bool* out_clipped)
 {
   using SegmentType = Segment<T, NDIMS>;
+  using VertexIndex = typename Polyhedron<T, NDIMS, MAX_VERTS>::VertexIndex;
 
   // Loop over Polyhedron vertices
   int numVerts = poly.numVertices();
-  for(std::int8_t i = 0; i < numVerts; i++)
+  for(VertexIndex i = 0; i < numVerts; i++)
   {
     int orientation = plane.getOrientation(poly[i], eps);
 
@@ -214,13 +215,13 @@ AXOM_HOST_DEVICE void poly_clip_vertices(Polyhedron<T, NDIMS>& poly,
     if(orientation == ON_NEGATIVE_SIDE)
     {
       // Mark this vertex for removal later
-      out_clipped |= 1 << i;
+      out_clipped[i] = true;
 
       // Check neighbors for vertex above the plane (edge clipped by plane)
       int numNeighbors = poly.getNumNeighbors(i);
       for(int j = 0; j < numNeighbors; j++)
       {
-        std::int8_t neighborIndex = poly.getNeighbors(i)[j];
+        VertexIndex neighborIndex = poly.getNeighbors(i)[j];
 
         int neighborOrientation = plane.getOrientation(poly[neighborIndex], eps);
 
@@ -234,7 +235,7 @@ AXOM_HOST_DEVICE void poly_clip_vertices(Polyhedron<T, NDIMS>& poly,
           SegmentType seg(poly[i], poly[neighborIndex]);
           intersect(plane, seg, lerp_val);
 
-          int newVertexIndex = poly.addVertex(seg.at(lerp_val));
+          VertexIndex newVertexIndex = poly.addVertex(seg.at(lerp_val));
           SLIC_ASSERT(newVertexIndex == expectedVertexIndex);
 
           poly.addNeighbors(newVertexIndex, {i, neighborIndex});
@@ -255,16 +256,18 @@ AXOM_HOST_DEVICE void poly_clip_vertices(Polyhedron<T, NDIMS>& poly,
   }  // end of loop over Polyhedron vertices
 }
 
-template <typename T, int NDIMS>
-AXOM_HOST_DEVICE void poly_clip_fix_nbrs(Polyhedron<T, NDIMS>& poly,
+template <typename T, int NDIMS, int MAX_VERTS>
+AXOM_HOST_DEVICE void poly_clip_fix_nbrs(Polyhedron<T, NDIMS, MAX_VERTS>& poly,
                                          const Plane<T, NDIMS>& plane,
                                          const int oldVerts,
                                          const double eps,
-                                         const unsigned int clipped)
+                                         const bool* clipped)
 {
-  NeighborCollection& poly_nbrs = poly.getNeighbors();
+  using NeighborsType = typename Polyhedron<T, NDIMS, MAX_VERTS>::NeighborsType;
+
+  NeighborsType& poly_nbrs = poly.getNeighbors();
   // Keep copy of old connectivity
-  NeighborCollection old_nbrs = poly.getNeighbors();
+  NeighborsType old_nbrs = poly.getNeighbors();
   for(int i = 0; i < poly.numVertices(); i++)
   {
     // Check clipped created vertices first, then vertices on the plane
@@ -288,7 +291,7 @@ AXOM_HOST_DEVICE void poly_clip_fix_nbrs(Polyhedron<T, NDIMS>& poly,
 
           int val = 0;
 
-          while((clipped & (1 << inext)) && (val++ < poly.numVertices()))
+          while(clipped[inext] && (val++ < poly.numVertices()))
           {
             itmp = inext;
             unsigned int next_nbrs = poly_nbrs.getNumNeighbors(inext);
@@ -353,50 +356,12 @@ AXOM_HOST_DEVICE void poly_clip_fix_nbrs(Polyhedron<T, NDIMS>& poly,
   poly.getNeighbors().pruneNeighbors();
 }
 
-template <typename T, int NDIMS>
-AXOM_HOST_DEVICE void poly_clip_reindex(Polyhedron<T, NDIMS>& poly,
-                                        const unsigned int clipped)
+template <typename T, int NDIMS, int MAX_VERTS>
+AXOM_HOST_DEVICE void poly_clip_reindex(Polyhedron<T, NDIMS, MAX_VERTS>& poly,
+                                        const bool* clipped)
 {
-  // Dictionary for old indices to new indices positions
-  std::int8_t newIndices[Polyhedron<T, NDIMS>::MAX_VERTS] = {0};
-
-  Polyhedron<T, NDIMS> old_poly;
-
-  for(int i = 0; i < poly.numVertices(); i++)
-  {
-    old_poly.addVertex(poly[i]);
-    for(int j = 0; j < poly.getNumNeighbors(i); j++)
-    {
-      old_poly.addNeighbors(i, poly.getNeighbors(i)[j]);
-    }
-  }
-
-  poly.clear();
-
-  int curIndex = 0;
-
-  for(int i = 0; i < old_poly.numVertices(); i++)
-  {
-    if(!(clipped & (1 << i)))
-    {
-      // Non-clipped vertex
-      newIndices[i] = curIndex++;
-      poly.addVertex(old_poly[i]);
-    }
-  }
-
-  // Reinsert neighbors into polyhedron
-  for(int i = 0; i < old_poly.numVertices(); i++)
-  {
-    if(!(clipped & (1 << i)))
-    {
-      for(int j = 0; j < old_poly.getNumNeighbors(i); j++)
-      {
-        poly.addNeighbors(newIndices[i],
-                          {newIndices[old_poly.getNeighbors()[i][j]]});
-      }
-    }
-  }
+  // Compact the remaining vertices and their neighbors in place
+  poly.removeVertices(clipped);
 }
 
 /*!
@@ -406,8 +371,8 @@ AXOM_HOST_DEVICE void poly_clip_reindex(Polyhedron<T, NDIMS>& poly,
  * \param [in] plane The plane defining the half-space used to clip the polyhedron
  * \param [in] eps The tolerance for plane point orientation
  */
-template <typename T, int NDIMS>
-AXOM_HOST_DEVICE void clipPolyhedron(Polyhedron<T, NDIMS>& poly,
+template <typename T, int NDIMS, int MAX_VERTS>
+AXOM_HOST_DEVICE void clipPolyhedron(Polyhedron<T, NDIMS, MAX_VERTS>& poly,
                                      const Plane<T, NDIMS>& plane,
                                      double eps)
 {
@@ -418,9 +383,9 @@ AXOM_HOST_DEVICE void clipPolyhedron(Polyhedron<T, NDIMS>& poly,
   {
     int numVerts = poly.numVertices();
 
-    // Each bit value indicates if that Polyhedron vertex is formed from
-    // Polyhedron clipping with a plane.
-    unsigned int clipped = 0;
+    // Flags the Polyhedron vertices that are removed by clipping
+    // with the plane.
+    bool clipped[MAX_VERTS] = {false};
 
     // Clip polyhedron against current plane, generating extra vertices
     // where edges meet the plane.
@@ -465,8 +430,8 @@ AXOM_HOST_DEVICE void clipPolyhedron(Polyhedron<T, NDIMS>& poly,
  * \param [in] planes The array of planes
  * \param [in] eps The tolerance for plane point orientation
  */
-template <typename T, int NDIMS>
-AXOM_HOST_DEVICE void clipPolyhedron(Polyhedron<T, NDIMS>& poly,
+template <typename T, int NDIMS, int MAX_VERTS>
+AXOM_HOST_DEVICE void clipPolyhedron(Polyhedron<T, NDIMS, MAX_VERTS>& poly,
                                      axom::ArrayView<Plane<T, NDIMS>> planes,
                                      double eps)
 {
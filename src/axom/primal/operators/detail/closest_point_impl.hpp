@@ -0,0 +1,168 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file closest_point_impl.hpp
+ *
+ * \brief Branch-free kernel for the closest points from a query point to a
+ *  group of triangles, used by the batched closest_point() and
+ *  squared_distance() overloads.
+ *
+ * The triangles of a group are stored as a structure of arrays with one
+ * entry per lane, so that each step of the kernel is a loop over the lanes
+ * which the compiler can vectorize.  The region of the triangle containing
+ * the closest point is selected with conditional assignments instead of the
+ * early returns of the scalar closest_point().  The kernel evaluates the same
+ * expressions, so both agree up to the rounding differences allowed by the
+ * compiler's floating point contraction.
+ */
+
+#ifndef AXOM_PRIMAL_CLOSEST_POINT_IMPL_HPP_
+#define AXOM_PRIMAL_CLOSEST_POINT_IMPL_HPP_
+
+#include "axom/core/Macros.hpp"
+#include "axom/core/Types.hpp"
+
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Triangle.hpp"
+#include "axom/primal/operators/detail/intersect_impl.hpp"
+
+namespace axom
+{
+namespace primal
+{
+namespace detail
+{
+/*!
+ * \brief The vertices of a group of triangles, stored as a structure of
+ *  arrays with one entry per lane
+ */
+template <typename T, int NDIMS, int LANES>
+struct TriangleLanes
+{
+  static_assert(LANES == 4 || LANES == 8 || LANES == 16,
+                "Triangles are processed in groups of 4, 8 or 16");
+
+  T coords[3][NDIMS][LANES];
+};
+
+/*!
+ * \brief Copies triangles [first, first + n) of \a tris into \a lanes
+ *
+ * Lanes past \a n are filled with copies of the last triangle, so that the
+ * kernel only ever operates on valid data.
+ *
+ * \pre 0 < n <= LANES
+ */
+template <typename TriIndexable, typename T, int NDIMS, int LANES>
+AXOM_HOST_DEVICE inline void gatherTriangleLanes(
+  const TriIndexable& tris,
+  IndexType first,
+  int n,
+  TriangleLanes<T, NDIMS, LANES>& lanes)
+{
+  for(int l = 0; l < LANES; ++l)
+  {
+    const Triangle<T, NDIMS> tri = tris[first + (l < n ? l : n - 1)];
+    for(int v = 0; v < 3; ++v)
+    {
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        lanes.coords[v][d][l] = tri[v][d];
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Computes the closest points from \a P to each triangle of \a lanes
+ *
+ * \param [in] P the query point
+ * \param [in] lanes the triangles
+ * \param [out] cp the coordinates of the closest point on each triangle
+ * \param [out] loc the location code of each closest point, as returned by
+ *  closest_point()
+ * \param [in] EPS the tolerance used to classify the closest points
+ */
+template <typename T, int NDIMS, int LANES>
+AXOM_HOST_DEVICE inline void closestPointLanes(
+  const Point<T, NDIMS>& P,
+  const TriangleLanes<T, NDIMS, LANES>& lanes,
+  T (&cp)[NDIMS][LANES],
+  int (&loc)[LANES],
+  double EPS)
+{
+  const auto& A = lanes.coords[0];
+  const auto& B = lanes.coords[1];
+  const auto& C = lanes.coords[2];
+
+  for(int l = 0; l < LANES; ++l)
+  {
+    // Dot products of the edges from A with the vectors to P from each vertex
+    T d1 {}, d2 {}, d3 {}, d4 {}, d5 {}, d6 {};
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const T ab = B[d][l] - A[d][l];
+      const T ac = C[d][l] - A[d][l];
+      d1 += ab * (P[d] - A[d][l]);
+      d2 += ac * (P[d] - A[d][l]);
+      d3 += ab * (P[d] - B[d][l]);
+      d4 += ac * (P[d] - B[d][l]);
+      d5 += ab * (P[d] - C[d][l]);
+      d6 += ac * (P[d] - C[d][l]);
+    }
+
+    const T vc = d1 * d4 - d3 * d2;
+    const T vb = d5 * d2 - d1 * d6;
+    const T va = d3 * d6 - d5 * d4;
+
+    // Classify the closest point in the same order as closest_point()
+    const bool inA = isLeq(d1, T(0), EPS) && isLeq(d2, T(0), EPS);
+    const bool inB = isGeq(d3, T(0), EPS) && isLeq(d4, d3, EPS);
+    const bool inAB =
+      isLeq(vc, T(0), EPS) && isGeq(d1, T(0), EPS) && isLeq(d3, T(0), EPS);
+    const bool inC = isGeq(d6, T(0), EPS) && isLeq(d5, d6, EPS);
+    const bool inAC =
+      isLeq(vb, T(0), EPS) && isGeq(d2, T(0), EPS) && isLeq(d6, T(0), EPS);
+    const bool inBC = isLeq(va, T(0), EPS) && isGeq(d4 - d3, T(0), EPS) &&
+      isGeq(d5 - d6, T(0), EPS);
+
+    const int code = inA ? 0
+      : inB              ? 1
+      : inAB             ? -1
+      : inC              ? 2
+      : inAC             ? -3
+      : inBC             ? -2
+                         : Triangle<T, NDIMS>::NUM_TRI_VERTS;
+
+    // The closest point is base + (s * u + t * ac), where base is a vertex
+    // and u is an edge from it; s and t are zero at the vertices
+    const T denom = T(1) / (va + vb + vc);
+    const T s = (code == -1) ? d1 / (d1 - d3)
+      : (code == -3)         ? d2 / (d2 - d6)
+      : (code == -2)         ? (d4 - d3) / ((d4 - d3) + (d5 - d6))
+      : (code == 3)          ? vb * denom
+                             : T(0);
+    const T t = (code == 3) ? vc * denom : T(0);
+
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const T base = (code == 1 || code == -2) ? B[d][l]
+        : (code == 2)                          ? C[d][l]
+                                               : A[d][l];
+      const T u = (code == -3) ? C[d][l] - A[d][l]
+        : (code == -2)         ? C[d][l] - B[d][l]
+                               : B[d][l] - A[d][l];
+      cp[d][l] = base + (s * u + t * (C[d][l] - A[d][l]));
+    }
+    loc[l] = code;
+  }
+}
+
+}  // namespace detail
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_CLOSEST_POINT_IMPL_HPP_
@@ -0,0 +1,1040 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file exact_predicates_impl.hpp
+ *
+ * \brief Floating point expansion and fixed point arithmetic supporting the
+ *  filtered exact predicates in exact_predicates.hpp
+ *
+ * An expansion represents a real number as an unevaluated sum of doubles
+ * whose nonzero components do not overlap, stored in increasing order of
+ * magnitude.  Sums and products of expansions are computed exactly with the
+ * error-free transformations of J. R. Shewchuk, "Adaptive Precision
+ * Floating-Point Arithmetic and Fast Robust Geometric Predicates",
+ * Discrete & Computational Geometry 18:305-363, 1997.
+ *
+ * Every expansion is compressed after each operation.  A compressed
+ * expansion is nonadjacent, so its components are separated by at least one
+ * bit, and it has at most MAX_COMPRESSED_LENGTH components over the range of
+ * double.  This bounds the storage of every intermediate result by a
+ * constant, which keeps the predicates free of dynamic allocation and usable
+ * in device code.
+ *
+ * incircle() and insphere() evaluate their determinants adaptively, in the
+ * stages of Shewchuk's predicates, so their exact evaluation only runs for
+ * nearly degenerate inputs whose coordinate differences are not exact
+ * doubles.  Their exact stages use the FixedPoint type rather than
+ * expansions, since the expansions of these degree four and five
+ * determinants can take tens of kilobytes.  A FixedPoint covers the range
+ * of double in 68 32-bit limbs, which bounds the stack of the exact
+ * evaluation of insphere() by about 7KB.
+ *
+ * \note As in Shewchuk's predicates, the arithmetic is exact as long as no
+ *  intermediate result overflows or underflows.
+ */
+
+#ifndef AXOM_PRIMAL_EXACT_PREDICATES_IMPL_HPP_
+#define AXOM_PRIMAL_EXACT_PREDICATES_IMPL_HPP_
+
+#include "axom/core/Macros.hpp"
+#include "axom/core/utilities/BitUtilities.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+namespace axom
+{
+namespace primal
+{
+namespace detail
+{
+/// Half of the machine epsilon of double, i.e. \f$ 2^{-53} \f$
+constexpr double EXACT_EPSILON = 1.1102230246251565e-16;
+
+/// Error bounds of the floating point filters of the predicates
+constexpr double ORIENT2D_ERRBOUND =
+  (3.0 + 16.0 * EXACT_EPSILON) * EXACT_EPSILON;
+constexpr double ORIENT3D_ERRBOUND =
+  (7.0 + 56.0 * EXACT_EPSILON) * EXACT_EPSILON;
+constexpr double INCIRCLE_ERRBOUND =
+  (10.0 + 96.0 * EXACT_EPSILON) * EXACT_EPSILON;
+constexpr double INSPHERE_ERRBOUND =
+  (16.0 + 224.0 * EXACT_EPSILON) * EXACT_EPSILON;
+
+/// Error bounds of the adaptive stages of incircle() and insphere()
+constexpr double RESULT_ERRBOUND = (3.0 + 8.0 * EXACT_EPSILON) * EXACT_EPSILON;
+constexpr double INCIRCLE_ERRBOUND_B =
+  (4.0 + 48.0 * EXACT_EPSILON) * EXACT_EPSILON;
+constexpr double INCIRCLE_ERRBOUND_C =
+  (44.0 + 576.0 * EXACT_EPSILON) * EXACT_EPSILON * EXACT_EPSILON;
+constexpr double INSPHERE_ERRBOUND_B =
+  (5.0 + 72.0 * EXACT_EPSILON) * EXACT_EPSILON;
+constexpr double INSPHERE_ERRBOUND_C =
+  (71.0 + 1408.0 * EXACT_EPSILON) * EXACT_EPSILON * EXACT_EPSILON;
+
+/// Bound on the length of a compressed expansion of doubles
+constexpr int MAX_COMPRESSED_LENGTH = 1050;
+
+/// Capacity for \a n components, capped by what compression can produce
+constexpr int expansionCapacity(int n)
+{
+  return n < 2 * MAX_COMPRESSED_LENGTH ? n : 2 * MAX_COMPRESSED_LENGTH;
+}
+
+/*!
+ * \brief A fixed capacity expansion holding up to \a N components
+ *
+ * An expansion always has at least one component; zero is stored as a
+ * single zero component.
+ */
+template <int N>
+struct Expansion
+{
+  AXOM_HOST_DEVICE Expansion() { components[0] = 0.; }
+
+  /// Returns the largest component, which has the sign of the expansion
+  AXOM_HOST_DEVICE double estimate() const { return components[size - 1]; }
+
+  int size {1};
+  double components[N];
+};
+
+/*! @{ @name Error-free transformations */
+
+/// Computes \a x + \a y = \a a + \a b exactly, where \a x = fl(a+b)
+AXOM_HOST_DEVICE inline void twoSum(double a, double b, double& x, double& y)
+{
+  x = a + b;
+  const double bVirtual = x - a;
+  const double aVirtual = x - bVirtual;
+  y = (a - aVirtual) + (b - bVirtual);
+}
+
+/// Like twoSum(), but requires \f$ |a| \ge |b| \f$
+AXOM_HOST_DEVICE inline void fastTwoSum(double a,
+                                        double b,
+                                        double& x,
+                                        double& y)
+{
+  x = a + b;
+  y = b - (x - a);
+}
+
+/*!
+ * \brief Absolute value of \a x
+ *
+ * \note Unlike axom::utilities::abs(), this compiles to a sign mask instead
+ *  of a branch, which matters for the predicates' error bounds since the
+ *  signs of their terms are unpredictable.
+ */
+AXOM_HOST_DEVICE inline double abs(double x)
+{
+#ifdef AXOM_DEVICE_CODE
+  return ::fabs(x);
+#else
+  return std::fabs(x);
+#endif
+}
+
+/// Computes \a x + \a y = \a a * \a b exactly, where \a x = fl(a*b)
+AXOM_HOST_DEVICE inline void twoProduct(double a,
+                                        double b,
+                                        double& x,
+                                        double& y)
+{
+  x = a * b;
+#ifdef AXOM_DEVICE_CODE
+  y = ::fma(a, b, -x);
+#else
+  y = std::fma(a, b, -x);
+#endif
+}
+
+/// Returns the roundoff \a y of \a x = fl(a-b), such that a - b = x + y
+AXOM_HOST_DEVICE inline double twoDiffTail(double a, double b, double x)
+{
+  const double bVirtual = a - x;
+  const double aVirtual = x + bVirtual;
+  return (a - aVirtual) + (bVirtual - b);
+}
+
+/// Sets \a h to the exact difference \a a - \a b
+template <int N>
+AXOM_HOST_DEVICE inline void setDifference(double a, double b, Expansion<N>& h)
+{
+  static_assert(N >= 2, "A difference needs two components");
+
+  const double x = a - b;
+  const double y = twoDiffTail(a, b, x);
+
+  h.size = 0;
+  if(y != 0.)
+  {
+    h.components[h.size++] = y;
+  }
+  h.components[h.size++] = x;
+}
+
+/*! @} */
+
+/*! @{ @name Expansion arithmetic */
+
+/*!
+ * \brief Compresses the \a len components of \a e in place
+ * \return The number of components of the compressed expansion
+ */
+AXOM_HOST_DEVICE inline int compressExpansion(int len, double* e)
+{
+  int bottom = len - 1;
+  double Q = e[bottom];
+  double Qnew, q;
+  for(int i = len - 2; i >= 0; --i)
+  {
+    fastTwoSum(Q, e[i], Qnew, q);
+    if(q != 0.)
+    {
+      e[bottom--] = Qnew;
+      Q = q;
+    }
+    else
+    {
+      Q = Qnew;
+    }
+  }
+
+  int top = 0;
+  for(int i = bottom + 1; i < len; ++i)
+  {
+    fastTwoSum(e[i], Q, Qnew, q);
+    if(q != 0.)
+    {
+      e[top++] = q;
+    }
+    Q = Qnew;
+  }
+  e[top] = Q;
+  return top + 1;
+}
+
+/*!
+ * \brief Sets \a h to the exact sum of \a e and \a f
+ * \note \a h must not alias \a e or \a f
+ */
+template <int N, int M, int K>
+AXOM_HOST_DEVICE inline void sum(const Expansion<N>& e,
+                                 const Expansion<M>& f,
+                                 Expansion<K>& h)
+{
+  const double* ec = e.components;
+  const double* fc = f.components;
+  double* hc = h.components;
+
+  // Merge the components of e and f in increasing order of magnitude,
+  // accumulating them into Q and emitting the roundoff of each addition
+  int ei = 0, fi = 0, hi = 0;
+  auto takeE = [&]() {
+    return fi >= f.size ||
+      (ei < e.size && ((fc[fi] > ec[ei]) == (fc[fi] > -ec[ei])));
+  };
+
+  double Q = takeE() ? ec[ei++] : fc[fi++];
+  double Qnew, hh;
+  for(int k = 1; k < e.size + f.size; ++k)
+  {
+    const double next = takeE() ? ec[ei++] : fc[fi++];
+    twoSum(Q, next, Qnew, hh);
+    Q = Qnew;
+    if(hh != 0.)
+    {
+      hc[hi++] = hh;
+    }
+  }
+  if(Q != 0. || hi == 0)
+  {
+    hc[hi++] = Q;
+  }
+
+  h.size = compressExpansion(hi, hc);
+}
+
+/*!
+ * \brief Sets \a h to the exact product of \a e and the scalar \a b
+ * \note \a h must not alias \a e
+ */
+template <int N, int K>
+AXOM_HOST_DEVICE inline void scale(const Expansion<N>& e,
+                                   double b,
+                                   Expansion<K>& h)
+{
+  double* hc = h.components;
+  int hi = 0;
+
+  double Q, hh;
+  twoProduct(e.components[0], b, Q, hh);
+  if(hh != 0.)
+  {
+    hc[hi++] = hh;
+  }
+  for(int i = 1; i < e.size; ++i)
+  {
+    double product1, product0, s;
+    twoProduct(e.components[i], b, product1, product0);
+    twoSum(Q, product0, s, hh);
+    if(hh != 0.)
+    {
+      hc[hi++] = hh;
+    }
+    fastTwoSum(product1, s, Q, hh);
+    if(hh != 0.)
+    {
+      hc[hi++] = hh;
+    }
+  }
+  if(Q != 0. || hi == 0)
+  {
+    hc[hi++] = Q;
+  }
+
+  h.size = compressExpansion(hi, hc);
+}
+
+/*!
+ * \brief Sets \a h to the exact product of \a e and \a f
+ *
+ * \a e is scaled by each component of \a f, so \a f should be the shorter
+ * of the two expansions.
+ * \note \a h must not alias \a e or \a f
+ */
+template <int N, int M, int K>
+AXOM_HOST_DEVICE inline void product(const Expansion<N>& e,
+                                     const Expansion<M>& f,
+                                     Expansion<K>& h)
+{
+  Expansion<expansionCapacity(2 * N)> scaled;
+  Expansion<K> partial;
+
+  scale(e, f.components[0], h);
+  for(int j = 1; j < f.size; ++j)
+  {
+    scale(e, f.components[j], scaled);
+    sum(h, scaled, partial);
+
+    h.size = partial.size;
+    for(int i = 0; i < partial.size; ++i)
+    {
+      h.components[i] = partial.components[i];
+    }
+  }
+}
+
+/// Negates the expansion \a e in place
+template <int N>
+AXOM_HOST_DEVICE inline void negate(Expansion<N>& e)
+{
+  for(int i = 0; i < e.size; ++i)
+  {
+    e.components[i] = -e.components[i];
+  }
+}
+
+/// Sets \a h to the exact value of \a a * \a b - \a c * \a d
+template <int D>
+AXOM_HOST_DEVICE inline void twoByTwo(const Expansion<D>& a,
+                                      const Expansion<D>& b,
+                                      const Expansion<D>& c,
+                                      const Expansion<D>& d,
+                                      Expansion<4 * D * D>& h)
+{
+  Expansion<2 * D * D> ab, cd;
+  product(a, b, ab);
+  product(c, d, cd);
+  negate(cd);
+  sum(ab, cd, h);
+}
+
+/*! @} */
+
+/*! @{ @name Fixed point arithmetic */
+
+/// Number of 32-bit limbs below and above the binary point of a FixedPoint
+constexpr int FIXED_FRACTION_LIMBS = 34;
+constexpr int FIXED_INTEGER_LIMBS = 34;
+constexpr int FIXED_LIMBS = FIXED_FRACTION_LIMBS + FIXED_INTEGER_LIMBS;
+
+/*!
+ * \brief A signed fixed point number with a resolution of \f$ 2^{-1088} \f$
+ *  and a magnitude below \f$ 2^{1088} \f$
+ *
+ * The magnitude is stored as 32-bit limbs, least significant first, of
+ * which only those in [lo, hi) are nonzero and initialized.  Since every
+ * double is a multiple of the resolution, differences, sums and products
+ * of doubles are exact in this type as long as, like with expansions, no
+ * intermediate result overflows or underflows.  The cost of an operation
+ * depends on the number of limbs in use, so values with a narrow range of
+ * bits remain cheap.
+ */
+struct FixedPoint
+{
+  /// Returns the value rounded to a double, with the exact sign
+  AXOM_HOST_DEVICE double estimate() const;
+
+  AXOM_HOST_DEVICE std::uint32_t limb(int k) const
+  {
+    return (k >= lo && k < hi) ? limbs[k] : 0u;
+  }
+
+  AXOM_HOST_DEVICE bool isZero() const { return lo == hi; }
+
+  /// Shrinks [lo, hi) to the nonzero limbs
+  AXOM_HOST_DEVICE void trim()
+  {
+    while(hi > lo && limbs[hi - 1] == 0u)
+    {
+      --hi;
+    }
+    while(lo < hi && limbs[lo] == 0u)
+    {
+      ++lo;
+    }
+    if(lo == hi)
+    {
+      lo = hi = 0;
+      negative = false;
+    }
+  }
+
+  std::uint32_t limbs[FIXED_LIMBS];
+  int lo {0};
+  int hi {0};
+  bool negative {false};
+};
+
+AXOM_HOST_DEVICE inline double FixedPoint::estimate() const
+{
+  if(isZero())
+  {
+    return 0.;
+  }
+
+  // Gather the 64 most significant bits, starting at the leading one
+  const int top = hi - 1;
+  const int shift = axom::utilities::leadingZeros(
+    static_cast<std::int32_t>(limbs[top]));
+  std::uint64_t bits = (static_cast<std::uint64_t>(limbs[top]) << 32) |
+    limb(top - 1);
+  if(shift > 0)
+  {
+    bits = (bits << shift) | (limb(top - 2) >> (32 - shift));
+  }
+
+  const int exponent = 32 * (top - 1 - FIXED_FRACTION_LIMBS) - shift;
+#ifdef AXOM_DEVICE_CODE
+  double value = ::ldexp(static_cast<double>(bits), exponent);
+#else
+  double value = std::ldexp(static_cast<double>(bits), exponent);
+#endif
+
+  // Keep the sign of values below the range of double
+  if(value == 0.)
+  {
+    value = 4.9406564584124654e-324;
+  }
+  return negative ? -value : value;
+}
+
+/// Sets \a h to the double \a a
+AXOM_HOST_DEVICE inline void setFixed(double a, FixedPoint& h)
+{
+  h.lo = h.hi = 0;
+  h.negative = false;
+  if(a == 0.)
+  {
+    return;
+  }
+
+  // a = mantissa * 2^(exponent - 53) with an integer mantissa
+  int exponent;
+#ifdef AXOM_DEVICE_CODE
+  const double fraction = ::frexp(abs(a), &exponent);
+  std::uint64_t mantissa =
+    static_cast<std::uint64_t>(::ldexp(fraction, 53));
+#else
+  const double fraction = std::frexp(abs(a), &exponent);
+  std::uint64_t mantissa =
+    static_cast<std::uint64_t>(std::ldexp(fraction, 53));
+#endif
+
+  // Drop the trailing zeros, after which the lowest bit is at or above the
+  // resolution for any double
+  const int zeros = axom::utilities::trailingZeros(mantissa);
+  mantissa >>= zeros;
+  const int bit = exponent - 53 + zeros + 32 * FIXED_FRACTION_LIMBS;
+
+  const int k = bit / 32;
+  const int offset = bit % 32;
+  const std::uint64_t low = mantissa << offset;
+  const std::uint64_t high = (offset > 0) ? mantissa >> (64 - offset) : 0u;
+  h.limbs[k] = static_cast<std::uint32_t>(low);
+  h.limbs[k + 1] = static_cast<std::uint32_t>(low >> 32);
+  h.limbs[k + 2] = static_cast<std::uint32_t>(high);
+  h.lo = k;
+  h.hi = k + 3;
+  h.negative = a < 0.;
+  h.trim();
+}
+
+/// Returns true when the magnitude of \a a is below that of \a b
+AXOM_HOST_DEVICE inline bool lessMagnitude(const FixedPoint& a,
+                                           const FixedPoint& b)
+{
+  if(a.hi != b.hi)
+  {
+    return a.hi < b.hi;
+  }
+  const int lo = (a.lo < b.lo) ? a.lo : b.lo;
+  for(int k = a.hi - 1; k >= lo; --k)
+  {
+    if(a.limb(k) != b.limb(k))
+    {
+      return a.limb(k) < b.limb(k);
+    }
+  }
+  return false;
+}
+
+/*!
+ * \brief Sets \a h to \a a plus or minus \a b, as selected by \a subtract
+ * \note \a h may alias \a a or \a b
+ */
+AXOM_HOST_DEVICE inline void addSigned(const FixedPoint& a,
+                                       const FixedPoint& b,
+                                       bool subtract,
+                                       FixedPoint& h)
+{
+  const bool bNegative = (b.negative != subtract) && !b.isZero();
+  int lo = (a.lo < b.lo) ? a.lo : b.lo;
+  if(a.isZero() || b.isZero())
+  {
+    lo = a.isZero() ? b.lo : a.lo;
+  }
+  const int hi = (a.hi > b.hi) ? a.hi : b.hi;
+
+  if(a.negative == bNegative)
+  {
+    // Same signs: add the magnitudes
+    std::uint64_t carry = 0;
+    for(int k = lo; k < hi; ++k)
+    {
+      const std::uint64_t s = carry + a.limb(k) + b.limb(k);
+      h.limbs[k] = static_cast<std::uint32_t>(s);
+      carry = s >> 32;
+    }
+    int newHi = hi;
+    if(carry != 0 && hi < FIXED_LIMBS)
+    {
+      h.limbs[newHi++] = static_cast<std::uint32_t>(carry);
+    }
+    h.negative = a.negative;
+    h.lo = lo;
+    h.hi = newHi;
+  }
+  else
+  {
+    // Opposite signs: subtract the smaller magnitude from the larger one
+    const bool swap = lessMagnitude(a, b);
+    const FixedPoint& big = swap ? b : a;
+    const FixedPoint& small = swap ? a : b;
+    const bool negative = swap ? bNegative : a.negative;
+
+    std::int64_t borrow = 0;
+    for(int k = lo; k < hi; ++k)
+    {
+      std::int64_t d = static_cast<std::int64_t>(big.limb(k)) -
+        static_cast<std::int64_t>(small.limb(k)) - borrow;
+      borrow = (d < 0) ? 1 : 0;
+      h.limbs[k] = static_cast<std::uint32_t>(d + (borrow << 32));
+    }
+    h.negative = negative;
+    h.lo = lo;
+    h.hi = hi;
+  }
+  h.trim();
+}
+
+/// Sets \a h to the sum of \a a and \a b, which \a h may alias
+AXOM_HOST_DEVICE inline void sum(const FixedPoint& a,
+                                 const FixedPoint& b,
+                                 FixedPoint& h)
+{
+  addSigned(a, b, false, h);
+}
+
+/// Sets \a h to the difference of \a a and \a b, which \a h may alias
+AXOM_HOST_DEVICE inline void difference(const FixedPoint& a,
+                                        const FixedPoint& b,
+                                        FixedPoint& h)
+{
+  addSigned(a, b, true, h);
+}
+
+/*!
+ * \brief Sets \a h to the product of \a a and \a b, truncated to the
+ *  resolution of FixedPoint
+ * \note \a h must not alias \a a or \a b
+ */
+AXOM_HOST_DEVICE inline void product(const FixedPoint& a,
+                                     const FixedPoint& b,
+                                     FixedPoint& h)
+{
+  h.lo = h.hi = 0;
+  h.negative = false;
+  if(a.isZero() || b.isZero())
+  {
+    return;
+  }
+
+  // Sum the limb products one column at a time into a 96-bit accumulator,
+  // keeping only the columns at or above the binary point of the result
+  std::uint64_t accLow = 0, accHigh = 0;
+  const int first = a.lo + b.lo;
+  const int last = a.hi + b.hi - 2;
+  int lo = -1;
+  for(int col = first; col <= last || accLow != 0 || accHigh != 0; ++col)
+  {
+    if(col <= last)
+    {
+      const int iBegin = (col - (b.hi - 1) > a.lo) ? col - (b.hi - 1) : a.lo;
+      const int iEnd = (col - b.lo < a.hi - 1) ? col - b.lo : a.hi - 1;
+      for(int i = iBegin; i <= iEnd; ++i)
+      {
+        const std::uint64_t p =
+          static_cast<std::uint64_t>(a.limbs[i]) * b.limbs[col - i];
+        accLow += p;
+        accHigh += (accLow < p) ? 1 : 0;
+      }
+    }
+
+    const int k = col - FIXED_FRACTION_LIMBS;
+    if(k >= FIXED_LIMBS)
+    {
+      break;
+    }
+    if(k >= 0)
+    {
+      h.limbs[k] = static_cast<std::uint32_t>(accLow);
+      lo = (lo < 0) ? k : lo;
+      h.hi = k + 1;
+    }
+    accLow = (accLow >> 32) | (accHigh << 32);
+    accHigh >>= 32;
+  }
+
+  if(lo >= 0)
+  {
+    h.lo = lo;
+    h.negative = a.negative != b.negative;
+    h.trim();
+  }
+}
+
+/// Sets \a h to the exact difference \a a - \a b
+AXOM_HOST_DEVICE inline void setFixedDifference(double a,
+                                                double b,
+                                                FixedPoint& h)
+{
+  FixedPoint fb;
+  setFixed(a, h);
+  setFixed(b, fb);
+  difference(h, fb, h);
+}
+
+/*! @} */
+
+/*! @{ @name Exact evaluation of the predicates' determinants */
+
+/// Exact evaluation of orient2d() for the case its filter cannot decide
+AXOM_HOST_DEVICE inline double orient2dExact(const double* pa,
+                                             const double* pb,
+                                             const double* pc)
+{
+  Expansion<2> acx, acy, bcx, bcy;
+  setDifference(pa[0], pc[0], acx);
+  setDifference(pa[1], pc[1], acy);
+  setDifference(pb[0], pc[0], bcx);
+  setDifference(pb[1], pc[1], bcy);
+
+  Expansion<16> det;
+  twoByTwo(acx, bcy, acy, bcx, det);
+  return det.estimate();
+}
+
+/// Exact evaluation of orient3d() for the case its filter cannot decide
+AXOM_HOST_DEVICE inline double orient3dExact(const double* pa,
+                                             const double* pb,
+                                             const double* pc,
+                                             const double* pd)
+{
+  Expansion<2> adx, ady, adz, bdx, bdy, bdz, cdx, cdy, cdz;
+  setDifference(pa[0], pd[0], adx);
+  setDifference(pa[1], pd[1], ady);
+  setDifference(pa[2], pd[2], adz);
+  setDifference(pb[0], pd[0], bdx);
+  setDifference(pb[1], pd[1], bdy);
+  setDifference(pb[2], pd[2], bdz);
+  setDifference(pc[0], pd[0], cdx);
+  setDifference(pc[1], pd[1], cdy);
+  setDifference(pc[2], pd[2], cdz);
+
+  // det = adz * bc + bdz * ca + cdz * ab
+  Expansion<16> bc, ca, ab;
+  twoByTwo(bdx, cdy, cdx, bdy, bc);
+  twoByTwo(cdx, ady, adx, cdy, ca);
+  twoByTwo(adx, bdy, bdx, ady, ab);
+
+  Expansion<64> adet, bdet, cdet;
+  product(bc, adz, adet);
+  product(ca, bdz, bdet);
+  product(ab, cdz, cdet);
+
+  Expansion<128> abdet;
+  Expansion<192> det;
+  sum(adet, bdet, abdet);
+  sum(abdet, cdet, det);
+  return det.estimate();
+}
+
+/*!
+ * \brief Incircle determinant of the differences \a dx and \a dy of the
+ *  coordinates of a, b and c to those of d
+ */
+AXOM_HOST_DEVICE inline double incircleFixed(const FixedPoint* dx,
+                                             const FixedPoint* dy)
+{
+  // det = alift * bc + blift * ca + clift * ab
+  FixedPoint det, minor, lift, term, t0, t1;
+  for(int i = 0; i < 3; ++i)
+  {
+    const int j = (i + 1) % 3, k = (i + 2) % 3;
+    product(dx[j], dy[k], t0);
+    product(dx[k], dy[j], t1);
+    difference(t0, t1, minor);
+
+    product(dx[i], dx[i], t0);
+    product(dy[i], dy[i], t1);
+    sum(t0, t1, lift);
+
+    product(lift, minor, term);
+    sum(det, term, det);
+  }
+  return det.estimate();
+}
+
+/// Exact evaluation of incircle() from the exact coordinate differences
+AXOM_HOST_DEVICE inline double incircleExact(const double* pa,
+                                             const double* pb,
+                                             const double* pc,
+                                             const double* pd)
+{
+  const double* pts[3] = {pa, pb, pc};
+
+  FixedPoint dx[3], dy[3];
+  for(int i = 0; i < 3; ++i)
+  {
+    setFixedDifference(pts[i][0], pd[0], dx[i]);
+    setFixedDifference(pts[i][1], pd[1], dy[i]);
+  }
+  return incircleFixed(dx, dy);
+}
+
+/*!
+ * \brief Adaptive evaluation of incircle() for the case its filter cannot
+ *  decide
+ *
+ * \param [in] permanent The bound on the magnitude of the terms of the
+ *  determinant computed by the filter
+ *
+ * As in Shewchuk's incircleadapt(), the determinant of the rounded
+ * coordinate differences is computed exactly first.  When its error bound
+ * does not certify the sign, a first order correction for the roundoff of
+ * the differences is added in floating point, and only when that does not
+ * certify the sign either is the determinant evaluated exactly.
+ */
+AXOM_HOST_DEVICE inline double incircleAdapt(const double* pa,
+                                             const double* pb,
+                                             const double* pc,
+                                             const double* pd,
+                                             double permanent)
+{
+  const double adx = pa[0] - pd[0], ady = pa[1] - pd[1];
+  const double bdx = pb[0] - pd[0], bdy = pb[1] - pd[1];
+  const double cdx = pc[0] - pd[0], cdy = pc[1] - pd[1];
+
+  // Exact determinant of the rounded differences
+  FixedPoint dx[3], dy[3];
+  setFixed(adx, dx[0]);
+  setFixed(ady, dy[0]);
+  setFixed(bdx, dx[1]);
+  setFixed(bdy, dy[1]);
+  setFixed(cdx, dx[2]);
+  setFixed(cdy, dy[2]);
+
+  double det = incircleFixed(dx, dy);
+  double errBound = INCIRCLE_ERRBOUND_B * permanent;
+  if(det >= errBound || -det >= errBound)
+  {
+    return det;
+  }
+
+  const double adxtail = twoDiffTail(pa[0], pd[0], adx);
+  const double adytail = twoDiffTail(pa[1], pd[1], ady);
+  const double bdxtail = twoDiffTail(pb[0], pd[0], bdx);
+  const double bdytail = twoDiffTail(pb[1], pd[1], bdy);
+  const double cdxtail = twoDiffTail(pc[0], pd[0], cdx);
+  const double cdytail = twoDiffTail(pc[1], pd[1], cdy);
+  if(adxtail == 0. && adytail == 0. && bdxtail == 0. && bdytail == 0. &&
+     cdxtail == 0. && cdytail == 0.)
+  {
+    return det;
+  }
+
+  // First order correction for the roundoff of the differences
+  errBound = INCIRCLE_ERRBOUND_C * permanent + RESULT_ERRBOUND * abs(det);
+  det += ((adx * adx + ady * ady) *
+            ((bdx * cdytail + cdy * bdxtail) -
+             (bdy * cdxtail + cdx * bdytail)) +
+          2.0 * (adx * adxtail + ady * adytail) * (bdx * cdy - bdy * cdx)) +
+    ((bdx * bdx + bdy * bdy) *
+       ((cdx * adytail + ady * cdxtail) - (cdy * adxtail + adx * cdytail)) +
+     2.0 * (bdx * bdxtail + bdy * bdytail) * (cdx * ady - cdy * adx)) +
+    ((cdx * cdx + cdy * cdy) *
+       ((adx * bdytail + bdy * adxtail) - (ady * bdxtail + bdx * adytail)) +
+     2.0 * (cdx * cdxtail + cdy * cdytail) * (adx * bdy - ady * bdx));
+  if(det >= errBound || -det >= errBound)
+  {
+    return det;
+  }
+
+  return incircleExact(pa, pb, pc, pd);
+}
+
+/*!
+ * \brief Insphere determinant of the differences \a ex, \a ey and \a ez of
+ *  the coordinates of a, b, c and d to those of e
+ */
+AXOM_HOST_DEVICE inline double insphereFixed(const FixedPoint* ex,
+                                             const FixedPoint* ey,
+                                             const FixedPoint* ez)
+{
+  FixedPoint t0, t1;
+  auto minor2 = [&](int i, int j, FixedPoint& h) {
+    product(ex[i], ey[j], t0);
+    product(ex[j], ey[i], t1);
+    difference(t0, t1, h);
+  };
+
+  // The 2x2 minors ab, bc, cd, da, ac and bd in the xy-plane
+  FixedPoint ab, bc, cd, da, ac, bd;
+  minor2(0, 1, ab);
+  minor2(1, 2, bc);
+  minor2(2, 3, cd);
+  minor2(3, 0, da);
+  minor2(0, 2, ac);
+  minor2(1, 3, bd);
+
+  // The 3x3 minors bcd, cda, dab and abc, as signed sums of z * minor
+  const int zIndex[4][3] = {{1, 2, 3}, {2, 3, 0}, {3, 0, 1}, {0, 1, 2}};
+  const FixedPoint* minors[4][3] = {{&cd, &bd, &bc},
+                                    {&da, &ac, &cd},
+                                    {&ab, &bd, &da},
+                                    {&bc, &ac, &ab}};
+  const bool subtractSecond[4] = {true, false, false, true};
+
+  // det = (dlift * abc - clift * dab) + (blift * cda - alift * bcd)
+  FixedPoint det, minor3, lift;
+  for(int i = 0; i < 4; ++i)
+  {
+    product(ez[zIndex[i][0]], *minors[i][0], minor3);
+    product(ez[zIndex[i][1]], *minors[i][1], t0);
+    addSigned(minor3, t0, subtractSecond[i], minor3);
+    product(ez[zIndex[i][2]], *minors[i][2], t0);
+    sum(minor3, t0, minor3);
+
+    product(ex[i], ex[i], t0);
+    product(ey[i], ey[i], t1);
+    sum(t0, t1, lift);
+    product(ez[i], ez[i], t0);
+    sum(lift, t0, lift);
+
+    product(lift, minor3, t0);
+    addSigned(det, t0, i % 2 == 0, det);
+  }
+  return det.estimate();
+}
+
+/// Exact evaluation of insphere() from the exact coordinate differences
+AXOM_HOST_DEVICE inline double insphereExact(const double* pa,
+                                             const double* pb,
+                                             const double* pc,
+                                             const double* pd,
+                                             const double* pe)
+{
+  const double* pts[4] = {pa, pb, pc, pd};
+
+  FixedPoint ex[4], ey[4], ez[4];
+  for(int i = 0; i < 4; ++i)
+  {
+    setFixedDifference(pts[i][0], pe[0], ex[i]);
+    setFixedDifference(pts[i][1], pe[1], ey[i]);
+    setFixedDifference(pts[i][2], pe[2], ez[i]);
+  }
+  return insphereFixed(ex, ey, ez);
+}
+
+/// Returns the largest component of the exact value of a * b - c * d
+AXOM_HOST_DEVICE inline double twoByTwoEstimate(double a,
+                                                double b,
+                                                double c,
+                                                double d)
+{
+  Expansion<1> ea, eb, ec, ed;
+  ea.components[0] = a;
+  eb.components[0] = b;
+  ec.components[0] = c;
+  ed.components[0] = d;
+
+  Expansion<4> h;
+  twoByTwo(ea, eb, ec, ed, h);
+  return h.estimate();
+}
+
+/*!
+ * \brief Adaptive evaluation of insphere() for the case its filter cannot
+ *  decide
+ *
+ * \param [in] permanent The bound on the magnitude of the terms of the
+ *  determinant computed by the filter
+ *
+ * Follows the same stages as incircleAdapt(), after Shewchuk's
+ * insphereadapt().
+ */
+AXOM_HOST_DEVICE inline double insphereAdapt(const double* pa,
+                                             const double* pb,
+                                             const double* pc,
+                                             const double* pd,
+                                             const double* pe,
+                                             double permanent)
+{
+  const double aex = pa[0] - pe[0], aey = pa[1] - pe[1], aez = pa[2] - pe[2];
+  const double bex = pb[0] - pe[0], bey = pb[1] - pe[1], bez = pb[2] - pe[2];
+  const double cex = pc[0] - pe[0], cey = pc[1] - pe[1], cez = pc[2] - pe[2];
+  const double dex = pd[0] - pe[0], dey = pd[1] - pe[1], dez = pd[2] - pe[2];
+
+  // Exact determinant of the rounded differences
+  double det;
+  {
+    const double x[4] = {aex, bex, cex, dex};
+    const double y[4] = {aey, bey, cey, dey};
+    const double z[4] = {aez, bez, cez, dez};
+
+    FixedPoint ex[4], ey[4], ez[4];
+    for(int i = 0; i < 4; ++i)
+    {
+      setFixed(x[i], ex[i]);
+      setFixed(y[i], ey[i]);
+      setFixed(z[i], ez[i]);
+    }
+    det = insphereFixed(ex, ey, ez);
+  }
+
+  double errBound = INSPHERE_ERRBOUND_B * permanent;
+  if(det >= errBound || -det >= errBound)
+  {
+    return det;
+  }
+
+  const double aextail = twoDiffTail(pa[0], pe[0], aex);
+  const double aeytail = twoDiffTail(pa[1], pe[1], aey);
+  const double aeztail = twoDiffTail(pa[2], pe[2], aez);
+  const double bextail = twoDiffTail(pb[0], pe[0], bex);
+  const double beytail = twoDiffTail(pb[1], pe[1], bey);
+  const double beztail = twoDiffTail(pb[2], pe[2], bez);
+  const double cextail = twoDiffTail(pc[0], pe[0], cex);
+  const double ceytail = twoDiffTail(pc[1], pe[1], cey);
+  const double ceztail = twoDiffTail(pc[2], pe[2], cez);
+  const double dextail = twoDiffTail(pd[0], pe[0], dex);
+  const double deytail = twoDiffTail(pd[1], pe[1], dey);
+  const double deztail = twoDiffTail(pd[2], pe[2], dez);
+  if(aextail == 0. && aeytail == 0. && aeztail == 0. && bextail == 0. &&
+     beytail == 0. && beztail == 0. && cextail == 0. && ceytail == 0. &&
+     ceztail == 0. && dextail == 0. && deytail == 0. && deztail == 0.)
+  {
+    return det;
+  }
+
+  // First order correction for the roundoff of the differences, using the
+  // largest components of the exact 2x2 minors
+  const double ab3 = twoByTwoEstimate(aex, bey, bex, aey);
+  const double bc3 = twoByTwoEstimate(bex, cey, cex, bey);
+  const double cd3 = twoByTwoEstimate(cex, dey, dex, cey);
+  const double da3 = twoByTwoEstimate(dex, aey, aex, dey);
+  const double ac3 = twoByTwoEstimate(aex, cey, cex, aey);
+  const double bd3 = twoByTwoEstimate(bex, dey, dex, bey);
+
+  const double abeps =
+    (aex * beytail + bey * aextail) - (aey * bextail + bex * aeytail);
+  const double bceps =
+    (bex * ceytail + cey * bextail) - (bey * cextail + cex * beytail);
+  const double cdeps =
+    (cex * deytail + dey * cextail) - (cey * dextail + dex * ceytail);
+  const double daeps =
+    (dex * aeytail + aey * dextail) - (dey * aextail + aex * deytail);
+  const double aceps =
+    (aex * ceytail + cey * aextail) - (aey * cextail + cex * aeytail);
+  const double bdeps =
+    (bex * deytail + dey * bextail) - (bey * dextail + dex * beytail);
+
+  const double alift = aex * aex + aey * aey + aez * aez;
+  const double blift = bex * bex + bey * bey + bez * bez;
+  const double clift = cex * cex + cey * cey + cez * cez;
+  const double dlift = dex * dex + dey * dey + dez * dez;
+
+  errBound = INSPHERE_ERRBOUND_C * permanent + RESULT_ERRBOUND * abs(det);
+  det += ((blift *
+             ((cez * daeps + dez * aceps + aez * cdeps) +
+              (ceztail * da3 + deztail * ac3 + aeztail * cd3)) +
+           dlift *
+             ((aez * bceps - bez * aceps + cez * abeps) +
+              (aeztail * bc3 - beztail * ac3 + ceztail * ab3))) -
+          (alift *
+             ((bez * cdeps - cez * bdeps + dez * bceps) +
+              (beztail * cd3 - ceztail * bd3 + deztail * bc3)) +
+           clift *
+             ((dez * abeps + aez * bdeps + bez * daeps) +
+              (deztail * ab3 + aeztail * bd3 + beztail * da3)))) +
+    2.0 *
+      (((bex * bextail + bey * beytail + bez * beztail) *
+          (cez * da3 + dez * ac3 + aez * cd3) +
+        (dex * dextail + dey * deytail + dez * deztail) *
+          (aez * bc3 - bez * ac3 + cez * ab3)) -
+       ((aex * aextail + aey * aeytail + aez * aeztail) *
+          (bez * cd3 - cez * bd3 + dez * bc3) +
+        (cex * cextail + cey * ceytail + cez * ceztail) *
+          (dez * ab3 + aez * bd3 + bez * da3)));
+  if(det >= errBound || -det >= errBound)
+  {
+    return det;
+  }
+
+  return insphereExact(pa, pb, pc, pd, pe);
+}
+
+/*! @} */
+
+}  // namespace detail
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_EXACT_PREDICATES_IMPL_HPP_
@@ -25,6 +25,8 @@
 #include "axom/primal/geometry/Segment.hpp"
 #include "axom/primal/geometry/Triangle.hpp"
 
+#include "axom/primal/operators/exact_predicates.hpp"
+
 namespace axom
 {
 namespace primal
@@ -108,7 +110,8 @@ bool intersectOnePermutedTriangle(const Point3& p1,
                                   double dr2,
                                   Vector3& normal,
                                   bool includeBoundary,
-                                  double EPS);
+                                  double EPS,
+                                  bool useExactPredicates);
 
 AXOM_HOST_DEVICE
 bool intersectTwoPermutedTriangles(const Point3& p1,
@@ -118,7 +121,8 @@ bool intersectTwoPermutedTriangles(const Point3& p1,
                                    const Point3& q2,
                                    const Point3& r2,
                                    bool includeBoundary,
-                                   double EPS);
+                                   double EPS,
+                                   bool useExactPredicates);
 
 /*!
  * Project (nearly) coplanar triangles 1 and 2 on an axis; call 2D worker
@@ -166,6 +170,10 @@ bool TriangleIntersection2D(const Triangle2& t1,
  * Coplanar triangles are handled with a decision tree, testing the
  * relative position of triangle vertices.
 
+ * When \a useExactPredicates is true, the side of a triangle's plane on
+ * which each vertex lies is computed with the filtered exact predicate
+ * orient3d() and \a EPS is ignored, so the classification is exact.
+ *
  * Olivier Devillers and Phillipe Guigue, Faster Triangle-Triangle Intersection
  * Tests, RR-4488, INRIA (2002).  https://hal.inria.fr/inria-00072100/
  */
@@ -173,7 +181,8 @@ template <typename T>
 AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
                                             const Triangle<T, 3>& t2,
                                             bool includeBoundary,
-                                            double EPS)
+                                            double EPS,
+                                            bool useExactPredicates = false)
 {
   typedef primal::Vector<T, 3> Vector3;
 
@@ -187,10 +196,22 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
 
   // Vector3 t2Normal = Vector3::cross_product(Vector3(t2[2], t2[0]),
   //                                           Vector3(t2[2], t2[1]));
-  Vector3 t2Normal = t2.normal().unitVector();
-  double dp1 = (Vector3(t2[2], t1[0])).dot(t2Normal);
-  double dq1 = (Vector3(t2[2], t1[1])).dot(t2Normal);
-  double dr1 = (Vector3(t2[2], t1[2])).dot(t2Normal);
+  double dp1, dq1, dr1;
+  if(useExactPredicates)
+  {
+    // orient3d() has the opposite sign of the distance along the normal
+    dp1 = -orient3d(t2[0], t2[1], t2[2], t1[0]);
+    dq1 = -orient3d(t2[0], t2[1], t2[2], t1[1]);
+    dr1 = -orient3d(t2[0], t2[1], t2[2], t1[2]);
+    EPS = 0.;
+  }
+  else
+  {
+    Vector3 t2Normal = t2.normal().unitVector();
+    dp1 = (Vector3(t2[2], t1[0])).dot(t2Normal);
+    dq1 = (Vector3(t2[2], t1[1])).dot(t2Normal);
+    dr1 = (Vector3(t2[2], t1[2])).dot(t2Normal);
+  }
 
   if(nonzeroSignMatch(dp1, dq1, dr1, EPS))
   {
@@ -209,9 +230,19 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
   // Vector3 t1Normal = Vector3::cross_product(Vector3(t1[0], t1[1]),
   //                                           Vector3(t1[0], t1[2]));
   Vector3 t1Normal = t1.normal().unitVector();
-  double dp2 = (Vector3(t1[2], t2[0])).dot(t1Normal);
-  double dq2 = (Vector3(t1[2], t2[1])).dot(t1Normal);
-  double dr2 = (Vector3(t1[2], t2[2])).dot(t1Normal);
+  double dp2, dq2, dr2;
+  if(useExactPredicates)
+  {
+    dp2 = -orient3d(t1[0], t1[1], t1[2], t2[0]);
+    dq2 = -orient3d(t1[0], t1[1], t1[2], t2[1]);
+    dr2 = -orient3d(t1[0], t1[1], t1[2], t2[2]);
+  }
+  else
+  {
+    dp2 = (Vector3(t1[2], t2[0])).dot(t1Normal);
+    dq2 = (Vector3(t1[2], t2[1])).dot(t1Normal);
+    dr2 = (Vector3(t1[2], t2[2])).dot(t1Normal);
+  }
 
   if(nonzeroSignMatch(dp2, dq2, dr2, EPS))
   {
@@ -257,7 +288,8 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
                                           dq2,
                                           t1Normal,
                                           includeBoundary,
-                                          EPS);
+                                          EPS,
+                                          useExactPredicates);
     }
     else if(isGt(dr1, 0.0, EPS))
     {
@@ -272,7 +304,8 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
                                           dq2,
                                           t1Normal,
                                           includeBoundary,
-                                          EPS);
+                                          EPS,
+                                          useExactPredicates);
     }
     else
     {
@@ -287,7 +320,8 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
                                           dr2,
                                           t1Normal,
                                           includeBoundary,
-                                          EPS);
+                                          EPS,
+                                          useExactPredicates);
     }
   }
   else if(isLt(dp1, 0.0, EPS))
@@ -305,7 +339,8 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
                                           dr2,
                                           t1Normal,
                                           includeBoundary,
-                                          EPS);
+                                          EPS,
+                                          useExactPredicates);
     }
     else if(isLt(dr1, 0.0, EPS))
     {
@@ -320,7 +355,8 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
                                           dr2,
                                           t1Normal,
                                           includeBoundary,
-                                          EPS);
+                                          EPS,
+                                          useExactPredicates);
     }
     else
     {
@@ -335,7 +371,8 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
                                           dq2,
                                           t1Normal,
                                           includeBoundary,
-                                          EPS);
+                                          EPS,
+                                          useExactPredicates);
     }
   }
   else  //dp1 ~= 0
@@ -355,7 +392,8 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
                                             dq2,
                                             t1Normal,
                                             includeBoundary,
-                                            EPS);
+                                            EPS,
+                                            useExactPredicates);
       }
       else
       {
@@ -370,7 +408,8 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
                                             dr2,
                                             t1Normal,
                                             includeBoundary,
-                                            EPS);
+                                            EPS,
+                                            useExactPredicates);
       }
     }
     else if(isGt(dq1, 0.0, EPS))
@@ -388,7 +427,8 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
                                             dq2,
                                             t1Normal,
                                             includeBoundary,
-                                            EPS);
+                                            EPS,
+                                            useExactPredicates);
       }
       else
       {
@@ -403,7 +443,8 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
                                             dr2,
                                             t1Normal,
                                             includeBoundary,
-                                            EPS);
+                                            EPS,
+                                            useExactPredicates);
       }
     }
     else
@@ -421,7 +462,8 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
                                             dr2,
                                             t1Normal,
                                             includeBoundary,
-                                            EPS);
+                                            EPS,
+                                            useExactPredicates);
       }
       else if(isLt(dr1, 0.0, EPS))
       {
@@ -436,7 +478,8 @@ AXOM_HOST_DEVICE bool intersect_tri3D_tri3D(const Triangle<T, 3>& t1,
                                             dq2,
                                             t1Normal,
                                             includeBoundary,
-                                            EPS);
+                                            EPS,
+                                            useExactPredicates);
       }
       else
       {
@@ -484,7 +527,8 @@ inline bool intersectTwoPermutedTriangles(const Point3& p1,
                                           const Point3& q2,
                                           const Point3& r2,
                                           bool includeBoundary,
-                                          double EPS)
+                                          double EPS,
+                                          bool useExactPredicates)
 {
   /* Step 5: From step's 1 through 4, we now have two triangles that,
      if intersecting, have a line that intersects segments p1r1, p1q1,
@@ -492,6 +536,14 @@ inline bool intersectTwoPermutedTriangles(const Point3& p1,
    */
   const bool bdr = includeBoundary;
 
+  // orient3d(a, b, c, d) has the opposite sign of the dot product of d - a
+  // with the normal of triangle (a, b, c)
+  if(useExactPredicates)
+  {
+    return isLpeq(-orient3d(q1, p2, p1, q2), 0.0, bdr, 0.) &&
+      isLpeq(-orient3d(p1, p2, r1, r2), 0.0, bdr, 0.);
+  }
+
   return isLpeq(Vector3(q1, q2).dot(Triangle3(q1, p2, p1).normal()), 0.0, bdr, EPS) &&
     isLpeq(Vector3(p1, r2).dot(Triangle3(p1, p2, r1).normal()), 0.0, bdr, EPS);
 }
@@ -558,12 +610,13 @@ inline bool checkVertex(const Point2& p1,
  * positive value indicates CCW orientation.
  *
  * \note The result is equal to twice the signed area of a 2D triangle
- * with vertices (A,B,C) (in CCW order).
+ * with vertices (A,B,C) (in CCW order).  It is computed with the filtered
+ * exact predicate orient2d(), so its sign is exact.
  */
 AXOM_HOST_DEVICE
 inline double twoDcross(const Point2& A, const Point2& B, const Point2& C)
 {
-  return (((A[0] - C[0]) * (B[1] - C[1]) - (A[1] - C[1]) * (B[0] - C[0])));
+  return orient2d(A, B, C);
 }
 
 /*!
@@ -1225,7 +1278,8 @@ inline bool intersectOnePermutedTriangle(const Point3& p1,
                                          double dr2,
                                          Vector3& normal,
                                          bool includeBoundary,
-                                         double EPS)
+                                         double EPS,
+                                         bool useExactPredicates)
 {
   /* Step 4: repeat Step 3, except doing it for triangle 2
      instead of triangle 1 */
@@ -1233,30 +1287,78 @@ inline bool intersectOnePermutedTriangle(const Point3& p1,
   {
     if(isGt(dq2, 0.0, EPS))
     {
-      return intersectTwoPermutedTriangles(p1, r1, q1, r2, p2, q2, includeBoundary, EPS);
+      return intersectTwoPermutedTriangles(p1,
+                                           r1,
+                                           q1,
+                                           r2,
+                                           p2,
+                                           q2,
+                                           includeBoundary,
+                                           EPS,
+                                           useExactPredicates);
     }
     else if(isGt(dr2, 0.0, EPS))
     {
-      return intersectTwoPermutedTriangles(p1, r1, q1, q2, r2, p2, includeBoundary, EPS);
+      return intersectTwoPermutedTriangles(p1,
+                                           r1,
+                                           q1,
+                                           q2,
+                                           r2,
+                                           p2,
+                                           includeBoundary,
+                                           EPS,
+                                           useExactPredicates);
     }
     else
     {
-      return intersectTwoPermutedTriangles(p1, q1, r1, p2, q2, r2, includeBoundary, EPS);
+      return intersectTwoPermutedTriangles(p1,
+                                           q1,
+                                           r1,
+                                           p2,
+                                           q2,
+                                           r2,
+                                           includeBoundary,
+                                           EPS,
+                                           useExactPredicates);
     }
   }
   else if(isLt(dp2, 0.0, EPS))
   {
     if(isLt(dq2, 0.0, EPS))
     {
-      return intersectTwoPermutedTriangles(p1, q1, r1, r2, p2, q2, includeBoundary, EPS);
+      return intersectTwoPermutedTriangles(p1,
+                                           q1,
+                                           r1,
+                                           r2,
+                                           p2,
+                                           q2,
+                                           includeBoundary,
+                                           EPS,
+                                           useExactPredicates);
     }
     else if(isLt(dr2, 0.0, EPS))
     {
-      return intersectTwoPermutedTriangles(p1, q1, r1, q2, r2, p2, includeBoundary, EPS);
+      return intersectTwoPermutedTriangles(p1,
+                                           q1,
+                                           r1,
+                                           q2,
+                                           r2,
+                                           p2,
+                                           includeBoundary,
+                                           EPS,
+                                           useExactPredicates);
     }
     else
     {
-      return intersectTwoPermutedTriangles(p1, r1, q1, p2, q2, r2, includeBoundary, EPS);
+      return intersectTwoPermutedTriangles(p1,
+                                           r1,
+                                           q1,
+                                           p2,
+                                           q2,
+                                           r2,
+                                           includeBoundary,
+                                           EPS,
+                                           useExactPredicates);
     }
   }
   else
@@ -1272,7 +1374,8 @@ inline bool intersectOnePermutedTriangle(const Point3& p1,
                                              r2,
                                              p2,
                                              includeBoundary,
-                                             EPS);
+                                             EPS,
+                                             useExactPredicates);
       }
       else
       {
@@ -1283,7 +1386,8 @@ inline bool intersectOnePermutedTriangle(const Point3& p1,
                                              q2,
                                              r2,
                                              includeBoundary,
-                                             EPS);
+                                             EPS,
+                                             useExactPredicates);
       }
     }
     else if(isGt(dq2, 0.0, EPS))
@@ -1297,7 +1401,8 @@ inline bool intersectOnePermutedTriangle(const Point3& p1,
                                              q2,
                                              r2,
                                              includeBoundary,
-                                             EPS);
+                                             EPS,
+                                             useExactPredicates);
       }
       else
       {
@@ -1308,7 +1413,8 @@ inline bool intersectOnePermutedTriangle(const Point3& p1,
                                              r2,
                                              p2,
                                              includeBoundary,
-                                             EPS);
+                                             EPS,
+                                             useExactPredicates);
       }
     }
     else
@@ -1322,7 +1428,8 @@ inline bool intersectOnePermutedTriangle(const Point3& p1,
                                              p2,
                                              q2,
                                              includeBoundary,
-                                             EPS);
+                                             EPS,
+                                             useExactPredicates);
       }
       else if(isLt(dr2, 0.0, EPS))
       {
@@ -1333,7 +1440,8 @@ inline bool intersectOnePermutedTriangle(const Point3& p1,
                                              p2,
                                              q2,
                                              includeBoundary,
-                                             EPS);
+                                             EPS,
+                                             useExactPredicates);
       }
       else
       {
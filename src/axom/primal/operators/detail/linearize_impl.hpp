@@ -0,0 +1,187 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file linearize_impl.hpp
+ *
+ * \brief Kernels for the adaptive linearization of Bezier curves.
+ *
+ * The kernels operate on raw buffers of homogeneous control points, with
+ * NDIMS+1 values per control point (the coordinates multiplied by the weight,
+ * followed by the weight), so that they can be used for rational and
+ * nonrational curves, and from host or device code.
+ */
+
+#ifndef AXOM_PRIMAL_LINEARIZE_IMPL_HPP_
+#define AXOM_PRIMAL_LINEARIZE_IMPL_HPP_
+
+#include "axom/core/Macros.hpp"
+#include "axom/primal/geometry/Point.hpp"
+
+namespace axom
+{
+namespace primal
+{
+namespace detail
+{
+/// The largest subdivision depth supported by the batched linearization
+constexpr int LINEARIZE_MAX_DEPTH = 24;
+
+/*!
+ * \brief Returns the Euclidean point of the homogeneous control point \a h
+ */
+template <typename T, int NDIMS>
+AXOM_HOST_DEVICE inline Point<T, NDIMS> project_homogeneous(const T* h)
+{
+  Point<T, NDIMS> pt;
+  for(int i = 0; i < NDIMS; ++i)
+  {
+    pt[i] = h[i] / h[NDIMS];
+  }
+  return pt;
+}
+
+/*!
+ * \brief Checks if all control points of a Bezier curve are within a
+ *  distance of the chord between its endpoints
+ *
+ * By the convex hull property, the curve is then also within that distance
+ * of the chord.
+ *
+ * \param [in] h the homogeneous control points
+ * \param [in] ord the order of the curve
+ * \param [in] sqTol the squared distance tolerance
+ */
+template <typename T, int NDIMS>
+AXOM_HOST_DEVICE inline bool is_flat_bezier(const T* h, int ord, double sqTol)
+{
+  constexpr int STRIDE = NDIMS + 1;
+  using PointType = Point<T, NDIMS>;
+
+  const PointType A = project_homogeneous<T, NDIMS>(h);
+  const PointType B = project_homogeneous<T, NDIMS>(h + ord * STRIDE);
+
+  T abab = T(0);
+  for(int i = 0; i < NDIMS; ++i)
+  {
+    abab += (B[i] - A[i]) * (B[i] - A[i]);
+  }
+
+  for(int k = 1; k < ord; ++k)
+  {
+    const PointType P = project_homogeneous<T, NDIMS>(h + k * STRIDE);
+
+    // Closest point to P on the chord, with parameter s in [0, 1]
+    T apab = T(0);
+    for(int i = 0; i < NDIMS; ++i)
+    {
+      apab += (P[i] - A[i]) * (B[i] - A[i]);
+    }
+    T s = (abab > T(0)) ? apab / abab : T(0);
+    s = (s < T(0)) ? T(0) : ((s > T(1)) ? T(1) : s);
+
+    T sqDist = T(0);
+    for(int i = 0; i < NDIMS; ++i)
+    {
+      const T d = P[i] - (A[i] + s * (B[i] - A[i]));
+      sqDist += d * d;
+    }
+    if(sqDist > sqTol)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*!
+ * \brief Splits a Bezier curve at its midpoint with de Casteljau's algorithm
+ *
+ * \param [inout] h the homogeneous control points of the curve; on output,
+ *  the control points of its second half
+ * \param [out] left the homogeneous control points of its first half
+ * \param [in] ord the order of the curve
+ */
+template <typename T, int NDIMS>
+AXOM_HOST_DEVICE inline void split_bezier_half(T* h, T* left, int ord)
+{
+  constexpr int STRIDE = NDIMS + 1;
+
+  for(int i = 0; i < STRIDE; ++i)
+  {
+    left[i] = h[i];
+  }
+  for(int p = 1; p <= ord; ++p)
+  {
+    const int end = ord - p;
+    for(int k = 0; k <= end; ++k)
+    {
+      T* hk = h + k * STRIDE;
+      for(int i = 0; i < STRIDE; ++i)
+      {
+        hk[i] = T(0.5) * (hk[i] + hk[i + STRIDE]);
+      }
+    }
+    for(int i = 0; i < STRIDE; ++i)
+    {
+      left[p * STRIDE + i] = h[i];
+    }
+  }
+}
+
+/*!
+ * \brief Adaptively linearizes a Bezier curve, passing the vertices of the
+ *  resulting polyline in order to \a emit
+ *
+ * The curve is split at its midpoint until its control points are within the
+ * tolerance of the chord, or until the maximum depth is reached. The pieces
+ * are kept on an explicit stack rather than by recursion.
+ *
+ * \param [inout] hcoords a buffer for (maxDepth+1) curves of order \a ord,
+ *  whose first curve holds the homogeneous control points of the input curve
+ * \param [inout] depths a buffer for (maxDepth+1) depths
+ * \param [in] ord the order of the curve
+ * \param [in] sqTol the squared chordal tolerance
+ * \param [in] maxDepth the maximum number of subdivisions of any piece
+ * \param [in] emit a functor taking a Point<T, NDIMS>, called for the first
+ *  point of the curve and for the end point of each piece
+ */
+template <typename T, int NDIMS, typename EmitFunc>
+AXOM_HOST_DEVICE inline void linearize_bezier(T* hcoords,
+                                              int* depths,
+                                              int ord,
+                                              double sqTol,
+                                              int maxDepth,
+                                              EmitFunc&& emit)
+{
+  const int stride = (ord + 1) * (NDIMS + 1);
+
+  emit(project_homogeneous<T, NDIMS>(hcoords));
+
+  int top = 0;
+  depths[0] = 0;
+  while(top >= 0)
+  {
+    T* h = hcoords + top * stride;
+    if(depths[top] >= maxDepth || is_flat_bezier<T, NDIMS>(h, ord, sqTol))
+    {
+      emit(project_homogeneous<T, NDIMS>(h + ord * (NDIMS + 1)));
+      --top;
+    }
+    else
+    {
+      // The first half goes on top of the stack, above the second half
+      split_bezier_half<T, NDIMS>(h, h + stride, ord);
+      depths[top + 1] = ++depths[top];
+      ++top;
+    }
+  }
+}
+
+}  // namespace detail
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_LINEARIZE_IMPL_HPP_
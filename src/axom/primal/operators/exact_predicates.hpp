@@ -0,0 +1,279 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file exact_predicates.hpp
+ *
+ * \brief Consists of filtered exact orientation and in-circle/in-sphere
+ *  predicates.
+ *
+ * Each predicate evaluates its determinant in floating point and compares it
+ * against an error bound.  Only when the bound cannot certify the sign does
+ * it fall back to exact arithmetic, so the common case costs a few extra
+ * floating point operations over the plain determinant.  incircle() and
+ * insphere() try cheaper intermediate stages before their exact evaluation.
+ * The sign of the returned value is always exact; its magnitude
+ * approximates the determinant.  See J. R. Shewchuk, "Adaptive Precision
+ * Floating-Point Arithmetic and Fast Robust Geometric Predicates", Discrete &
+ * Computational Geometry 18:305-363, 1997.
+ *
+ * \note The predicates operate on double precision coordinates; other
+ *  coordinate types are converted to double.
+ *
+ * \note All the predicates can be called in device code.
+ */
+
+#ifndef AXOM_PRIMAL_EXACT_PREDICATES_HPP_
+#define AXOM_PRIMAL_EXACT_PREDICATES_HPP_
+
+#include "axom/core/Macros.hpp"
+
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/operators/detail/exact_predicates_impl.hpp"
+
+namespace axom
+{
+namespace primal
+{
+/*!
+ * \brief Exact orientation of three points in the plane
+ *
+ * \param [in] a the first point
+ * \param [in] b the second point
+ * \param [in] c the third point
+ * \return A positive value if \a a, \a b and \a c are in counterclockwise
+ *  order, a negative value if they are in clockwise order and zero if they
+ *  are collinear.  The value approximates twice the signed area of the
+ *  triangle (a, b, c).
+ */
+template <typename T>
+AXOM_HOST_DEVICE inline double orient2d(const Point<T, 2>& a,
+                                        const Point<T, 2>& b,
+                                        const Point<T, 2>& c)
+{
+  using detail::abs;
+
+  const double pa[2] = {static_cast<double>(a[0]), static_cast<double>(a[1])};
+  const double pb[2] = {static_cast<double>(b[0]), static_cast<double>(b[1])};
+  const double pc[2] = {static_cast<double>(c[0]), static_cast<double>(c[1])};
+
+  const double detLeft = (pa[0] - pc[0]) * (pb[1] - pc[1]);
+  const double detRight = (pa[1] - pc[1]) * (pb[0] - pc[0]);
+  const double det = detLeft - detRight;
+
+  // The floating point result is exact when the two products differ in sign
+  if((detLeft > 0.) ? (detRight <= 0.) : (detLeft < 0. ? detRight >= 0. : true))
+  {
+    return det;
+  }
+
+  const double errBound =
+    detail::ORIENT2D_ERRBOUND * (abs(detLeft) + abs(detRight));
+  if(det >= errBound || -det >= errBound)
+  {
+    return det;
+  }
+
+  return detail::orient2dExact(pa, pb, pc);
+}
+
+/*!
+ * \brief Exact orientation of a point with respect to the plane of three
+ *  other points
+ *
+ * \param [in] a the first point of the plane
+ * \param [in] b the second point of the plane
+ * \param [in] c the third point of the plane
+ * \param [in] d the query point
+ * \return A positive value if \a d lies below the plane through \a a, \a b
+ *  and \a c, a negative value if it lies above the plane and zero if the four
+ *  points are coplanar.  Above is the side from which \a a, \a b and \a c
+ *  appear in counterclockwise order.  The value approximates the determinant
+ *  of the rows \a a - \a d, \a b - \a d and \a c - \a d, which is six times
+ *  the signed volume of the tetrahedron (a, b, c, d) with the opposite sign
+ *  of Tetrahedron::signedVolume().
+ */
+template <typename T>
+AXOM_HOST_DEVICE inline double orient3d(const Point<T, 3>& a,
+                                        const Point<T, 3>& b,
+                                        const Point<T, 3>& c,
+                                        const Point<T, 3>& d)
+{
+  using detail::abs;
+
+  double pa[3], pb[3], pc[3], pd[3];
+  for(int i = 0; i < 3; ++i)
+  {
+    pa[i] = static_cast<double>(a[i]);
+    pb[i] = static_cast<double>(b[i]);
+    pc[i] = static_cast<double>(c[i]);
+    pd[i] = static_cast<double>(d[i]);
+  }
+
+  const double adx = pa[0] - pd[0], ady = pa[1] - pd[1], adz = pa[2] - pd[2];
+  const double bdx = pb[0] - pd[0], bdy = pb[1] - pd[1], bdz = pb[2] - pd[2];
+  const double cdx = pc[0] - pd[0], cdy = pc[1] - pd[1], cdz = pc[2] - pd[2];
+
+  const double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+  const double cdxady = cdx * ady, adxcdy = adx * cdy;
+  const double adxbdy = adx * bdy, bdxady = bdx * ady;
+
+  const double det = adz * (bdxcdy - cdxbdy) + bdz * (cdxady - adxcdy) +
+    cdz * (adxbdy - bdxady);
+
+  const double permanent = (abs(bdxcdy) + abs(cdxbdy)) * abs(adz) +
+    (abs(cdxady) + abs(adxcdy)) * abs(bdz) +
+    (abs(adxbdy) + abs(bdxady)) * abs(cdz);
+  const double errBound = detail::ORIENT3D_ERRBOUND * permanent;
+  if(det > errBound || -det > errBound)
+  {
+    return det;
+  }
+
+  return detail::orient3dExact(pa, pb, pc, pd);
+}
+
+/*!
+ * \brief Exact test of a point against the circle through three points
+ *
+ * \param [in] a the first point on the circle
+ * \param [in] b the second point on the circle
+ * \param [in] c the third point on the circle
+ * \param [in] d the query point
+ * \return When \a a, \a b and \a c are in counterclockwise order (see
+ *  orient2d()), a positive value if \a d lies inside their circumcircle,
+ *  a negative value if it lies outside and zero if the four points are
+ *  cocircular.  The sign is reversed when \a a, \a b and \a c are in
+ *  clockwise order.
+ */
+template <typename T>
+AXOM_HOST_DEVICE inline double incircle(const Point<T, 2>& a,
+                                        const Point<T, 2>& b,
+                                        const Point<T, 2>& c,
+                                        const Point<T, 2>& d)
+{
+  using detail::abs;
+
+  const double pa[2] = {static_cast<double>(a[0]), static_cast<double>(a[1])};
+  const double pb[2] = {static_cast<double>(b[0]), static_cast<double>(b[1])};
+  const double pc[2] = {static_cast<double>(c[0]), static_cast<double>(c[1])};
+  const double pd[2] = {static_cast<double>(d[0]), static_cast<double>(d[1])};
+
+  const double adx = pa[0] - pd[0], ady = pa[1] - pd[1];
+  const double bdx = pb[0] - pd[0], bdy = pb[1] - pd[1];
+  const double cdx = pc[0] - pd[0], cdy = pc[1] - pd[1];
+
+  const double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+  const double cdxady = cdx * ady, adxcdy = adx * cdy;
+  const double adxbdy = adx * bdy, bdxady = bdx * ady;
+
+  const double alift = adx * adx + ady * ady;
+  const double blift = bdx * bdx + bdy * bdy;
+  const double clift = cdx * cdx + cdy * cdy;
+
+  const double det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) +
+    clift * (adxbdy - bdxady);
+
+  const double permanent = (abs(bdxcdy) + abs(cdxbdy)) * alift +
+    (abs(cdxady) + abs(adxcdy)) * blift + (abs(adxbdy) + abs(bdxady)) * clift;
+  const double errBound = detail::INCIRCLE_ERRBOUND * permanent;
+  if(det > errBound || -det > errBound)
+  {
+    return det;
+  }
+
+  return detail::incircleAdapt(pa, pb, pc, pd, permanent);
+}
+
+/*!
+ * \brief Exact test of a point against the sphere through four points
+ *
+ * \param [in] a the first point on the sphere
+ * \param [in] b the second point on the sphere
+ * \param [in] c the third point on the sphere
+ * \param [in] d the fourth point on the sphere
+ * \param [in] e the query point
+ * \return When orient3d(a, b, c, d) is positive, a positive value if \a e
+ *  lies inside the sphere through \a a, \a b, \a c and \a d, a negative
+ *  value if it lies outside and zero if the five points are cospherical.
+ *  The sign is reversed when orient3d(a, b, c, d) is negative.
+ */
+template <typename T>
+AXOM_HOST_DEVICE inline double insphere(const Point<T, 3>& a,
+                                        const Point<T, 3>& b,
+                                        const Point<T, 3>& c,
+                                        const Point<T, 3>& d,
+                                        const Point<T, 3>& e)
+{
+  using detail::abs;
+
+  double pa[3], pb[3], pc[3], pd[3], pe[3];
+  for(int i = 0; i < 3; ++i)
+  {
+    pa[i] = static_cast<double>(a[i]);
+    pb[i] = static_cast<double>(b[i]);
+    pc[i] = static_cast<double>(c[i]);
+    pd[i] = static_cast<double>(d[i]);
+    pe[i] = static_cast<double>(e[i]);
+  }
+
+  const double aex = pa[0] - pe[0], aey = pa[1] - pe[1], aez = pa[2] - pe[2];
+  const double bex = pb[0] - pe[0], bey = pb[1] - pe[1], bez = pb[2] - pe[2];
+  const double cex = pc[0] - pe[0], cey = pc[1] - pe[1], cez = pc[2] - pe[2];
+  const double dex = pd[0] - pe[0], dey = pd[1] - pe[1], dez = pd[2] - pe[2];
+
+  const double aexbey = aex * bey, bexaey = bex * aey;
+  const double bexcey = bex * cey, cexbey = cex * bey;
+  const double cexdey = cex * dey, dexcey = dex * cey;
+  const double dexaey = dex * aey, aexdey = aex * dey;
+  const double aexcey = aex * cey, cexaey = cex * aey;
+  const double bexdey = bex * dey, dexbey = dex * bey;
+
+  const double ab = aexbey - bexaey;
+  const double bc = bexcey - cexbey;
+  const double cd = cexdey - dexcey;
+  const double da = dexaey - aexdey;
+  const double ac = aexcey - cexaey;
+  const double bd = bexdey - dexbey;
+
+  const double abc = aez * bc - bez * ac + cez * ab;
+  const double bcd = bez * cd - cez * bd + dez * bc;
+  const double cda = cez * da + dez * ac + aez * cd;
+  const double dab = dez * ab + aez * bd + bez * da;
+
+  const double alift = aex * aex + aey * aey + aez * aez;
+  const double blift = bex * bex + bey * bey + bez * bez;
+  const double clift = cex * cex + cey * cey + cez * cez;
+  const double dlift = dex * dex + dey * dey + dez * dez;
+
+  const double det = (dlift * abc - clift * dab) + (blift * cda - alift * bcd);
+
+  const double aezp = abs(aez), bezp = abs(bez);
+  const double cezp = abs(cez), dezp = abs(dez);
+  const double abp = abs(aexbey) + abs(bexaey);
+  const double bcp = abs(bexcey) + abs(cexbey);
+  const double cdp = abs(cexdey) + abs(dexcey);
+  const double dap = abs(dexaey) + abs(aexdey);
+  const double acp = abs(aexcey) + abs(cexaey);
+  const double bdp = abs(bexdey) + abs(dexbey);
+
+  const double permanent =
+    (cdp * bezp + bdp * cezp + bcp * dezp) * alift +
+    (dap * cezp + acp * dezp + cdp * aezp) * blift +
+    (abp * dezp + bdp * aezp + dap * bezp) * clift +
+    (bcp * aezp + acp * bezp + abp * cezp) * dlift;
+  const double errBound = detail::INSPHERE_ERRBOUND * permanent;
+  if(det > errBound || -det > errBound)
+  {
+    return det;
+  }
+
+  return detail::insphereAdapt(pa, pb, pc, pd, pe, permanent);
+}
+
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_EXACT_PREDICATES_HPP_
@@ -49,9 +49,9 @@ namespace primal
  *
  * \return boolean value indicating containment.
  */
-template <typename T>
+template <typename T, int MAX_VERTS>
 bool in_polyhedron(const Point<T, 3>& query,
-                   const Polyhedron<T, 3>& poly,
+                   const Polyhedron<T, 3, MAX_VERTS>& poly,
                    bool includeBoundary = false,
                    bool useNonzeroRule = true,
                    double edge_tol = 1e-8,
@@ -48,6 +48,9 @@ namespace primal
  * \param [in] includeBoundary Indicates if boundaries should be considered
  * when detecting intersections (default: false)
  * \param [in] EPS Tolerance for determining intersections (default: 1E-8)
+ * \param [in] useExactPredicates Indicates if the orientation tests should
+ * use the filtered exact predicates of exact_predicates.hpp instead of the
+ * tolerance \a EPS (default: false)
  * \return status true iff t1 intersects with t2, otherwise, false.
  *
  * If parameter \a includeBoundary is false (default), this function will
@@ -58,9 +61,14 @@ template <typename T>
 AXOM_HOST_DEVICE bool intersect(const Triangle<T, 3>& t1,
                                 const Triangle<T, 3>& t2,
                                 bool includeBoundary = false,
-                                double EPS = 1E-08)
+                                double EPS = 1E-08,
+                                bool useExactPredicates = false)
 {
-  return detail::intersect_tri3D_tri3D<T>(t1, t2, includeBoundary, EPS);
+  return detail::intersect_tri3D_tri3D<T>(t1,
+                                          t2,
+                                          includeBoundary,
+                                          EPS,
+                                          useExactPredicates);
 }
 
 /*!
@@ -14,6 +14,7 @@
 #ifndef AXOM_PRIMAL_INTERSECTION_VOLUME_HPP_
 #define AXOM_PRIMAL_INTERSECTION_VOLUME_HPP_
 
+#include "axom/primal/geometry/Hexahedron.hpp"
 #include "axom/primal/geometry/Tetrahedron.hpp"
 #include "axom/primal/geometry/Octahedron.hpp"
 #include "axom/primal/geometry/Polyhedron.hpp"
@@ -161,6 +162,86 @@ AXOM_HOST_DEVICE T intersection_volume(const Tetrahedron<T, 3>& tet,
   return intersection_volume(oct, tet, eps, tryFixOrientation);
 }
 
+/*!
+ * \brief Finds the absolute (unsigned) intersection volume between
+ *        a hexahedron and an octahedron
+ *
+ * \param [in] hex The hexahedron
+ * \param [in] oct The octahedron
+ * \param [in] eps The tolerance for determining the intersection
+ * \param [in] tryFixOrientation If true, takes each shape with a negative
+ *             signed volume and swaps the order of some vertices in that
+ *             shape to try to obtain a nonnegative signed volume.
+ *             Defaults to false.
+ *
+ * \return Intersection volume between the hexahedron and octahedron
+ *
+ * The octahedron is split into four tetrahedra around its diagonal PS, each
+ * of which has two of the octahedron's faces, and the hexahedron is clipped
+ * directly against each of them.  For hexahedra with planar faces, this gives
+ * the volume of decomposing the hexahedron into tetrahedra and clipping the
+ * octahedron against each of them, with far fewer clipping planes.
+ *
+ * \warning tryFixOrientation flag does not guarantee the shapes' vertex orders
+ *          will be valid. It is the responsiblity of the caller to pass
+ *          shapes with a valid vertex order. Otherwise, if the shapes have
+ *          invalid vertex orders, the returned volume may be zero
+ *          and/or unexpected.
+ *
+ * \warning If tryFixOrientation flag is false and some of the shapes have
+ *          a negative signed volume, the returned volume of intersection
+ *          may be zero and/or unexpected.
+ *
+ */
+template <typename T>
+AXOM_HOST_DEVICE T intersection_volume(const Hexahedron<T, 3>& hex,
+                                       const Octahedron<T, 3>& oct,
+                                       double eps = 1.e-10,
+                                       bool tryFixOrientation = false)
+{
+  using TetrahedronType = Tetrahedron<T, 3>;
+
+  // The tetrahedra have the orientation of the octahedron
+  const TetrahedronType tets[4] = {
+    TetrahedronType(oct[0], oct[3], oct[1], oct[2]),
+    TetrahedronType(oct[0], oct[3], oct[2], oct[4]),
+    TetrahedronType(oct[0], oct[3], oct[4], oct[5]),
+    TetrahedronType(oct[0], oct[3], oct[5], oct[1])};
+
+  T volume = 0;
+  for(const TetrahedronType& tet : tets)
+  {
+    volume += clip(hex, tet, eps, tryFixOrientation).volume();
+  }
+  return volume;
+}
+
+/*!
+ * \brief Finds the absolute (unsigned) intersection volume between
+ *        an octahedron and a hexahedron
+ *
+ * \param [in] oct The octahedron
+ * \param [in] hex The hexahedron
+ * \param [in] eps The tolerance for determining the intersection
+ * \param [in] tryFixOrientation If true, takes each shape with a negative
+ *             signed volume and swaps the order of some vertices in that
+ *             shape to try to obtain a nonnegative signed volume.
+ *             Defaults to false.
+ *
+ * \return Intersection volume between the octahedron and hexahedron
+ *
+ * \sa intersection_volume(const Hexahedron<T, 3>&, const Octahedron<T, 3>&,
+ *     double, bool)
+ */
+template <typename T>
+AXOM_HOST_DEVICE T intersection_volume(const Octahedron<T, 3>& oct,
+                                       const Hexahedron<T, 3>& hex,
+                                       double eps = 1.e-10,
+                                       bool tryFixOrientation = false)
+{
+  return intersection_volume(hex, oct, eps, tryFixOrientation);
+}
+
 /*!
  * \brief Finds the absolute (unsigned) intersection volume between
  *        a tetrahedron and another tetrahedron
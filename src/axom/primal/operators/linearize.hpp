@@ -0,0 +1,348 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file linearize.hpp
+ *
+ * \brief Consists of methods to approximate Bezier curves by polylines and
+ *        Bezier patches by triangle meshes, to within a chordal tolerance
+ */
+
+#ifndef AXOM_PRIMAL_LINEARIZE_HPP_
+#define AXOM_PRIMAL_LINEARIZE_HPP_
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/BezierCurve.hpp"
+#include "axom/primal/geometry/BezierPatch.hpp"
+#include "axom/primal/operators/detail/linearize_impl.hpp"
+
+namespace axom
+{
+namespace primal
+{
+/*!
+ * \brief Approximates a Bezier curve by a polyline to within a chordal
+ *  tolerance
+ *
+ * The curve is adaptively split at the midpoints of its pieces until the
+ * control points of each piece are within \a tol of the chord between its
+ * endpoints. By the convex hull property, each piece of the curve is then
+ * within \a tol of its segment of the polyline; this also holds for rational
+ * curves with positive weights.
+ *
+ * \param [in] curve The Bezier curve to linearize
+ * \param [in] tol The chordal tolerance
+ * \param [out] polyline The vertices of the polyline, from the start of the
+ *  curve to its end; its previous contents are replaced
+ * \param [in] maxDepth The maximum number of times a piece is split
+ *
+ * \pre tol > 0 and maxDepth >= 0
+ */
+template <typename T, int NDIMS>
+void linearize(const BezierCurve<T, NDIMS>& curve,
+               double tol,
+               axom::Array<Point<T, NDIMS>>& polyline,
+               int maxDepth = 16)
+{
+  SLIC_ASSERT(tol > 0. && maxDepth >= 0);
+
+  const int ord = curve.getOrder();
+  const int stride = (ord + 1) * (NDIMS + 1);
+  const bool rational = curve.isRational();
+
+  axom::Array<T> hcoords((maxDepth + 1) * stride);
+  axom::Array<int> depths(maxDepth + 1);
+  for(int p = 0; p <= ord; ++p)
+  {
+    const T w = rational ? curve.getWeight(p) : T(1);
+    for(int i = 0; i < NDIMS; ++i)
+    {
+      hcoords[p * (NDIMS + 1) + i] = w * curve[p][i];
+    }
+    hcoords[p * (NDIMS + 1) + NDIMS] = w;
+  }
+
+  polyline.clear();
+  detail::linearize_bezier<T, NDIMS>(hcoords.data(),
+                                     depths.data(),
+                                     ord,
+                                     tol * tol,
+                                     maxDepth,
+                                     [&](const Point<T, NDIMS>& pt) {
+                                       polyline.push_back(pt);
+                                     });
+}
+
+/*!
+ * \brief Approximates an array of Bezier curves by polylines to within a
+ *  chordal tolerance, processing the curves in parallel
+ *
+ * Each curve is linearized as in the single curve version of linearize().
+ * A first pass counts the vertices of each polyline and a second pass
+ * computes them, each in a for_all loop over the curves. The subdivision of
+ * each curve uses fixed size buffers on the stack, so the kernels can run in
+ * any execution space.
+ *
+ * \tparam ExecSpace the execution space for the loops over the curves
+ * \tparam MAX_ORDER the largest supported order of the curves
+ *
+ * \param [in] curves The Bezier curves
+ * \param [in] tol The chordal tolerance
+ * \param [out] offsets The offset of the first vertex of each polyline in
+ *  \a polylines, followed by the total number of vertices; allocated with
+ *  the allocator of the execution space
+ * \param [out] polylines The vertices of all the polylines; allocated with
+ *  the allocator of the execution space
+ * \param [in] maxDepth The maximum number of times a piece is split
+ *
+ * \pre tol > 0 and 0 <= maxDepth <= detail::LINEARIZE_MAX_DEPTH
+ * \pre The order of each curve is at most MAX_ORDER
+ */
+template <typename ExecSpace, int MAX_ORDER = 7, typename T, int NDIMS>
+void linearize(const axom::Array<BezierCurve<T, NDIMS>>& curves,
+               double tol,
+               axom::Array<IndexType>& offsets,
+               axom::Array<Point<T, NDIMS>>& polylines,
+               int maxDepth = 16)
+{
+  using PointType = Point<T, NDIMS>;
+  constexpr int STRIDE = (MAX_ORDER + 1) * (NDIMS + 1);
+  constexpr int MAX_DEPTH = detail::LINEARIZE_MAX_DEPTH;
+
+  SLIC_ASSERT(tol > 0.);
+  SLIC_ERROR_IF(maxDepth < 0 || maxDepth > MAX_DEPTH,
+                "linearize: maxDepth must be between 0 and " << MAX_DEPTH);
+
+  const int hostAllocID = axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+  const int allocID = axom::execution_space<ExecSpace>::allocatorID();
+  const IndexType numCurves = curves.size();
+
+  // Gather the homogeneous control points of the curves
+  const IndexType numCoords = numCurves * STRIDE;
+  axom::Array<T> hcoordsHost(numCoords, numCoords, hostAllocID);
+  axom::Array<int> ordersHost(numCurves, numCurves, hostAllocID);
+  for(IndexType c = 0; c < numCurves; ++c)
+  {
+    const auto& curve = curves[c];
+    const int ord = curve.getOrder();
+    SLIC_ERROR_IF(ord > MAX_ORDER,
+                  "linearize: curve " << c << " has order " << ord
+                                      << ", larger than " << MAX_ORDER);
+    ordersHost[c] = ord;
+    for(int p = 0; p <= ord; ++p)
+    {
+      const T w = curve.isRational() ? curve.getWeight(p) : T(1);
+      T* h = hcoordsHost.data() + c * STRIDE + p * (NDIMS + 1);
+      for(int i = 0; i < NDIMS; ++i)
+      {
+        h[i] = w * curve[p][i];
+      }
+      h[NDIMS] = w;
+    }
+  }
+  const axom::Array<T> hcoords(hcoordsHost, allocID);
+  const axom::Array<int> orders(ordersHost, allocID);
+  const auto hcoords_v = hcoords.view();
+  const auto orders_v = orders.view();
+  const double sqTol = tol * tol;
+
+  // Count the vertices of each polyline
+  axom::Array<IndexType> counts(numCurves, numCurves, allocID);
+  const auto counts_v = counts.view();
+  axom::for_all<ExecSpace>(
+    numCurves,
+    AXOM_LAMBDA(IndexType c) {
+      T buffer[(MAX_DEPTH + 1) * STRIDE];
+      int depths[MAX_DEPTH + 1];
+      for(int k = 0; k < STRIDE; ++k)
+      {
+        buffer[k] = hcoords_v[c * STRIDE + k];
+      }
+
+      IndexType count = 0;
+      detail::linearize_bezier<T, NDIMS>(buffer,
+                                         depths,
+                                         orders_v[c],
+                                         sqTol,
+                                         maxDepth,
+                                         [&](const PointType&) { ++count; });
+      counts_v[c] = count;
+    });
+
+  // Compute the offsets on the host
+  axom::Array<IndexType> countsHost(counts, hostAllocID);
+  axom::Array<IndexType> offsetsHost(numCurves + 1, numCurves + 1, hostAllocID);
+  offsetsHost[0] = 0;
+  for(IndexType c = 0; c < numCurves; ++c)
+  {
+    offsetsHost[c + 1] = offsetsHost[c] + countsHost[c];
+  }
+  const IndexType total = offsetsHost[numCurves];
+
+  offsets = axom::Array<IndexType>(offsetsHost, allocID);
+  polylines = axom::Array<PointType>(total, total, allocID);
+  const auto offsets_v = offsets.view();
+  const auto polylines_v = polylines.view();
+
+  // Compute the vertices of each polyline
+  axom::for_all<ExecSpace>(
+    numCurves,
+    AXOM_LAMBDA(IndexType c) {
+      T buffer[(MAX_DEPTH + 1) * STRIDE];
+      int depths[MAX_DEPTH + 1];
+      for(int k = 0; k < STRIDE; ++k)
+      {
+        buffer[k] = hcoords_v[c * STRIDE + k];
+      }
+
+      IndexType idx = offsets_v[c];
+      detail::linearize_bezier<T, NDIMS>(
+        buffer,
+        depths,
+        orders_v[c],
+        sqTol,
+        maxDepth,
+        [&](const PointType& pt) { polylines_v[idx++] = pt; });
+    });
+}
+
+/*!
+ * \brief Approximates a Bezier patch by a triangle mesh to within a chordal
+ *  tolerance
+ *
+ * The patch is sampled on a regular grid of parameters, whose resolution in
+ * each direction is the smallest that satisfies the bound of Filip et al.
+ * on the distance between a surface and its piecewise linear interpolant,
+ *
+ *   (M_uu h_u^2 + 2 M_uv h_u h_v + M_vv h_v^2) / 8 <= tol,
+ *
+ * where h_u and h_v are the grid spacings and the M's bound the second
+ * derivatives of the patch, computed from the second differences of its
+ * control points. The grid points are evaluated with the batched
+ * BezierPatch::evaluate() and each grid cell is split into two triangles.
+ *
+ * \param [in] patch The Bezier patch to linearize
+ * \param [in] tol The chordal tolerance
+ * \param [out] vertices The vertices of the triangle mesh; the vertex of the
+ *  grid point (i, j) along (u, v) has index i * (numV + 1) + j
+ * \param [out] connectivity The three vertex indices of each triangle, which
+ *  are oriented like the normal of the patch
+ * \param [in] maxSegments The maximum number of grid cells in each direction
+ *
+ * \note For rational patches, the derivative bounds are computed from the
+ *  control points without their weights, so the tolerance is approximate.
+ *
+ * \pre tol > 0 and maxSegments >= 1
+ *
+ * \see D. Filip, R. Magedson and R. Markot, "Surface algorithms using bounds
+ *  on derivatives", Computer Aided Geometric Design 3 (1986), 295--311.
+ */
+template <typename T, int NDIMS>
+void linearize(const BezierPatch<T, NDIMS>& patch,
+               double tol,
+               axom::Array<Point<T, NDIMS>>& vertices,
+               axom::Array<IndexType>& connectivity,
+               int maxSegments = 256)
+{
+  using VectorType = Vector<T, NDIMS>;
+
+  SLIC_ASSERT(tol > 0. && maxSegments >= 1);
+
+  const int ord_u = patch.getOrder_u();
+  const int ord_v = patch.getOrder_v();
+
+  // Bound the second derivatives of the patch
+  double M_uu = 0., M_vv = 0., M_uv = 0.;
+  for(int p = 0; p <= ord_u; ++p)
+  {
+    for(int q = 0; q <= ord_v; ++q)
+    {
+      if(p + 2 <= ord_u)
+      {
+        const auto d = patch(p + 2, q).array() - 2. * patch(p + 1, q).array() +
+          patch(p, q).array();
+        M_uu = utilities::max(M_uu, static_cast<double>(VectorType(d).norm()));
+      }
+      if(q + 2 <= ord_v)
+      {
+        const auto d = patch(p, q + 2).array() - 2. * patch(p, q + 1).array() +
+          patch(p, q).array();
+        M_vv = utilities::max(M_vv, static_cast<double>(VectorType(d).norm()));
+      }
+      if(p + 1 <= ord_u && q + 1 <= ord_v)
+      {
+        const auto d = patch(p + 1, q + 1).array() - patch(p + 1, q).array() -
+          patch(p, q + 1).array() + patch(p, q).array();
+        M_uv = utilities::max(M_uv, static_cast<double>(VectorType(d).norm()));
+      }
+    }
+  }
+  M_uu *= ord_u * (ord_u - 1);
+  M_vv *= ord_v * (ord_v - 1);
+  M_uv *= ord_u * ord_v;
+
+  // Refine the direction with the larger error term until within tolerance
+  int numU = 1, numV = 1;
+  auto errorBound = [&](int nu, int nv) {
+    return (M_uu / (nu * nu) + 2. * M_uv / (nu * nv) + M_vv / (nv * nv)) / 8.;
+  };
+  while(errorBound(numU, numV) > tol &&
+        (numU < maxSegments || numV < maxSegments))
+  {
+    const double err_u = M_uu / (numU * numU);
+    const double err_v = M_vv / (numV * numV);
+    const bool refineU = (numV >= maxSegments) ||
+      (numU < maxSegments &&
+       (err_u > err_v || (err_u == err_v && numU <= numV)));
+    if(refineU)
+    {
+      ++numU;
+    }
+    else
+    {
+      ++numV;
+    }
+  }
+
+  // Evaluate the patch on the grid
+  const IndexType numVerts = (numU + 1) * (numV + 1);
+  axom::Array<T> us(numVerts), vs(numVerts);
+  for(int i = 0; i <= numU; ++i)
+  {
+    for(int j = 0; j <= numV; ++j)
+    {
+      us[i * (numV + 1) + j] = static_cast<T>(i) / numU;
+      vs[i * (numV + 1) + j] = static_cast<T>(j) / numV;
+    }
+  }
+  vertices.resize(numVerts);
+  patch.evaluate(us.view(), vs.view(), vertices.view());
+
+  // Split each grid cell into two triangles
+  connectivity.resize(6 * numU * numV);
+  IndexType idx = 0;
+  for(int i = 0; i < numU; ++i)
+  {
+    for(int j = 0; j < numV; ++j)
+    {
+      const IndexType v00 = i * (numV + 1) + j;
+      const IndexType v10 = v00 + numV + 1;
+      connectivity[idx++] = v00;
+      connectivity[idx++] = v10;
+      connectivity[idx++] = v10 + 1;
+      connectivity[idx++] = v00;
+      connectivity[idx++] = v10 + 1;
+      connectivity[idx++] = v00 + 1;
+    }
+  }
+}
+
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_LINEARIZE_HPP_
@@ -187,6 +187,68 @@ inline double squared_distance(const Point<T, NDIMS>& P,
   return squared_distance(P, cpt);
 }
 
+/*!
+ * \brief Computes the minimum squared distances from a query point, P, to a
+ *  batch of triangles stored as a structure of arrays.
+ *
+ * \param [in] P the query point
+ * \param [in] tris the triangles, whose vertex coordinates are stored in
+ *  separate arrays (see ZipIndexable)
+ * \param [in] ntris the number of triangles in \a tris
+ * \param [out] sqDists array of at least \a ntris squared distances
+ * \param [out] locs array of at least \a ntris locations of the closest
+ *  points (optional), encoded as in closest_point()
+ * \param [in] EPS tolerance used to classify the closest points
+ *
+ * \tparam LANES the number of triangles processed together, one of 4, 8
+ *  or 16
+ *
+ * \note The results agree with calling squared_distance() on each triangle,
+ *  up to rounding.
+ * \see closest_point()
+ */
+template <int LANES = 8, typename T, int NDIMS>
+AXOM_HOST_DEVICE inline void squared_distance(
+  const Point<T, NDIMS>& P,
+  const ZipIndexable<Triangle<T, NDIMS>>& tris,
+  IndexType ntris,
+  double* sqDists,
+  int* locs = nullptr,
+  double EPS = 1E-8)
+{
+  detail::TriangleLanes<T, NDIMS, LANES> lanes;
+  T cp[NDIMS][LANES];
+  int loc[LANES];
+
+  for(IndexType first = 0; first < ntris; first += LANES)
+  {
+    const int n =
+      static_cast<int>(ntris - first < LANES ? ntris - first : LANES);
+    detail::gatherTriangleLanes(tris, first, n, lanes);
+    detail::closestPointLanes(P, lanes, cp, loc, EPS);
+
+    double dist[LANES];
+    for(int l = 0; l < LANES; ++l)
+    {
+      dist[l] = 0.;
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        const double diff = cp[d][l] - P[d];
+        dist[l] += diff * diff;
+      }
+    }
+
+    for(int l = 0; l < n; ++l)
+    {
+      sqDists[first + l] = dist[l];
+      if(locs != nullptr)
+      {
+        locs[first + l] = loc[l];
+      }
+    }
+  }
+}
+
 }  // namespace primal
 }  // namespace axom
 
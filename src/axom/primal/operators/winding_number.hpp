@@ -414,9 +414,9 @@ double winding_number(const Point<T, 3>& q,
  *
  * \return int The integer winding number.
  */
-template <typename T>
+template <typename T, int MAX_VERTS>
 int winding_number(const Point<T, 3>& query,
-                   const Polyhedron<T, 3>& poly,
+                   const Polyhedron<T, 3, MAX_VERTS>& poly,
                    bool includeBoundary = false,
                    double edge_tol = 1e-8,
                    double EPS = 1e-8)
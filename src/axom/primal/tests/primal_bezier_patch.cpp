@@ -618,6 +618,59 @@ TEST(primal_bezierpatch, rational_evaluation)
   }
 }
 
+//------------------------------------------------------------------------------
+TEST(primal_bezierpatch, evaluate_array)
+{
+  const int DIM = 3;
+  using CoordType = double;
+  using PointType = primal::Point<CoordType, DIM>;
+  using BezierPatchType = primal::BezierPatch<CoordType, DIM>;
+
+  const int order_u = 3;
+  const int order_v = 4;
+
+  // clang-format off
+  PointType controlPoints[(order_u + 1) * (order_v + 1)] = {
+                  PointType {0, 0, 0}, PointType{0, 4,  0}, PointType{0, 8, -3}, PointType{0, 12, 1}, PointType{0, 16, 3},
+                  PointType {2, 0, 6}, PointType{2, 4,  5}, PointType{2, 8,  0}, PointType{4, 12, 2}, PointType{2, 16, 2},
+                  PointType {4, 0, 0}, PointType{4, 4,  5}, PointType{4, 8,  3}, PointType{2, 12, 3}, PointType{4, 16, 1},
+                  PointType {6, 0, 0}, PointType{6, 4, -3}, PointType{6, 8,  0}, PointType{6, 12, 2}, PointType{6, 16, 0}};
+
+  double weights[(order_u + 1) * (order_v + 1)] = {
+                  1.0, 1.0, 1.0, 1.0, 1.0,
+                  1.0, 2.0, 3.0, 2.0, 1.0,
+                  1.0, 2.0, 3.0, 2.0, 1.0,
+                  1.0, 1.0, 1.0, 1.0, 1.0};
+  // clang-format on
+
+  const int N = 7;
+  axom::Array<CoordType> us(N * N), vs(N * N);
+  for(int j = 0; j < N * N; ++j)
+  {
+    us[j] = (j / N) / (N - 1.);
+    vs[j] = (j % N) / (N - 1.);
+  }
+
+  BezierPatchType patches[2] = {
+    BezierPatchType(controlPoints, order_u, order_v),
+    BezierPatchType(controlPoints, weights, order_u, order_v)};
+
+  for(const auto& patch : patches)
+  {
+    axom::Array<PointType> pts(N * N);
+    patch.evaluate(us.view(), vs.view(), pts.view());
+
+    for(int j = 0; j < N * N; ++j)
+    {
+      const PointType expected = patch.evaluate(us[j], vs[j]);
+      for(int i = 0; i < DIM; ++i)
+      {
+        EXPECT_NEAR(expected[i], pts[j][i], 1e-13);
+      }
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 TEST(primal_bezierpatch, rational_first_derivatives)
 {
@@ -21,6 +21,7 @@
 #include "axom/primal/operators/intersection_volume.hpp"
 #include "axom/primal/operators/split.hpp"
 
+#include <cmath>
 #include <limits>
 
 namespace Primal3D
@@ -293,8 +294,11 @@ void unit_check_poly_clip()
   PolyhedronType* out_square = axom::allocate<PolyhedronType>(1);
   out_square[0] = square;
 
-  unsigned int* out_clipped = axom::allocate<unsigned int>(1);
-  out_clipped[0] = 0;
+  bool* out_clipped = axom::allocate<bool>(PolyhedronType::MAX_VERTS);
+  for(int i = 0; i < PolyhedronType::MAX_VERTS; i++)
+  {
+    out_clipped[i] = false;
+  }
 
   axom::for_all<ExecPolicy>(
     0,
@@ -303,7 +307,7 @@ void unit_check_poly_clip()
       axom::primal::detail::poly_clip_vertices(out_square[0],
                                                plane,
                                                EPS,
-                                               out_clipped[0]);
+                                               out_clipped);
     });
 
   const PolyhedronType& clippedSquare = out_square[0];
@@ -333,7 +337,10 @@ void unit_check_poly_clip()
   EXPECT_NE(hi_idx, -1);
 
   // Check that vertices outside the plane were marked as clipped
-  EXPECT_EQ(out_clipped[0], (1 | (1 << 3)));
+  for(int i = 0; i < 6; i++)
+  {
+    EXPECT_EQ(out_clipped[i], i == 0 || i == 3);
+  }
 
   // Generate sets of expected neighbors
   std::vector<std::set<int>> expectedNbrs(6);
@@ -1078,6 +1085,203 @@ TEST(primal_clip, oct_tet_clip_special_case_2)
               EPS);
 }
 
+namespace
+{
+// Sums the volumes of clipping a shape against the 24 tetrahedra of a hex
+template <typename ShapeType>
+double decomposed_intersection_volume(Primal3D::HexahedronType hex,
+                                      const ShapeType& shape,
+                                      double eps)
+{
+  using namespace Primal3D;
+  axom::StackArray<TetrahedronType, HexahedronType::NUM_TRIANGULATE> tets;
+  hex.triangulate(tets);
+
+  double volume = 0.;
+  for(int i = 0; i < HexahedronType::NUM_TRIANGULATE; ++i)
+  {
+    volume += axom::primal::clip(shape, tets[i], eps, true).volume();
+  }
+  return volume;
+}
+
+}  // namespace
+
+// Octahedron does not clip hexahedron.
+TEST(primal_clip, hex_oct_clip_nonintersect)
+{
+  using namespace Primal3D;
+
+  OctahedronType oct(PointType {3, 0, 0},
+                     PointType {2, 1, 0},
+                     PointType {2, 0, 1},
+                     PointType {1, 0, 0},
+                     PointType {2, -1, 0},
+                     PointType {2, 0, -1});
+  HexahedronType hex(PointType {-1, 0, 0},
+                     PointType {0, 0, 0},
+                     PointType {0, 1, 0},
+                     PointType {-1, 1, 0},
+                     PointType {-1, 0, 1},
+                     PointType {0, 0, 1},
+                     PointType {0, 1, 1},
+                     PointType {-1, 1, 1});
+
+  EXPECT_EQ(0.0, axom::primal::intersection_volume<double>(hex, oct));
+  EXPECT_EQ(0.0, axom::primal::intersection_volume<double>(oct, hex));
+}
+
+// Octahedron is encapsulated by the hexahedron, and vice versa
+TEST(primal_clip, hex_oct_clip_encapsulate)
+{
+  using namespace Primal3D;
+  constexpr double EPS = 1e-12;
+
+  // Regular octahedron with volume 4/3
+  OctahedronType oct(PointType {1, 0, 0},
+                     PointType {0, 1, 0},
+                     PointType {0, 0, 1},
+                     PointType {-1, 0, 0},
+                     PointType {0, -1, 0},
+                     PointType {0, 0, -1});
+  const double octVolume =
+    PolyhedronType::from_primitive(oct, true).volume();
+  EXPECT_NEAR(4. / 3., octVolume, EPS);
+
+  auto cube = [](double c, double h) {
+    return HexahedronType(PointType {c - h, c - h, c - h},
+                          PointType {c + h, c - h, c - h},
+                          PointType {c + h, c + h, c - h},
+                          PointType {c - h, c + h, c - h},
+                          PointType {c - h, c - h, c + h},
+                          PointType {c + h, c - h, c + h},
+                          PointType {c + h, c + h, c + h},
+                          PointType {c - h, c + h, c + h});
+  };
+
+  const HexahedronType outer = cube(0., 2.);
+  EXPECT_NEAR(octVolume,
+              axom::primal::intersection_volume<double>(outer, oct, EPS, true),
+              EPS);
+
+  // The cube [-0.25, 0.25]^3 is inside the octahedron
+  const HexahedronType inner = cube(0., .25);
+  EXPECT_NEAR(inner.volume(),
+              axom::primal::intersection_volume<double>(oct, inner, EPS, true),
+              EPS);
+
+  // The cube [0, 1]^3 contains one eighth of the octahedron
+  const HexahedronType corner = cube(.5, .5);
+  EXPECT_NEAR(octVolume / 8.,
+              axom::primal::intersection_volume<double>(corner, oct, EPS, true),
+              EPS);
+}
+
+// Direct clipping matches clipping the 24 tetrahedra of the hexahedron
+TEST(primal_clip, hex_clip_matches_decomposition)
+{
+  using namespace Primal3D;
+  constexpr double EPS = 1e-10;
+
+  // A rotated, stretched box and a frustum, which have planar faces
+  const double c = std::cos(.3), s = std::sin(.3);
+  auto rotate = [=](double x, double y, double z) {
+    return PointType {c * x - s * y, s * x + c * y, z};
+  };
+  const HexahedronType hexes[2] = {
+    HexahedronType(rotate(0, 0, 0),
+                   rotate(1.5, 0, 0),
+                   rotate(1.5, 1, 0),
+                   rotate(0, 1, 0),
+                   rotate(0, 0, .75),
+                   rotate(1.5, 0, .75),
+                   rotate(1.5, 1, .75),
+                   rotate(0, 1, .75)),
+    HexahedronType(PointType {0, 0, 0},
+                   PointType {1.2, 0, 0},
+                   PointType {1.2, 1.2, 0},
+                   PointType {0, 1.2, 0},
+                   PointType {.3, .3, .8},
+                   PointType {.9, .3, .8},
+                   PointType {.9, .9, .8},
+                   PointType {.3, .9, .8})};
+
+  // Octahedra and tetrahedra of various sizes around the hexahedra
+  for(const HexahedronType& hex : hexes)
+  {
+    EXPECT_TRUE(hex.hasPlanarFaces());
+    for(int i = 0; i < 27; ++i)
+    {
+      const PointType ctr {.5 * (i % 3), .5 * ((i / 3) % 3), .4 * (i / 9)};
+      const double r = .3 + .1 * (i % 4);
+      const OctahedronType oct(PointType {ctr[0] + r, ctr[1], ctr[2]},
+                               PointType {ctr[0], ctr[1] + r, ctr[2]},
+                               PointType {ctr[0], ctr[1], ctr[2] + .5 * r},
+                               PointType {ctr[0] - r, ctr[1], ctr[2]},
+                               PointType {ctr[0], ctr[1] - .7 * r, ctr[2]},
+                               PointType {ctr[0], ctr[1], ctr[2] - r});
+      const TetrahedronType tet(PointType {ctr[0] - r, ctr[1] - r, ctr[2]},
+                                PointType {ctr[0] + r, ctr[1] - r, ctr[2]},
+                                PointType {ctr[0], ctr[1] + r, ctr[2] - r},
+                                PointType {ctr[0], ctr[1], ctr[2] + r});
+
+      EXPECT_NEAR(decomposed_intersection_volume(hex, oct, EPS),
+                  axom::primal::intersection_volume(hex, oct, EPS, true),
+                  EPS);
+      EXPECT_NEAR(decomposed_intersection_volume(hex, tet, EPS),
+                  axom::primal::intersection_volume(hex, tet, EPS, true),
+                  EPS);
+    }
+  }
+}
+
+TEST(primal_clip, hex_clip_many_planes)
+{
+  using namespace Primal3D;
+  constexpr double EPS = 1e-10;
+
+  const HexahedronType hex(PointType {-1, -1, -1},
+                           PointType {1, -1, -1},
+                           PointType {1, 1, -1},
+                           PointType {-1, 1, -1},
+                           PointType {-1, -1, 1},
+                           PointType {1, -1, 1},
+                           PointType {1, 1, 1},
+                           PointType {-1, 1, 1});
+
+  // Cut the cube down to a regular prism with many sides, whose number of
+  // vertices exceeds the default capacity of a Polyhedron
+  const int NUM_SIDES = 20;
+  const double R = .9;
+  const double apothem = R * std::cos(M_PI / NUM_SIDES);
+
+  axom::Array<PlaneType> planes;
+  for(int k = 0; k < NUM_SIDES; ++k)
+  {
+    const double theta = 2 * M_PI * k / NUM_SIDES;
+    const VectorType inward {-std::cos(theta), -std::sin(theta), 0};
+    planes.push_back(PlaneType(inward, -apothem));
+  }
+
+  const auto poly = axom::primal::clip<64>(hex, planes.view(), EPS);
+  EXPECT_EQ(2 * NUM_SIDES, poly.numVertices());
+  EXPECT_TRUE(poly.hasNeighbors());
+  for(int i = 0; i < poly.numVertices(); ++i)
+  {
+    EXPECT_EQ(3, poly.getNumNeighbors(i));
+  }
+
+  const double area = .5 * NUM_SIDES * R * R * std::sin(2 * M_PI / NUM_SIDES);
+  EXPECT_NEAR(2 * area, poly.volume(), EPS);
+
+  // Also cut off the top and bottom faces
+  planes.push_back(PlaneType(VectorType {0, 0, -1}, -.5));
+  planes.push_back(PlaneType(VectorType {0, 0, 1}, -.5));
+  const auto poly2 = axom::primal::clip<64>(hex, planes.view(), EPS);
+  EXPECT_EQ(2 * NUM_SIDES, poly2.numVertices());
+  EXPECT_NEAR(area, poly2.volume(), EPS);
+}
+
 // Tetrahedron does not clip tetrahedron.
 TEST(primal_clip, tet_tet_clip_nonintersect)
 {
@@ -5,6 +5,8 @@
 
 #include <limits>
 #include <algorithm>
+#include <set>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "axom/primal.hpp"
@@ -130,6 +132,73 @@ TEST(primal_closest_point, obb_test_closest_point_edge)
   EXPECT_TRUE((found - expected).squared_norm() < EPS);
 }
 
+//------------------------------------------------------------------------------
+TEST(primal_closest_point, segment_point_2D)
+{
+  constexpr int DIM = 2;
+  using QPoint = primal::Point<double, DIM>;
+  using QSegment = primal::Segment<double, DIM>;
+
+  constexpr double EPS = 1e-12;
+
+  QSegment seg(QPoint {1., 1.}, QPoint {3., 1.});
+  double t = -1.;
+
+  // projects onto the interior
+  QPoint cp = primal::closest_point(QPoint {1.5, 4.}, seg, &t);
+  EXPECT_NEAR(1.5, cp[0], EPS);
+  EXPECT_NEAR(1., cp[1], EPS);
+  EXPECT_NEAR(0.25, t, EPS);
+
+  // before the source
+  cp = primal::closest_point(QPoint {-2., -1.}, seg, &t);
+  EXPECT_EQ(seg.source(), cp);
+  EXPECT_EQ(0., t);
+
+  // past the target
+  cp = primal::closest_point(QPoint {5., 2.}, seg, &t);
+  EXPECT_EQ(seg.target(), cp);
+  EXPECT_EQ(1., t);
+
+  // on the segment
+  cp = primal::closest_point(QPoint {2.5, 1.}, seg);
+  EXPECT_NEAR(2.5, cp[0], EPS);
+  EXPECT_NEAR(1., cp[1], EPS);
+
+  // degenerate segment
+  QSegment degenerate(QPoint {1., 1.}, QPoint {1., 1.});
+  cp = primal::closest_point(QPoint {4., 5.}, degenerate, &t);
+  EXPECT_EQ(degenerate.source(), cp);
+  EXPECT_EQ(0., t);
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_closest_point, segment_point_3D)
+{
+  constexpr int DIM = 3;
+  using QPoint = primal::Point<double, DIM>;
+  using QSegment = primal::Segment<double, DIM>;
+
+  constexpr double EPS = 1e-12;
+
+  QSegment seg(QPoint {0., 0., 0.}, QPoint {2., 2., 2.});
+  for(double s : {-0.5, 0., 0.3, 0.5, 0.9, 1., 1.7})
+  {
+    // offset a point on the segment's line along a perpendicular direction
+    const QPoint onLine = QPoint {2. * s, 2. * s, 2. * s};
+    const QPoint query = QPoint {onLine[0] + 1., onLine[1] - 1., onLine[2]};
+
+    double t = -1.;
+    const QPoint cp = primal::closest_point(query, seg, &t);
+    const double expT = axom::utilities::clampVal(s, 0., 1.);
+    EXPECT_NEAR(expT, t, EPS);
+    EXPECT_NEAR(0., primal::squared_distance(seg.at(expT), cp), EPS);
+    EXPECT_NEAR(primal::squared_distance(query, seg),
+                primal::squared_distance(query, cp),
+                EPS);
+  }
+}
+
 //------------------------------------------------------------------------------
 TEST(primal_closest_point, sphere_point_2D)
 {
@@ -263,4 +332,81 @@ TEST(primal_closest_point, sphere_point_3D)
       }
     }
   }
-}
\ No newline at end of file
+}
+
+//------------------------------------------------------------------------------
+template <int LANES, int DIM>
+void check_batched_triangles()
+{
+  using QPoint = primal::Point<double, DIM>;
+  using QTriangle = primal::Triangle<double, DIM>;
+  using ZipTriangle = primal::ZipIndexable<QTriangle>;
+
+  // A number of triangles that is not a multiple of the lane count
+  constexpr int NUM_TRIS = 37;
+  constexpr int NUM_QUERIES = 50;
+
+  std::vector<double> coords[3][DIM];
+  for(int v = 0; v < 3; ++v)
+  {
+    for(int d = 0; d < DIM; ++d)
+    {
+      for(int i = 0; i < NUM_TRIS; ++i)
+      {
+        coords[v][d].push_back(axom::utilities::random_real(-1., 1.));
+      }
+    }
+  }
+
+  const double* a[DIM];
+  const double* b[DIM];
+  const double* c[DIM];
+  for(int d = 0; d < DIM; ++d)
+  {
+    a[d] = coords[0][d].data();
+    b[d] = coords[1][d].data();
+    c[d] = coords[2][d].data();
+  }
+  ZipTriangle tris {a, b, c};
+
+  std::vector<QPoint> cps(NUM_TRIS);
+  std::vector<int> locs(NUM_TRIS);
+  std::set<int> foundLocs;
+
+  for(int q = 0; q < NUM_QUERIES; ++q)
+  {
+    QPoint P;
+    for(int d = 0; d < DIM; ++d)
+    {
+      P[d] = axom::utilities::random_real(-2., 2.);
+    }
+
+    primal::closest_point<LANES>(P, tris, NUM_TRIS, cps.data(), locs.data());
+
+    for(int i = 0; i < NUM_TRIS; ++i)
+    {
+      int loc;
+      const QPoint expected = primal::closest_point(P, tris[i], &loc);
+      EXPECT_EQ(loc, locs[i]);
+      for(int d = 0; d < DIM; ++d)
+      {
+        EXPECT_NEAR(expected[d], cps[i][d], 1e-12);
+      }
+      foundLocs.insert(loc);
+    }
+  }
+
+  // The queries should cover each vertex, edge and face region
+  EXPECT_EQ(7, foundLocs.size());
+}
+
+TEST(primal_closest_point, batched_triangles)
+{
+  check_batched_triangles<4, 2>();
+  check_batched_triangles<8, 2>();
+  check_batched_triangles<16, 2>();
+
+  check_batched_triangles<4, 3>();
+  check_batched_triangles<8, 3>();
+  check_batched_triangles<16, 3>();
+}
@@ -0,0 +1,533 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "gtest/gtest.h"
+
+#include "axom/config.hpp"
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Triangle.hpp"
+#include "axom/primal/geometry/Tetrahedron.hpp"
+#include "axom/primal/operators/exact_predicates.hpp"
+#include "axom/primal/operators/in_sphere.hpp"
+#include "axom/primal/operators/intersect.hpp"
+
+#include <cmath>
+
+namespace primal = axom::primal;
+
+namespace
+{
+int sign(double val) { return (val > 0.) ? 1 : ((val < 0.) ? -1 : 0); }
+
+/// Returns \a val moved by \a steps units in the last place
+double ulpShift(double val, int steps)
+{
+  const double dir = (steps > 0) ? HUGE_VAL : -HUGE_VAL;
+  for(int i = 0; i < std::abs(steps); ++i)
+  {
+    val = std::nextafter(val, dir);
+  }
+  return val;
+}
+}  // namespace
+
+//------------------------------------------------------------------------------
+TEST(primal_exact_predicates, orient2d_simple)
+{
+  using PointType = primal::Point<double, 2>;
+
+  PointType a {0., 0.};
+  PointType b {1., 0.};
+  PointType c {0., 1.};
+
+  EXPECT_DOUBLE_EQ(1., primal::orient2d(a, b, c));
+  EXPECT_DOUBLE_EQ(-1., primal::orient2d(a, c, b));
+  EXPECT_EQ(0., primal::orient2d(a, b, PointType {2., 0.}));
+
+  // Integer coordinates are converted to double
+  primal::Point<int, 2> ia {0, 0};
+  primal::Point<int, 2> ib {2, 0};
+  primal::Point<int, 2> ic {0, 2};
+  EXPECT_DOUBLE_EQ(4., primal::orient2d(ia, ib, ic));
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_exact_predicates, orient2d_near_collinear)
+{
+  using PointType = primal::Point<double, 2>;
+
+  // Points near the line y = x, a few units in the last place apart; the
+  // floating point determinant gets many of these signs wrong
+  const PointType b {12., 12.};
+  const PointType c {24., 24.};
+
+  const int N = 16;
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      const PointType a {ulpShift(0.5, i), ulpShift(0.5, j)};
+      EXPECT_EQ(sign(j - i), sign(primal::orient2d(a, b, c)))
+        << "i: " << i << " j: " << j;
+      EXPECT_EQ(sign(i - j), sign(primal::orient2d(b, a, c)))
+        << "i: " << i << " j: " << j;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_exact_predicates, orient3d_simple)
+{
+  using PointType = primal::Point<double, 3>;
+  using TetrahedronType = primal::Tetrahedron<double, 3>;
+
+  PointType a {0., 0., 0.};
+  PointType b {1., 0., 0.};
+  PointType c {0., 1., 0.};
+
+  PointType above {0.25, 0.25, 1.};
+  PointType below {0.25, 0.25, -1.};
+  PointType on {3., -7., 0.};
+
+  EXPECT_LT(primal::orient3d(a, b, c, above), 0.);
+  EXPECT_GT(primal::orient3d(a, b, c, below), 0.);
+  EXPECT_EQ(0., primal::orient3d(a, b, c, on));
+
+  // orient3d() has the opposite sign of Tetrahedron::signedVolume()
+  for(const auto& d : {above, below})
+  {
+    TetrahedronType tet(a, b, c, d);
+    EXPECT_DOUBLE_EQ(-6. * tet.signedVolume(), primal::orient3d(a, b, c, d));
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_exact_predicates, orient3d_near_coplanar)
+{
+  using PointType = primal::Point<double, 3>;
+
+  // The plane through a, b and c contains the line x = y in the z = 0 plane
+  const PointType a {12., 12., 0.};
+  const PointType b {24., 24., 0.};
+  const PointType c {1., 1., 1.};
+
+  const PointType side {0., 1., 0.};
+  const int expectedSide = sign(primal::orient3d(a, b, c, side));
+  ASSERT_NE(0, expectedSide);
+
+  const int N = 16;
+  for(int i = 0; i < N; ++i)
+  {
+    for(int j = 0; j < N; ++j)
+    {
+      const PointType d {ulpShift(0.5, i), ulpShift(0.5, j), 0.};
+      EXPECT_EQ(sign(j - i) * expectedSide, sign(primal::orient3d(a, b, c, d)))
+        << "i: " << i << " j: " << j;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_exact_predicates, incircle)
+{
+  using PointType = primal::Point<double, 2>;
+
+  // Cocircular points on the circle of radius 5, translated so that the
+  // floating point determinant suffers from cancellation
+  const double off = 1 << 20;
+  const PointType a {off + 5., off + 0.};
+  const PointType b {off + 3., off + 4.};
+  const PointType c {off + 0., off + 5.};
+  const PointType d {off - 4., off + 3.};
+
+  ASSERT_GT(primal::orient2d(a, b, c), 0.);
+  EXPECT_EQ(0., primal::incircle(a, b, c, d));
+  EXPECT_EQ(0., primal::incircle(b, c, d, a));
+
+  // Move the fourth point outward and inward by a unit in the last place
+  const PointType dOut {ulpShift(off - 4., -1), off + 3.};
+  const PointType dIn {ulpShift(off - 4., 1), off + 3.};
+  EXPECT_LT(primal::incircle(a, b, c, dOut), 0.);
+  EXPECT_GT(primal::incircle(a, b, c, dIn), 0.);
+
+  // The sign flips for clockwise triangles
+  EXPECT_GT(primal::incircle(a, c, b, dOut), 0.);
+  EXPECT_LT(primal::incircle(a, c, b, dIn), 0.);
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_exact_predicates, insphere)
+{
+  using PointType = primal::Point<double, 3>;
+
+  // Cospherical points on the sphere of radius 3, translated so that the
+  // floating point determinant suffers from cancellation
+  const double off = 1 << 20;
+  const PointType a {off + 3., off + 0., off + 0.};
+  const PointType b {off + 0., off + 3., off + 0.};
+  const PointType c {off + 0., off + 0., off + 3.};
+  const PointType d {off + 2., off - 2., off + 1.};
+  const PointType e {off - 1., off + 2., off + 2.};
+
+  const double orient = primal::orient3d(a, b, c, d);
+  ASSERT_NE(0., orient);
+  EXPECT_EQ(0., primal::insphere(a, b, c, d, e));
+  EXPECT_EQ(0., primal::insphere(e, a, b, c, d));
+
+  // Move the fifth point outward and inward by a unit in the last place
+  const PointType eOut {ulpShift(off - 1., -1), off + 2., off + 2.};
+  const PointType eIn {ulpShift(off - 1., 1), off + 2., off + 2.};
+  EXPECT_LT(sign(primal::insphere(a, b, c, d, eOut)) * sign(orient), 0);
+  EXPECT_GT(sign(primal::insphere(a, b, c, d, eIn)) * sign(orient), 0);
+  EXPECT_GT(sign(primal::insphere(b, a, c, d, eOut)) * sign(orient), 0);
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_exact_predicates, fixed_point_arithmetic)
+{
+  namespace detail = primal::detail;
+
+  // Doubles over a wide range of exponents, including subnormals
+  auto randomDouble = []() {
+    const double mantissa = axom::utilities::random_real(-1., 1.);
+    const int exponent = static_cast<int>(
+      std::floor(axom::utilities::random_real(-1070., 500.)));
+    return std::ldexp(mantissa, exponent);
+  };
+
+  // The roundoff of a sum or product is a double, so subtracting the
+  // rounded result from the fixed point result must recover it exactly
+  const int NUM_TESTS = 1000;
+  for(int i = 0; i < NUM_TESTS; ++i)
+  {
+    const double a = randomDouble();
+    const double b = (i % 2 == 0) ? randomDouble() : std::ldexp(a, 20) / 3.;
+
+    detail::FixedPoint fa, fb, fx, h, tail;
+    detail::setFixed(a, fa);
+    detail::setFixed(b, fb);
+    EXPECT_EQ(a, fa.estimate());
+
+    double x, y;
+    detail::twoSum(a, b, x, y);
+    detail::sum(fa, fb, h);
+    detail::setFixed(x, fx);
+    detail::difference(h, fx, tail);
+    EXPECT_EQ(y, tail.estimate());
+    EXPECT_EQ(x, h.estimate());
+
+    detail::twoSum(a, -b, x, y);
+    detail::difference(fa, fb, h);
+    detail::setFixed(x, fx);
+    detail::difference(h, fx, tail);
+    EXPECT_EQ(y, tail.estimate());
+
+    // Keep the product within the range of double
+    const double c = std::ldexp(axom::utilities::random_real(-1., 1.), 300);
+    const double d = std::ldexp(axom::utilities::random_real(-1., 1.), -700);
+    detail::FixedPoint fc, fd;
+    detail::setFixed(c, fc);
+    detail::setFixed(d, fd);
+    detail::twoProduct(c, d, x, y);
+    detail::product(fc, fd, h);
+    detail::setFixed(x, fx);
+    detail::difference(h, fx, tail);
+    EXPECT_EQ(y, tail.estimate());
+    EXPECT_EQ(x, h.estimate());
+  }
+
+  detail::FixedPoint zero, one;
+  detail::setFixed(1., one);
+  detail::difference(one, one, zero);
+  EXPECT_TRUE(zero.isZero());
+  EXPECT_EQ(0., zero.estimate());
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_exact_predicates, exact_stages_agree)
+{
+  namespace detail = primal::detail;
+  using Point2 = primal::Point<double, 2>;
+  using Point3 = primal::Point<double, 3>;
+
+  // Points on a small integer grid are often cocircular or cospherical, and
+  // their determinants are exact in 64-bit integers
+  auto gridCoord = []() {
+    return std::floor(axom::utilities::random_real(-4., 4.));
+  };
+  auto isign = [](long long val) {
+    return (val > 0) ? 1 : ((val < 0) ? -1 : 0);
+  };
+
+  const int NUM_TESTS = 1000;
+  int numZeros = 0;
+  for(int i = 0; i < NUM_TESTS; ++i)
+  {
+    double pts[4][2];
+    long long d[3][2];
+    for(int j = 0; j < 4; ++j)
+    {
+      pts[j][0] = gridCoord();
+      pts[j][1] = gridCoord();
+    }
+    for(int j = 0; j < 3; ++j)
+    {
+      d[j][0] = static_cast<long long>(pts[j][0] - pts[3][0]);
+      d[j][1] = static_cast<long long>(pts[j][1] - pts[3][1]);
+    }
+
+    long long expected = 0;
+    for(int j = 0; j < 3; ++j)
+    {
+      const int k = (j + 1) % 3, l = (j + 2) % 3;
+      expected += (d[j][0] * d[j][0] + d[j][1] * d[j][1]) *
+        (d[k][0] * d[l][1] - d[l][0] * d[k][1]);
+    }
+
+    const Point2 a(pts[0], 2), b(pts[1], 2), c(pts[2], 2), q(pts[3], 2);
+    EXPECT_EQ(isign(expected),
+              sign(detail::incircleExact(pts[0], pts[1], pts[2], pts[3])));
+    EXPECT_EQ(isign(expected), sign(primal::incircle(a, b, c, q)));
+    numZeros += (expected == 0) ? 1 : 0;
+  }
+
+  for(int i = 0; i < NUM_TESTS; ++i)
+  {
+    double pts[5][3];
+    long long d[4][3];
+    for(int j = 0; j < 5; ++j)
+    {
+      for(int k = 0; k < 3; ++k)
+      {
+        pts[j][k] = gridCoord();
+      }
+    }
+    for(int j = 0; j < 4; ++j)
+    {
+      for(int k = 0; k < 3; ++k)
+      {
+        d[j][k] = static_cast<long long>(pts[j][k] - pts[4][k]);
+      }
+    }
+
+    // Cofactor expansion along the lifted column
+    long long expected = 0;
+    for(int j = 0; j < 4; ++j)
+    {
+      long long m[3][3];
+      for(int r = 0, row = 0; r < 4; ++r)
+      {
+        if(r != j)
+        {
+          for(int k = 0; k < 3; ++k)
+          {
+            m[row][k] = d[r][k];
+          }
+          ++row;
+        }
+      }
+      const long long minor =
+        m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+        m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+        m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+      const long long lift =
+        d[j][0] * d[j][0] + d[j][1] * d[j][1] + d[j][2] * d[j][2];
+      expected += ((j % 2 == 0) ? -1 : 1) * lift * minor;
+    }
+
+    const Point3 a(pts[0], 3), b(pts[1], 3), c(pts[2], 3), e(pts[3], 3);
+    const Point3 q(pts[4], 3);
+    EXPECT_EQ(
+      isign(expected),
+      sign(detail::insphereExact(pts[0], pts[1], pts[2], pts[3], pts[4])));
+    EXPECT_EQ(isign(expected), sign(primal::insphere(a, b, c, e, q)));
+    numZeros += (expected == 0) ? 1 : 0;
+  }
+  EXPECT_GT(numZeros, 0);
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_exact_predicates, adaptive_stages)
+{
+  namespace detail = primal::detail;
+  using Point2 = primal::Point<double, 2>;
+  using Point3 = primal::Point<double, 3>;
+
+  // Query points within a few ulps of a circle or sphere of radius R around
+  // the origin, whose coordinate differences to the points on it are not
+  // exact doubles.  The adaptive stages must agree with the exact evaluation.
+  const double R = std::ldexp(1., 60);
+  const double tiny = 1e-3;
+
+  const Point2 a2 {R, 0.}, b2 {0., R}, c2 {-R, 0.};
+  const Point3 a3 {R, 0., 0.}, b3 {0., R, 0.}, c3 {0., 0., R};
+  const Point3 d3 {-R, 0., 0.};
+
+  const int NUM_TESTS = 200;
+  for(int i = 0; i < NUM_TESTS; ++i)
+  {
+    const double x = axom::utilities::random_real(-1e3, 1e3);
+    const double y = axom::utilities::random_real(-1e3, 1e3);
+    const double onCircle = std::sqrt(R * R - x * x);
+    const double onSphere = std::sqrt(R * R - x * x - y * y);
+
+    for(int steps = -2; steps <= 2; ++steps)
+    {
+      const Point2 q2 {x, -ulpShift(onCircle, steps)};
+      EXPECT_EQ(sign(detail::incircleExact(a2.data(),
+                                           b2.data(),
+                                           c2.data(),
+                                           q2.data())),
+                sign(primal::incircle(a2, b2, c2, q2)));
+
+      const Point3 q3 {x, y, -ulpShift(onSphere, steps)};
+      EXPECT_EQ(sign(detail::insphereExact(a3.data(),
+                                           b3.data(),
+                                           c3.data(),
+                                           d3.data(),
+                                           q3.data())),
+                sign(primal::insphere(a3, b3, c3, d3, q3)));
+    }
+  }
+
+  // Repeated points make the determinants exactly zero, which only the
+  // exact evaluation can certify when the differences are inexact
+  const Point2 q2 {tiny, tiny};
+  const Point3 q3 {tiny, tiny, tiny};
+  EXPECT_EQ(0., primal::incircle(a2, a2, c2, q2));
+  EXPECT_EQ(0., primal::insphere(a3, a3, c3, d3, q3));
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_exact_predicates, inexact_differences)
+{
+  namespace detail = primal::detail;
+
+  // Points far from the origin, together with query points near it, have
+  // coordinate differences that are not exact doubles
+  const double R = std::ldexp(1., 60);
+  const double tiny = 1e-3;
+  detail::Expansion<2> diff;
+  detail::setDifference(R, tiny, diff);
+  ASSERT_EQ(2, diff.size);
+
+  // Circle of radius R around the origin, in counterclockwise order
+  const double a2[2] = {R, 0.}, b2[2] = {0., R}, c2[2] = {-R, 0.};
+  const double in2[2] = {tiny, tiny}, out2[2] = {tiny, 2. * R};
+  EXPECT_GT(detail::incircleExact(a2, b2, c2, in2), 0.);
+  EXPECT_LT(detail::incircleExact(a2, b2, c2, out2), 0.);
+  EXPECT_EQ(0., detail::incircleExact(a2, a2, c2, in2));
+
+  // Sphere of radius R around the origin
+  const double a3[3] = {R, 0., 0.}, b3[3] = {0., R, 0.};
+  const double c3[3] = {0., 0., R}, d3[3] = {-R, 0., 0.};
+  const double in3[3] = {tiny, tiny, tiny}, out3[3] = {tiny, tiny, 2. * R};
+  const int orient = sign(detail::orient3dExact(a3, b3, c3, d3));
+  ASSERT_NE(0, orient);
+  EXPECT_GT(sign(detail::insphereExact(a3, b3, c3, d3, in3)) * orient, 0);
+  EXPECT_LT(sign(detail::insphereExact(a3, b3, c3, d3, out3)) * orient, 0);
+  EXPECT_EQ(0., detail::insphereExact(a3, a3, c3, d3, in3));
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_exact_predicates, agrees_with_in_sphere)
+{
+  using Point2 = primal::Point<double, 2>;
+  using Point3 = primal::Point<double, 3>;
+
+  auto rand2 = []() {
+    return Point2 {axom::utilities::random_real(-1., 1.),
+                   axom::utilities::random_real(-1., 1.)};
+  };
+  auto rand3 = []() {
+    return Point3 {axom::utilities::random_real(-1., 1.),
+                   axom::utilities::random_real(-1., 1.),
+                   axom::utilities::random_real(-1., 1.)};
+  };
+
+  const int NUM_TESTS = 1000;
+  for(int i = 0; i < NUM_TESTS; ++i)
+  {
+    const Point2 p0 = rand2(), p1 = rand2(), p2 = rand2(), q = rand2();
+    const bool inside =
+      primal::incircle(p0, p1, p2, q) * primal::orient2d(p0, p1, p2) > 0.;
+    const bool ccw = primal::orient2d(p0, p1, p2) > 0.;
+    EXPECT_EQ(ccw ? primal::in_sphere(q, p0, p1, p2, 0.)
+                  : primal::in_sphere(q, p0, p2, p1, 0.),
+              inside);
+  }
+
+  for(int i = 0; i < NUM_TESTS; ++i)
+  {
+    const Point3 p0 = rand3(), p1 = rand3(), p2 = rand3(), p3 = rand3();
+    const Point3 q = rand3();
+    const bool inside = primal::insphere(p0, p1, p2, p3, q) *
+        primal::orient3d(p0, p1, p2, p3) >
+      0.;
+    const bool positive = primal::orient3d(p0, p1, p2, p3) < 0.;
+    EXPECT_EQ(positive ? primal::in_sphere(q, p0, p1, p2, p3, 0.)
+                       : primal::in_sphere(q, p0, p2, p1, p3, 0.),
+              inside);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_exact_predicates, triangle_intersection)
+{
+  using PointType = primal::Point<double, 3>;
+  using TriangleType = primal::Triangle<double, 3>;
+
+  const TriangleType t1(PointType {0., 0., 0.},
+                        PointType {1., 0., 0.},
+                        PointType {0., 1., 0.});
+
+  // The exact predicates agree with the default test on well separated
+  // and clearly crossing triangles
+  {
+    const TriangleType t2(PointType {0.2, 0.2, -1.},
+                          PointType {0.3, 0.2, 1.},
+                          PointType {0.2, 0.3, 1.});
+    EXPECT_TRUE(primal::intersect(t1, t2));
+    EXPECT_TRUE(primal::intersect(t1, t2, false, 1e-8, true));
+
+    const TriangleType t3(PointType {0.2, 0.2, 1.},
+                          PointType {0.3, 0.2, 2.},
+                          PointType {0.2, 0.3, 2.});
+    EXPECT_FALSE(primal::intersect(t1, t3));
+    EXPECT_FALSE(primal::intersect(t1, t3, false, 1e-8, true));
+  }
+
+  // A triangle hovering just above t1 is within the default tolerance, but
+  // the exact predicates see that it does not touch t1
+  {
+    const double tiny = 1e-12;
+    const TriangleType t2(PointType {0.2, 0.2, tiny},
+                          PointType {0.3, 0.2, 1.},
+                          PointType {0.2, 0.3, 1.});
+    EXPECT_TRUE(primal::intersect(t1, t2, true));
+    EXPECT_FALSE(primal::intersect(t1, t2, true, 1e-8, true));
+
+    // ... while a vertex exactly on t1 touches it
+    const TriangleType t3(PointType {0.2, 0.2, 0.},
+                          PointType {0.3, 0.2, 1.},
+                          PointType {0.2, 0.3, 1.});
+    EXPECT_TRUE(primal::intersect(t1, t3, true, 1e-8, true));
+  }
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  axom::slic::SimpleLogger logger(axom::slic::message::Info);
+
+  int result = RUN_ALL_TESTS();
+  return result;
+}
@@ -283,6 +283,42 @@ TEST_F(HexahedronTest, volume)
   EXPECT_DOUBLE_EQ(hex6.volume(), signed_volume_tet_decomp(hex6));
 }
 
+TEST_F(HexahedronTest, planarFaces)
+{
+  using QPoint = HexahedronTest::QPoint;
+  using QHex = HexahedronTest::Hex;
+
+  const QPoint* pt0 = this->qData0;
+  const QPoint* pt2 = this->qData2;
+  const QPoint* pt3 = this->qData3;
+
+  // Cubes, frustums and boxes have planar faces
+  QHex hex0(pt0[0], pt0[1], pt0[2], pt0[3], pt0[4], pt0[5], pt0[6], pt0[7]);
+  QHex hex2(pt2[0], pt2[1], pt2[2], pt2[3], pt2[4], pt2[5], pt2[6], pt2[7]);
+  QHex hex3(pt3[0], pt3[1], pt3[2], pt3[3], pt3[4], pt3[5], pt3[6], pt3[7]);
+  EXPECT_TRUE(hex0.hasPlanarFaces());
+  EXPECT_TRUE(hex2.hasPlanarFaces());
+  EXPECT_TRUE(hex3.hasPlanarFaces());
+
+  // Moving one vertex of a cube off its three faces makes them non-planar
+  const QPoint non_planar_pt {-0.5, -0.5, -0.5};
+  QHex hex4(non_planar_pt, pt0[1], pt0[2], pt0[3], pt0[4], pt0[5], pt0[6], pt0[7]);
+  EXPECT_FALSE(hex4.hasPlanarFaces());
+
+  // ... unless it is moved within the tolerance
+  const QPoint nearly_planar_pt {1e-12, 0, 0};
+  QHex hex5(nearly_planar_pt,
+            pt0[1],
+            pt0[2],
+            pt0[3],
+            pt0[4],
+            pt0[5],
+            pt0[6],
+            pt0[7]);
+  EXPECT_TRUE(hex5.hasPlanarFaces());
+  EXPECT_FALSE(hex5.hasPlanarFaces(1e-14));
+}
+
 TEST_F(HexahedronTest, equals)
 {
   using QPoint = HexahedronTest::QPoint;
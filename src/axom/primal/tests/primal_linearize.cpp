@@ -0,0 +1,307 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file primal_linearize.cpp
+ * \brief This file tests the linearization of Bezier curves and patches
+ */
+
+#include "gtest/gtest.h"
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Segment.hpp"
+#include "axom/primal/geometry/Triangle.hpp"
+#include "axom/primal/geometry/BezierCurve.hpp"
+#include "axom/primal/geometry/BezierPatch.hpp"
+#include "axom/primal/operators/linearize.hpp"
+#include "axom/primal/operators/squared_distance.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace primal = axom::primal;
+
+namespace
+{
+/// Returns the distance from \a pt to the closest segment of \a polyline
+template <typename T, int NDIMS>
+double distance_to_polyline(const primal::Point<T, NDIMS>& pt,
+                            const primal::Point<T, NDIMS>* polyline,
+                            int numVerts)
+{
+  using SegmentType = primal::Segment<T, NDIMS>;
+
+  double minSqDist = std::numeric_limits<double>::max();
+  for(int k = 0; k + 1 < numVerts; ++k)
+  {
+    const SegmentType seg(polyline[k], polyline[k + 1]);
+    minSqDist =
+      axom::utilities::min(minSqDist, primal::squared_distance(pt, seg));
+  }
+  return std::sqrt(minSqDist);
+}
+
+/// Checks that the batched linearization matches the single curve version
+template <typename ExecSpace>
+void check_batched_linearize(double tol)
+{
+  const int DIM = 2;
+  using CoordType = double;
+  using PointType = primal::Point<CoordType, DIM>;
+  using BezierCurveType = primal::BezierCurve<CoordType, DIM>;
+
+  const int hostAllocID = axom::execution_space<axom::SEQ_EXEC>::allocatorID();
+
+  const int numCurves = 20;
+  axom::Array<BezierCurveType> curves(numCurves);
+  for(int c = 0; c < numCurves; ++c)
+  {
+    const int ord = c % 5;
+    BezierCurveType& curve = curves[c];
+    curve.setOrder(ord);
+    for(int p = 0; p <= ord; ++p)
+    {
+      curve[p] = PointType {std::cos(0.7 * c + p), std::sin(1.3 * c - 2 * p)};
+    }
+    if(c % 2 == 1)
+    {
+      curve.makeRational();
+      for(int p = 0; p <= ord; ++p)
+      {
+        curve.setWeight(p, 1. + 0.25 * ((c + p) % 3));
+      }
+    }
+  }
+
+  axom::Array<axom::IndexType> offsets;
+  axom::Array<PointType> polylines;
+  primal::linearize<ExecSpace>(curves, tol, offsets, polylines);
+
+  const axom::Array<axom::IndexType> offsetsHost(offsets, hostAllocID);
+  const axom::Array<PointType> polylinesHost(polylines, hostAllocID);
+  ASSERT_EQ(numCurves + 1, offsetsHost.size());
+  EXPECT_EQ(polylinesHost.size(), offsetsHost[numCurves]);
+
+  for(int c = 0; c < numCurves; ++c)
+  {
+    axom::Array<PointType> expected;
+    primal::linearize(curves[c], tol, expected);
+
+    ASSERT_EQ(expected.size(), offsetsHost[c + 1] - offsetsHost[c]);
+    for(int k = 0; k < expected.size(); ++k)
+    {
+      const PointType& pt = polylinesHost[offsetsHost[c] + k];
+      for(int i = 0; i < DIM; ++i)
+      {
+        EXPECT_DOUBLE_EQ(expected[k][i], pt[i]);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+TEST(primal_linearize, bezier_curve)
+{
+  const int DIM = 3;
+  using CoordType = double;
+  using PointType = primal::Point<CoordType, DIM>;
+  using BezierCurveType = primal::BezierCurve<CoordType, DIM>;
+
+  const int ord = 3;
+  PointType data[ord + 1] = {PointType {0.6, 1.2, 1.0},
+                             PointType {1.3, 1.6, 1.8},
+                             PointType {2.9, 2.4, 2.3},
+                             PointType {3.2, 3.5, 3.0}};
+  BezierCurveType curve(data, ord);
+
+  for(double tol : {1e-1, 1e-2, 1e-4})
+  {
+    axom::Array<PointType> polyline;
+    primal::linearize(curve, tol, polyline);
+
+    const int numVerts = polyline.size();
+    ASSERT_GE(numVerts, 2);
+    EXPECT_EQ(curve[0], polyline[0]);
+    EXPECT_EQ(curve[ord], polyline[numVerts - 1]);
+
+    // The curve is within the tolerance of the polyline
+    const int NUM_SAMPLES = 101;
+    for(int s = 0; s < NUM_SAMPLES; ++s)
+    {
+      const PointType pt = curve.evaluate(s / (NUM_SAMPLES - 1.));
+      EXPECT_LE(distance_to_polyline(pt, polyline.data(), numVerts), tol);
+    }
+  }
+
+  // A linear curve gives a single segment
+  {
+    BezierCurveType line(data, 1);
+    axom::Array<PointType> polyline;
+    primal::linearize(line, 1e-8, polyline);
+    EXPECT_EQ(2, polyline.size());
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_linearize, rational_quarter_circle)
+{
+  const int DIM = 2;
+  using CoordType = double;
+  using PointType = primal::Point<CoordType, DIM>;
+  using VectorType = primal::Vector<CoordType, DIM>;
+  using BezierCurveType = primal::BezierCurve<CoordType, DIM>;
+
+  PointType data[3] = {PointType {1., 0.},
+                       PointType {1., 1.},
+                       PointType {0., 1.}};
+  double weights[3] = {1., std::sqrt(2.) / 2., 1.};
+  BezierCurveType quarterCircle(data, weights, 2);
+
+  for(double tol : {1e-2, 1e-3, 1e-5})
+  {
+    axom::Array<PointType> polyline;
+    primal::linearize(quarterCircle, tol, polyline);
+
+    // The vertices are on the circle and the segments within the tolerance
+    const int numVerts = polyline.size();
+    ASSERT_GE(numVerts, 3);
+    for(int k = 0; k < numVerts; ++k)
+    {
+      EXPECT_NEAR(1., VectorType(polyline[k]).norm(), 1e-12);
+    }
+    for(int k = 0; k + 1 < numVerts; ++k)
+    {
+      const PointType mid = PointType::midpoint(polyline[k], polyline[k + 1]);
+      EXPECT_LE(1. - VectorType(mid).norm(), tol);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_linearize, batched_bezier_curves)
+{
+  check_batched_linearize<axom::SEQ_EXEC>(1e-3);
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+  check_batched_linearize<axom::OMP_EXEC>(1e-3);
+#endif
+}
+
+//------------------------------------------------------------------------------
+TEST(primal_linearize, bezier_patch)
+{
+  const int DIM = 3;
+  using CoordType = double;
+  using PointType = primal::Point<CoordType, DIM>;
+  using TriangleType = primal::Triangle<CoordType, DIM>;
+  using BezierPatchType = primal::BezierPatch<CoordType, DIM>;
+
+  // A bilinear patch of a plane needs a single grid cell
+  {
+    PointType controlPoints[4] = {PointType {0, 0, 0},
+                                  PointType {0, 1, 0},
+                                  PointType {2, 0, 0},
+                                  PointType {2, 1, 0}};
+    BezierPatchType patch(controlPoints, 1, 1);
+
+    axom::Array<PointType> vertices;
+    axom::Array<axom::IndexType> connectivity;
+    primal::linearize(patch, 1e-8, vertices, connectivity);
+    EXPECT_EQ(4, vertices.size());
+    EXPECT_EQ(6, connectivity.size());
+
+    // The triangles are oriented like the patch
+    for(int t = 0; t < 2; ++t)
+    {
+      const TriangleType tri(vertices[connectivity[3 * t]],
+                             vertices[connectivity[3 * t + 1]],
+                             vertices[connectivity[3 * t + 2]]);
+      const auto normal = tri.normal();
+      const auto patchNormal = patch.normal(0.5, 0.5);
+      EXPECT_GT(normal.dot(patchNormal), 0.);
+    }
+  }
+
+  // A curved patch is within the tolerance of its piecewise linear interpolant
+  {
+    const int order_u = 3;
+    const int order_v = 2;
+
+    // clang-format off
+    PointType controlPoints[(order_u + 1) * (order_v + 1)] = {
+                    PointType {0, 0, 0}, PointType{0, 4,  2}, PointType{0, 8, -1},
+                    PointType {2, 0, 3}, PointType{2, 4,  1}, PointType{2, 8,  0},
+                    PointType {4, 0, 0}, PointType{4, 4, -2}, PointType{4, 8,  3},
+                    PointType {6, 0, 1}, PointType{6, 4,  0}, PointType{6, 8,  0}};
+    // clang-format on
+    BezierPatchType patch(controlPoints, order_u, order_v);
+
+    for(double tol : {1e-1, 1e-2})
+    {
+      axom::Array<PointType> vertices;
+      axom::Array<axom::IndexType> connectivity;
+      primal::linearize(patch, tol, vertices, connectivity);
+
+      ASSERT_EQ(0, connectivity.size() % 6);
+      const int numCells = connectivity.size() / 6;
+
+      // Recover the grid resolution from the first row of cells
+      int numV = 0;
+      while(numV < numCells && connectivity[6 * numV] == numV)
+      {
+        ++numV;
+      }
+      ASSERT_GT(numV, 0);
+      ASSERT_EQ(0, numCells % numV);
+      const int numU = numCells / numV;
+      EXPECT_EQ((numU + 1) * (numV + 1), vertices.size());
+
+      // Compare the patch to the interpolating triangle at random parameters
+      for(int s = 0; s < 200; ++s)
+      {
+        const double u = axom::utilities::random_real(0., 1.);
+        const double v = axom::utilities::random_real(0., 1.);
+        const int i =
+          axom::utilities::min(static_cast<int>(u * numU), numU - 1);
+        const int j =
+          axom::utilities::min(static_cast<int>(v * numV), numV - 1);
+        const double a = u * numU - i;
+        const double b = v * numV - j;
+
+        const PointType& p00 = vertices[i * (numV + 1) + j];
+        const PointType& p10 = vertices[(i + 1) * (numV + 1) + j];
+        const PointType& p01 = vertices[i * (numV + 1) + j + 1];
+        const PointType& p11 = vertices[(i + 1) * (numV + 1) + j + 1];
+
+        PointType interp;
+        for(int d = 0; d < DIM; ++d)
+        {
+          interp[d] = (a >= b)
+            ? p00[d] + a * (p10[d] - p00[d]) + b * (p11[d] - p10[d])
+            : p00[d] + b * (p01[d] - p00[d]) + a * (p11[d] - p01[d]);
+        }
+
+        const PointType expected = patch.evaluate(u, v);
+        EXPECT_LE(std::sqrt(primal::squared_distance(expected, interp)), tol);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  axom::slic::SimpleLogger logger;
+
+  int result = RUN_ALL_TESTS();
+
+  return result;
+}
@@ -772,6 +772,70 @@ TEST(primal_polyhedron, polyhedron_from_primitive)
   EXPECT_NEAR(2.6666, poly.signedVolume(), EPS);
 }
 
+//------------------------------------------------------------------------------
+TEST(primal_polyhedron, polyhedron_large_capacity)
+{
+  constexpr int MAX_VERTS = 512;
+  using Polyhedron3D = primal::Polyhedron<double, 3, MAX_VERTS>;
+  using Point3D = primal::Point<double, 3>;
+
+  // Vertex indices no longer fit in 8 bits
+  EXPECT_EQ(sizeof(std::int16_t), sizeof(Polyhedron3D::VertexIndex));
+
+  // A regular prism with more vertices than the default capacity
+  constexpr int N = 100;
+  constexpr double EPS = 1e-10;
+  Polyhedron3D poly;
+  for(int k = 0; k < N; ++k)
+  {
+    const double theta = 2 * M_PI * k / N;
+    poly.addVertex(Point3D {cos(theta), sin(theta), 0});
+    poly.addVertex(Point3D {cos(theta), sin(theta), 1});
+  }
+  for(int k = 0; k < N; ++k)
+  {
+    using VertexIndex = Polyhedron3D::VertexIndex;
+    const VertexIndex bot = 2 * k, top = 2 * k + 1;
+    const VertexIndex prevBot = 2 * ((k + N - 1) % N), prevTop = prevBot + 1;
+    const VertexIndex nextBot = 2 * ((k + 1) % N), nextTop = nextBot + 1;
+    poly.addNeighbors(bot, {nextBot, top, prevBot});
+    poly.addNeighbors(top, {prevTop, bot, nextTop});
+  }
+  EXPECT_EQ(2 * N, poly.numVertices());
+
+  const double area = .5 * N * sin(2 * M_PI / N);
+  EXPECT_NEAR(area, poly.volume(), EPS);
+
+  // Add unconnected vertices in between, then remove them again
+  Polyhedron3D poly2;
+  bool removed[MAX_VERTS] = {false};
+  for(int i = 0; i < poly.numVertices(); ++i)
+  {
+    removed[poly2.addVertex(Point3D {5., 5., 5.})] = true;
+    poly2.addVertex(poly[i]);
+  }
+  for(int i = 0; i < poly.numVertices(); ++i)
+  {
+    for(int j = 0; j < poly.getNumNeighbors(i); ++j)
+    {
+      poly2.addNeighbors(2 * i + 1, 2 * poly.getNeighbors(i)[j] + 1);
+    }
+  }
+  poly2.removeVertices(removed);
+
+  ASSERT_EQ(poly.numVertices(), poly2.numVertices());
+  for(int i = 0; i < poly.numVertices(); ++i)
+  {
+    EXPECT_EQ(poly[i], poly2[i]);
+    ASSERT_EQ(poly.getNumNeighbors(i), poly2.getNumNeighbors(i));
+    for(int j = 0; j < poly.getNumNeighbors(i); ++j)
+    {
+      EXPECT_EQ(poly.getNeighbors(i)[j], poly2.getNeighbors(i)[j]);
+    }
+  }
+  EXPECT_NEAR(area, poly2.volume(), EPS);
+}
+
 //------------------------------------------------------------------------------
 
 int main(int argc, char* argv[])
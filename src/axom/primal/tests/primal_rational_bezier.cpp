@@ -112,6 +112,52 @@ TEST(primal_rationalbezier, evaluate)
   }
 }
 
+//------------------------------------------------------------------------------
+TEST(primal_rationalbezier, evaluate_array)
+{
+  SLIC_INFO("Testing Rational Bezier evaluation at arrays of parameters");
+
+  const int DIM = 3;
+  using CoordType = double;
+  using PointType = primal::Point<CoordType, DIM>;
+  using VectorType = primal::Vector<CoordType, DIM>;
+  using BezierCurveType = primal::BezierCurve<CoordType, DIM>;
+
+  const int max_order = 3;
+  PointType data[max_order + 1] = {PointType {0.6, 1.2, 1.0},
+                                   PointType {1.3, 1.6, 1.8},
+                                   PointType {2.9, 2.4, 2.3},
+                                   PointType {3.2, 3.5, 3.0}};
+  double weights[max_order + 1] = {1, 2, 3, 4};
+
+  const int N = 11;
+  axom::Array<CoordType> ts(N);
+  for(int j = 0; j < N; ++j)
+  {
+    ts[j] = j / (N - 1.);
+  }
+
+  for(int ord = 0; ord <= max_order; ++ord)
+  {
+    BezierCurveType curve(data, weights, ord);
+
+    axom::Array<PointType> pts(N), evals(N);
+    axom::Array<VectorType> tangents(N);
+    curve.evaluate(ts.view(), pts.view());
+    curve.evaluate_first_derivative(ts.view(), evals.view(), tangents.view());
+
+    for(int j = 0; j < N; ++j)
+    {
+      for(int i = 0; i < DIM; ++i)
+      {
+        EXPECT_NEAR(curve.evaluate(ts[j])[i], pts[j][i], 1e-14);
+        EXPECT_NEAR(curve.evaluate(ts[j])[i], evals[j][i], 1e-14);
+        EXPECT_NEAR(curve.dt(ts[j])[i], tangents[j][i], 1e-13);
+      }
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 TEST(primal_rationalbezier, first_derivative)
 {
@@ -134,6 +134,50 @@ TEST(primal_squared_distance, point_to_triangle)
   EXPECT_DOUBLE_EQ(primal::squared_distance(xC, C), dist);
 }
 
+//------------------------------------------------------------------------------
+TEST(primal_squared_distance, point_to_triangles_batched)
+{
+  using QPoint = primal::Point<double, 3>;
+  using QTriangle = primal::Triangle<double, 3>;
+
+  // Triangle ABC from the point_to_triangle test, and two translated copies
+  constexpr int NUM_TRIS = 3;
+  const double ax[] = {0.0, 0.0, 10.0}, ay[] = {0.0, 1.0, 0.0};
+  const double az[] = {0.0, 0.0, 0.0};
+  const double bx[] = {1.5, 1.5, 11.5}, by[] = {1.5, 2.5, 1.5};
+  const double bz[] = {0.0, 0.0, 0.0};
+  const double cx[] = {2.5, 2.5, 12.5}, cy[] = {0.0, 1.0, 0.0};
+  const double cz[] = {0.0, 0.0, 0.0};
+  primal::ZipIndexable<QTriangle> tris {{ax, ay, az},
+                                        {bx, by, bz},
+                                        {cx, cy, cz}};
+
+  const QPoint queries[] = {QPoint {0.0, 0.0, 0.0},
+                            QPoint {1.5, 0.5, 0.5},
+                            QPoint {-1.0, -1.0, 0.0},
+                            QPoint {1.5, 2.0, 0.0},
+                            QPoint {3.0, -1.0, 0.5}};
+
+  double dists[NUM_TRIS];
+  int locs[NUM_TRIS];
+  for(const auto& q : queries)
+  {
+    primal::squared_distance(q, tris, NUM_TRIS, dists, locs);
+    for(int i = 0; i < NUM_TRIS; ++i)
+    {
+      int loc;
+      const QPoint cp = primal::closest_point(q, tris[i], &loc);
+      EXPECT_NEAR(primal::squared_distance(q, tris[i]), dists[i], 1e-12);
+      EXPECT_NEAR(primal::squared_distance(q, cp), dists[i], 1e-12);
+      EXPECT_EQ(loc, locs[i]);
+    }
+  }
+
+  // The point inside ABC and above it by 0.5
+  primal::squared_distance<4>(queries[1], tris, 1, dists);
+  EXPECT_DOUBLE_EQ(0.25, dists[0]);
+}
+
 //------------------------------------------------------------------------------
 TEST(primal_squared_distance, point_to_segment)
 {
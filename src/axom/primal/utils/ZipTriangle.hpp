@@ -0,0 +1,99 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_PRIMAL_ZIP_TRIANGLE_HPP_
+#define AXOM_PRIMAL_ZIP_TRIANGLE_HPP_
+
+#include "axom/config.hpp"
+#include "axom/core/StackArray.hpp"
+#include "axom/slic/interface/slic.hpp"
+
+#include "axom/primal/geometry/Triangle.hpp"
+#include "axom/primal/utils/ZipIndexable.hpp"
+
+namespace axom
+{
+namespace primal
+{
+namespace detail
+{
+/*!
+ * \brief Implements ZipIndexable for a primal::Triangle instantiation
+ */
+template <typename T, int NDIMS>
+struct ZipBase<Triangle<T, NDIMS>>
+{
+  using GeomType = Triangle<T, NDIMS>;
+
+  static constexpr bool Exists = true;
+
+  /// Default constructor for a ZipBase of primal::Triangle
+  ZipBase()
+  {
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      tri_a[d] = nullptr;
+      tri_b[d] = nullptr;
+      tri_c[d] = nullptr;
+    }
+  }
+
+  /*!
+   * \brief Creates a ZipIndexable from a set of arrays
+   * \param [in] a_arrays the arrays storing the coordinates of the first
+   *  vertex of each triangle for each dimension
+   * \param [in] b_arrays the arrays storing the coordinates of the second
+   *  vertex of each triangle for each dimension
+   * \param [in] c_arrays the arrays storing the coordinates of the third
+   *  vertex of each triangle for each dimension
+   *
+   * \pre Size1 >= NDIMS
+   * \pre Size2 >= NDIMS
+   * \pre Size3 >= NDIMS
+   */
+  template <size_t Size1, size_t Size2, size_t Size3>
+  ZipBase(const T* const (&a_arrays)[Size1],
+          const T* const (&b_arrays)[Size2],
+          const T* const (&c_arrays)[Size3])
+  {
+    AXOM_STATIC_ASSERT_MSG(Size1 >= NDIMS, "Must provide at least NDIMS arrays");
+    AXOM_STATIC_ASSERT_MSG(Size2 >= NDIMS, "Must provide at least NDIMS arrays");
+    AXOM_STATIC_ASSERT_MSG(Size3 >= NDIMS, "Must provide at least NDIMS arrays");
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      tri_a[d] = a_arrays[d];
+      tri_b[d] = b_arrays[d];
+      tri_c[d] = c_arrays[d];
+    }
+  }
+
+  /*!
+   * \brief Returns the Triangle at an index i.
+   * \param [in] i the index to access
+   */
+  AXOM_HOST_DEVICE GeomType operator[](int i) const
+  {
+    using PointType = typename GeomType::PointType;
+    StackArray<T, NDIMS> a_data, b_data, c_data;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      a_data[d] = tri_a[d][i];
+      b_data[d] = tri_b[d][i];
+      c_data[d] = tri_c[d][i];
+    }
+    return GeomType(PointType(a_data), PointType(b_data), PointType(c_data));
+  }
+
+private:
+  const T* tri_a[NDIMS];
+  const T* tri_b[NDIMS];
+  const T* tri_c[NDIMS];
+};
+
+}  // namespace detail
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_ZIP_TRIANGLE_HPP_
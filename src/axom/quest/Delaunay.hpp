@@ -13,9 +13,17 @@
 #include "axom/mint.hpp"
 #include "axom/spin.hpp"
 
+#include "axom/quest/detail/Delaunay_detail.hpp"
+
 #include "axom/fmt.hpp"
 
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>
+#endif
+
+#include <algorithm>
 #include <list>
+#include <memory>
 #include <vector>
 #include <set>
 #include <cstdlib>
@@ -28,7 +36,8 @@ namespace quest
 /**
  * \brief A class for incremental generation of a 2D or 3D Delaunay triangulation
  *
- * Construct a Delaunay triangulation incrementally by inserting points one by one.
+ * Construct a Delaunay triangulation incrementally by inserting points one by one,
+ * or in batches with \a insertPoints(...).
  * A bounding box of the points needs to be defined first via \a initializeBoundary(...)
  */
 template <int DIM = 2>
@@ -57,17 +66,50 @@ public:
   static constexpr int VERT_PER_ELEMENT = DIM + 1;
   static constexpr IndexType INVALID_INDEX = -1;
 
+  /// Default seed for the random levels of computeInsertionOrder()
+  static constexpr std::uint64_t DEFAULT_BRIO_SEED = 0x5eed;
+
 private:
+#ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+  using HostExecSpace = axom::OMP_EXEC;
+#else
+  using HostExecSpace = axom::SEQ_EXEC;
+#endif
+
+  using MortonIndexType = std::uint64_t;
+
+  /// Number of partitions per thread in the parallel mode of insertPoints()
+  static constexpr int PARTITIONS_PER_THREAD = 8;
+
+  /// Bits of the BRIO sort key used by the Morton index, below the level
+  static constexpr int BRIO_MORTON_BITS = 58;
+
+  /**
+   * \brief Returns 64 random bits for point \a idx, from the SplitMix64
+   * generator keyed on \a seed and \a idx
+   */
+  static std::uint64_t brioRandomBits(std::uint64_t seed, axom::IndexType idx)
+  {
+    std::uint64_t z = seed + (static_cast<std::uint64_t>(idx) + 1) *
+        0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  }
+
   using ModularFaceIndex =
     slam::ModularInt<slam::policies::CompileTimeSize<IndexType, VERT_PER_ELEMENT>>;
 
 private:
   struct ElementFinder;
+  struct InsertionHelper;
 
   IAMeshType m_mesh;
   BoundingBox m_bounding_box;
   bool m_has_boundary;
   int m_num_removed_elements_since_last_compact;
+  bool m_use_exact_predicates;
+  bool m_parallel_insertion;
 
   ElementFinder m_element_finder;
 
@@ -79,8 +121,48 @@ public:
   Delaunay()
     : m_has_boundary(false)
     , m_num_removed_elements_since_last_compact(0)
+    , m_use_exact_predicates(false)
+    , m_parallel_insertion(false)
   { }
 
+  /**
+   * \brief Sets whether point insertion uses exact in-sphere predicates
+   *
+   * \details When enabled, the test of whether a new point lies inside an
+   * element's circumsphere uses the filtered exact primal::incircle() and
+   * primal::insphere() predicates instead of a floating point determinant,
+   * and the walk to the element containing a point uses the exact
+   * primal::orient2d() and primal::orient3d() predicates.  This keeps the
+   * triangulation consistent for cocircular or cospherical inputs, e.g. points
+   * on a regular grid.  Disabled by default.
+   */
+  void setUseExactPredicates(bool useExact)
+  {
+    m_use_exact_predicates = useExact;
+  }
+
+  /// Returns whether point insertion uses exact in-sphere predicates
+  bool getUseExactPredicates() const { return m_use_exact_predicates; }
+
+  /**
+   * \brief Sets whether insertPoints() inserts the points in parallel
+   *
+   * \details In parallel mode, insertPoints() splits the points, in their
+   * insertion order, into contiguous partitions that cover compact regions of
+   * space.  In each round, every partition proposes its next point, and the
+   * points are located and their cavities found concurrently with OpenMP.
+   * The insertions are then accepted optimistically, in partition order: an
+   * insertion whose cavity, or an element next to it, was locked by an
+   * insertion accepted earlier in the round is retried in the next round.
+   * Since the accepted cavities and their neighbors are disjoint, the result
+   * is the same Delaunay triangulation as with serial insertion, but the
+   * vertices are numbered in order of acceptance.  Disabled by default.
+   */
+  void setParallelInsertion(bool parallel) { m_parallel_insertion = parallel; }
+
+  /// Returns whether insertPoints() inserts the points in parallel
+  bool getParallelInsertion() const { return m_parallel_insertion; }
+
   /**
    * \brief Defines the boundary of the triangulation.
    * \details subsequent points added to the triangulation must not be outside of this boundary.
@@ -122,34 +204,182 @@ public:
     // Find the mesh element containing the insertion point
     IndexType element_i = findContainingElement(new_pt);
 
-    if(element_i == INVALID_INDEX)
+    insertPointInElement(new_pt, element_i);
+  }
+
+  /**
+   * \brief Adds a batch of points to the triangulation
+   *
+   * The points are inserted in the Biased Randomized Insertion Order (BRIO)
+   * computed by \a computeInsertionOrder(), so that successive points are
+   * close together, and the search for the element containing each point
+   * starts from an element incident to the previously inserted point.
+   * For large scattered point sets, this is much faster than calling
+   * \a insertPoint() for each point in the input order.
+   *
+   * \param [in] points The points to insert
+   * \param [out] insertionOrder Optional; if provided, holds the index in
+   * \a points of each inserted vertex, in order of insertion
+   *
+   * \pre All points must be inside the boundary of the triangulation
+   * \sa setParallelInsertion()
+   */
+  void insertPoints(axom::ArrayView<const PointType> points,
+                    axom::Array<axom::IndexType>* insertionOrder = nullptr)
+  {
+    BoundingBox bb;
+    for(const auto& pt : points)
     {
-      SLIC_WARNING(
-        fmt::format("Could not insert point {} into Delaunay triangulation: "
-                    "Element containing that point was not found",
-                    new_pt));
-      return;
+      bb.addPoint(pt);
     }
 
-    // Run the insertion operation by finding invalidated elements around the point (the "cavity")
-    // and replacing them with new valid elements (the Delaunay "ball")
-    InsertionHelper insertionHelper(m_mesh);
-    insertionHelper.findCavityElements(new_pt, element_i);
-    insertionHelper.createCavity();
-    IndexType new_pt_i = m_mesh.addVertex(new_pt);
-    insertionHelper.delaunayBall(new_pt_i);
+    const axom::Array<axom::IndexType> order =
+      computeInsertionOrder(points, bb);
+    insertPoints(points, order.view(), insertionOrder);
+  }
 
-    m_element_finder.updateBin(new_pt, new_pt_i);
-    m_num_removed_elements_since_last_compact +=
-      insertionHelper.numRemovedElements();
+  /**
+   * \brief Adds the points \a points[order[i]] to the triangulation, in order
+   *
+   * The search for the element containing each point starts from an element
+   * incident to the previously inserted point, so \a order should keep
+   * successive points close together, e.g. using \a computeInsertionOrder().
+   *
+   * \tparam PointArray An array type whose operator[] returns a PointType
+   *
+   * \param [in] points The points to insert
+   * \param [in] order The indices in \a points of the points to insert
+   * \param [out] insertionOrder Optional; if provided, holds the index in
+   * \a points of each inserted vertex, in order of insertion.  This is
+   * \a order, unless the points are inserted in parallel.
+   *
+   * \pre All points must be inside the boundary of the triangulation
+   * \sa setParallelInsertion()
+   */
+  template <typename PointArray>
+  void insertPoints(const PointArray& points,
+                    axom::ArrayView<const axom::IndexType> order,
+                    axom::Array<axom::IndexType>* insertionOrder = nullptr)
+  {
+    SLIC_ASSERT_MSG(
+      m_has_boundary,
+      "Error: Need a predefined boundary box prior to adding points.");
 
-    // Compact the mesh if there are too many removed elements
-    if(shouldCompactMesh())
+    if(m_parallel_insertion)
     {
-      this->compactMesh();
+      insertPointsInParallel(points, order, insertionOrder);
+      return;
+    }
+
+    if(insertionOrder != nullptr)
+    {
+      insertionOrder->clear();
+      insertionOrder->reserve(order.size());
+    }
+
+    IndexType prev_vertex = INVALID_INDEX;
+    for(const axom::IndexType idx : order)
+    {
+      const PointType new_pt = points[idx];
+      SLIC_ASSERT_MSG(m_bounding_box.contains(new_pt),
+                      "Error: new point is outside of the boundary box.");
+
+      // Walk from the previous point, falling back to the element finder
+      IndexType element_i = INVALID_INDEX;
+      if(m_mesh.isValidVertex(prev_vertex))
+      {
+        element_i =
+          walkToContainingElement(new_pt,
+                                  m_mesh.coboundaryElement(prev_vertex),
+                                  false);
+      }
+      if(element_i == INVALID_INDEX)
+      {
+        element_i = findContainingElement(new_pt);
+      }
+
+      const IndexType new_pt_i = insertPointInElement(new_pt, element_i);
+      if(new_pt_i != INVALID_INDEX)
+      {
+        prev_vertex = new_pt_i;
+      }
+      if(insertionOrder != nullptr)
+      {
+        insertionOrder->push_back(idx);
+      }
     }
   }
 
+  /**
+   * \brief Generates a permutation of [0, pts.size()) following the Biased
+   * Randomized Insertion Order (BRIO)
+   *
+   * BRIO helps improve worst-case performance on poorly ordered point sets.
+   * It was introduced in the following paper:
+   *   N. Amenta, S. Choi, and G. Rote. "Incremental constructions con BRIO."
+   *   Proceedings of the 19th annual symposium on Computational geometry, 2003.
+   *
+   * Each point gets a random level and a Morton index, quantized over \a bb,
+   * and the points are sorted by level, then by Morton index.  The levels
+   * come from a counter-based random generator keyed on \a seed and the
+   * point index, so the permutation does not depend on the number of
+   * threads.  The keys are sorted with a stable LSD radix sort.  The levels,
+   * Morton indices and sort run in parallel when OpenMP is available.
+   *
+   * \param [in] pts The points, supporting size() and operator[]
+   * \param [in] bb A bounding box containing the points
+   * \param [in] seed Seed for the random levels
+   */
+  template <typename PointArray>
+  static axom::Array<axom::IndexType> computeInsertionOrder(
+    const PointArray& pts,
+    const BoundingBox& bb,
+    std::uint64_t seed = DEFAULT_BRIO_SEED)
+  {
+    const axom::IndexType npts = pts.size();
+    const int nlevels = npts > 1
+      ? axom::utilities::ceil(axom::utilities::log2<DataType>(npts))
+      : 0;
+
+    // We use a Morton index, quantized over the mesh bounding box to
+    // order the points on each level.  The level goes in the top bits of
+    // the sort key, so fit as many bits as possible per dimension into the
+    // remaining BRIO_MORTON_BITS bits, i.e. floor(58/DIM)
+    using QuantizedCoordType = std::uint32_t;
+    using MortonizerType =
+      spin::Mortonizer<QuantizedCoordType, MortonIndexType, DIM>;
+
+    constexpr int shift_bits = BRIO_MORTON_BITS / DIM;
+    primal::NumericArray<QuantizedCoordType, DIM> res(1 << shift_bits, DIM);
+    auto quantizer =
+      spin::rectangular_lattice_from_bounding_box<DIM, DataType, QuantizedCoordType>(
+        bb,
+        res);
+
+    axom::Array<MortonIndexType> keys(npts, npts);
+    axom::Array<axom::IndexType> reordered(npts, npts);
+    auto keysView = keys.view();
+    auto reorderedView = reordered.view();
+    axom::for_all<HostExecSpace>(npts, [=, &pts](axom::IndexType idx) {
+      // Each point has a 50% chance of being at the max level; of the remaining points
+      // from the previous level, there's a 50% chance of being at the current level.
+      // Any remaining points are at level 0.
+      const int heads =
+        axom::utilities::trailingZeros(brioRandomBits(seed, idx));
+      const MortonIndexType level = nlevels - std::min(heads, nlevels);
+
+      const auto cell = quantizer.gridCell(pts[idx]);
+      keysView[idx] =
+        (level << BRIO_MORTON_BITS) | MortonizerType::mortonize(cell);
+      reorderedView[idx] = idx;
+    });
+
+    // Sort following BRIO; the stable sort breaks ties by point index
+    detail::radixSortPairs(keys.data(), reordered.data(), npts);
+
+    return reordered;
+  }
+
   template <int TDIM = DIM>
   typename std::enable_if<TDIM == 2, ElementType>::type getElement(
     int element_index) const
@@ -437,6 +667,30 @@ public:
       SLIC_ASSERT(m_mesh.isValidElement(element_i));
     }
 
+    return walkToContainingElement(query_pt, element_i, warnOnInvalid);
+  }
+
+  /**
+   * \brief helper function to retrieve the barycentric coordinate of the query point in the element
+   * \note The signs of the coordinates are exact when exact predicates are enabled
+   * \sa setUseExactPredicates()
+   */
+  BaryCoordType getBaryCoords(IndexType element_idx, const PointType& q_pt) const;
+
+private:
+  /**
+   * \brief Walks through the mesh from element \a element_i towards the
+   * query point, and returns the index of the element that contains it
+   */
+  IndexType walkToContainingElement(const PointType& query_pt,
+                                    IndexType element_i,
+                                    bool warnOnInvalid) const
+  {
+    if(!m_mesh.isValidElement(element_i))
+    {
+      return INVALID_INDEX;
+    }
+
     while(1)
     {
       const BaryCoordType bary_coord = getBaryCoords(element_i, query_pt);
@@ -469,11 +723,241 @@ public:
   }
 
   /**
-   * \brief helper function to retrieve the barycentric coordinate of the query point in the element
+   * \brief Inserts \a new_pt into element \a element_i and locally
+   * re-triangulates the mesh
+   *
+   * \return The index of the new vertex, or INVALID_INDEX if \a element_i
+   * is not a valid element
    */
-  BaryCoordType getBaryCoords(IndexType element_idx, const PointType& q_pt) const;
+  IndexType insertPointInElement(const PointType& new_pt, IndexType element_i)
+  {
+    if(element_i == INVALID_INDEX)
+    {
+      SLIC_WARNING(
+        fmt::format("Could not insert point {} into Delaunay triangulation: "
+                    "Element containing that point was not found",
+                    new_pt));
+      return INVALID_INDEX;
+    }
+
+    // Run the insertion operation by finding invalidated elements around the point (the "cavity")
+    // and replacing them with new valid elements (the Delaunay "ball")
+    InsertionHelper insertionHelper(m_mesh, m_use_exact_predicates);
+    insertionHelper.findCavityElements(new_pt, element_i);
+    const IndexType new_pt_i = fillCavity(new_pt, insertionHelper);
+
+    // Compact the mesh if there are too many removed elements
+    if(shouldCompactMesh())
+    {
+      this->compactMesh();
+    }
+
+    return new_pt_i;
+  }
+
+  /**
+   * \brief Replaces the cavity found by \a insertionHelper with the
+   * Delaunay ball of \a new_pt
+   *
+   * \return The index of the new vertex
+   */
+  IndexType fillCavity(const PointType& new_pt,
+                       InsertionHelper& insertionHelper)
+  {
+    insertionHelper.createCavity();
+    IndexType new_pt_i = m_mesh.addVertex(new_pt);
+    insertionHelper.delaunayBall(new_pt_i);
+
+    m_element_finder.updateBin(new_pt, new_pt_i);
+    m_num_removed_elements_since_last_compact +=
+      insertionHelper.numRemovedElements();
+
+    return new_pt_i;
+  }
+
+  /**
+   * \brief Inserts the points \a points[order[i]] in parallel
+   *
+   * \sa setParallelInsertion(), insertPoints()
+   */
+  template <typename PointArray>
+  void insertPointsInParallel(const PointArray& points,
+                              axom::ArrayView<const axom::IndexType> order,
+                              axom::Array<axom::IndexType>* insertionOrder)
+  {
+#ifdef AXOM_USE_OPENMP
+    const int maxPartitions = PARTITIONS_PER_THREAD * omp_get_max_threads();
+#else
+    const int maxPartitions = PARTITIONS_PER_THREAD;
+#endif
+    const IndexType npts = order.size();
+
+    if(insertionOrder != nullptr)
+    {
+      insertionOrder->clear();
+      insertionOrder->reserve(npts);
+    }
+
+    // The range of points of each partition, and its last inserted vertex
+    axom::Array<IndexType> next(maxPartitions), end(maxPartitions);
+    axom::Array<IndexType> prevVertex(maxPartitions);
+
+    // The partitions proposing a point in the current round, and the
+    // cavities of their points
+    axom::Array<int> candidates(maxPartitions);
+    std::vector<std::unique_ptr<InsertionHelper>> helpers(maxPartitions);
+
+    // The last round in which each element was locked
+    IndexArray locks;
+    IndexType round = 0;
+
+    for(IndexType begin = 0; begin < npts;)
+    {
+      // Split the next chunk of points into partitions.  The chunk grows
+      // with the mesh, which keeps the partitions apart.
+      const IndexType chunkSize = axom::utilities::min(
+        npts - begin,
+        axom::utilities::max(static_cast<IndexType>(maxPartitions),
+                             m_mesh.getNumberOfValidVertices()));
+      const int numPartitions = static_cast<int>(
+        axom::utilities::min(static_cast<IndexType>(maxPartitions), chunkSize));
+      for(int p = 0; p < numPartitions; ++p)
+      {
+        next[p] = begin + chunkSize * p / numPartitions;
+        end[p] = begin + chunkSize * (p + 1) / numPartitions;
+        prevVertex[p] = INVALID_INDEX;
+      }
+      begin += chunkSize;
+
+      while(true)
+      {
+        int numCandidates = 0;
+        for(int p = 0; p < numPartitions; ++p)
+        {
+          if(next[p] < end[p])
+          {
+            candidates[numCandidates++] = p;
+          }
+        }
+        if(numCandidates == 0)
+        {
+          break;
+        }
+
+        // Locate the proposed points and find their cavities, which only
+        // reads the mesh
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic)
+#endif
+        for(int c = 0; c < numCandidates; ++c)
+        {
+          const int p = candidates[c];
+          const PointType new_pt = points[order[next[p]]];
+
+          IndexType element_i = INVALID_INDEX;
+          if(m_mesh.isValidVertex(prevVertex[p]))
+          {
+            element_i =
+              walkToContainingElement(new_pt,
+                                      m_mesh.coboundaryElement(prevVertex[p]),
+                                      false);
+          }
+          if(element_i == INVALID_INDEX)
+          {
+            element_i = findContainingElement(new_pt, false);
+          }
+
+          helpers[c].reset();
+          if(element_i != INVALID_INDEX)
+          {
+            helpers[c].reset(
+              new InsertionHelper(m_mesh, m_use_exact_predicates));
+            helpers[c]->findCavityElements(new_pt, element_i);
+          }
+        }
+
+        // Accept the insertions whose cavities are still unchanged
+        ++round;
+        locks.resize(m_mesh.elements().size(), INVALID_INDEX);
+        for(int c = 0; c < numCandidates; ++c)
+        {
+          const int p = candidates[c];
+          const PointType new_pt = points[order[next[p]]];
+          SLIC_ASSERT_MSG(m_bounding_box.contains(new_pt),
+                          "Error: new point is outside of the boundary box.");
+
+          if(!helpers[c])
+          {
+            // Warns that the point could not be located
+            insertPointInElement(new_pt, INVALID_INDEX);
+          }
+          else if(lockCavity(*helpers[c], locks, round))
+          {
+            prevVertex[p] = fillCavity(new_pt, *helpers[c]);
+          }
+          else
+          {
+            // Retry in the next round
+            continue;
+          }
+
+          if(insertionOrder != nullptr)
+          {
+            insertionOrder->push_back(order[next[p]]);
+          }
+          ++next[p];
+        }
+
+        if(shouldCompactMesh())
+        {
+          this->compactMesh();
+        }
+      }
+    }
+  }
+
+  /**
+   * \brief Locks the cavity elements of \a insertionHelper and their
+   * neighbors across the cavity boundary for \a round, unless an insertion
+   * accepted earlier in the round locked any of them
+   *
+   * \return True if the elements were locked
+   */
+  bool lockCavity(InsertionHelper& insertionHelper,
+                  IndexArray& locks,
+                  IndexType round) const
+  {
+    // The cavity elements and their neighbors across its boundary, except
+    // across the domain boundary
+    IndexArray elems;
+    for(auto elem : insertionHelper.cavity_elems)
+    {
+      elems.push_back(elem);
+    }
+    const IndexType numLocks = static_cast<IndexType>(locks.size());
+    for(int i = 0; i < insertionHelper.facet_set.size(); ++i)
+    {
+      const IndexType nbr = insertionHelper.fc_rel[i][0];
+      if(nbr >= 0 && nbr < numLocks)
+      {
+        elems.push_back(nbr);
+      }
+    }
+
+    for(auto elem : elems)
+    {
+      if(locks[elem] == round)
+      {
+        return false;
+      }
+    }
+    for(auto elem : elems)
+    {
+      locks[elem] = round;
+    }
+    return true;
+  }
 
-private:
   /// \brief Predicate for when to compact internal mesh data structures after removing elements
   bool shouldCompactMesh() const
   {
@@ -609,8 +1093,9 @@ private:
   struct InsertionHelper
   {
   public:
-    InsertionHelper(IAMeshType& mesh)
+    InsertionHelper(IAMeshType& mesh, bool useExactPredicates = false)
       : m_mesh(mesh)
+      , m_use_exact_predicates(useExactPredicates)
       , facet_set(0)
       , fv_rel(&facet_set, &m_mesh.vertices())
       , fc_rel(&facet_set, &m_mesh.elements())
@@ -774,6 +1259,7 @@ private:
 
   public:
     IAMeshType& m_mesh;
+    bool m_use_exact_predicates;
 
     FacetSet facet_set;
     FacetBoundaryRelation fv_rel;
@@ -789,6 +1275,12 @@ private:
 template <int DIM>
 constexpr typename Delaunay<DIM>::IndexType Delaunay<DIM>::INVALID_INDEX;
 
+template <int DIM>
+constexpr std::uint64_t Delaunay<DIM>::DEFAULT_BRIO_SEED;
+
+template <int DIM>
+constexpr int Delaunay<DIM>::BRIO_MORTON_BITS;
+
 //--------------------------------------------------------------------------------
 // Below are 2D and 3D specializations for methods in the Delaunay class
 //--------------------------------------------------------------------------------
@@ -857,10 +1349,20 @@ inline Delaunay<2>::BaryCoordType Delaunay<2>::getBaryCoords(
   const PointType& query_pt) const
 {
   const auto verts = m_mesh.boundaryVertices(element_idx);
-  const ElementType tri(m_mesh.getVertexPosition(verts[0]),
-                        m_mesh.getVertexPosition(verts[1]),
-                        m_mesh.getVertexPosition(verts[2]));
+  const PointType& p0 = m_mesh.getVertexPosition(verts[0]);
+  const PointType& p1 = m_mesh.getVertexPosition(verts[1]);
+  const PointType& p2 = m_mesh.getVertexPosition(verts[2]);
 
+  // Ratios of exact orientations, so the signs of the coordinates are exact
+  if(m_use_exact_predicates)
+  {
+    const double area = primal::orient2d(p0, p1, p2);
+    return BaryCoordType {primal::orient2d(query_pt, p1, p2) / area,
+                          primal::orient2d(p0, query_pt, p2) / area,
+                          primal::orient2d(p0, p1, query_pt) / area};
+  }
+
+  const ElementType tri(p0, p1, p2);
   return tri.physToBarycentric(query_pt);
 }
 
@@ -871,11 +1373,22 @@ inline Delaunay<3>::BaryCoordType Delaunay<3>::getBaryCoords(
   const PointType& query_pt) const
 {
   const auto verts = m_mesh.boundaryVertices(element_idx);
-  const ElementType tet(m_mesh.getVertexPosition(verts[0]),
-                        m_mesh.getVertexPosition(verts[1]),
-                        m_mesh.getVertexPosition(verts[2]),
-                        m_mesh.getVertexPosition(verts[3]));
+  const PointType& p0 = m_mesh.getVertexPosition(verts[0]);
+  const PointType& p1 = m_mesh.getVertexPosition(verts[1]);
+  const PointType& p2 = m_mesh.getVertexPosition(verts[2]);
+  const PointType& p3 = m_mesh.getVertexPosition(verts[3]);
 
+  // Ratios of exact orientations, so the signs of the coordinates are exact
+  if(m_use_exact_predicates)
+  {
+    const double vol = primal::orient3d(p0, p1, p2, p3);
+    return BaryCoordType {primal::orient3d(query_pt, p1, p2, p3) / vol,
+                          primal::orient3d(p0, query_pt, p2, p3) / vol,
+                          primal::orient3d(p0, p1, query_pt, p3) / vol,
+                          primal::orient3d(p0, p1, p2, query_pt) / vol};
+  }
+
+  const ElementType tet(p0, p1, p2, p3);
   return tet.physToBarycentric(query_pt);
 }
 
@@ -888,6 +1401,15 @@ inline bool Delaunay<2>::InsertionHelper::isPointInSphere(const PointType& query
   const PointType& p0 = m_mesh.getVertexPosition(verts[0]);
   const PointType& p1 = m_mesh.getVertexPosition(verts[1]);
   const PointType& p2 = m_mesh.getVertexPosition(verts[2]);
+
+  // The sign of incircle() flips with the triangle's orientation
+  if(m_use_exact_predicates)
+  {
+    return primal::incircle(p0, p1, p2, query_pt) *
+      primal::orient2d(p0, p1, p2) >
+      0.;
+  }
+
   return primal::in_sphere(query_pt, p0, p1, p2, 0.);
 }
 
@@ -901,6 +1423,15 @@ inline bool Delaunay<3>::InsertionHelper::isPointInSphere(const PointType& query
   const PointType& p1 = m_mesh.getVertexPosition(verts[1]);
   const PointType& p2 = m_mesh.getVertexPosition(verts[2]);
   const PointType& p3 = m_mesh.getVertexPosition(verts[3]);
+
+  // The sign of insphere() flips with the tetrahedron's orientation
+  if(m_use_exact_predicates)
+  {
+    return primal::insphere(p0, p1, p2, p3, query_pt) *
+      primal::orient3d(p0, p1, p2, p3) >
+      0.;
+  }
+
   return primal::in_sphere(query_pt, p0, p1, p2, p3, 0.);
 }
 
@@ -23,10 +23,15 @@
 #include "conduit_relay_mpi.hpp"
 #include "conduit_relay_io.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
 #include <memory>
 #include <limits>
 #include <cstdlib>
 #include <cmath>
+#include <thread>
 #include <vector>
 
 #ifndef AXOM_USE_MPI
@@ -299,6 +304,161 @@ inline int recv_using_schema(conduit::Node& node, int src, int tag, MPI_Comm com
 }  // namespace mpi
 }  // namespace relay
 
+/**
+ * \brief Packs values into a flat byte buffer for point-to-point messages
+ *
+ * Each written value or array starts on an 8-byte boundary, so arrays of
+ * doubles and indices can be read in place from a received buffer.
+ * The buffer is cleared on construction but keeps its capacity, so it can
+ * be reused across messages.
+ *
+ * \sa BinaryMessageReader
+ */
+class BinaryMessageWriter
+{
+public:
+  static constexpr axom::IndexType ALIGNMENT = 8;
+
+  explicit BinaryMessageWriter(axom::Array<char>& buffer) : m_buffer(buffer)
+  {
+    m_buffer.clear();
+  }
+
+  /// Appends a single value
+  template <typename T>
+  void write(const T& value)
+  {
+    writeArray(&value, 1);
+  }
+
+  /// Appends \a count contiguous values
+  template <typename T>
+  void writeArray(const T* values, axom::IndexType count)
+  {
+    const axom::IndexType offset = m_buffer.size();
+    const axom::IndexType nBytes = count * sizeof(T);
+    m_buffer.resize(offset + padded(nBytes));
+    if(nBytes > 0)
+    {
+      std::memcpy(m_buffer.data() + offset, values, nBytes);
+    }
+  }
+
+  /// Returns the padded size of an entry of \a nBytes bytes
+  static axom::IndexType padded(axom::IndexType nBytes)
+  {
+    return (nBytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+  }
+
+private:
+  axom::Array<char>& m_buffer;
+};
+
+/**
+ * \brief Reads values packed by a BinaryMessageWriter, in the same order
+ *
+ * Arrays are returned as pointers into the buffer, without copying.
+ */
+class BinaryMessageReader
+{
+public:
+  BinaryMessageReader(char* buffer, axom::IndexType nBytes)
+    : m_pos(buffer)
+    , m_end(buffer + nBytes)
+  { }
+
+  /// Reads a single value
+  template <typename T>
+  T read()
+  {
+    return *readArray<T>(1);
+  }
+
+  /// Returns a pointer to the next \a count values and skips past them
+  template <typename T>
+  T* readArray(axom::IndexType count)
+  {
+    T* values = reinterpret_cast<T*>(m_pos);
+    m_pos += BinaryMessageWriter::padded(count * sizeof(T));
+    SLIC_ASSERT_MSG(m_pos <= m_end, "Read past the end of a binary message");
+    return values;
+  }
+
+private:
+  char* m_pos;
+  char* m_end;
+};
+
+/**
+ * \brief Drives MPI progress from a helper thread while the owning thread
+ * computes, for MPI implementations without asynchronous progress.
+ *
+ * The helper thread only probes the communicator, so it never matches or
+ * completes messages owned by the caller.  The thread runs from
+ * construction until stop() or destruction.
+ *
+ * Between probes, the thread sleeps for an interval that doubles, up to
+ * MAX_SLEEP_US microseconds, while no unmatched messages are pending.
+ * This bounds the progress latency without keeping a core busy.
+ *
+ * \pre MPI was initialized with MPI_THREAD_MULTIPLE, see isSupported()
+ */
+class MpiProgressThread
+{
+public:
+  /// Longest sleep between probes, in microseconds
+  static constexpr int MAX_SLEEP_US = 64;
+
+  explicit MpiProgressThread(MPI_Comm comm)
+    : m_thread([this, comm]() {
+      int sleepUs = 0;
+      while(!m_done.load(std::memory_order_relaxed))
+      {
+        int flag = 0;
+        MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE);
+        if(flag)
+        {
+          // A message is arriving; keep its protocol moving.
+          sleepUs = 0;
+          std::this_thread::yield();
+        }
+        else
+        {
+          sleepUs = sleepUs == 0 ? 1 : std::min(2 * sleepUs, int(MAX_SLEEP_US));
+          std::this_thread::sleep_for(std::chrono::microseconds(sleepUs));
+        }
+      }
+    })
+  { }
+
+  ~MpiProgressThread() { stop(); }
+
+  MpiProgressThread(const MpiProgressThread&) = delete;
+  MpiProgressThread& operator=(const MpiProgressThread&) = delete;
+
+  /// Stops and joins the helper thread
+  void stop()
+  {
+    m_done.store(true, std::memory_order_relaxed);
+    if(m_thread.joinable())
+    {
+      m_thread.join();
+    }
+  }
+
+  /// Whether MPI allows concurrent calls from several threads
+  static bool isSupported()
+  {
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    return provided == MPI_THREAD_MULTIPLE;
+  }
+
+private:
+  std::atomic<bool> m_done {false};
+  std::thread m_thread;
+};
+
 /**
  * \brief Implements the DistributedClosestPoint query for a specified dimension
  * using a provided execution policy (e.g. sequential, openmp, cuda, hip)
@@ -313,8 +473,13 @@ public:
   using RuntimePolicy = axom::runtime_policy::Policy;
   using PointType = primal::Point<double, DIM>;
   using BoxType = primal::BoundingBox<double, DIM>;
+  using SegmentType = primal::Segment<double, DIM>;
+  using TriangleType = primal::Triangle<double, DIM>;
   using PointArray = axom::Array<PointType>;
   using BoxArray = axom::Array<BoxType>;
+  /// Parametric coordinates of a closest point within its object element
+  using ParamType = primal::Point<double, 2>;
+  using ParamArray = axom::Array<ParamType>;
 
   using SeqBVHTree = spin::BVH<DIM, axom::SEQ_EXEC>;
 #ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
@@ -338,6 +503,45 @@ private:
     int pointIdx {-1};
     /// MPI rank of closest element
     int rank {-1};
+    /// Closest point on the closest element
+    PointType cp {0.};
+    /// Parametric coordinates of the closest point in the closest element
+    ParamType param {0.};
+  };
+
+  /// Views of query points and their closest point fields
+  struct QueryBatch
+  {
+    axom::ArrayView<PointType> queryPts;
+    /// Optional bounds on the squared distance of each closest point
+    axom::ArrayView<double> cpSqDists;
+    axom::ArrayView<axom::IndexType> cpIndexes;
+    axom::ArrayView<axom::IndexType> cpDomainIndexes;
+    axom::ArrayView<axom::IndexType> cpRanks;
+    axom::ArrayView<PointType> cpCoords;
+    /// Optional parametric coordinates of the closest points
+    axom::ArrayView<ParamType> cpParams;
+    /// Optional distances to the closest points
+    axom::ArrayView<double> minDists;
+    /// Whether the closest point fields are uninitialized
+    bool isFirst {false};
+  };
+
+  /// Number of 64-bit values in the header of a binary message
+  static constexpr int HEADER_SIZE = 3;
+
+  /// Source, tag and size bound of a persistent receive
+  struct RecvSpec
+  {
+    int source {-1};
+    int tag {-1};
+    axom::IndexType maxBytes {0};
+
+    bool operator==(const RecvSpec& other) const
+    {
+      return source == other.source && tag == other.tag &&
+        maxBytes == other.maxBytes;
+    }
   };
 
 public:
@@ -353,17 +557,29 @@ public:
     , m_nranks(-1)
     , m_objectPtCoords(0, 0, allocatorID)
     , m_objectPtDomainIds(0, 0, allocatorID)
+    , m_objectElemConn(0, 0, allocatorID)
+    , m_objectElemDomainIds(0, 0, allocatorID)
   {
     SLIC_ASSERT(allocatorID != axom::INVALID_ALLOCATOR_ID);
 
     setMpiCommunicator(MPI_COMM_WORLD);
   }
 
+  DistributedClosestPointImpl(const DistributedClosestPointImpl&) = delete;
+  DistributedClosestPointImpl& operator=(const DistributedClosestPointImpl&) =
+    delete;
+
+  ~DistributedClosestPointImpl() { freeRecvRequests(); }
+
   /**
    * \brief Set the MPI communicator.
    */
   void setMpiCommunicator(MPI_Comm mpiComm)
   {
+    if(mpiComm != m_mpiComm)
+    {
+      freeRecvRequests();
+    }
     m_mpiComm = mpiComm;
     MPI_Comm_rank(m_mpiComm, &m_rank);
     MPI_Comm_size(m_mpiComm, &m_nranks);
@@ -391,6 +607,34 @@ public:
     m_allocatorID = allocatorID;
   }
 
+  /// Number of bytes this rank sent in the most recent query
+  axom::IndexType getSentBytes() const { return m_sentBytes; }
+
+  /// Number of messages this rank sent in the most recent query
+  int getSentMessages() const { return m_sentMessages; }
+
+  /**
+   * \brief Sends candidates to other ranks before the local search, so
+   * that the exchange overlaps the local search
+   *
+   * Without pipelining, the local search runs first, and only points that
+   * other ranks could improve upon are sent.
+   */
+  void setPipelined(bool isPipelined) { m_isPipelined = isPipelined; }
+
+  /// Drives MPI progress from a helper thread during the query
+  void setUseProgressThread(bool useThread) { m_useProgressThread = useThread; }
+
+  /// Seconds of the most recent query spent searching for local query points
+  double getLocalSearchTime() const { return m_localSearchTime; }
+
+  /// Seconds of the most recent query spent searching for other ranks
+  double getRemoteSearchTime() const { return m_remoteSearchTime; }
+
+  /// Seconds of the most recent query spent waiting on other ranks
+  double getIdleTime() const { return m_idleTime; }
+
+
 public:
   /**
    * Import object mesh points from the object blueprint mesh into internal memory.
@@ -464,6 +708,71 @@ public:
     m_objectPtDomainIds = axom::Array<axom::IndexType>(domIds, m_allocatorID);
   }
 
+  /**
+   * Import object mesh segments or triangles from the object blueprint mesh.
+   *
+   * \param [in] mdMeshNode The blueprint mesh containing the object elements.
+   * \param [in] topologyName Name of the blueprint topology in \a mdMeshNode.
+   * \param [in] vertsPerElem Vertices per element: 2 for the "line" shape and
+   *   3 for the "tri" shape.
+   *
+   * \pre importObjectPoints() was called with the same mesh, so the
+   *   connectivity can be offset into the imported points.
+   */
+  void importObjectElements(const conduit::Node& mdMeshNode,
+                            const std::string& topologyName,
+                            int vertsPerElem)
+  {
+    SLIC_ASSERT(vertsPerElem == 2 || vertsPerElem == 3);
+    SLIC_ASSERT_MSG(DIM == 3 || vertsPerElem == 2,
+                    "Triangle object meshes are only supported in 3D");
+
+    m_objectElemVerts = vertsPerElem;
+
+    const std::string connPath =
+      axom::fmt::format("topologies/{}/elements/connectivity", topologyName);
+
+    // Count elements in the mesh.
+    axom::IndexType connCount = 0;
+    for(const conduit::Node& domain : mdMeshNode.children())
+    {
+      connCount += domain.fetch_existing(connPath).dtype().number_of_elements();
+    }
+    const axom::IndexType elemCount = connCount / vertsPerElem;
+
+    // Copy connectivity, offset into the flattened object points
+    axom::Array<axom::IndexType> conn(connCount, connCount);
+    axom::Array<axom::IndexType> domIds(elemCount, elemCount);
+    axom::IndexType copiedConn = 0;
+    axom::IndexType ptOffset = 0;
+    conduit::Node tmpConn;
+    for(conduit::index_t d = 0; d < mdMeshNode.number_of_children(); ++d)
+    {
+      const conduit::Node& domain = mdMeshNode.child(d);
+      domain.fetch_existing(connPath).to_int64_array(tmpConn);
+      const conduit::int64* src = tmpConn.as_int64_ptr();
+      const axom::IndexType N = tmpConn.dtype().number_of_elements();
+      for(axom::IndexType i = 0; i < N; ++i)
+      {
+        conn[copiedConn + i] = ptOffset + src[i];
+      }
+      domIds.fill(d, copiedConn / vertsPerElem, N / vertsPerElem);
+      copiedConn += N;
+
+      const std::string coordsetName =
+        domain
+          .fetch_existing(
+            axom::fmt::format("topologies/{}/coordset", topologyName))
+          .as_string();
+      ptOffset += internal::extractSize(domain.fetch_existing(
+        axom::fmt::format("coordsets/{}/values", coordsetName)));
+    }
+
+    // copy computed data to ExecSpace
+    m_objectElemConn = axom::Array<axom::IndexType>(conn, m_allocatorID);
+    m_objectElemDomainIds = axom::Array<axom::IndexType>(domIds, m_allocatorID);
+  }
+
   /// Predicate to check if the BVH tree has been initialized
   bool isBVHTreeInitialized() const
   {
@@ -602,6 +911,29 @@ public:
     }
   }
 
+  /// Allgather the domain and point counts of each rank's query partition.
+  void gatherQuerySizes(conduit::Node& xferNode,
+                        axom::Array<std::int64_t>& allSizes) const
+  {
+    conduit::Node& xferDoms = xferNode.fetch_existing("xferDoms");
+    std::int64_t sizes[2] = {xferDoms.number_of_children(), 0};
+    for(conduit::Node& xferDom : xferDoms.children())
+    {
+      sizes[1] += xferDom.fetch_existing("qPtCount").as_int();
+    }
+
+    allSizes.resize(2 * m_nranks);
+    int errf = MPI_Allgather(sizes,
+                             2,
+                             mpi_traits<std::int64_t>::type,
+                             allSizes.data(),
+                             2,
+                             mpi_traits<std::int64_t>::type,
+                             m_mpiComm);
+    SLIC_ASSERT(errf == MPI_SUCCESS);
+    AXOM_UNUSED_VAR(errf);
+  }
+
   /// Compute bounding box for local part of a mesh.
   BoxType computeMeshBoundingBox(conduit::Node& xferNode) const
   {
@@ -661,6 +993,12 @@ public:
                                      xferDom["cp_coords"]);
       xferDom["cp_domain_index"].set_external(fields.fetch_existing("cp_domain_index/values"));
 
+      if(fields.has_path("cp_parametric"))
+      {
+        copy_components_to_interleaved(fields.fetch_existing("cp_parametric/values"),
+                                       xferDom["cp_parametric"]);
+      }
+
       if(fields.has_path("cp_distance"))
       {
         xferDom["debug/cp_distance"].set_external(fields.fetch_existing("cp_distance/values"));
@@ -717,6 +1055,13 @@ public:
       copy_interleaved_to_components(xferDom.fetch_existing("cp_coords"),
                                      fields.fetch_existing("cp_coords/values"));
 
+      if(xferDom.has_path("cp_parametric"))
+      {
+        copy_interleaved_to_components(
+          xferDom.fetch_existing("cp_parametric"),
+          fields.fetch_existing("cp_parametric/values"));
+      }
+
       if(xferDom.has_path("debug/cp_distance"))
       {
         auto& src = xferDom.fetch_existing("debug/cp_distance");
@@ -729,6 +1074,340 @@ public:
     }
   }
 
+  /// Whether query partition \a queryBb may have closest points in \a objectBb
+  bool isClosePartition(const BoxType& queryBb, const BoxType& objectBb) const
+  {
+    return queryBb.isValid() && objectBb.isValid() &&
+      primal::squared_distance(queryBb, objectBb) <= m_sqDistanceThreshold;
+  }
+
+  /// Upper bound on the bytes of a candidate or reply message for a
+  /// query partition with \a domainCount domains and \a ptCount points
+  static axom::IndexType maxMessageBytes(axom::IndexType domainCount,
+                                         axom::IndexType ptCount)
+  {
+    constexpr axom::IndexType A = BinaryMessageWriter::ALIGNMENT;
+    constexpr axom::IndexType ptBytes = 3 * sizeof(axom::IndexType) +
+      sizeof(PointType) + sizeof(ParamType) + sizeof(double);
+    return (HEADER_SIZE + 2 * domainCount) * sizeof(std::int64_t) +
+      5 * A * (domainCount + 1) + ptCount * ptBytes;
+  }
+
+  /// Upper bound on the bytes of a message for the query partition of
+  /// \a rank, whose domain and point counts are in \a allQuerySizes
+  static axom::IndexType maxMessageBytes(
+    const axom::Array<std::int64_t>& allQuerySizes,
+    int rank)
+  {
+    return maxMessageBytes(allQuerySizes[2 * rank],
+                           allQuerySizes[2 * rank + 1]);
+  }
+
+#ifdef AXOM_DEBUG
+  /*!
+   * Check that rank r is in \a requesters exactly when this rank is in
+   * the recipients of rank r.  Otherwise, a posted receive would never
+   * complete or a message would have no matching receive.
+   */
+  void checkExchangeSymmetry(const std::vector<int>& requesters,
+                             const std::vector<int>& recipients) const
+  {
+    std::vector<int> isRecipient(m_nranks, 0);
+    for(const int r : recipients)
+    {
+      isRecipient[r] = 1;
+    }
+    std::vector<int> isRequester(m_nranks, 0);
+    MPI_Alltoall(isRecipient.data(),
+                 1,
+                 MPI_INT,
+                 isRequester.data(),
+                 1,
+                 MPI_INT,
+                 m_mpiComm);
+
+    std::vector<int> expected(m_nranks, 0);
+    for(const int r : requesters)
+    {
+      expected[r] = 1;
+    }
+    for(int r = 0; r < m_nranks; ++r)
+    {
+      SLIC_ERROR_IF(expected[r] != isRequester[r],
+                    fmt::format("Rank {} {} candidates from rank {}, which "
+                                "does not agree",
+                                m_rank,
+                                expected[r] ? "expects" : "does not expect",
+                                r));
+    }
+  }
+#endif
+
+  /*!
+   * Pack the query points of \a xferNode that might have a closer point
+   * in the object partition bounded by \a objectBb into \a buffer.
+   *
+   * A point is a candidate if its squared distance to \a objectBb is
+   * less than the squared distance to its closest point found so far,
+   * or within the threshold if none was found.
+   *
+   * Message layout (all entries 8-byte aligned):
+   *   - header: homeRank, sender rank, domain count
+   *   - per domain: domain index, candidate count n, n coordinates,
+   *     n indices in the home domain, n current best squared distances
+   */
+  void pack_candidates(conduit::Node& xferNode,
+                       const BoxType& objectBb,
+                       axom::Array<char>& buffer) const
+  {
+    conduit::Node& xferDoms = xferNode.fetch_existing("xferDoms");
+    const std::int64_t domainCount = xferDoms.number_of_children();
+    // Closest points are uninitialized before the local search.
+    const bool isFirst = xferNode.has_path("is_first");
+
+    BinaryMessageWriter writer(buffer);
+    writer.write<std::int64_t>(m_rank);
+    writer.write<std::int64_t>(m_rank);
+    writer.write(domainCount);
+
+    std::vector<axom::IndexType> qPtIndices;
+    std::vector<double> sqDists;
+    for(std::int64_t di = 0; di < domainCount; ++di)
+    {
+      conduit::Node& xferDom = xferDoms.child(di);
+      const int qPtCount = xferDom.fetch_existing("qPtCount").value();
+      auto queryPts =
+        ArrayView_from_Node<PointType>(xferDom.fetch_existing("coords"),
+                                       qPtCount);
+      auto cpRanks =
+        ArrayView_from_Node<axom::IndexType>(xferDom.fetch_existing("cp_rank"),
+                                             qPtCount);
+      auto cpCoords =
+        ArrayView_from_Node<PointType>(xferDom.fetch_existing("cp_coords"),
+                                       qPtCount);
+
+      qPtIndices.clear();
+      sqDists.clear();
+      for(int i = 0; i < qPtCount; ++i)
+      {
+        const double sqDist = primal::squared_distance(queryPts[i], objectBb);
+        const bool hasCp = !isFirst && cpRanks[i] >= 0;
+        const double bestSqDist = hasCp
+          ? primal::squared_distance(queryPts[i], cpCoords[i])
+          : m_sqDistanceThreshold;
+        if(hasCp ? sqDist < bestSqDist : sqDist <= bestSqDist)
+        {
+          qPtIndices.push_back(i);
+          sqDists.push_back(bestSqDist);
+        }
+      }
+
+      const std::int64_t candidateCount = qPtIndices.size();
+      writer.write(di);
+      writer.write(candidateCount);
+
+      PointArray coords(candidateCount, candidateCount);
+      for(std::int64_t j = 0; j < candidateCount; ++j)
+      {
+        coords[j] = queryPts[qPtIndices[j]];
+      }
+      writer.writeArray(coords.data(), candidateCount);
+      writer.writeArray(qPtIndices.data(), candidateCount);
+      writer.writeArray(sqDists.data(), candidateCount);
+    }
+  }
+
+  /*!
+   * Search the local object partition for the candidates in a message
+   * packed by pack_candidates(), and pack the candidates for which this
+   * rank found a closer point into \a buffer.
+   *
+   * The candidates' current best squared distances bound the search.
+   *
+   * Message layout (all entries 8-byte aligned):
+   *   - header: homeRank, sender rank, domain count
+   *   - per domain: domain index, count n of closer points, n indices in
+   *     the home domain, n cp_index, n cp_domain_index, n cp_coords and,
+   *     for segment or triangle object meshes, n cp_parametric
+   *
+   * \return The home rank of the candidates
+   */
+  int answer_candidates(BinaryMessageReader& reader,
+                        axom::Array<char>& buffer) const
+  {
+    const std::int64_t homeRank = reader.read<std::int64_t>();
+    reader.read<std::int64_t>();
+    const std::int64_t domainCount = reader.read<std::int64_t>();
+
+    BinaryMessageWriter writer(buffer);
+    writer.write(homeRank);
+    writer.write<std::int64_t>(m_rank);
+    writer.write(domainCount);
+
+    std::vector<axom::IndexType> replyQPtIndices;
+    std::vector<axom::IndexType> replyCpIndexes;
+    std::vector<axom::IndexType> replyCpDomainIndexes;
+    std::vector<PointType> replyCpCoords;
+    std::vector<ParamType> replyCpParams;
+    const bool hasParams = m_objectElemVerts > 1;
+    for(std::int64_t d = 0; d < domainCount; ++d)
+    {
+      const std::int64_t di = reader.read<std::int64_t>();
+      const std::int64_t qPtCount = reader.read<std::int64_t>();
+      auto queryPts =
+        axom::ArrayView<PointType>(reader.readArray<PointType>(qPtCount),
+                                   qPtCount);
+      const axom::IndexType* qPtIndices =
+        reader.readArray<axom::IndexType>(qPtCount);
+      auto cpSqDists =
+        axom::ArrayView<double>(reader.readArray<double>(qPtCount), qPtCount);
+
+      axom::Array<axom::IndexType> cpIndexes(qPtCount, qPtCount);
+      axom::Array<axom::IndexType> cpDomainIndexes(qPtCount, qPtCount);
+      axom::Array<axom::IndexType> cpRanks(qPtCount, qPtCount);
+      PointArray cpCoords(qPtCount, qPtCount);
+      const axom::IndexType paramCount = hasParams ? qPtCount : 0;
+      ParamArray cpParams(paramCount, paramCount);
+
+      QueryBatch batch;
+      batch.queryPts = queryPts;
+      batch.cpSqDists = cpSqDists;
+      batch.cpIndexes = cpIndexes.view();
+      batch.cpDomainIndexes = cpDomainIndexes.view();
+      batch.cpRanks = cpRanks.view();
+      batch.cpCoords = cpCoords.view();
+      batch.cpParams = cpParams.view();
+      batch.isFirst = true;
+      computeLocalClosestPointsByPolicy(batch);
+
+      replyQPtIndices.clear();
+      replyCpIndexes.clear();
+      replyCpDomainIndexes.clear();
+      replyCpCoords.clear();
+      replyCpParams.clear();
+      for(std::int64_t i = 0; i < qPtCount; ++i)
+      {
+        if(cpRanks[i] == m_rank)
+        {
+          replyQPtIndices.push_back(qPtIndices[i]);
+          replyCpIndexes.push_back(cpIndexes[i]);
+          replyCpDomainIndexes.push_back(cpDomainIndexes[i]);
+          replyCpCoords.push_back(cpCoords[i]);
+          if(hasParams)
+          {
+            replyCpParams.push_back(cpParams[i]);
+          }
+        }
+      }
+
+      const std::int64_t replyCount = replyQPtIndices.size();
+      writer.write(di);
+      writer.write(replyCount);
+      writer.writeArray(replyQPtIndices.data(), replyCount);
+      writer.writeArray(replyCpIndexes.data(), replyCount);
+      writer.writeArray(replyCpDomainIndexes.data(), replyCount);
+      writer.writeArray(replyCpCoords.data(), replyCount);
+      if(hasParams)
+      {
+        writer.writeArray(replyCpParams.data(), replyCount);
+      }
+    }
+
+    return static_cast<int>(homeRank);
+  }
+
+  /*!
+   * Merge closest points from a message packed by answer_candidates()
+   * into \a xferNode.
+   *
+   * A returned point replaces the current closest point if it is closer.
+   * Ties go to the lower rank, so the result does not depend on the
+   * order in which replies arrive.
+   */
+  void merge_reply(BinaryMessageReader& reader, conduit::Node& xferNode) const
+  {
+    reader.read<std::int64_t>();
+    const axom::IndexType replyRank = reader.read<std::int64_t>();
+    const std::int64_t domainCount = reader.read<std::int64_t>();
+    const bool hasParams = m_objectElemVerts > 1;
+
+    conduit::Node& xferDoms = xferNode.fetch_existing("xferDoms");
+    for(std::int64_t d = 0; d < domainCount; ++d)
+    {
+      const std::int64_t di = reader.read<std::int64_t>();
+      const std::int64_t replyCount = reader.read<std::int64_t>();
+      const axom::IndexType* replyQPtIndices =
+        reader.readArray<axom::IndexType>(replyCount);
+      const axom::IndexType* replyCpIndexes =
+        reader.readArray<axom::IndexType>(replyCount);
+      const axom::IndexType* replyCpDomainIndexes =
+        reader.readArray<axom::IndexType>(replyCount);
+      const PointType* replyCpCoords = reader.readArray<PointType>(replyCount);
+      const ParamType* replyCpParams =
+        hasParams ? reader.readArray<ParamType>(replyCount) : nullptr;
+
+      conduit::Node& xferDom = xferDoms.child(di);
+      const int qPtCount = xferDom.fetch_existing("qPtCount").value();
+      auto queryPts =
+        ArrayView_from_Node<PointType>(xferDom.fetch_existing("coords"),
+                                       qPtCount);
+      auto cpIndexes =
+        ArrayView_from_Node<axom::IndexType>(xferDom.fetch_existing("cp_index"),
+                                             qPtCount);
+      auto cpDomainIndexes = ArrayView_from_Node<axom::IndexType>(
+        xferDom.fetch_existing("cp_domain_index"),
+        qPtCount);
+      auto cpRanks =
+        ArrayView_from_Node<axom::IndexType>(xferDom.fetch_existing("cp_rank"),
+                                             qPtCount);
+      auto cpCoords =
+        ArrayView_from_Node<PointType>(xferDom.fetch_existing("cp_coords"),
+                                       qPtCount);
+      const bool has_cp_distance = xferDom.has_path("debug/cp_distance");
+      auto minDist = has_cp_distance
+        ? ArrayView_from_Node<double>(
+            xferDom.fetch_existing("debug/cp_distance"),
+            qPtCount)
+        : ArrayView<double>();
+      const bool has_cp_param = hasParams && xferDom.has_path("cp_parametric");
+      auto cpParams = has_cp_param
+        ? ArrayView_from_Node<ParamType>(xferDom.fetch_existing("cp_parametric"),
+                                         qPtCount)
+        : ArrayView<ParamType>();
+
+      for(std::int64_t j = 0; j < replyCount; ++j)
+      {
+        const axom::IndexType i = replyQPtIndices[j];
+        const double sqDist =
+          primal::squared_distance(queryPts[i], replyCpCoords[j]);
+        bool isCloser = cpRanks[i] < 0;
+        if(!isCloser)
+        {
+          const double curSqDist =
+            primal::squared_distance(queryPts[i], cpCoords[i]);
+          isCloser = sqDist < curSqDist ||
+            (sqDist == curSqDist && replyRank < cpRanks[i]);
+        }
+
+        if(isCloser)
+        {
+          cpIndexes[i] = replyCpIndexes[j];
+          cpDomainIndexes[i] = replyCpDomainIndexes[j];
+          cpRanks[i] = replyRank;
+          cpCoords[i] = replyCpCoords[j];
+          if(has_cp_param)
+          {
+            cpParams[i] = replyCpParams[j];
+          }
+          if(has_cp_distance)
+          {
+            minDist[i] = sqrt(sqDist);
+          }
+        }
+      }
+    }
+  }
+
   /*
     Special copy from coordinates (in a format that's not
     necessarily interleaved) to a 1D array of interleaved values).
@@ -800,25 +1479,45 @@ public:
    *   - cp_rank: Will hold the rank of the object point containing the closest point
    *   - cp_domain_index: will hold the index of the object domain containing
    *     the closest points.
-   *   - cp_index: Will hold the index of the closest object points.
+   *   - cp_index: Will hold the index of the closest object points,
+   *     or of the closest segments or triangles for element object meshes.
    *     For multiple object mesh domains on a rank, cp_index is relative to
    *     each domain.
    *   - cp_coords: Will hold the coordinates of the closest points
    *     interleaved in a 1D array.
    *
+   * If \a queryMesh has a two-component cp_parametric field, it will hold
+   * the parametric coordinates of the closest points in their object
+   * elements: (t, 0) on segments and (r, s) on triangles, such that
+   * cp = v0 + r * (v1 - v0) + s * (v2 - v0).  It is (0, 0) for point meshes.
+   *
    * \note The current implementation assumes that the coordinates and
    * cp_coords are interleaved or contiguous.
    *
    * \note We're temporarily also using a cp_distance field while debugging this class.
    * The code will use this field if it is present in \a queryMesh.
    *
+   * Each rank first searches its own object partition.  It then sends
+   * to every rank whose object partition bounding box is within the
+   * threshold of its query points only those points that could improve
+   * on their current closest point, along with their current best
+   * squared distance.  Recipients search with that tightened radius
+   * and reply with the points they improved.
+   *
+   * Messages use a fixed binary layout (see pack_candidates() and
+   * answer_candidates()) rather than serialized conduit nodes, so they
+   * can be received into pre-posted, reused buffers and read in place.
    * We use non-blocking sends for performance and deadlock avoidance.
-   * The worst case could incur nranks^2 sends.  To avoid excessive
-   * buffer usage, we occasionally check the sends for completion,
-   * using check_send_requests().
+   * The worst case could incur 2*nranks^2 sends.
+   *
+   * When pipelined (see setPipelined()), the candidates are sent before
+   * the local search, filtered by the threshold only, and the local
+   * search overlaps the exchange.  Per-rank search and idle times of the
+   * most recent query are available from getLocalSearchTime(),
+   * getRemoteSearchTime() and getIdleTime().
    */
   void computeClosestPoints(conduit::Node& queryMesh_,
-                            const std::string& topologyName) const
+                            const std::string& topologyName)
   {
     SLIC_ASSERT_MSG(
       isBVHTreeInitialized(),
@@ -835,233 +1534,289 @@ public:
     }
     conduit::Node& queryMesh = qmIsMultidomain ? queryMesh_ : *tmpNode;
 
-    std::map<int, std::shared_ptr<conduit::Node>> xferNodes;
-
     // create conduit Node containing data that has to xfer between ranks.
     // The node will be mostly empty if there are no domains on this rank
-    {
-      xferNodes[m_rank] = std::make_shared<conduit::Node>();
-      conduit::Node& xferNode = *xferNodes[m_rank];
-      node_copy_query_to_xfer(queryMesh, xferNode, topologyName);
-      xferNode["homeRank"] = m_rank;
-    }
+    conduit::Node myXferNode;
+    node_copy_query_to_xfer(queryMesh, myXferNode, topologyName);
 
-    BoxType myQueryBb = computeMeshBoundingBox(*xferNodes[m_rank]);
-    put_bounding_box_to_conduit_node(myQueryBb, xferNodes[m_rank]->fetch("aabb"));
+    BoxType myQueryBb = computeMeshBoundingBox(myXferNode);
     BoxArray allQueryBbs;
     gatherBoundingBoxes(myQueryBb, allQueryBbs);
-
+    axom::Array<std::int64_t> allQuerySizes;
+    gatherQuerySizes(myXferNode, allQuerySizes);
+
+    m_localSearchTime = 0.;
+    m_remoteSearchTime = 0.;
+    m_idleTime = 0.;
+    axom::utilities::Timer timer;
+    auto timed = [&timer](double& seconds, auto&& f) {
+      timer.start();
+      f();
+      timer.stop();
+      seconds += timer.elapsedTimeInSec();
+    };
+
+    // Unless pipelined, search the local object partition first, to
+    // tighten the search radius of the points sent to other ranks.
+    if(!m_isPipelined)
     {
-      conduit::Node& xferNode = *xferNodes[m_rank];
-      computeLocalClosestPointsByPolicy(xferNode);
+      timed(m_localSearchTime, [&]() { computeLocalClosestPoints(myXferNode); });
     }
 
+    /*
+      Ranks whose query points are close to our object partition send us
+      candidates; ranks whose object partitions are close to our query
+      points get our candidates and reply.  Both sides know the message
+      sources and size bounds, so all receives are posted up front.
+    */
     const auto& myObjectBb = m_objectPartitionBbs[m_rank];
-    int remainingRecvs = 0;
-    for(int r = 0; r < m_nranks; ++r)
+    std::vector<int> requesters;
+    std::vector<int> recipients;
+    for(int i = 1; i < m_nranks; ++i)
     {
-      if(r != m_rank)
+      const int r = (m_rank + i) % m_nranks;
+      if(isClosePartition(allQueryBbs[r], myObjectBb))
       {
-        const auto& otherQueryBb = allQueryBbs[r];
-        double sqDistance =
-          axom::primal::squared_distance(otherQueryBb, myObjectBb);
-        if(sqDistance <= m_sqDistanceThreshold)
-        {
-          ++remainingRecvs;
-        }
+        requesters.push_back(r);
+      }
+      if(isClosePartition(myQueryBb, m_objectPartitionBbs[r]))
+      {
+        recipients.push_back(r);
       }
     }
+#ifdef AXOM_DEBUG
+    checkExchangeSymmetry(requesters, recipients);
+#endif
 
-    // arbitrary tags for send/recv xferNode.
-    const int tag = 987342;
-
-    std::list<conduit::relay::mpi::Request> isendRequests;
-
+    // arbitrary tags for candidate and reply messages.
+    const int requestTag = 987342;
+    const int replyTag = 987343;
+
+    /*
+      The receives are persistent requests on m_recvBuffers.  Repeated
+      queries usually exchange with the same ranks, so a request is only
+      re-created when its source, tag or size bound changes.
+    */
+    const int recvCount =
+      static_cast<int>(requesters.size() + recipients.size());
+    if(static_cast<int>(m_recvSpecs.size()) < recvCount)
+    {
+      m_recvBuffers.resize(recvCount);
+      m_recvSpecs.resize(recvCount);
+      m_recvRequests.resize(recvCount, MPI_REQUEST_NULL);
+    }
+    for(int ri = 0; ri < recvCount; ++ri)
     {
-      /*
-        Send local query mesh to next rank with close-enough object
-        partition, if any.  Increase remainingRecvs, because this data
-        will come back.
-      */
-      int firstRecipForMyQuery = next_recipient(*xferNodes[m_rank]);
-      if(m_nranks == 1)
+      const bool isRequest = ri < static_cast<int>(requesters.size());
+      RecvSpec spec;
+      spec.source = isRequest ? requesters[ri]
+                              : recipients[ri - requesters.size()];
+      spec.tag = isRequest ? requestTag : replyTag;
+      spec.maxBytes =
+        maxMessageBytes(allQuerySizes, isRequest ? spec.source : m_rank);
+      if(spec == m_recvSpecs[ri] && m_recvRequests[ri] != MPI_REQUEST_NULL)
       {
-        SLIC_ASSERT(firstRecipForMyQuery == -1);
+        continue;
       }
 
-      if(firstRecipForMyQuery == -1)
-      {
-        // No need to send anywhere.  Put computed data back into queryMesh.
-        node_copy_xfer_to_query(*xferNodes[m_rank], queryMesh);
-        xferNodes.erase(m_rank);
-      }
-      else
+      SLIC_ERROR_IF(
+        spec.maxBytes > std::numeric_limits<int>::max(),
+        fmt::format("Messages from rank {} may have {} bytes, more than "
+                    "an MPI count can hold",
+                    spec.source,
+                    spec.maxBytes));
+      if(m_recvRequests[ri] != MPI_REQUEST_NULL)
       {
-        isendRequests.emplace_back(conduit::relay::mpi::Request());
-        auto& req = isendRequests.back();
-        relay::mpi::isend_using_schema(*xferNodes[m_rank],
-                                       firstRecipForMyQuery,
-                                       tag,
-                                       m_mpiComm,
-                                       &req);
-        ++remainingRecvs;
+        MPI_Request_free(&m_recvRequests[ri]);
       }
+      auto& buffer = m_recvBuffers[ri];
+      buffer.resize(spec.maxBytes);
+      MPI_Recv_init(buffer.data(),
+                    static_cast<int>(spec.maxBytes),
+                    MPI_BYTE,
+                    spec.source,
+                    spec.tag,
+                    m_mpiComm,
+                    &m_recvRequests[ri]);
+      m_recvSpecs[ri] = spec;
+    }
+    if(recvCount > 0)
+    {
+      MPI_Startall(recvCount, m_recvRequests.data());
+    }
+
+    m_sentBytes = 0;
+    m_sentMessages = 0;
+    if(static_cast<int>(m_sendBuffers.size()) < recvCount)
+    {
+      m_sendBuffers.resize(recvCount);
+    }
+    std::vector<MPI_Request> sendRequests;
+    sendRequests.reserve(recvCount);
+    auto isend = [&](axom::Array<char>& buffer, int dest, int tag) {
+      SLIC_ERROR_IF(buffer.size() > std::numeric_limits<int>::max(),
+                    fmt::format("Message of {} bytes for rank {} is more "
+                                "than an MPI count can hold",
+                                buffer.size(),
+                                dest));
+      sendRequests.push_back(MPI_REQUEST_NULL);
+      MPI_Isend(buffer.data(),
+                static_cast<int>(buffer.size()),
+                MPI_BYTE,
+                dest,
+                tag,
+                m_mpiComm,
+                &sendRequests.back());
+      m_sentBytes += buffer.size();
+      ++m_sentMessages;
+    };
+
+    std::unique_ptr<MpiProgressThread> progressThread;
+    if(m_useProgressThread)
+    {
+      progressThread = std::make_unique<MpiProgressThread>(m_mpiComm);
     }
 
-    while(remainingRecvs > 0)
+    /*
+      Send each recipient only the query points that might improve on
+      the closest point found so far, with their current best squared
+      distance.
+    */
+    for(const int r : recipients)
+    {
+      auto& buffer = m_sendBuffers[sendRequests.size()];
+      pack_candidates(myXferNode, m_objectPartitionBbs[r], buffer);
+      SLIC_ERROR_IF(buffer.size() > maxMessageBytes(allQuerySizes, m_rank),
+                    fmt::format("Candidate message of {} bytes for rank {} "
+                                "exceeds its receive bound",
+                                buffer.size(),
+                                r));
+      isend(buffer, r, requestTag);
+    }
+
+    // When pipelined, the local search overlaps the exchange.
+    if(m_isPipelined)
+    {
+      timed(m_localSearchTime, [&]() { computeLocalClosestPoints(myXferNode); });
+    }
+
+    // All receives are posted, so later messages arrive while we search
+    // for the earlier ones.
+    for(int remainingRecvs = recvCount; remainingRecvs > 0; --remainingRecvs)
     {
       SLIC_INFO_IF(
         m_isVerbose,
         fmt::format("=======  {} receives remaining =======", remainingRecvs));
 
-      // Receive the next xferNode
-      std::shared_ptr<conduit::Node> recvXferNodePtr =
-        std::make_shared<conduit::Node>();
-      relay::mpi::recv_using_schema(*recvXferNodePtr,
-                                    MPI_ANY_SOURCE,
-                                    tag,
-                                    m_mpiComm);
+      int ri = MPI_UNDEFINED;
+      MPI_Status status;
+      timed(m_idleTime, [&]() {
+        MPI_Waitany(recvCount, m_recvRequests.data(), &ri, &status);
+      });
+      int msgBytes = 0;
+      MPI_Get_count(&status, MPI_BYTE, &msgBytes);
+      BinaryMessageReader reader(m_recvBuffers[ri].data(), msgBytes);
 
-      const int homeRank = recvXferNodePtr->fetch_existing("homeRank").as_int();
-      --remainingRecvs;
-      xferNodes[homeRank] = recvXferNodePtr;
-      conduit::Node& xferNode = *xferNodes[homeRank];
-
-      if(homeRank == m_rank)
+      if(status.MPI_TAG == requestTag)
       {
-        node_copy_xfer_to_query(xferNode, queryMesh);
+        auto& buffer = m_sendBuffers[sendRequests.size()];
+        int homeRank = -1;
+        timed(m_remoteSearchTime,
+              [&]() { homeRank = answer_candidates(reader, buffer); });
+        SLIC_ERROR_IF(
+          buffer.size() > maxMessageBytes(allQuerySizes, homeRank),
+          fmt::format("Reply message of {} bytes for rank {} exceeds its "
+                      "receive bound",
+                      buffer.size(),
+                      homeRank));
+        isend(buffer, homeRank, replyTag);
       }
       else
       {
-        computeLocalClosestPointsByPolicy(xferNode);
-
-        isendRequests.emplace_back(conduit::relay::mpi::Request());
-        auto& isendRequest = isendRequests.back();
-        int nextRecipient = next_recipient(xferNode);
-        SLIC_ASSERT(nextRecipient != -1);
-        relay::mpi::isend_using_schema(xferNode,
-                                       nextRecipient,
-                                       tag,
-                                       m_mpiComm,
-                                       &isendRequest);
-
-        // Check non-blocking sends to free memory.
-        check_send_requests(isendRequests, false);
+        // Reply to one of our own requests.
+        merge_reply(reader, myXferNode);
       }
+    }
 
-    }  // remainingRecvs loop
+    // Put computed data back into queryMesh.
+    node_copy_xfer_to_query(myXferNode, queryMesh);
+
+    SLIC_INFO_IF(m_isVerbose,
+                 fmt::format("Sent {} messages with {} bytes",
+                             m_sentMessages,
+                             m_sentBytes));
 
     // Complete remaining non-blocking sends.
-    while(!isendRequests.empty())
+    timed(m_idleTime, [&]() {
+      MPI_Waitall(static_cast<int>(sendRequests.size()),
+                  sendRequests.data(),
+                  MPI_STATUSES_IGNORE);
+    });
+
+    if(progressThread)
     {
-      check_send_requests(isendRequests, true);
+      progressThread->stop();
     }
 
-    MPI_Barrier(m_mpiComm);
+    SLIC_INFO_IF(m_isVerbose,
+                 fmt::format("Searched locally for {} s, for other ranks for "
+                             "{} s and waited for {} s",
+                             m_localSearchTime,
+                             m_remoteSearchTime,
+                             m_idleTime));
+
+    timed(m_idleTime, [&]() { MPI_Barrier(m_mpiComm); });
     slic::flushStreams();
   }
 
 private:
-  /// Distance search using local object partition and xferNode.
-  void computeLocalClosestPointsByPolicy(conduit::Node& xferNode) const
+  /// Frees the persistent receives, which are all inactive between queries
+  void freeRecvRequests()
+  {
+    int mpiIsFinalized = 0;
+    MPI_Finalized(&mpiIsFinalized);
+    for(auto& request : m_recvRequests)
+    {
+      if(request != MPI_REQUEST_NULL && !mpiIsFinalized)
+      {
+        MPI_Request_free(&request);
+      }
+      request = MPI_REQUEST_NULL;
+    }
+    m_recvSpecs.clear();
+    m_recvRequests.clear();
+    m_recvBuffers.clear();
+  }
+
+  /// Distance search using local object partition and query batch.
+  void computeLocalClosestPointsByPolicy(const QueryBatch& batch) const
   {
     switch(m_runtimePolicy)
     {
     case RuntimePolicy::seq:
-      computeLocalClosestPoints<SeqBVHTree>(m_bvh_seq.get(), xferNode);
+      computeLocalClosestPoints<SeqBVHTree>(m_bvh_seq.get(), batch);
       break;
 
 #ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
     case RuntimePolicy::omp:
-      computeLocalClosestPoints<OmpBVHTree>(m_bvh_omp.get(), xferNode);
+      computeLocalClosestPoints<OmpBVHTree>(m_bvh_omp.get(), batch);
 #endif
       break;
 
 #ifdef AXOM_RUNTIME_POLICY_USE_CUDA
     case RuntimePolicy::cuda:
-      computeLocalClosestPoints<CudaBVHTree>(m_bvh_cuda.get(), xferNode);
+      computeLocalClosestPoints<CudaBVHTree>(m_bvh_cuda.get(), batch);
 #endif
       break;
 
 #ifdef AXOM_RUNTIME_POLICY_USE_HIP
     case RuntimePolicy::hip:
-      computeLocalClosestPoints<HipBVHTree>(m_bvh_hip.get(), xferNode);
+      computeLocalClosestPoints<HipBVHTree>(m_bvh_hip.get(), batch);
 #endif
       break;
     }
   }
 
-  /**
-    Determine the next rank (in ring order) with an object partition
-    close to the query points in xferNode.  The intent is to send
-    xferNode there next.
-  */
-  int next_recipient(const conduit::Node& xferNode) const
-  {
-    int homeRank = xferNode.fetch_existing("homeRank").value();
-    BoxType bb;
-    get_bounding_box_from_conduit_node(bb, xferNode.fetch_existing("aabb"));
-    for(int i = 1; i < m_nranks; ++i)
-    {
-      int maybeNextRecip = (m_rank + i) % m_nranks;
-      if(maybeNextRecip == homeRank)
-      {
-        return maybeNextRecip;
-      }
-      double sqDistance =
-        primal::squared_distance(bb, m_objectPartitionBbs[maybeNextRecip]);
-      if(sqDistance <= m_sqDistanceThreshold)
-      {
-        return maybeNextRecip;
-      }
-    }
-    return -1;
-  }
-
-  /// Wait for some non-blocking sends (if any) to finish.
-  void check_send_requests(std::list<conduit::relay::mpi::Request>& isendRequests,
-                           bool atLeastOne) const
-  {
-    std::vector<MPI_Request> reqs;
-    for(auto& isr : isendRequests)
-    {
-      reqs.push_back(isr.m_request);
-    }
-
-    int inCount = static_cast<int>(reqs.size());
-    int outCount = 0;
-    std::vector<int> indices(reqs.size(), -1);
-    if(atLeastOne)
-    {
-      MPI_Waitsome(inCount,
-                   reqs.data(),
-                   &outCount,
-                   indices.data(),
-                   MPI_STATUSES_IGNORE);
-    }
-    else
-    {
-      MPI_Testsome(inCount,
-                   reqs.data(),
-                   &outCount,
-                   indices.data(),
-                   MPI_STATUSES_IGNORE);
-    }
-    indices.resize(outCount);
-
-    auto reqIter = isendRequests.begin();
-    int prevIdx = 0;
-    for(const int idx : indices)
-    {
-      for(; prevIdx < idx; ++prevIdx)
-      {
-        ++reqIter;
-      }
-      reqIter = isendRequests.erase(reqIter);
-      ++prevIdx;
-    }
-  }
-
   /**
    * \brief Extracts a field \a fieldName from the mesh blueprint
    *
@@ -1098,37 +1853,320 @@ public:
 
     SLIC_ASSERT(bvh != nullptr);
 
-    const int npts = m_objectPtCoords.size();
-    axom::Array<BoxType> boxesArray(npts, npts, m_allocatorID);
+    // Leaves are the object points or the boxes of the object elements
+    const int nverts = m_objectElemVerts;
+    const int nleaves = objectLeafCount();
+    axom::Array<BoxType> boxesArray(nleaves, nleaves, m_allocatorID);
     auto boxesView = boxesArray.view();
     auto pointsView = m_objectPtCoords.view();
+    auto connView = m_objectElemConn.view();
 
     axom::for_all<ExecSpace>(
-      npts,
-      AXOM_LAMBDA(axom::IndexType i) { boxesView[i] = BoxType {pointsView[i]}; });
+      nleaves,
+      AXOM_LAMBDA(axom::IndexType i) {
+        if(nverts == 1)
+        {
+          boxesView[i] = BoxType {pointsView[i]};
+        }
+        else
+        {
+          BoxType bb;
+          for(int v = 0; v < nverts; ++v)
+          {
+            bb.addPoint(pointsView[connView[nverts * i + v]]);
+          }
+          boxesView[i] = bb;
+        }
+      });
 
     // Build bounding volume hierarchy
     bvh->setAllocatorID(m_allocatorID);
-    int result = bvh->initialize(boxesView, npts);
+    int result = bvh->initialize(boxesView, nleaves);
 
     gatherBVHRoots();
 
     return (result == spin::BVH_BUILD_OK);
   }
 
+  /// Number of BVH leaves: object points, segments or triangles
+  axom::IndexType objectLeafCount() const
+  {
+    return m_objectElemVerts == 1 ? m_objectPtCoords.size()
+                                  : m_objectElemConn.size() / m_objectElemVerts;
+  }
+
   /**
-   * This method assumes xferNode is a blueprint single-domain mesh.
+   * Parametric coordinates (r, s) of point \a p in triangle \a tri, such that
+   * p = v0 + r * (v1 - v0) + s * (v2 - v0).
+   *
+   * \note Unlike Triangle::physToBarycentric(), this is usable in device
+   * kernels.  Degenerate triangles return (0, 0).
+   */
+  AXOM_HOST_DEVICE static ParamType triangleParams(const TriangleType& tri,
+                                                   const PointType& p)
+  {
+    using VectorType = primal::Vector<double, DIM>;
+    const VectorType e1(tri[0], tri[1]);
+    const VectorType e2(tri[0], tri[2]);
+    const VectorType d(tri[0], p);
+
+    const double a = e1.dot(e1);
+    const double b = e1.dot(e2);
+    const double c = e2.dot(e2);
+    const double det = a * c - b * b;
+    if(det <= 0.)
+    {
+      return ParamType {0., 0.};
+    }
+
+    const double f = e1.dot(d);
+    const double g = e2.dot(d);
+    return ParamType {(c * f - b * g) / det, (a * g - b * f) / det};
+  }
+
+  /**
+   * Search the local object partition for the closest points to the
+   * query points in \a batch, updating its closest point fields.
    */
   template <typename BVHTreeType>
   void computeLocalClosestPoints(const BVHTreeType* bvh,
-                                 conduit::Node& xferNode) const
+                                 const QueryBatch& batch) const
   {
     using ExecSpace = typename BVHTreeType::ExecSpaceType;
     using axom::primal::squared_distance;
 
+    const bool hasObjectPoints = objectLeafCount() > 0;
+    const bool is_first = batch.isFirst;
+    const int qPtCount = batch.queryPts.size();
+
+    auto queryPts = batch.queryPts;
+    auto cpIndexes = batch.cpIndexes;
+    auto cpDomainIndexes = batch.cpDomainIndexes;
+    auto cpRanks = batch.cpRanks;
+    auto cpCoords = batch.cpCoords;
+
+    /// Create ArrayViews in ExecSpace that are compatible with fields
+    // This deep-copies host memory in batch to device memory.
+    // TODO: Avoid copying arrays (here and at the end) if both are on the host
+    auto cp_idx = is_first
+      ? axom::Array<axom::IndexType>(qPtCount, qPtCount, m_allocatorID)
+      : axom::Array<axom::IndexType>(cpIndexes, m_allocatorID);
+    auto cp_domidx = is_first
+      ? axom::Array<axom::IndexType>(qPtCount, qPtCount, m_allocatorID)
+      : axom::Array<axom::IndexType>(cpDomainIndexes, m_allocatorID);
+    auto cp_rank = is_first
+      ? axom::Array<axom::IndexType>(qPtCount, qPtCount, m_allocatorID)
+      : axom::Array<axom::IndexType>(cpRanks, m_allocatorID);
+
+    /// PROBLEM: The striding does not appear to be retained by conduit relay
+    ///          We might need to transform it? or to use a single array w/ pointers into it?
+    auto cp_pos = is_first
+      ? axom::Array<PointType>(qPtCount, qPtCount, m_allocatorID)
+      : axom::Array<PointType>(cpCoords, m_allocatorID);
+
+    const bool has_cp_param = !batch.cpParams.empty();
+    auto cpParams = batch.cpParams;
+    auto cp_param = has_cp_param
+      ? (is_first ? axom::Array<ParamType>(qPtCount, qPtCount, m_allocatorID)
+                  : axom::Array<ParamType>(cpParams, m_allocatorID))
+      : axom::Array<ParamType>(0, 0, m_allocatorID);
+
+    // DEBUG
+    const bool has_cp_distance = !batch.minDists.empty();
+    auto minDist = batch.minDists;
+
+    auto cp_dist = has_cp_distance
+      ? (is_first ? axom::Array<double>(qPtCount, qPtCount, m_allocatorID)
+                  : axom::Array<double>(minDist, m_allocatorID))
+      : axom::Array<double>(0, 0, m_allocatorID);
+    // END DEBUG
+
+    // Candidates sent by another rank carry their current best squared
+    // distance, which bounds the search radius.
+    const bool has_cp_sqdist = !batch.cpSqDists.empty();
+    auto cp_sqdist = axom::Array<double>(batch.cpSqDists, m_allocatorID);
+
+    if(is_first)
+    {
+      cp_rank.fill(-1);
+      cp_idx.fill(-1);
+      cp_domidx.fill(-1);
+      const PointType nowhere(std::numeric_limits<double>::signaling_NaN());
+      cp_pos.fill(nowhere);
+      cp_param.fill(ParamType {0., 0.});
+      cp_dist.fill(std::numeric_limits<double>::signaling_NaN());
+    }
+    auto query_inds = cp_idx.view();
+    auto query_doms = cp_domidx.view();
+    auto query_ranks = cp_rank.view();
+    auto query_pos = cp_pos.view();
+    auto query_param = cp_param.view();
+    auto query_min_dist = cp_dist.view();
+    auto query_sqdist = cp_sqdist.view();
+
+    /// Create an ArrayView in ExecSpace that is compatible with queryPts
+    PointArray execPoints(queryPts, m_allocatorID);
+    auto query_pts = execPoints.view();
+
+    if(hasObjectPoints)
+    {
+      // Get a device-useable iterator
+      auto it = bvh->getTraverser();
+      const int rank = m_rank;
+
+      double* sqDistThresh = axom::allocate<double>(
+        1,
+        axom::execution_space<ExecSpace>::allocatorID());
+      *sqDistThresh = m_sqDistanceThreshold;
+
+      auto ptCoordsView = m_objectPtCoords.view();
+      auto ptDomainIdsView = m_objectPtDomainIds.view();
+      auto elemConnView = m_objectElemConn.view();
+      auto elemDomainIdsView = m_objectElemDomainIds.view();
+      const int nverts = m_objectElemVerts;
+
+      AXOM_PERF_MARK_SECTION(
+        "ComputeClosestPoints",
+        axom::for_all<ExecSpace>(
+          qPtCount,
+          AXOM_LAMBDA(std::int32_t idx) mutable {
+            PointType qpt = query_pts[idx];
+
+            MinCandidate curr_min {};
+            // Preset cur_min to the closest point found so far.
+            if(query_ranks[idx] >= 0)
+            {
+              curr_min.sqDist = squared_distance(qpt, query_pos[idx]);
+              curr_min.pointIdx = query_inds[idx];
+              curr_min.domainIdx = query_doms[idx];
+              curr_min.rank = query_ranks[idx];
+              curr_min.cp = query_pos[idx];
+              if(has_cp_param)
+              {
+                curr_min.param = query_param[idx];
+              }
+            }
+            else if(has_cp_sqdist)
+            {
+              curr_min.sqDist = query_sqdist[idx];
+            }
+
+            auto checkMinDist = [&](std::int32_t current_node,
+                                    const std::int32_t* leaf_nodes) {
+              const int candidate_idx = leaf_nodes[current_node];
+
+              // Closest point on the candidate point, segment or triangle
+              PointType candidate_pt;
+              ParamType candidate_param {0., 0.};
+              int candidate_domain_idx;
+              if(nverts == 1)
+              {
+                candidate_pt = ptCoordsView[candidate_idx];
+                candidate_domain_idx = ptDomainIdsView[candidate_idx];
+              }
+              else if(nverts == 2)
+              {
+                const SegmentType seg(
+                  ptCoordsView[elemConnView[2 * candidate_idx]],
+                  ptCoordsView[elemConnView[2 * candidate_idx + 1]]);
+                double t;
+                candidate_pt = primal::closest_point(qpt, seg, &t);
+                candidate_param[0] = t;
+                candidate_domain_idx = elemDomainIdsView[candidate_idx];
+              }
+              else
+              {
+                const TriangleType tri(
+                  ptCoordsView[elemConnView[3 * candidate_idx]],
+                  ptCoordsView[elemConnView[3 * candidate_idx + 1]],
+                  ptCoordsView[elemConnView[3 * candidate_idx + 2]]);
+                candidate_pt = primal::closest_point(qpt, tri);
+                candidate_param = triangleParams(tri, candidate_pt);
+                candidate_domain_idx = elemDomainIdsView[candidate_idx];
+              }
+              const double sq_dist = squared_distance(qpt, candidate_pt);
+
+              // An element's bounding box can be within the threshold
+              // while the element itself is not
+              if(sq_dist < curr_min.sqDist && sq_dist <= sqDistThresh[0])
+              {
+                curr_min.sqDist = sq_dist;
+                curr_min.pointIdx = candidate_idx;
+                curr_min.domainIdx = candidate_domain_idx;
+                curr_min.rank = rank;
+                curr_min.cp = candidate_pt;
+                curr_min.param = candidate_param;
+              }
+            };
+
+            auto traversePredicate = [&](const PointType& p,
+                                         const BoxType& bb) -> bool {
+              auto sqDist = squared_distance(p, bb);
+              return sqDist <= curr_min.sqDist && sqDist <= sqDistThresh[0];
+            };
+
+            // Traverse the tree, searching for the point with minimum distance.
+            it.traverse_tree(qpt, checkMinDist, traversePredicate);
+
+            // If modified, update the fields that changed
+            if(curr_min.rank == rank)
+            {
+              query_inds[idx] = curr_min.pointIdx;
+              query_doms[idx] = curr_min.domainIdx;
+              query_ranks[idx] = curr_min.rank;
+              query_pos[idx] = curr_min.cp;
+              if(has_cp_param)
+              {
+                query_param[idx] = curr_min.param;
+              }
+
+              //DEBUG
+              if(has_cp_distance)
+              {
+                query_min_dist[idx] = sqrt(curr_min.sqDist);
+              }
+            }
+          }););
+
+      axom::deallocate(sqDistThresh);
+    }
+
+    axom::copy(cpIndexes.data(),
+               query_inds.data(),
+               cpIndexes.size() * sizeof(axom::IndexType));
+    axom::copy(cpDomainIndexes.data(),
+               query_doms.data(),
+               cpDomainIndexes.size() * sizeof(axom::IndexType));
+    axom::copy(cpRanks.data(),
+               query_ranks.data(),
+               cpRanks.size() * sizeof(axom::IndexType));
+    axom::copy(cpCoords.data(),
+               query_pos.data(),
+               cpCoords.size() * sizeof(PointType));
+    if(has_cp_param)
+    {
+      axom::copy(cpParams.data(),
+                 query_param.data(),
+                 cpParams.size() * sizeof(ParamType));
+    }
+
+    // DEBUG
+    if(has_cp_distance)
+    {
+      axom::copy(minDist.data(),
+                 query_min_dist.data(),
+                 minDist.size() * sizeof(double));
+    }
+  }
+
+  /**
+   * This method assumes xferNode is a blueprint single-domain mesh.
+   */
+  void computeLocalClosestPoints(conduit::Node& xferNode) const
+  {
     // Note: There is some additional computation the first time this function
     // is called for a query node, even if the local object mesh is empty
-    const bool hasObjectPoints = m_objectPtCoords.size() > 0;
+    const bool hasObjectPoints = objectLeafCount() > 0;
     const bool is_first = xferNode.has_path("is_first");
     if(!hasObjectPoints && !is_first)
     {
@@ -1138,179 +2176,42 @@ public:
     conduit::Node& xferDoms = xferNode["xferDoms"];
     for(conduit::Node& xferDom : xferDoms.children())
     {
-      // --- Set up arrays and views in the execution space
-      // Arrays are initialized in that execution space the first time they are processed
-      // and are copied in during subsequent processing
-
       // Check dimension and extract the number of points
       SLIC_ASSERT(xferDom.fetch_existing("dim").as_int() == NDIMS);
       const int qPtCount = xferDom.fetch_existing("qPtCount").value();
 
       /// Extract fields from the input node as ArrayViews
-      auto queryPts =
+      QueryBatch batch;
+      batch.queryPts =
         ArrayView_from_Node<PointType>(xferDom.fetch_existing("coords"),
                                        qPtCount);
-      auto cpIndexes =
+      batch.cpIndexes =
         ArrayView_from_Node<axom::IndexType>(xferDom.fetch_existing("cp_index"),
                                              qPtCount);
-      auto cpDomainIndexes = ArrayView_from_Node<axom::IndexType>(
+      batch.cpDomainIndexes = ArrayView_from_Node<axom::IndexType>(
         xferDom.fetch_existing("cp_domain_index"),
         qPtCount);
-      auto cpRanks =
+      batch.cpRanks =
         ArrayView_from_Node<axom::IndexType>(xferDom.fetch_existing("cp_rank"),
                                              qPtCount);
-      auto cpCoords =
+      batch.cpCoords =
         ArrayView_from_Node<PointType>(xferDom.fetch_existing("cp_coords"),
                                        qPtCount);
-
-      /// Create ArrayViews in ExecSpace that are compatible with fields
-      // This deep-copies host memory in xferDom to device memory.
-      // TODO: Avoid copying arrays (here and at the end) if both are on the host
-      auto cp_idx = is_first
-        ? axom::Array<axom::IndexType>(qPtCount, qPtCount, m_allocatorID)
-        : axom::Array<axom::IndexType>(cpIndexes, m_allocatorID);
-      auto cp_domidx = is_first
-        ? axom::Array<axom::IndexType>(qPtCount, qPtCount, m_allocatorID)
-        : axom::Array<axom::IndexType>(cpDomainIndexes, m_allocatorID);
-      auto cp_rank = is_first
-        ? axom::Array<axom::IndexType>(qPtCount, qPtCount, m_allocatorID)
-        : axom::Array<axom::IndexType>(cpRanks, m_allocatorID);
-
-      /// PROBLEM: The striding does not appear to be retained by conduit relay
-      ///          We might need to transform it? or to use a single array w/ pointers into it?
-      auto cp_pos = is_first
-        ? axom::Array<PointType>(qPtCount, qPtCount, m_allocatorID)
-        : axom::Array<PointType>(cpCoords, m_allocatorID);
-
-      // DEBUG
-      const bool has_cp_distance = xferDom.has_path("debug/cp_distance");
-      auto minDist = has_cp_distance
-        ? ArrayView_from_Node<double>(
-            xferDom.fetch_existing("debug/cp_distance"),
-            qPtCount)
-        : ArrayView<double>();
-
-      auto cp_dist = has_cp_distance
-        ? (is_first ? axom::Array<double>(qPtCount, qPtCount, m_allocatorID)
-                    : axom::Array<double>(minDist, m_allocatorID))
-        : axom::Array<double>(0, 0, m_allocatorID);
-      // END DEBUG
-
-      if(is_first)
+      if(xferDom.has_path("cp_parametric"))
       {
-        cp_rank.fill(-1);
-        cp_idx.fill(-1);
-        cp_domidx.fill(-1);
-        const PointType nowhere(std::numeric_limits<double>::signaling_NaN());
-        cp_pos.fill(nowhere);
-        cp_dist.fill(std::numeric_limits<double>::signaling_NaN());
+        batch.cpParams =
+          ArrayView_from_Node<ParamType>(xferDom.fetch_existing("cp_parametric"),
+                                         qPtCount);
       }
-      auto query_inds = cp_idx.view();
-      auto query_doms = cp_domidx.view();
-      auto query_ranks = cp_rank.view();
-      auto query_pos = cp_pos.view();
-      auto query_min_dist = cp_dist.view();
-
-      /// Create an ArrayView in ExecSpace that is compatible with queryPts
-      PointArray execPoints(queryPts, m_allocatorID);
-      auto query_pts = execPoints.view();
-
-      if(hasObjectPoints)
+      if(xferDom.has_path("debug/cp_distance"))
       {
-        // Get a device-useable iterator
-        auto it = bvh->getTraverser();
-        const int rank = m_rank;
-
-        double* sqDistThresh = axom::allocate<double>(
-          1,
-          axom::execution_space<ExecSpace>::allocatorID());
-        *sqDistThresh = m_sqDistanceThreshold;
-
-        auto ptCoordsView = m_objectPtCoords.view();
-        auto ptDomainIdsView = m_objectPtDomainIds.view();
-
-        AXOM_PERF_MARK_SECTION(
-          "ComputeClosestPoints",
-          axom::for_all<ExecSpace>(
-            qPtCount,
-            AXOM_LAMBDA(std::int32_t idx) mutable {
-              PointType qpt = query_pts[idx];
-
-              MinCandidate curr_min {};
-              // Preset cur_min to the closest point found so far.
-              if(query_ranks[idx] >= 0)
-              {
-                curr_min.sqDist = squared_distance(qpt, query_pos[idx]);
-                curr_min.pointIdx = query_inds[idx];
-                curr_min.domainIdx = query_doms[idx];
-                curr_min.rank = query_ranks[idx];
-              }
-
-              auto checkMinDist = [&](std::int32_t current_node,
-                                      const std::int32_t* leaf_nodes) {
-                const int candidate_point_idx = leaf_nodes[current_node];
-                const int candidate_domain_idx =
-                  ptDomainIdsView[candidate_point_idx];
-                const PointType candidate_pt = ptCoordsView[candidate_point_idx];
-                const double sq_dist = squared_distance(qpt, candidate_pt);
-
-                if(sq_dist < curr_min.sqDist)
-                {
-                  curr_min.sqDist = sq_dist;
-                  curr_min.pointIdx = candidate_point_idx;
-                  curr_min.domainIdx = candidate_domain_idx;
-                  curr_min.rank = rank;
-                }
-              };
-
-              auto traversePredicate = [&](const PointType& p,
-                                           const BoxType& bb) -> bool {
-                auto sqDist = squared_distance(p, bb);
-                return sqDist <= curr_min.sqDist && sqDist <= sqDistThresh[0];
-              };
-
-              // Traverse the tree, searching for the point with minimum distance.
-              it.traverse_tree(qpt, checkMinDist, traversePredicate);
-
-              // If modified, update the fields that changed
-              if(curr_min.rank == rank)
-              {
-                query_inds[idx] = curr_min.pointIdx;
-                query_doms[idx] = curr_min.domainIdx;
-                query_ranks[idx] = curr_min.rank;
-                query_pos[idx] = ptCoordsView[curr_min.pointIdx];
-
-                //DEBUG
-                if(has_cp_distance)
-                {
-                  query_min_dist[idx] = sqrt(curr_min.sqDist);
-                }
-              }
-            }););
-
-        axom::deallocate(sqDistThresh);
+        batch.minDists = ArrayView_from_Node<double>(
+          xferDom.fetch_existing("debug/cp_distance"),
+          qPtCount);
       }
+      batch.isFirst = is_first;
 
-      axom::copy(cpIndexes.data(),
-                 query_inds.data(),
-                 cpIndexes.size() * sizeof(axom::IndexType));
-      axom::copy(cpDomainIndexes.data(),
-                 query_doms.data(),
-                 cpDomainIndexes.size() * sizeof(axom::IndexType));
-      axom::copy(cpRanks.data(),
-                 query_ranks.data(),
-                 cpRanks.size() * sizeof(axom::IndexType));
-      axom::copy(cpCoords.data(),
-                 query_pos.data(),
-                 cpCoords.size() * sizeof(PointType));
-
-      // DEBUG
-      if(has_cp_distance)
-      {
-        axom::copy(minDist.data(),
-                   query_min_dist.data(),
-                   minDist.size() * sizeof(double));
-      }
+      computeLocalClosestPointsByPolicy(batch);
     }
 
     // Data has now been initialized
@@ -1330,6 +2231,26 @@ private:
   int m_rank;
   int m_nranks;
 
+  bool m_isPipelined {false};
+  bool m_useProgressThread {false};
+
+  /// Bytes and messages sent by the most recent computeClosestPoints()
+  axom::IndexType m_sentBytes {0};
+  int m_sentMessages {0};
+
+  /// Per-rank timings of the most recent computeClosestPoints()
+  double m_localSearchTime {0.};
+  double m_remoteSearchTime {0.};
+  double m_idleTime {0.};
+
+  /// Message buffers, reused across calls to computeClosestPoints()
+  std::vector<axom::Array<char>> m_recvBuffers;
+  std::vector<axom::Array<char>> m_sendBuffers;
+
+  /// Persistent receives on m_recvBuffers and the messages they match
+  std::vector<MPI_Request> m_recvRequests;
+  std::vector<RecvSpec> m_recvSpecs;
+
   /*!
     @brief Object point coordindates array.
 
@@ -1339,6 +2260,16 @@ private:
 
   axom::Array<axom::IndexType> m_objectPtDomainIds;
 
+  /*!  @brief Vertices per object element.
+    1 for point meshes, 2 for segments and 3 for triangles.
+  */
+  int m_objectElemVerts {1};
+
+  /// Flattened element connectivity into m_objectPtCoords
+  axom::Array<axom::IndexType> m_objectElemConn;
+
+  axom::Array<axom::IndexType> m_objectElemDomainIds;
+
   /*!  @brief Object partition bounding boxes, one per rank.
     All are in physical space, not index space.
   */
@@ -1372,8 +2303,8 @@ private:
  * query points to all ranks whose object meshes might contain a
  * closest point.
  *
- * \note The class currently supports object meshes that are comprised of a collection of points.
- * In the future, we'd like to consider more general object meshes, e.g. triangle meshes.
+ * \note The class supports object meshes that are comprised of a collection of points,
+ * of segments (the "line" shape) or, in 3D, of triangles (the "tri" shape).
  *
  * To use this class, first set some parameters, such as the runtime execution policy,
  * then pass in the object mesh and build a spatial index over this mesh.
@@ -1403,6 +2334,9 @@ public:
 
   ~DistributedClosestPoint()
   {
+    // The implementations' persistent requests use the communicator
+    m_dcp_2.reset();
+    m_dcp_3.reset();
     if(m_mpiCommIsPrivate)
     {
       int mpiIsFinalized = 0;
@@ -1531,6 +2465,33 @@ public:
   /// Sets the logging verbosity of the query. By default the query is not verbose
   void setVerbosity(bool isVerbose) { m_isVerbose = isVerbose; }
 
+  /**
+   * \brief Sets whether to overlap the exchange with the local search
+   *
+   * By default, each rank searches its own object partition before sending
+   * query points to other ranks, which sends fewer points.  When pipelined,
+   * the points are sent first and the local search overlaps the exchange,
+   * which can reduce idle time when the local search is expensive.
+   */
+  void setPipelined(bool isPipelined) { m_isPipelined = isPipelined; }
+
+  /**
+   * \brief Sets whether to drive MPI progress from a helper thread during
+   * \a computeClosestPoints(), for MPI implementations without
+   * asynchronous progress
+   *
+   * \note Requires MPI to be initialized with MPI_THREAD_MULTIPLE.
+   * Otherwise, this emits a warning and the helper thread is not used.
+   */
+  void setUseProgressThread(bool useThread)
+  {
+    const bool isSupported = internal::MpiProgressThread::isSupported();
+    SLIC_WARNING_IF(useThread && !isSupported,
+                    "DistributedClosestPoint progress thread requires MPI "
+                    "to be initialized with MPI_THREAD_MULTIPLE");
+    m_useProgressThread = useThread && isSupported;
+  }
+
   /**
    * \brief Sets the object mesh for the query
    *
@@ -1539,6 +2500,8 @@ public:
    *
    * \pre \a meshNode must follow the mesh blueprint convention.
    * \pre Dimension of the mesh must be 2D or 3D
+   * \pre The topology must be of type "points" or an unstructured topology
+   * with the "point", "line" or, in 3D, "tri" shape
    */
   void setObjectMesh(const conduit::Node& meshNode,
                      const std::string& topologyName)
@@ -1581,15 +2544,38 @@ public:
       setDimension(dim);
     }
 
+    // Vertices per object element, from the topology shape
+    // use allreduce since some ranks might be empty
+    int vertsPerElem = 1;
+    {
+      int localVerts = 1;
+      if(domainCount > 0)
+      {
+        localVerts = verticesPerElement(
+          mdMeshNode.child(0).fetch_existing("topologies/" + topologyName));
+      }
+      MPI_Allreduce(&localVerts, &vertsPerElem, 1, MPI_INT, MPI_MAX, m_mpiComm);
+      SLIC_ERROR_IF(vertsPerElem == 3 && m_dimension != 3,
+                    "Triangle object meshes are only supported in 3D");
+    }
+
     allocateQueryInstance();
 
     switch(m_dimension)
     {
     case 2:
       m_dcp_2->importObjectPoints(mdMeshNode, topologyName);
+      if(vertsPerElem > 1)
+      {
+        m_dcp_2->importObjectElements(mdMeshNode, topologyName, vertsPerElem);
+      }
       break;
     case 3:
       m_dcp_3->importObjectPoints(mdMeshNode, topologyName);
+      if(vertsPerElem > 1)
+      {
+        m_dcp_3->importObjectElements(mdMeshNode, topologyName, vertsPerElem);
+      }
       break;
     }
 
@@ -1645,16 +2631,102 @@ public:
     case 2:
       m_dcp_2->setSquaredDistanceThreshold(m_sqDistanceThreshold);
       m_dcp_2->setMpiCommunicator(m_mpiComm);
+      m_dcp_2->setPipelined(m_isPipelined);
+      m_dcp_2->setUseProgressThread(m_useProgressThread);
       m_dcp_2->computeClosestPoints(query_node, coordset);
       break;
     case 3:
       m_dcp_3->setSquaredDistanceThreshold(m_sqDistanceThreshold);
       m_dcp_3->setMpiCommunicator(m_mpiComm);
+      m_dcp_3->setPipelined(m_isPipelined);
+      m_dcp_3->setUseProgressThread(m_useProgressThread);
       m_dcp_3->computeClosestPoints(query_node, coordset);
       break;
     }
   }
 
+  /**
+   * \brief Returns the number of bytes this rank sent to other ranks
+   * during the most recent call to \a computeClosestPoints()
+   */
+  axom::IndexType getSentBytes() const
+  {
+    switch(m_dimension)
+    {
+    case 2:
+      return m_dcp_2 ? m_dcp_2->getSentBytes() : 0;
+    case 3:
+      return m_dcp_3 ? m_dcp_3->getSentBytes() : 0;
+    }
+    return 0;
+  }
+
+  /**
+   * \brief Returns the number of messages this rank sent to other ranks
+   * during the most recent call to \a computeClosestPoints()
+   */
+  int getSentMessages() const
+  {
+    switch(m_dimension)
+    {
+    case 2:
+      return m_dcp_2 ? m_dcp_2->getSentMessages() : 0;
+    case 3:
+      return m_dcp_3 ? m_dcp_3->getSentMessages() : 0;
+    }
+    return 0;
+  }
+
+  /**
+   * \brief Returns the seconds this rank spent searching its object
+   * partition for its own query points during the most recent call to
+   * \a computeClosestPoints()
+   */
+  double getLocalSearchTime() const
+  {
+    switch(m_dimension)
+    {
+    case 2:
+      return m_dcp_2 ? m_dcp_2->getLocalSearchTime() : 0.;
+    case 3:
+      return m_dcp_3 ? m_dcp_3->getLocalSearchTime() : 0.;
+    }
+    return 0.;
+  }
+
+  /**
+   * \brief Returns the seconds this rank spent searching its object
+   * partition for other ranks' query points during the most recent call to
+   * \a computeClosestPoints()
+   */
+  double getRemoteSearchTime() const
+  {
+    switch(m_dimension)
+    {
+    case 2:
+      return m_dcp_2 ? m_dcp_2->getRemoteSearchTime() : 0.;
+    case 3:
+      return m_dcp_3 ? m_dcp_3->getRemoteSearchTime() : 0.;
+    }
+    return 0.;
+  }
+
+  /**
+   * \brief Returns the seconds this rank spent waiting for messages and
+   * other ranks during the most recent call to \a computeClosestPoints()
+   */
+  double getIdleTime() const
+  {
+    switch(m_dimension)
+    {
+    case 2:
+      return m_dcp_2 ? m_dcp_2->getIdleTime() : 0.;
+    case 3:
+      return m_dcp_3 ? m_dcp_3->getIdleTime() : 0.;
+    }
+    return 0.;
+  }
+
 private:
   void allocateQueryInstance()
   {
@@ -1721,6 +2793,39 @@ private:
     }
   }
 
+  /// Vertices per element of an object mesh topology: 1, 2 or 3
+  int verticesPerElement(const conduit::Node& topology) const
+  {
+    const std::string type = topology.fetch_existing("type").as_string();
+    if(type == "points")
+    {
+      return 1;
+    }
+
+    const std::string shape = topology.has_path("elements/shape")
+      ? topology.fetch_existing("elements/shape").as_string()
+      : std::string();
+    if(type == "unstructured" && shape == "point")
+    {
+      return 1;
+    }
+    if(type == "unstructured" && shape == "line")
+    {
+      return 2;
+    }
+    if(type == "unstructured" && shape == "tri")
+    {
+      return 3;
+    }
+
+    SLIC_ERROR(axom::fmt::format(
+      "Object mesh topology of type '{}' and shape '{}' is not supported."
+      "  Use a points topology or an unstructured point, line or tri mesh.",
+      type,
+      shape));
+    return 0;
+  }
+
 private:
   RuntimePolicy m_runtimePolicy {RuntimePolicy::seq};
   MPI_Comm m_mpiComm;
@@ -1728,6 +2833,8 @@ private:
   int m_allocatorID {axom::INVALID_ALLOCATOR_ID};
   int m_dimension {-1};
   bool m_isVerbose {false};
+  bool m_isPipelined {false};
+  bool m_useProgressThread {false};
   double m_sqDistanceThreshold {std::numeric_limits<double>::max()};
 
   bool m_objectMeshCreated {false};
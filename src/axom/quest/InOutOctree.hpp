@@ -23,12 +23,16 @@
 #include "detail/inout/MeshWrapper.hpp"
 #include "detail/inout/InOutOctreeValidator.hpp"
 #include "detail/inout/InOutOctreeStats.hpp"
+#include "detail/inout/InOutOctreeSnapshot.hpp"
+#include "detail/inout/InOutOctreeSerializer.hpp"
 
 #include "axom/fmt.hpp"
 
+#include <cstdint>
 #include <vector>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <sstream>
 #include <unordered_map>
 
@@ -92,6 +96,8 @@ private:
   friend class detail::InOutOctreeStats<DIM>;
   friend class detail::InOutOctreeValidator<DIM>;
   friend class detail::InOutOctreeMeshDumper<DIM>;
+  friend class detail::InOutOctreeSnapshot<DIM>;
+  friend class detail::InOutOctreeSerializer<DIM>;
   friend class detail::InOutOctreeMeshDumperBase<DIM, detail::InOutOctreeMeshDumper<DIM>>;
 
 public:
@@ -204,6 +210,50 @@ public:
    */
   bool within(const SpacePt& pt) const;
 
+  /**
+   * \brief Batched point containment query
+   *
+   * Sorts the query points along a Morton curve and traverses a flattened
+   * snapshot of the octree, reusing the leaf block of the previous point
+   * for nearby queries. The results are scattered back to the input order.
+   *
+   * \param [in] pts The points at which we are checking for containment
+   * \param [out] containment Set to 1 for points within (or on) the surface,
+   * and to 0 otherwise
+   * \pre generateIndex() has been called
+   * \pre containment.size() >= pts.size()
+   * \note Results are identical to calling within() for each point
+   */
+  void within(axom::ArrayView<const SpacePt> pts,
+              axom::ArrayView<int> containment) const;
+
+  /**
+   * \brief Saves the generated spatial index to a binary file
+   *
+   * \param [in] fileName The path to the output file
+   * \return True if the file was written successfully, false otherwise
+   * \pre generateIndex() has been called
+   * \sa loadIndex()
+   */
+  bool saveIndex(const std::string& fileName) const
+  {
+    return detail::InOutOctreeSerializer<DIM>::write(*this, fileName);
+  }
+
+  /**
+   * \brief Restores the spatial index from a file written by saveIndex()
+   *
+   * The file is only loaded when it was generated from the same surface
+   * mesh, bounding box and vertex welding threshold as this octree.
+   * When this function returns false, the octree is unchanged and the index
+   * can be generated using generateIndex().
+   *
+   * \param [in] fileName The path to the input file
+   * \return True if the index was restored, false otherwise
+   * \pre generateIndex() has not been called
+   */
+  bool loadIndex(const std::string& fileName);
+
   /**
    * \brief Sets the threshold for welding vertices during octree construction
    *
@@ -233,6 +283,24 @@ public:
     m_vertexWeldThresholdSquared = thresh * thresh;
   }
 
+  /**
+   * \brief Sets whether containment queries use exact orientation predicates
+   *
+   * \param [in] useExact When true, the inside/outside decision for points
+   * in gray blocks is made with the exact primal::orient3d() (or
+   * primal::orient2d()) predicate against the first surface cell hit by the
+   * query ray, instead of the floating point sign of the cell normal dotted
+   * with the ray direction. This is more robust for query points that are
+   * very close to the surface. Default: false
+   *
+   * \note Unlike the vertex welding threshold, this can be changed after the
+   * octree has been generated.
+   */
+  void setUseExactPredicates(bool useExact)
+  {
+    m_useExactPredicates = useExact;
+  }
+
 private:
   /**
    * \brief Helper function to insert a vertex into the octree
@@ -248,6 +316,22 @@ private:
    */
   void insertMeshCells();
 
+  /**
+   * \brief Binds the relations from the gray leaf blocks of level \a lev
+   * to the mesh vertices and cells
+   *
+   * \param lev The level of the octree
+   * \param gvRelData The vertex index of each gray leaf block
+   * \param geIndRelData The cell indices of the gray leaf blocks
+   * \param geSizeRelData The offsets into \a geIndRelData for each block
+   * \note The relations reference the data buffers, which must be owned
+   * by m_indexRegistry
+   */
+  void bindGrayLeafRelations(int lev,
+                             std::vector<VertexIndex>& gvRelData,
+                             std::vector<VertexIndex>& geIndRelData,
+                             std::vector<VertexIndex>& geSizeRelData);
+
   /**
    * \brief Set a color for each leaf block of the octree.
    *
@@ -419,8 +503,17 @@ protected:
 
   double m_vertexWeldThresholdSquared;
 
+  /// Whether containment queries use exact orientation predicates
+  bool m_useExactPredicates {false};
+
   /// Bounding box scaling factor for dealing with grazing triangles
   double m_boundingBoxScaleFactor {DEFAULT_BOUNDING_BOX_SCALE_FACTOR};
+
+  /// Flattened copy of the octree blocks for batched queries
+  std::unique_ptr<detail::InOutOctreeSnapshot<DIM>> m_querySnapshot;
+
+  /// Hash of the input surface mesh, used to validate saved indexes
+  std::uint64_t m_meshHash {0};
 };
 
 template <int DIM>
@@ -464,6 +557,9 @@ void InOutOctree<DIM>::generateIndex()
 
   Timer timer;
 
+  // Record the input mesh before it is modified, for saveIndex()
+  m_meshHash = m_meshWrapper.computeMeshHash();
+
   // STEP 1 -- Add mesh vertices to octree
   timer.start();
   int numMeshVerts = m_meshWrapper.numMeshVertices();
@@ -514,6 +610,9 @@ void InOutOctree<DIM>::generateIndex()
   m_generationState = INOUTOCTREE_LEAVES_COLORED;
   SLIC_INFO("\t--Coloring octree leaves took " << timer.elapsed() << " seconds.");
 
+  // STEP 4 -- Flatten the final octree for batched queries
+  m_querySnapshot.reset(new detail::InOutOctreeSnapshot<DIM>(*this));
+
 // -- Print some stats about the octree
 #ifdef DUMP_OCTREE_INFO
   SLIC_INFO("** Octree stats after inserting cells");
@@ -829,24 +928,7 @@ void InOutOctree<DIM>::insertMeshCells()
 
     if(!levelLeafMap.empty())
     {
-      // Create the relations from gray leaves to mesh vertices and elements
-      m_grayLeafsMap[lev] = GrayLeafSet(static_cast<int>(gvRelData.size()));
-
-      m_grayLeafToVertexRelationLevelMap[lev] =
-        GrayLeafVertexRelation(&m_grayLeafsMap[lev], &m_meshWrapper.vertexSet());
-      m_grayLeafToVertexRelationLevelMap[lev].bindIndices(
-        static_cast<int>(gvRelData.size()),
-        &gvRelData);
-
-      m_grayLeafToElementRelationLevelMap[lev] =
-        GrayLeafElementRelation(&m_grayLeafsMap[lev],
-                                &m_meshWrapper.elementSet());
-      m_grayLeafToElementRelationLevelMap[lev].bindBeginOffsets(
-        m_grayLeafsMap[lev].size(),
-        &geSizeRelData);
-      m_grayLeafToElementRelationLevelMap[lev].bindIndices(
-        static_cast<int>(geIndRelData.size()),
-        &geIndRelData);
+      bindGrayLeafRelations(lev, gvRelData, geIndRelData, geSizeRelData);
     }
 
     currentLevelData.clear();
@@ -860,6 +942,32 @@ void InOutOctree<DIM>::insertMeshCells()
   }
 }
 
+template <int DIM>
+void InOutOctree<DIM>::bindGrayLeafRelations(
+  int lev,
+  std::vector<VertexIndex>& gvRelData,
+  std::vector<VertexIndex>& geIndRelData,
+  std::vector<VertexIndex>& geSizeRelData)
+{
+  // Create the relations from gray leaves to mesh vertices and elements
+  m_grayLeafsMap[lev] = GrayLeafSet(static_cast<int>(gvRelData.size()));
+
+  m_grayLeafToVertexRelationLevelMap[lev] =
+    GrayLeafVertexRelation(&m_grayLeafsMap[lev], &m_meshWrapper.vertexSet());
+  m_grayLeafToVertexRelationLevelMap[lev].bindIndices(
+    static_cast<int>(gvRelData.size()),
+    &gvRelData);
+
+  m_grayLeafToElementRelationLevelMap[lev] =
+    GrayLeafElementRelation(&m_grayLeafsMap[lev], &m_meshWrapper.elementSet());
+  m_grayLeafToElementRelationLevelMap[lev].bindBeginOffsets(
+    m_grayLeafsMap[lev].size(),
+    &geSizeRelData);
+  m_grayLeafToElementRelationLevelMap[lev].bindIndices(
+    static_cast<int>(geIndRelData.size()),
+    &geIndRelData);
+}
+
 template <int DIM>
 void InOutOctree<DIM>::colorOctreeLeaves()
 {
@@ -1221,7 +1329,15 @@ typename std::enable_if<TDIM == 3, bool>::type InOutOctree<DIM>::withinGrayBlock
       continue;
     }
 
-    // Inside when the dot product of the normal with this triangle is positive
+    // Inside when the query point is below the hit triangle's plane;
+    // equivalently, when the normal's dot product with the ray is positive
+    if(m_useExactPredicates)
+    {
+      const SpaceCell hitTri =
+        (tIdx == idx) ? tri : m_meshWrapper.cellPositions(tIdx);
+      return primal::orient3d(hitTri[0], hitTri[1], hitTri[2], queryPt) > 0.;
+    }
+
     SpaceVector normal =
       (tIdx == idx) ? tri.normal() : m_meshWrapper.cellPositions(tIdx).normal();
 
@@ -1346,6 +1462,16 @@ typename std::enable_if<TDIM == 2, bool>::type InOutOctree<DIM>::withinGrayBlock
       continue;
     }
 
+    // When the ray hits the interior of a segment, the query point is inside
+    // when it is to the left of that segment
+    if(m_useExactPredicates &&
+       !axom::utilities::isNearlyEqual(minSegParam, 0.) &&
+       !axom::utilities::isNearlyEqual(minSegParam, 1.))
+    {
+      const SpaceCell hitSeg = m_meshWrapper.cellPositions(tIdx);
+      return primal::orient2d(hitSeg.source(), hitSeg.target(), queryPt) > 0.;
+    }
+
     // Get the surface normal at the intersection point
     // If the latter is a vertex, the normal is the average of its two incident segments
     SpaceVector normal =
@@ -1486,6 +1612,32 @@ bool InOutOctree<DIM>::allCellsIncidentInCommonVertex(
   return shareCommonVert;
 }
 
+template <int DIM>
+bool InOutOctree<DIM>::loadIndex(const std::string& fileName)
+{
+  using Timer = axom::utilities::Timer;
+  Timer timer(true);
+
+  if(!detail::InOutOctreeSerializer<DIM>::read(*this, fileName))
+  {
+    return false;
+  }
+
+  // Flatten the restored octree for batched queries
+  m_querySnapshot.reset(new detail::InOutOctreeSnapshot<DIM>(*this));
+  checkValid();
+
+  // Fix up the surface mesh, as in generateIndex()
+  m_meshWrapper.regenerateSurfaceMesh();
+
+  timer.stop();
+  SLIC_INFO(fmt::format("  Loaded InOutOctree from '{}' in {} seconds.",
+                        fileName,
+                        timer.elapsed()));
+
+  return true;
+}
+
 template <int DIM>
 bool InOutOctree<DIM>::within(const SpacePt& pt) const
 {
@@ -1516,6 +1668,29 @@ bool InOutOctree<DIM>::within(const SpacePt& pt) const
   return false;
 }
 
+template <int DIM>
+void InOutOctree<DIM>::within(axom::ArrayView<const SpacePt> pts,
+                              axom::ArrayView<int> containment) const
+{
+  SLIC_ASSERT(m_generationState >= INOUTOCTREE_LEAVES_COLORED);
+  SLIC_ASSERT(containment.size() >= pts.size());
+
+  if(m_querySnapshot != nullptr && m_querySnapshot->isValid())
+  {
+    m_querySnapshot->within(pts, containment);
+    return;
+  }
+
+  const IndexType npts = pts.size();
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for(IndexType i = 0; i < npts; ++i)
+  {
+    containment[i] = within(pts[i]) ? 1 : 0;
+  }
+}
+
 template <int DIM>
 void InOutOctree<DIM>::printOctreeStats() const
 {
@@ -21,23 +21,25 @@
 #include "axom/spin.hpp"
 #include "axom/klee.hpp"
 
-#ifndef AXOM_USE_MFEM
-  #error Shaping functionality requires Axom to be configured with MFEM and the AXOM_ENABLE_MFEM_SIDRE_DATACOLLECTION option
-#endif
-
 #include "axom/quest/Shaper.hpp"
 #include "axom/spin/BVH.hpp"
 #include "axom/quest/interface/internal/mpicomm_wrapper.hpp"
 #include "axom/quest/interface/internal/QuestHelpers.hpp"
-#include "axom/quest/detail/shaping/shaping_helpers.hpp"
+#include "axom/quest/detail/shaping/cell_classification.hpp"
 
-#include "mfem.hpp"
+#if defined(AXOM_USE_MFEM)
+  #include "axom/quest/detail/shaping/shaping_helpers.hpp"
+  #include "mfem.hpp"
+#endif
 
 #include "axom/fmt.hpp"
 
+#include <algorithm>
+
 // RAJA
 #if defined(AXOM_USE_RAJA)
   #include "RAJA/RAJA.hpp"
+  #include "axom/mint/execution/internal/structured_exec.hpp"
 #endif
 
 // clang-format off
@@ -73,8 +75,9 @@ namespace quest
 /*!
  * \class GridFunctionView
  *
- * \brief Provides a view over an MFEM grid function. MFEM grid functions are
- *        assumed to live in host memory. This class performs data movement
+ * \brief Provides a view over an MFEM grid function or another host array
+ *        of per-element values, such as a mint field. The data are assumed
+ *        to live in host memory. This class performs data movement
  *        needed to access the grid function data within a GPU device lambda. This
  *        view is limited in scope, though could be expanded in the future.
  *
@@ -92,10 +95,25 @@ public:
    * \param _needResult Whether the data needs to be brought back to the host
    *                    from the device.
    */
+#if defined(AXOM_USE_MFEM)
   AXOM_HOST GridFunctionView(mfem::GridFunction* gf, bool _needResult = true)
   {
     initialize(gf->GetData(), gf->Size(), _needResult);
   }
+#endif
+
+  /*!
+   * \brief Host constructor that accepts a host array.
+   *
+   * \param data The array that will be accessed/modified by the view.
+   * \param size The number of values in the array.
+   * \param _needResult Whether the data needs to be brought back to the host
+   *                    from the device.
+   */
+  AXOM_HOST GridFunctionView(double* data, int size, bool _needResult = true)
+  {
+    initialize(data, size, _needResult);
+  }
 
   /*!
    * \brief Copy constructor, which is called to make a copy of the host
@@ -274,6 +292,11 @@ AXOM_HOST_DEVICE inline void GridFunctionView<hip_exec>::finalize()
  * a material overwrites them. If a new material is not yet represented by
  * a grid function, one will be added.
  *
+ * The mesh can also be given as a mint mesh or as a blueprint mesh in sidre,
+ * in which case MFEM is not needed. Its hexahedral cells are read in place
+ * and the volume fractions are stored as cell-centered fields with the same
+ * names, which are blueprint element fields when the mesh is sidre-backed.
+ *
  * In addition to user-specified materials, the IntersectionShaper creates
  * a "free" material that is used to account for volume fractions that are
  * not assigned to any other material. The free material mainly is used to
@@ -300,12 +323,44 @@ public:
   static constexpr double DEFAULT_REVOLVED_VOLUME {0.};
 
 public:
+#if defined(AXOM_USE_MFEM)
   IntersectionShaper(const klee::ShapeSet& shapeSet,
                      sidre::MFEMSidreDataCollection* dc)
     : Shaper(shapeSet, dc)
   {
     m_free_mat_name = "free";
   }
+#endif
+
+  /*!
+   * \brief Constructs a shaper over the hexahedral cells of a mint mesh
+   *
+   * The mesh can be a structured mesh or an unstructured hexahedral mesh.
+   */
+  IntersectionShaper(const klee::ShapeSet& shapeSet,
+                     mint::Mesh* cellMesh,
+                     MPI_Comm comm = MPI_COMM_SELF)
+    : Shaper(shapeSet, cellMesh, comm)
+  {
+    m_free_mat_name = "free";
+  }
+
+#if defined(AXOM_MINT_USE_SIDRE)
+  /*!
+   * \brief Constructs a shaper over a blueprint mesh with hexahedral cells
+   *
+   * \sa Shaper::Shaper(const klee::ShapeSet&, sidre::Group*,
+   *                    const std::string&, MPI_Comm)
+   */
+  IntersectionShaper(const klee::ShapeSet& shapeSet,
+                     sidre::Group* bpGroup,
+                     const std::string& topo = "",
+                     MPI_Comm comm = MPI_COMM_SELF)
+    : Shaper(shapeSet, bpGroup, topo, comm)
+  {
+    m_free_mat_name = "free";
+  }
+#endif
 
   //@{
   //!  @name Functions to get and set shaping parameters related to intersection; supplements parameters in base class
@@ -314,6 +369,34 @@ public:
 
   void setExecPolicy(RuntimePolicy policy) { m_execPolicy = policy; }
 
+  /*!
+   * \brief Sets whether elements are classified against each shape before
+   *  the intersection volumes are computed
+   *
+   * When enabled (the default), elements that do not touch the boundary of
+   * the shape are classified as entirely inside or outside of it, and only
+   * the remaining elements are decomposed and clipped against the shape.
+   *
+   * \note An element inside a shape gets its whole volume, while a clipped
+   * element gets the sum of its overlaps with each primitive of the shape.
+   * These agree when the primitives do not overlap, as for the tetrahedra
+   * and octahedra produced by discretizing a shape.  Where primitives
+   * overlap, the sum counts the common volume once per primitive, so the
+   * volume fractions of inside elements and of clipped elements differ.
+   */
+  void setCellClassification(bool classify) { m_classifyCells = classify; }
+
+  /*!
+   * \brief Sets whether mixed elements with planar faces are clipped
+   *  directly against the shape's primitives
+   *
+   * When enabled (the default), such elements are clipped as a whole.
+   * Otherwise, every mixed element is decomposed into 24 tetrahedra that are
+   * clipped separately, as is always done for elements with non-planar
+   * faces.  Both give the same volumes up to roundoff.
+   */
+  void setDirectHexClipping(bool direct) { m_directHexClipping = direct; }
+
   /*!
    * \brief Set the name of the material used to account for free volume fractions.
    * \param name The new name of the material. This name cannot contain 
@@ -613,11 +696,6 @@ public:
                          int shape_count)
 
   {
-    constexpr int NUM_VERTS_PER_HEX = 8;
-    constexpr int NUM_COMPS_PER_VERT = 3;
-    constexpr int NUM_TETS_PER_HEX = 24;
-    constexpr double ZERO_THRESHOLD = 1.e-10;
-
     // Save current/default allocator
     const int current_allocator = axom::getDefaultAllocatorID();
 
@@ -625,36 +703,176 @@ public:
     // Set new default to device
     axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
 
-    SLIC_INFO(axom::fmt::format("{:-^80}",
-                                " Inserting shapes' bounding boxes into BVH "));
-
-    // Generate the BVH tree over the shapes
-    // Access-aligned bounding boxes
-    m_aabbs = axom::Array<BoundingBoxType>(shape_count, shape_count);
+    initializeHexes<ExecSpace>();
+    const int NE = m_num_elements;
 
-    axom::ArrayView<ShapeType> shapes_view = shapes.view();
+    registerShapeVolFrac(shape);
 
-    axom::ArrayView<BoundingBoxType> aabbs_view = m_aabbs.view();
+    axom::ArrayView<ShapeType> shapes_view =
+      shapes.view().subspan(0, shape_count);
+    snapShapeVertices<ExecSpace, ShapeType>(shapes_view);
 
-    // Get the bounding boxes for the shapes
+    // All the primitives belong to the one shape
+    axom::Array<int> shape_ids(shape_count, shape_count);
+    const auto shape_ids_view = shape_ids.view();
     axom::for_all<ExecSpace>(
       shape_count,
-      AXOM_LAMBDA(axom::IndexType i) {
-        aabbs_view[i] = primal::compute_bounding_box<double, 3>(shapes_view[i]);
-      });
+      AXOM_LAMBDA(axom::IndexType i) { shape_ids_view[i] = 0; });
 
-    // Insert shapes' Bounding Boxes into BVH.
-    //bvh.setAllocatorID(poolID);
-    spin::BVH<3, ExecSpace, double> bvh;
-    bvh.initialize(aabbs_view, shape_count);
+    // Overlap volume is the volume of clip(oct,tet)
+    shaping::CandidatePairs pairs;
+    axom::Array<double> pair_volumes;
+    computeOverlapVolumes<ExecSpace, ShapeType>(shapes_view,
+                                                shape_ids_view,
+                                                {0, shape_count},
+                                                pairs,
+                                                pair_volumes);
 
-    SLIC_INFO(axom::fmt::format("{:-^80}", " Querying the BVH tree "));
+    m_overlap_volumes = axom::Array<double>(NE, NE);
+    copyShapeOverlapVolumes<ExecSpace>(pairs,
+                                       pair_volumes,
+                                       0,
+                                       m_overlap_volumes.view());
 
-    mfem::Mesh* mesh = getDC()->GetMesh();
+    printOverlapVolumes<ExecSpace>();
 
-    // Intersection algorithm only works on linear elements
-    SLIC_ASSERT(mesh != nullptr);
-    int const NE = mesh->GetNE();
+    axom::setDefaultAllocator(current_allocator);
+  }  // end of runShapeQuery() function
+
+  /*!
+   * \brief Shapes every shape in the shape set in a single pass over the mesh
+   *
+   * The shapes are loaded and discretized in shape set order, and their
+   * primitives are gathered into batches tagged with the index of their
+   * shape.  The mesh elements are extracted once, and the overlap volumes of
+   * all the elements with all the shapes of a batch come from one traversal
+   * of a BVH over the batch.  The replacement rules are then applied in
+   * shape set order, so the volume fractions are the same as when each shape
+   * goes through the stages above.
+   */
+  template <typename ExecSpace>
+  void runBatchedShapeQueriesImpl(klee::Dimensions shapeDimension)
+  {
+    const auto& shapes = m_shapeSet.getShapes();
+    const int numShapes = static_cast<int>(shapes.size());
+    const int allocatorID = axom::execution_space<ExecSpace>::allocatorID();
+
+    // Gather the primitives of the shapes.  Pro/E shapes are tetrahedra and
+    // c2c shapes are octahedra, so there is a batch for each type.
+    axom::utilities::Timer timer(true);
+    PrimitiveBatch<TetrahedronType> tetBatch(allocatorID);
+    PrimitiveBatch<OctahedronType> octBatch(allocatorID);
+    for(int s = 0; s < numShapes; ++s)
+    {
+      const klee::Shape& shape = shapes[s];
+      loadShape(shape);
+      prepareShapeQuery(shapeDimension, shape);
+
+      if(shape.getGeometry().getFormat() == "proe")
+      {
+        tetBatch.add(m_tets.view().subspan(0, m_tetcount));
+        octBatch.add(axom::ArrayView<OctahedronType>());
+      }
+      else
+      {
+        tetBatch.add(axom::ArrayView<TetrahedronType>());
+        octBatch.add(m_octs.view().subspan(0, m_octcount));
+      }
+
+      finalizeShapeQuery();
+    }
+    timer.stop();
+
+    SLIC_INFO(axom::fmt::format(
+      "{:-^80}",
+      axom::fmt::format(" Batched {} tetrahedra and {} octahedra from {} "
+                        "shapes in {} s ",
+                        tetBatch.primitives.size(),
+                        octBatch.primitives.size(),
+                        numShapes,
+                        timer.elapsedTimeInSec())));
+
+    // Save current/default allocator
+    const int current_allocator = axom::getDefaultAllocatorID();
+    axom::setDefaultAllocator(allocatorID);
+
+    timer.start();
+    initializeHexes<ExecSpace>();
+    const int NE = m_num_elements;
+
+    // The overlap volumes are kept for the hex/shape pairs of each batch
+    // only, rather than for every element and shape
+    shaping::CandidatePairs tetPairs;
+    shaping::CandidatePairs octPairs;
+    axom::Array<double> tetPairVolumes;
+    axom::Array<double> octPairVolumes;
+    if(!tetBatch.primitives.empty())
+    {
+      auto tets_view = tetBatch.primitives.view();
+      snapShapeVertices<ExecSpace, TetrahedronType>(tets_view);
+      computeOverlapVolumes<ExecSpace, TetrahedronType>(
+        tets_view,
+        tetBatch.shapeIds.view(),
+        tetBatch.offsets,
+        tetPairs,
+        tetPairVolumes);
+    }
+    if(!octBatch.primitives.empty())
+    {
+      auto octs_view = octBatch.primitives.view();
+      snapShapeVertices<ExecSpace, OctahedronType>(octs_view);
+      computeOverlapVolumes<ExecSpace, OctahedronType>(octs_view,
+                                                       octBatch.shapeIds.view(),
+                                                       octBatch.offsets,
+                                                       octPairs,
+                                                       octPairVolumes);
+    }
+    timer.stop();
+
+    SLIC_INFO(axom::fmt::format(
+      "{:-^80}",
+      axom::fmt::format(" Computed the overlap volumes of {} elements with "
+                        "{} shapes in {} s ",
+                        NE,
+                        numShapes,
+                        timer.elapsedTimeInSec())));
+
+    // Apply the replacement rules in shape set order, walking the pairs of
+    // each shape.  The primitives of a shape are all in one batch.
+    m_overlap_volumes = axom::Array<double>(NE, NE);
+    axom::ArrayView<double> overlap_volumes_view = m_overlap_volumes.view();
+    for(int s = 0; s < numShapes; ++s)
+    {
+      const klee::Shape& shape = shapes[s];
+      SLIC_INFO(axom::fmt::format("Applying replacement rules for shape {}",
+                                  shape.getName()));
+
+      const bool isTetShape = tetBatch.offsets[s + 1] > tetBatch.offsets[s];
+      copyShapeOverlapVolumes<ExecSpace>(isTetShape ? tetPairs : octPairs,
+                                         isTetShape ? tetPairVolumes
+                                                    : octPairVolumes,
+                                         s,
+                                         overlap_volumes_view);
+
+      registerShapeVolFrac(shape);
+      printOverlapVolumes<ExecSpace>();
+      applyReplacementRulesImpl<ExecSpace>(shape);
+    }
+
+    axom::setDefaultAllocator(current_allocator);
+  }
+
+  /*!
+   * \brief Extracts the hexahedral elements of the mesh with their bounding
+   *  boxes and volumes into m_hexes, m_hex_bbs and m_hex_volumes
+   */
+  template <typename ExecSpace>
+  void initializeHexes()
+  {
+    constexpr int NUM_VERTS_PER_HEX = 8;
+    constexpr double ZERO_THRESHOLD = 1.e-10;
+
+    int const NE = getNumElements();
     m_num_elements = NE;
 
     if(this->isVerbose())
@@ -666,18 +884,6 @@ public:
           m_num_elements)));
     }
 
-    if(NE > 0)
-    {
-      SLIC_ASSERT(mesh->GetNodes() == nullptr ||
-                  mesh->GetNodes()->FESpace()->GetOrder(0));
-    }
-
-    // Create and register a scalar field for this shape's volume fractions
-    // The Degrees of Freedom will be in correspondence with the elements
-    auto* volFrac = this->newVolFracGridFunction();
-    auto volFracName = axom::fmt::format("shape_vol_frac_{}", shape.getName());
-    this->getDC()->RegisterField(volFracName, volFrac);
-
     // Initialize hexahedral elements
     m_hexes = axom::Array<HexahedronType>(NE, NE);
     axom::ArrayView<HexahedronType> hexes_view = m_hexes.view();
@@ -685,8 +891,111 @@ public:
     m_hex_bbs = axom::Array<BoundingBoxType>(NE, NE);
     axom::ArrayView<BoundingBoxType> hex_bbs_view = m_hex_bbs.view();
 
-    // Initialize vertices from mfem mesh and
-    // set each shape volume fraction to 1
+    if(m_cellMesh != nullptr)
+    {
+      extractMintHexes<ExecSpace>(hexes_view);
+    }
+#if defined(AXOM_USE_MFEM)
+    else
+    {
+      extractMFEMHexes<ExecSpace>(hexes_view);
+    }
+#endif
+
+    // Snap the hexahedra and compute their bounding boxes
+    axom::for_all<ExecSpace>(
+      NE,
+      AXOM_LAMBDA(axom::IndexType i) {
+        for(int j = 0; j < NUM_VERTS_PER_HEX; ++j)
+        {
+          // Set hexahedra components to zero if within threshold
+          if(axom::utilities::isNearlyEqual(hexes_view[i][j][0],
+                                            0.0,
+                                            ZERO_THRESHOLD))
+          {
+            hexes_view[i][j][0] = 0.0;
+          }
+
+          if(axom::utilities::isNearlyEqual(hexes_view[i][j][1],
+                                            0.0,
+                                            ZERO_THRESHOLD))
+          {
+            hexes_view[i][j][1] = 0.0;
+          }
+
+          if(axom::utilities::isNearlyEqual(hexes_view[i][j][2],
+                                            0.0,
+                                            ZERO_THRESHOLD))
+          {
+            hexes_view[i][j][2] = 0.0;
+          }
+        }
+
+        // Get bounding box for hexahedral element
+        hex_bbs_view[i] = primal::compute_bounding_box<double, 3>(hexes_view[i]);
+      });  // end of loop to initialize hexahedral elements and bounding boxes
+
+    // Hex volume is the volume of the hexahedron element
+    m_hex_volumes = axom::Array<double>(NE, NE);
+    axom::ArrayView<double> hex_volumes_view = m_hex_volumes.view();
+
+    SLIC_INFO(
+      axom::fmt::format("{:-^80}", " Calculating hexahedron element volume "));
+
+    AXOM_PERF_MARK_SECTION("hex_volume",
+                           axom::for_all<ExecSpace>(
+                             NE,
+                             AXOM_LAMBDA(axom::IndexType i) {
+                               hex_volumes_view[i] = hexes_view[i].volume();
+                             }););
+  }
+
+  /*!
+   * \brief Sets the hexahedra from the cells of the mint mesh
+   *
+   * The cells are traversed with mint, which reads the coordinates and the
+   * connectivity in place, so no vertex data are gathered on the host.
+   */
+  template <typename ExecSpace>
+  void extractMintHexes(axom::ArrayView<HexahedronType> hexes_view)
+  {
+    SLIC_ERROR_IF(
+      m_cellMesh->hasMixedCellTypes() || m_cellMesh->getCellType() != mint::HEX,
+      "IntersectionShaper requires a mesh of hexahedral cells");
+
+    mint::for_all_cells<ExecSpace, mint::xargs::coords>(
+      m_cellMesh,
+      AXOM_LAMBDA(axom::IndexType cellIdx,
+                  numerics::Matrix<double> & coords,
+                  const axom::IndexType* AXOM_UNUSED_PARAM(nodeIds)) {
+        for(int j = 0; j < HexahedronType::NUM_HEX_VERTS; ++j)
+        {
+          hexes_view[cellIdx][j] = Point3D(coords.getColumn(j));
+        }
+      });
+  }
+
+#if defined(AXOM_USE_MFEM)
+  /// Sets the hexahedra from the elements of the mfem mesh
+  template <typename ExecSpace>
+  void extractMFEMHexes(axom::ArrayView<HexahedronType> hexes_view)
+  {
+    constexpr int NUM_VERTS_PER_HEX = 8;
+    constexpr int NUM_COMPS_PER_VERT = 3;
+
+    mfem::Mesh* mesh = getDC()->GetMesh();
+
+    // Intersection algorithm only works on linear elements
+    SLIC_ASSERT(mesh != nullptr);
+    int const NE = mesh->GetNE();
+
+    if(NE > 0)
+    {
+      SLIC_ASSERT(mesh->GetNodes() == nullptr ||
+                  mesh->GetNodes()->FESpace()->GetOrder(0));
+    }
+
+    // Initialize vertices from mfem mesh
     // Allocation size is:
     // # of elements * # of vertices per hex * # of components per vertex
     axom::Array<double> vertCoords(NE * NUM_VERTS_PER_HEX * NUM_COMPS_PER_VERT,
@@ -700,10 +1009,6 @@ public:
       mesh->GetElementVertices(i, verts);
       SLIC_ASSERT(verts.Size() == NUM_VERTS_PER_HEX);
 
-      // Set each shape volume fraction to 1
-      double vf = 1.0;
-      (*volFrac)(i) = vf;
-
       // Get the coordinates for the vertices
       for(int j = 0; j < NUM_VERTS_PER_HEX; ++j)
       {
@@ -716,11 +1021,10 @@ public:
       }
     }
 
-    // Initialize each hexahedral element and its bounding box
+    // Set each hexahedral element vertices
     axom::for_all<ExecSpace>(
       NE,
       AXOM_LAMBDA(axom::IndexType i) {
-        // Set each hexahedral element vertices
         hexes_view[i] = HexahedronType();
         for(int j = 0; j < NUM_VERTS_PER_HEX; ++j)
         {
@@ -729,37 +1033,19 @@ public:
           hexes_view[i][j] = Point3D({verts_view[vertIndex],
                                       verts_view[vertIndex + 1],
                                       verts_view[vertIndex + 2]});
-
-          // Set hexahedra components to zero if within threshold
-          if(axom::utilities::isNearlyEqual(hexes_view[i][j][0],
-                                            0.0,
-                                            ZERO_THRESHOLD))
-          {
-            hexes_view[i][j][0] = 0.0;
-          }
-
-          if(axom::utilities::isNearlyEqual(hexes_view[i][j][1],
-                                            0.0,
-                                            ZERO_THRESHOLD))
-          {
-            hexes_view[i][j][1] = 0.0;
-          }
-
-          if(axom::utilities::isNearlyEqual(hexes_view[i][j][2],
-                                            0.0,
-                                            ZERO_THRESHOLD))
-          {
-            hexes_view[i][j][2] = 0.0;
-          }
         }
+      });
+  }
+#endif
 
-        // Get bounding box for hexahedral element
-        hex_bbs_view[i] = primal::compute_bounding_box<double, 3>(hexes_view[i]);
-      });  // end of loop to initialize hexahedral elements and bounding boxes
+  /// Sets the shape vertex components that are nearly zero to zero
+  template <typename ExecSpace, typename ShapeType>
+  void snapShapeVertices(axom::ArrayView<ShapeType> shapes_view)
+  {
+    constexpr double ZERO_THRESHOLD = 1.e-10;
 
-    // Set shape components to zero if within threshold
     axom::for_all<ExecSpace>(
-      shape_count,
+      shapes_view.size(),
       AXOM_LAMBDA(axom::IndexType i) {
         for(int j = 0; j < ShapeType::NUM_VERTS; j++)
         {
@@ -785,136 +1071,345 @@ public:
           }
         }
       });
+  }
+
+  /// Prints the total overlap volume of the shape and the mesh volume
+  template <typename ExecSpace>
+  void printOverlapVolumes()
+  {
+    using REDUCE_POL = typename axom::execution_space<ExecSpace>::reduce_policy;
+
+    axom::ArrayView<double> overlap_volumes_view = m_overlap_volumes.view();
+    axom::ArrayView<double> hex_volumes_view = m_hex_volumes.view();
+
+    RAJA::ReduceSum<REDUCE_POL, double> totalOverlap(0);
+    RAJA::ReduceSum<REDUCE_POL, double> totalHex(0);
+
+    axom::for_all<ExecSpace>(
+      m_num_elements,
+      AXOM_LAMBDA(axom::IndexType i) {
+        totalOverlap += overlap_volumes_view[i];
+        totalHex += hex_volumes_view[i];
+      });
+
+    SLIC_INFO(axom::fmt::format("Total overlap volume with shape is {}",
+                                this->allReduceSum(totalOverlap)));
+    SLIC_INFO(axom::fmt::format("Total mesh volume is {}",
+                                this->allReduceSum(totalHex)));
+  }
+
+  /*!
+   * \brief Computes the overlap volumes of the hexahedra with a batch of
+   *  shapes
+   *
+   * \param [in] shapes_view the primitives of the shapes
+   * \param [in] shape_ids_view the index of the shape of each primitive
+   * \param [in] shape_offsets the offsets of the primitives of each shape,
+   *  with one more entry than the number of shapes
+   * \param [out] pairs the hex/shape pairs of the candidate primitives of
+   *  each hex
+   * \param [out] pair_volumes the overlap volume of each pair
+   *
+   * The primitives of shape s are contiguous, from shape_offsets[s] to
+   * shape_offsets[s + 1].  A single BVH over the primitives of all the
+   * shapes gives the candidate primitives of each hex, which are grouped
+   * into hex/shape pairs.  A hex that is not in a pair with a shape does
+   * not overlap it.  The pairs are classified as inside, outside or mixed,
+   * and only the mixed pairs are clipped.  Inside pairs get the hex volume,
+   * which is the sum of the overlaps with the primitives only when these do
+   * not overlap; see setCellClassification().
+   */
+  template <typename ExecSpace, typename ShapeType>
+  void computeOverlapVolumes(axom::ArrayView<const ShapeType> shapes_view,
+                             axom::ArrayView<const int> shape_ids_view,
+                             const std::vector<IndexType>& shape_offsets,
+                             shaping::CandidatePairs& pairs,
+                             axom::Array<double>& pair_volumes)
+  {
+    constexpr int NUM_TETS_PER_HEX = 24;
+
+    const int NE = m_num_elements;
+    const int numShapes = static_cast<int>(shape_offsets.size()) - 1;
+    const int shape_count = shapes_view.size();
+    const auto hexes_view = m_hexes.view();
+    const auto hex_bbs_view = m_hex_bbs.view();
+    const auto hex_volumes_view = m_hex_volumes.view();
+
+    SLIC_INFO(axom::fmt::format("{:-^80}",
+                                " Inserting shapes' bounding boxes into BVH "));
+
+    // Generate the BVH tree over the shapes
+    // Access-aligned bounding boxes
+    m_aabbs = axom::Array<BoundingBoxType>(shape_count, shape_count);
+
+    axom::ArrayView<BoundingBoxType> aabbs_view = m_aabbs.view();
+
+    // Get the bounding boxes for the shapes
+    axom::for_all<ExecSpace>(
+      shape_count,
+      AXOM_LAMBDA(axom::IndexType i) {
+        aabbs_view[i] = primal::compute_bounding_box<double, 3>(shapes_view[i]);
+      });
+
+    // Insert shapes' Bounding Boxes into BVH.
+    //bvh.setAllocatorID(poolID);
+    spin::BVH<3, ExecSpace, double> bvh;
+    bvh.initialize(aabbs_view, shape_count);
+
+    SLIC_INFO(axom::fmt::format("{:-^80}", " Querying the BVH tree "));
 
     // Find which shape bounding boxes intersect hexahedron bounding boxes
     SLIC_INFO(axom::fmt::format(
       "{:-^80}",
       " Finding shape candidates for each hexahedral element "));
 
-    axom::Array<IndexType> offsets(NE);
-    axom::Array<IndexType> counts(NE);
-    axom::Array<IndexType> candidates;
-    bvh.findBoundingBoxes(offsets, counts, candidates, NE, hex_bbs_view);
+    axom::Array<IndexType> offsets(NE);
+    axom::Array<IndexType> counts(NE);
+    axom::Array<IndexType> candidates;
+    bvh.findBoundingBoxes(offsets, counts, candidates, NE, hex_bbs_view);
+
+    // Group the candidate primitives of each hex by shape
+    pairs = shaping::makeCandidatePairs<ExecSpace>(NE,
+                                                   offsets.view(),
+                                                   counts.view(),
+                                                   candidates.view(),
+                                                   shape_ids_view,
+                                                   numShapes);
+    const IndexType numPairs = pairs.numPairs();
+    const auto pair_cells_v = pairs.cells.view();
+    const auto pair_offsets_v = pairs.cellOffsets.view();
+    const auto prim_offsets_v = pairs.primitiveOffsets.view();
+    const auto prims_v = pairs.primitives.view();
+
+    using REDUCE_POL = typename axom::execution_space<ExecSpace>::reduce_policy;
+    using ATOMIC_POL = typename axom::execution_space<ExecSpace>::atomic_policy;
+
+    constexpr double EPS = 1e-10;
+    constexpr bool tryFixOrientation = true;
+
+    // Classify the hex/shape pairs.  Only the mixed pairs, where the hex may
+    // touch the boundary of the shape, are clipped below.
+    axom::utilities::Timer timer(true);
+    axom::Array<int> pair_class(numPairs, numPairs);
+    const auto pair_class_v = pair_class.view();
+    if(m_classifyCells)
+    {
+      SLIC_INFO(axom::fmt::format(
+        "{:-^80}",
+        " Classifying hexahedral elements against the shapes "));
+
+      classifyHexes<ExecSpace, ShapeType>(shapes_view,
+                                          shape_offsets,
+                                          pairs,
+                                          pair_class_v,
+                                          EPS);
+    }
+    else
+    {
+      axom::for_all<ExecSpace>(
+        numPairs,
+        AXOM_LAMBDA(axom::IndexType p) {
+          pair_class_v[p] = shaping::CELL_MIXED;
+        });
+    }
+    timer.stop();
+    const double classifyTime = timer.elapsedTimeInSec();
+
+    RAJA::ReduceSum<REDUCE_POL, IndexType> numInside(0);
+    RAJA::ReduceSum<REDUCE_POL, IndexType> numMixed(0);
+    axom::for_all<ExecSpace>(
+      numPairs,
+      AXOM_LAMBDA(axom::IndexType p) {
+        numInside += pair_class_v[p] == shaping::CELL_INSIDE ? 1 : 0;
+        numMixed += pair_class_v[p] == shaping::CELL_MIXED ? 1 : 0;
+      });
+
+    if(this->isVerbose())
+    {
+      SLIC_INFO(axom::fmt::format(
+        "Classified {} hexahedra against {} shapes: {} inside, {} outside and "
+        "{} mixed in {} s",
+        NE,
+        numShapes,
+        numInside.get(),
+        static_cast<IndexType>(numShapes) * NE - numInside.get() -
+          numMixed.get(),
+        numMixed.get(),
+        classifyTime));
+    }
+
+    timer.start();
 
-    // Get the total number of candidates
-    using REDUCE_POL = typename axom::execution_space<ExecSpace>::reduce_policy;
-    using ATOMIC_POL = typename axom::execution_space<ExecSpace>::atomic_policy;
+    // Mixed hexahedra with planar faces are clipped directly against their
+    // candidate shapes, unless direct clipping is disabled.  The others are
+    // decomposed into 24 tetrahedra, which are clipped against the
+    // candidates.  The offset of a hex's tetrahedra is -1 for hexahedra that
+    // are not decomposed.
+    axom::Array<IndexType> tet_offsets(NE, NE);
+    const auto tet_offsets_v = tet_offsets.view();
+    const bool directHexClipping = m_directHexClipping;
 
-    const auto counts_v = counts.view();
     RAJA::ReduceSum<REDUCE_POL, int> totalCandidates(0);
+    RAJA::ReduceSum<REDUCE_POL, int> numDecomposed(0);
     axom::for_all<ExecSpace>(
       NE,
-      AXOM_LAMBDA(axom::IndexType i) { totalCandidates += counts_v[i]; });
+      AXOM_LAMBDA(axom::IndexType i) {
+        tet_offsets_v[i] = -1;
+
+        int numMixedCandidates = 0;
+        for(IndexType p = pair_offsets_v[i]; p < pair_offsets_v[i + 1]; ++p)
+        {
+          if(pair_class_v[p] == shaping::CELL_MIXED)
+          {
+            numMixedCandidates += prim_offsets_v[p + 1] - prim_offsets_v[p];
+          }
+        }
+        if(numMixedCandidates == 0)
+        {
+          return;
+        }
+
+        if(directHexClipping && hexes_view[i].hasPlanarFaces(EPS))
+        {
+          totalCandidates += numMixedCandidates;
+        }
+        else
+        {
+          tet_offsets_v[i] = 0;
+          totalCandidates += numMixedCandidates * NUM_TETS_PER_HEX;
+          numDecomposed += 1;
+        }
+      });
 
-    // Initialize hexahedron indices and shape candidates
-    axom::IndexType* hex_indices =
-      axom::allocate<axom::IndexType>(totalCandidates.get() * NUM_TETS_PER_HEX);
+    // Initialize pair indices and shape candidates
+    axom::IndexType* pair_indices =
+      axom::allocate<axom::IndexType>(totalCandidates.get());
     axom::IndexType* shape_candidates =
-      axom::allocate<axom::IndexType>(totalCandidates.get() * NUM_TETS_PER_HEX);
+      axom::allocate<axom::IndexType>(totalCandidates.get());
 
-    // Tetrahedrons from hexes (24 for each hex)
-    axom::Array<TetrahedronType> tets_from_hexes(NE * NUM_TETS_PER_HEX,
-                                                 NE * NUM_TETS_PER_HEX);
+    // Tetrahedrons from the decomposed hexes (24 for each hex)
+    const int numDecomposedTets = numDecomposed.get() * NUM_TETS_PER_HEX;
+    axom::Array<TetrahedronType> tets_from_hexes(numDecomposedTets,
+                                                 numDecomposedTets);
     axom::ArrayView<TetrahedronType> tets_from_hexes_view =
       tets_from_hexes.view();
 
-    // Index into 'tets'
+    // Index into 'tets', or -1 to clip the hex directly
     axom::IndexType* tet_indices =
-      axom::allocate<axom::IndexType>(totalCandidates.get() * NUM_TETS_PER_HEX);
+      axom::allocate<axom::IndexType>(totalCandidates.get());
 
     // New total number of candidates after omitting degenerate shapes
     axom::Array<IndexType> newTotalCandidates(1, 1);
     const auto newTotalCandidates_view = newTotalCandidates.view();
     newTotalCandidates_view[0] = 0;
 
+    axom::Array<IndexType> numTets(1, 1);
+    const auto numTets_view = numTets.view();
+    numTets_view[0] = 0;
+
     SLIC_INFO(axom::fmt::format(
       "{:-^80}",
-      " Decomposing each hexahedron element into 24 tetrahedrons "));
+      axom::fmt::format(" Decomposing {} non-planar hexahedra into 24 "
+                        "tetrahedrons ",
+                        numDecomposed.get())));
 
     using TetHexArray = axom::StackArray<TetrahedronType, NUM_TETS_PER_HEX>;
 
-    AXOM_PERF_MARK_SECTION("init_tets",
-                           axom::for_all<ExecSpace>(
-                             NE,
-                             AXOM_LAMBDA(axom::IndexType i) {
-                               TetHexArray cur_tets;
-                               hexes_view[i].triangulate(cur_tets);
-
-                               for(int j = 0; j < NUM_TETS_PER_HEX; j++)
-                               {
-                                 tets_from_hexes_view[i * NUM_TETS_PER_HEX + j] =
-                                   cur_tets[j];
-                               }
-                             }););
+    AXOM_PERF_MARK_SECTION(
+      "init_tets",
+      axom::for_all<ExecSpace>(
+        NE,
+        AXOM_LAMBDA(axom::IndexType i) {
+          if(tet_offsets_v[i] < 0)
+          {
+            return;
+          }
+
+          const IndexType offset =
+            RAJA::atomicAdd<ATOMIC_POL>(&numTets_view[0],
+                                        IndexType {NUM_TETS_PER_HEX});
+          tet_offsets_v[i] = offset;
+
+          TetHexArray cur_tets;
+          hexes_view[i].triangulate(cur_tets);
+
+          for(int j = 0; j < NUM_TETS_PER_HEX; j++)
+          {
+            tets_from_hexes_view[offset + j] = cur_tets[j];
+          }
+        }););
 
     SLIC_INFO(
       axom::fmt::format("{:-^80}",
                         " Creating an array of candidate pairs for shaping "));
 
-    const auto offsets_v = offsets.view();
-    const auto candidates_v = candidates.view();
-    AXOM_PERF_MARK_SECTION("init_candidates",
-                           axom::for_all<ExecSpace>(
-                             NE,
-                             AXOM_LAMBDA(axom::IndexType i) {
-                               for(int j = 0; j < counts_v[i]; j++)
-                               {
-                                 int shapeIdx = candidates_v[offsets_v[i] + j];
-
-                                 for(int k = 0; k < NUM_TETS_PER_HEX; k++)
-                                 {
-                                   IndexType idx = RAJA::atomicAdd<ATOMIC_POL>(
-                                     &newTotalCandidates_view[0],
-                                     IndexType {1});
-                                   hex_indices[idx] = i;
-                                   shape_candidates[idx] = shapeIdx;
-                                   tet_indices[idx] = i * NUM_TETS_PER_HEX + k;
-                                 }
-                               }
-                             }););
-
-    // Overlap volume is the volume of clip(oct,tet)
-    m_overlap_volumes = axom::Array<double>(NE, NE);
+    AXOM_PERF_MARK_SECTION(
+      "init_candidates",
+      axom::for_all<ExecSpace>(
+        NE,
+        AXOM_LAMBDA(axom::IndexType i) {
+          const IndexType tetOffset = tet_offsets_v[i];
+          const int numParts = tetOffset < 0 ? 1 : NUM_TETS_PER_HEX;
 
-    // Hex volume is the volume of the hexahedron element
-    m_hex_volumes = axom::Array<double>(NE, NE);
+          for(IndexType p = pair_offsets_v[i]; p < pair_offsets_v[i + 1]; ++p)
+          {
+            if(pair_class_v[p] != shaping::CELL_MIXED)
+            {
+              continue;
+            }
 
-    axom::ArrayView<double> overlap_volumes_view = m_overlap_volumes.view();
-    axom::ArrayView<double> hex_volumes_view = m_hex_volumes.view();
+            for(IndexType j = prim_offsets_v[p]; j < prim_offsets_v[p + 1]; ++j)
+            {
+              for(int k = 0; k < numParts; k++)
+              {
+                IndexType idx =
+                  RAJA::atomicAdd<ATOMIC_POL>(&newTotalCandidates_view[0],
+                                              IndexType {1});
+                pair_indices[idx] = p;
+                shape_candidates[idx] = prims_v[j];
+                tet_indices[idx] = tetOffset < 0 ? -1 : tetOffset + k;
+              }
+            }
+          }
+        }););
 
-    // Set initial values to 0
+    // Hexahedra inside a shape are entirely covered by it.  This counts the
+    // volume once, even where the shape's primitives overlap.
+    pair_volumes = axom::Array<double>(numPairs, numPairs);
+    const auto pair_volumes_v = pair_volumes.view();
     axom::for_all<ExecSpace>(
-      NE,
-      AXOM_LAMBDA(axom::IndexType i) {
-        hex_volumes_view[i] = 0;
-        overlap_volumes_view[i] = 0;
+      numPairs,
+      AXOM_LAMBDA(axom::IndexType p) {
+        pair_volumes_v[p] = pair_class_v[p] == shaping::CELL_INSIDE
+          ? hex_volumes_view[pair_cells_v[p]]
+          : 0.;
       });
 
-    SLIC_INFO(
-      axom::fmt::format("{:-^80}", " Calculating hexahedron element volume "));
-
-    AXOM_PERF_MARK_SECTION("hex_volume",
-                           axom::for_all<ExecSpace>(
-                             NE,
-                             AXOM_LAMBDA(axom::IndexType i) {
-                               hex_volumes_view[i] = hexes_view[i].volume();
-                             }););
-
     SLIC_INFO(axom::fmt::format(
       "{:-^80}",
-      " Calculating element overlap volume from each tet-shape pair "));
-
-    constexpr double EPS = 1e-10;
-    constexpr bool tryFixOrientation = true;
+      " Calculating element overlap volume from each hex/tet-shape pair "));
 
     AXOM_PERF_MARK_SECTION(
       "tet_shape_volume",
       axom::for_all<ExecSpace>(
         newTotalCandidates_view[0],
         AXOM_LAMBDA(axom::IndexType i) {
-          int index = hex_indices[i];
+          const IndexType pairIndex = pair_indices[i];
+          const IndexType index = pair_cells_v[pairIndex];
           int shapeIndex = shape_candidates[i];
           int tetIndex = tet_indices[i];
+          double* overlap = pair_volumes_v.data() + pairIndex;
+
+          if(tetIndex < 0)
+          {
+            const double volume =
+              primal::intersection_volume(hexes_view[index],
+                                          shapes_view[shapeIndex],
+                                          EPS,
+                                          tryFixOrientation);
+            RAJA::atomicAdd<ATOMIC_POL>(overlap, volume);
+            return;
+          }
 
           PolyhedronType poly = primal::clip(shapes_view[shapeIndex],
                                              tets_from_hexes_view[tetIndex],
@@ -924,33 +1419,206 @@ public:
           // Poly is valid
           if(poly.numVertices() >= 4)
           {
-            RAJA::atomicAdd<ATOMIC_POL>(overlap_volumes_view.data() + index,
-                                        poly.volume());
+            RAJA::atomicAdd<ATOMIC_POL>(overlap, poly.volume());
           }
         }););
 
-    RAJA::ReduceSum<REDUCE_POL, double> totalOverlap(0);
-    RAJA::ReduceSum<REDUCE_POL, double> totalHex(0);
+    timer.stop();
+    if(this->isVerbose())
+    {
+      SLIC_INFO(axom::fmt::format(
+        "Clipped {} hex/tet-shape pairs of the mixed hexahedra in {} s",
+        newTotalCandidates_view[0],
+        timer.elapsedTimeInSec()));
+    }
+
+    // Deallocate no longer needed variables
+    axom::deallocate(pair_indices);
+    axom::deallocate(shape_candidates);
+    axom::deallocate(tet_indices);
+  }
 
+  /*!
+   * \brief Copies the overlap volumes of the hexahedra with shape \a shape
+   *  from their hex/shape pairs into \a overlap_volumes_view
+   *
+   * Hexahedra without a pair with the shape get zero.  The pairs of the
+   * shape are visited through pairs.shapeOrder.
+   */
+  template <typename ExecSpace>
+  void copyShapeOverlapVolumes(const shaping::CandidatePairs& pairs,
+                               const axom::Array<double>& pair_volumes,
+                               int shape,
+                               axom::ArrayView<double> overlap_volumes_view)
+  {
     axom::for_all<ExecSpace>(
-      NE,
-      AXOM_LAMBDA(axom::IndexType i) {
-        totalOverlap += overlap_volumes_view[i];
-        totalHex += hex_volumes_view[i];
+      overlap_volumes_view.size(),
+      AXOM_LAMBDA(axom::IndexType i) { overlap_volumes_view[i] = 0; });
+
+    if(shape + 1 >= static_cast<int>(pairs.shapeOffsets.size()))
+    {
+      return;
+    }
+    const IndexType first = pairs.shapeOffsets[shape];
+    const IndexType count = pairs.shapeOffsets[shape + 1] - first;
+    const auto order_v = pairs.shapeOrder.view();
+    const auto cells_v = pairs.cells.view();
+    const auto pair_volumes_v = pair_volumes.view();
+    axom::for_all<ExecSpace>(
+      count,
+      AXOM_LAMBDA(axom::IndexType k) {
+        const IndexType p = order_v[first + k];
+        overlap_volumes_view[cells_v[p]] = pair_volumes_v[p];
       });
+  }
 
-    SLIC_INFO(axom::fmt::format("Total overlap volume with shape is {}",
-                                this->allReduceSum(totalOverlap)));
-    SLIC_INFO(axom::fmt::format("Total mesh volume is {}",
-                                this->allReduceSum(totalHex)));
+  /*!
+   * \brief Classifies the hex/shape pairs as inside, outside or mixed,
+   *  using the faces of each shape that are not shared by two of its
+   *  primitives
+   *
+   * \param [in] shapes_view the primitives of the shapes
+   * \param [in] shape_offsets the offsets of the primitives of each shape
+   * \param [in] pairs the hex/shape pairs of the candidate primitives
+   * \param [out] pair_class_v the shaping::CellClass of each pair
+   * \param [in] eps distance tolerance
+   *
+   * A hex whose bounding box, expanded by \a eps, overlaps the bounding box
+   * of an unshared face of a shape is mixed.  Otherwise the hex does not
+   * touch the boundary of the shape, so it is inside exactly when a
+   * candidate primitive of the pair contains its vertex mean.  The faces of
+   * all the shapes go in one BVH.
+   */
+  template <typename ExecSpace, typename ShapeType>
+  void classifyHexes(axom::ArrayView<const ShapeType> shapes_view,
+                     const std::vector<IndexType>& shape_offsets,
+                     const shaping::CandidatePairs& pairs,
+                     axom::ArrayView<int> pair_class_v,
+                     double eps)
+  {
+    using TriangleType = primal::Triangle<double, 3>;
 
-    // Deallocate no longer needed variables
-    axom::deallocate(hex_indices);
-    axom::deallocate(shape_candidates);
-    axom::deallocate(tet_indices);
+    const int NE = m_hexes.size();
+    const int numShapes = static_cast<int>(shape_offsets.size()) - 1;
+    const auto hexes_view = m_hexes.view();
+    const auto hex_bbs_view = m_hex_bbs.view();
 
-    axom::setDefaultAllocator(current_allocator);
-  }  // end of runShapeQuery() function
+    // Gather the unshared faces of the shapes, tagged with their shape
+    axom::Array<TriangleType> faces;
+    axom::Array<int> face_shapes;
+    for(int s = 0; s < numShapes; ++s)
+    {
+      const IndexType first = shape_offsets[s];
+      const IndexType count = shape_offsets[s + 1] - first;
+      if(count == 0)
+      {
+        continue;
+      }
+
+      const auto shapeFaces = shaping::findUnsharedFaces<ExecSpace, ShapeType>(
+        shapes_view.subspan(first, count),
+        eps);
+      faces.append(shapeFaces.view());
+      face_shapes.insert(face_shapes.size(), shapeFaces.size(), s);
+
+      if(this->isVerbose())
+      {
+        constexpr int NUM_FACES = shaping::PrimitiveFaces<ShapeType>::NUM_FACES;
+        SLIC_INFO(axom::fmt::format("Shape {} has {} boundary faces out of {}",
+                                    s,
+                                    shapeFaces.size(),
+                                    count * NUM_FACES));
+      }
+    }
+    const IndexType numFaces = faces.size();
+    const auto faces_v = faces.view();
+    const auto face_shapes_v = face_shapes.view();
+
+    // Find the boundary faces near each hex
+    axom::Array<IndexType> faceOffsets(NE, NE);
+    axom::Array<IndexType> faceCounts(NE, NE);
+    axom::Array<IndexType> faceCandidates;
+    if(numFaces > 0)
+    {
+      axom::Array<BoundingBoxType> face_bbs(numFaces, numFaces);
+      const auto face_bbs_v = face_bbs.view();
+      axom::for_all<ExecSpace>(
+        numFaces,
+        AXOM_LAMBDA(axom::IndexType i) {
+          face_bbs_v[i] = primal::compute_bounding_box<double, 3>(faces_v[i]);
+        });
+
+      axom::Array<BoundingBoxType> query_bbs(NE, NE);
+      const auto query_bbs_v = query_bbs.view();
+      axom::for_all<ExecSpace>(
+        NE,
+        AXOM_LAMBDA(axom::IndexType i) {
+          query_bbs_v[i] = hex_bbs_view[i];
+          query_bbs_v[i].expand(eps);
+        });
+
+      spin::BVH<3, ExecSpace, double> faceBvh;
+      faceBvh.initialize(face_bbs_v, numFaces);
+      faceBvh.findBoundingBoxes(faceOffsets,
+                                faceCounts,
+                                faceCandidates,
+                                NE,
+                                query_bbs_v);
+    }
+    const auto faceOffsets_v = faceOffsets.view();
+    const auto faceCounts_v = faceCounts.view();
+    const auto faceCandidates_v = faceCandidates.view();
+    if(numFaces == 0)
+    {
+      axom::for_all<ExecSpace>(
+        NE,
+        AXOM_LAMBDA(axom::IndexType i) { faceCounts_v[i] = 0; });
+    }
+
+    const auto pair_offsets_v = pairs.cellOffsets.view();
+    const auto pair_shapes_v = pairs.shapes.view();
+    const auto prim_offsets_v = pairs.primitiveOffsets.view();
+    const auto prims_v = pairs.primitives.view();
+    axom::for_all<ExecSpace>(
+      NE,
+      AXOM_LAMBDA(axom::IndexType i) {
+        for(IndexType p = pair_offsets_v[i]; p < pair_offsets_v[i + 1]; ++p)
+        {
+          pair_class_v[p] = shaping::CELL_OUTSIDE;
+        }
+
+        // The hex is mixed against the shapes of its nearby boundary faces.
+        // A face may be near a hex that has no candidate primitive of the
+        // face's shape, which leaves nothing to clip.
+        for(int j = 0; j < faceCounts_v[i]; j++)
+        {
+          const IndexType faceIdx = faceCandidates_v[faceOffsets_v[i] + j];
+          const int faceShape = face_shapes_v[faceIdx];
+          const IndexType p = shaping::findCandidatePair(pair_offsets_v,
+                                                         pair_shapes_v,
+                                                         i,
+                                                         faceShape);
+          if(p >= 0)
+          {
+            pair_class_v[p] = shaping::CELL_MIXED;
+          }
+        }
+
+        // Against its other candidate shapes, the hex is inside or outside
+        const Point3D centroid = hexes_view[i].vertexMean();
+        for(IndexType p = pair_offsets_v[i]; p < pair_offsets_v[i + 1]; ++p)
+        {
+          for(IndexType k = prim_offsets_v[p]; k < prim_offsets_v[p + 1]; ++k)
+          {
+            if(pair_class_v[p] == shaping::CELL_OUTSIDE &&
+               shaping::convexContains(shapes_view[prims_v[k]], centroid, eps))
+            {
+              pair_class_v[p] = shaping::CELL_INSIDE;
+            }
+          }
+        }
+      });
+  }
 #endif
 
 #if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
@@ -989,61 +1657,55 @@ private:
   }
 
   /*!
-   * \brief Gets the grid function and material number for a material name.
+   * \brief Gets the volume fraction data and material number for a material
+   *        name.
    *
    * \param materialName The name of the material.
    *
-   * \return A pair containing the associated grid function and material
-   *         number (its order in the list).
+   * \return A pair containing the associated volume fraction data and
+   *         material number (its order in the list).
    */
-  std::pair<mfem::GridFunction*, int> getMaterial(const std::string& materialName)
+  std::pair<double*, int> getMaterial(const std::string& materialName)
   {
     // If we already know about the material, return it.
     for(size_t i = 0; i < m_vf_material_names.size(); i++)
     {
       if(m_vf_material_names[i] == materialName)
       {
-        return std::make_pair(m_vf_grid_functions[i], static_cast<int>(i));
+        return std::make_pair(m_vf_fields[i], static_cast<int>(i));
       }
     }
 
     // Get or create the volume fraction field for this shape's material
     auto materialVolFracName = materialNameToFieldName(materialName);
-    mfem::GridFunction* matVolFrac = nullptr;
-    if(this->getDC()->HasField(materialVolFracName))
-    {
-      matVolFrac = this->getDC()->GetField(materialVolFracName);
-    }
-    else
+    double* matVolFrac = getVolFracField(materialVolFracName);
+    if(matVolFrac == nullptr)
     {
-      matVolFrac = newVolFracGridFunction();
-      this->getDC()->RegisterField(materialVolFracName, matVolFrac);
-      // Zero out the volume fractions (on host).
-      memset(matVolFrac->begin(), 0, matVolFrac->Size() * sizeof(double));
+      matVolFrac = newVolFracField(materialVolFracName, 0.);
     }
 
     // Add the material to our vectors.
-    int idx = static_cast<int>(m_vf_grid_functions.size());
-    m_vf_grid_functions.push_back(matVolFrac);
+    int idx = static_cast<int>(m_vf_fields.size());
+    m_vf_fields.push_back(matVolFrac);
     m_vf_material_names.push_back(materialName);
 
     return std::make_pair(matVolFrac, idx);
   }
 
   /*!
-   * \brief Scans the grid functions in the data collection and creates
-   *        a material entry for any that do not already exist. We maintain
-   *        our own vectors because we assume that the order of materials
-   *        does not change. The mfem::DataCollection uses a map internally
-   *        so if we add materials, it could change the traversal order.
+   * \brief Scans the fields of the mesh and creates a material entry for
+   *        any that do not already exist. We maintain our own vectors
+   *        because we assume that the order of materials does not change.
+   *        The fields are traversed by name, so if we add materials, it
+   *        could change the traversal order.
    *
    */
   void populateMaterials()
   {
     std::vector<std::string> materialNames;
-    for(auto it : this->getDC()->GetFieldMap())
+    for(const auto& fieldName : getFieldNames())
     {
-      std::string materialName = fieldNameToMaterialName(it.first);
+      std::string materialName = fieldNameToMaterialName(fieldName);
       if(!materialName.empty())
       {
         materialNames.emplace_back(materialName);
@@ -1061,45 +1723,37 @@ private:
 
 public:
   /*!
-   * \brief Make a new grid function that contains all of the free space not
-   *        occupied by existing materials.
+   * \brief Make a new volume fraction field that contains all of the free
+   *        space not occupied by existing materials.
    *
-   * \note We currently leave the free material in the data collection,
+   * \note We currently leave the free material in the mesh,
    *       even after the shaper has executed.
    *
    * \tparam ExecSpace The execution space where the data are computed.
    *
-   * \return The grid function that represents the amount of completely
+   * \return The field data that represent the amount of completely
    *         free space in each zone.
    */
   template <typename ExecSpace>
-  mfem::GridFunction* getCompletelyFree()
+  double* getCompletelyFree()
   {
     // Add the material prefix so the MFEMSidreDataCollection will automatically
     // consider the free material something it needs to write as a matset.
     const std::string fieldName(materialNameToFieldName(m_free_mat_name));
-    mfem::GridFunction* cfgf = nullptr;
-    if(this->getDC()->HasField(fieldName))
-    {
-      cfgf = this->getDC()->GetField(fieldName);
-    }
-    else
+    double* cfgf = getVolFracField(fieldName);
+    if(cfgf == nullptr)
     {
-      // Make the new grid function.
-      cfgf = newVolFracGridFunction();
-      this->getDC()->RegisterField(fieldName, cfgf);
+      // Make the new field.
+      cfgf = newVolFracField(fieldName, 1.);
 
       AXOM_PERF_MARK_SECTION("compute_free", {
-        int dataSize = cfgf->Size();
-        GridFunctionView<ExecSpace> cfView(cfgf);
-        axom::for_all<ExecSpace>(
-          dataSize,
-          AXOM_LAMBDA(axom::IndexType i) { cfView[i] = 1.; });
+        int dataSize = getNumElements();
+        GridFunctionView<ExecSpace> cfView(cfgf, dataSize);
 
         // Iterate over all materials and subtract off their VFs from cfgf.
-        for(auto& gf : m_vf_grid_functions)
+        for(auto& gf : m_vf_fields)
         {
-          GridFunctionView<ExecSpace> matVFView(gf, false);
+          GridFunctionView<ExecSpace> matVFView(gf, dataSize, false);
           axom::for_all<ExecSpace>(
             dataSize,
             AXOM_LAMBDA(axom::IndexType i) {
@@ -1169,16 +1823,16 @@ public:
     populateMaterials();
 
     // Get the free material so it is created first.
-    mfem::GridFunction* freeMat = getCompletelyFree<ExecSpace>();
+    double* freeMat = getCompletelyFree<ExecSpace>();
 
-    // Get this shape's material, creating the GridFunction if needed.
+    // Get this shape's material, creating the field if needed.
     auto matVF = getMaterial(shape.getMaterial());
-    int dataSize = matVF.first->Size();
+    int dataSize = getNumElements();
 
     // Get this shape's array.
     auto shapeVolFracName =
       axom::fmt::format("shape_vol_frac_{}", shape.getName());
-    auto* shapeVolFrac = this->getDC()->GetField(shapeVolFracName);
+    double* shapeVolFrac = getVolFracField(shapeVolFracName);
     SLIC_ASSERT(shapeVolFrac != nullptr);
 
     // Allocate some memory for the replacement rule data arrays.
@@ -1189,8 +1843,8 @@ public:
     ArrayView<double> vf_writable(vf_writable_array);
 
     // Determine which grid functions need to be considered for VF updates.
-    std::vector<std::pair<mfem::GridFunction*, int>> gf_order_by_matnumber;
-    std::vector<mfem::GridFunction*> updateVFs, excludeVFs;
+    std::vector<std::pair<double*, int>> gf_order_by_matnumber;
+    std::vector<double*> updateVFs, excludeVFs;
     if(!shape.getMaterialsReplaced().empty())
     {
       // Include materials replaced in updateVFs.
@@ -1204,11 +1858,11 @@ public:
       // Include all materials except those in "does_not_replace".
       // We'll also sort them by material number since the field map
       // sorts them by name rather than order added.
-      for(auto it : this->getDC()->GetFieldMap())
+      for(const auto& fieldName : getFieldNames())
       {
         // Check whether the field name looks like a VF field (and is not the
         // "free" field, which we handle specially)
-        std::string name = fieldNameToMaterialName(it.first);
+        std::string name = fieldNameToMaterialName(fieldName);
         if(!name.empty() && name != m_free_mat_name)
         {
           // See if the field is in the exclusion list. For the normal
@@ -1239,8 +1893,8 @@ public:
     // Sort eligible update materials by material number.
     std::sort(gf_order_by_matnumber.begin(),
               gf_order_by_matnumber.end(),
-              [&](const std::pair<mfem::GridFunction*, int>& lhs,
-                  const std::pair<mfem::GridFunction*, int>& rhs) {
+              [&](const std::pair<double*, int>& lhs,
+                  const std::pair<double*, int>& rhs) {
                 return lhs.second < rhs.second;
               });
 
@@ -1271,7 +1925,7 @@ public:
         for(const auto& name : shape.getMaterialsReplaced())
         {
           auto mat = getMaterial(name);
-          GridFunctionView<ExecSpace> matVFView(mat.first, false);
+          GridFunctionView<ExecSpace> matVFView(mat.first, dataSize, false);
           axom::for_all<ExecSpace>(
             dataSize,
             AXOM_LAMBDA(axom::IndexType i) {
@@ -1290,7 +1944,7 @@ public:
           AXOM_LAMBDA(axom::IndexType i) { vf_writable[i] = 1.; });
         for(auto& gf : excludeVFs)
         {
-          GridFunctionView<ExecSpace> matVFView(gf, false);
+          GridFunctionView<ExecSpace> matVFView(gf, dataSize, false);
           axom::for_all<ExecSpace>(
             dataSize,
             AXOM_LAMBDA(axom::IndexType i) {
@@ -1303,8 +1957,8 @@ public:
 
     // Compute the volume fractions for the current shape's material.
     AXOM_PERF_MARK_SECTION("compute_vf", {
-      GridFunctionView<ExecSpace> matVFView(matVF.first);
-      GridFunctionView<ExecSpace> shapeVFView(shapeVolFrac);
+      GridFunctionView<ExecSpace> matVFView(matVF.first, dataSize);
+      GridFunctionView<ExecSpace> shapeVFView(shapeVolFrac, dataSize);
 
       axom::ArrayView<double> overlap_volumes_view = m_overlap_volumes.view();
       axom::ArrayView<double> hex_volumes_view = m_hex_volumes.view();
@@ -1334,7 +1988,7 @@ public:
     AXOM_PERF_MARK_SECTION("update_vf", {
       for(auto& gf : updateVFs)
       {
-        GridFunctionView<ExecSpace> matVFView(gf);
+        GridFunctionView<ExecSpace> matVFView(gf, dataSize);
         axom::for_all<ExecSpace>(
           dataSize,
           AXOM_LAMBDA(axom::IndexType i) {
@@ -1510,6 +2164,46 @@ public:
     }
   }
 
+  /*!
+   * \brief Shapes all the shapes of the shape set in a single pass over the
+   *        mesh, based on the policy member set (default is sequential)
+   *
+   * \param shapeDimension The dimension of the shapes
+   *
+   * This replaces calling loadShape(), prepareShapeQuery(), runShapeQuery(),
+   * applyReplacementRules() and finalizeShapeQuery() for each shape.  The
+   * mesh elements are extracted once, and the overlap volumes with all the
+   * shapes are computed together before the replacement rules are applied
+   * in shape set order.
+   */
+  void runBatchedShapeQueries(klee::Dimensions shapeDimension)
+  {
+    switch(m_execPolicy)
+    {
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+    case RuntimePolicy::seq:
+      runBatchedShapeQueriesImpl<seq_exec>(shapeDimension);
+      break;
+  #if defined(AXOM_USE_OPENMP)
+    case RuntimePolicy::omp:
+      runBatchedShapeQueriesImpl<omp_exec>(shapeDimension);
+      break;
+  #endif  // AXOM_USE_OPENMP
+  #if defined(AXOM_USE_CUDA)
+    case RuntimePolicy::cuda:
+      runBatchedShapeQueriesImpl<cuda_exec>(shapeDimension);
+      break;
+  #endif  // AXOM_USE_CUDA
+  #if defined(AXOM_USE_HIP)
+    case RuntimePolicy::hip:
+      runBatchedShapeQueriesImpl<hip_exec>(shapeDimension);
+      break;
+  #endif  // AXOM_USE_HIP
+#endif    // AXOM_USE_RAJA && AXOM_USE_UMPIRE
+    }
+    AXOM_UNUSED_VAR(shapeDimension);
+  }
+
   void adjustVolumeFractions() override
   {
     // Implementation here -- not sure if this will require anything for intersection-based shaping
@@ -1970,6 +2664,96 @@ private:
     m_level = circleLevel;
   }
 
+  /// Returns the number of elements of the mesh being shaped
+  int getNumElements()
+  {
+    if(m_cellMesh != nullptr)
+    {
+      return static_cast<int>(m_cellMesh->getNumberOfCells());
+    }
+#if defined(AXOM_USE_MFEM)
+    mfem::Mesh* mesh = getDC()->GetMesh();
+    SLIC_ASSERT(mesh != nullptr);
+    return mesh->GetNE();
+#else
+    return 0;
+#endif
+  }
+
+  /// Returns the names of the fields of the mesh in alphabetical order
+  std::vector<std::string> getFieldNames()
+  {
+    std::vector<std::string> names;
+    if(m_cellMesh != nullptr)
+    {
+      const mint::FieldData* fd = m_cellMesh->getFieldData(mint::CELL_CENTERED);
+      for(int i = 0; i < fd->getNumFields(); ++i)
+      {
+        names.push_back(fd->getField(i)->getName());
+      }
+      std::sort(names.begin(), names.end());
+    }
+#if defined(AXOM_USE_MFEM)
+    else
+    {
+      for(auto it : this->getDC()->GetFieldMap())
+      {
+        names.push_back(it.first);
+      }
+    }
+#endif
+    return names;
+  }
+
+  /*!
+   * \brief Returns the per-element data of a volume fraction field, or
+   *        nullptr if the mesh does not have the field
+   */
+  double* getVolFracField(const std::string& fieldName)
+  {
+    if(m_cellMesh != nullptr)
+    {
+      return m_cellMesh->hasField(fieldName, mint::CELL_CENTERED)
+        ? m_cellMesh->getFieldPtr<double>(fieldName, mint::CELL_CENTERED)
+        : nullptr;
+    }
+#if defined(AXOM_USE_MFEM)
+    if(this->getDC()->HasField(fieldName))
+    {
+      return this->getDC()->GetField(fieldName)->GetData();
+    }
+#endif
+    return nullptr;
+  }
+
+  /*!
+   * \brief Adds a volume fraction field with one value per element to the
+   *        mesh and returns its data
+   *
+   * \param fieldName The name of the new field.
+   * \param value The initial value of the field (set on host).
+   */
+  double* newVolFracField(const std::string& fieldName, double value)
+  {
+    double* data = nullptr;
+    if(m_cellMesh != nullptr)
+    {
+      data = m_cellMesh->createField<double>(fieldName, mint::CELL_CENTERED);
+    }
+#if defined(AXOM_USE_MFEM)
+    else
+    {
+      mfem::GridFunction* volFrac = newVolFracGridFunction();
+      this->getDC()->RegisterField(fieldName, volFrac);
+      data = volFrac->GetData();
+    }
+#endif
+    SLIC_ASSERT(data != nullptr);
+    std::fill_n(data, getNumElements(), value);
+    return data;
+  }
+
+#if defined(AXOM_USE_MFEM)
   /// Create and return a new volume fraction grid function for the current mesh
   mfem::GridFunction* newVolFracGridFunction()
   {
@@ -1986,10 +2770,51 @@ private:
 
     return volFrac;
   }
+#endif
+
+  /*!
+   * \brief Registers the volume fraction field of a shape, which starts out
+   *        as 1 in every element
+   */
+  double* registerShapeVolFrac(const klee::Shape& shape)
+  {
+    // Create and register a scalar field for this shape's volume fractions
+    // The Degrees of Freedom will be in correspondence with the elements
+    auto volFracName = axom::fmt::format("shape_vol_frac_{}", shape.getName());
+    return newVolFracField(volFracName, 1.);
+  }
+
+  /// The primitives of several shapes, tagged with the index of their shape
+  template <typename ShapeType>
+  struct PrimitiveBatch
+  {
+    explicit PrimitiveBatch(int allocatorID)
+      : primitives(0, 0, allocatorID)
+      , shapeIds(0, 0, allocatorID)
+      , offsets {0}
+    { }
+
+    /// Appends the primitives of the next shape
+    void add(axom::ArrayView<const ShapeType> shape_primitives)
+    {
+      const int shape = static_cast<int>(offsets.size()) - 1;
+      primitives.append(shape_primitives);
+      shapeIds.insert(shapeIds.size(), shape_primitives.size(), shape);
+      offsets.push_back(primitives.size());
+    }
+
+    axom::Array<ShapeType> primitives;
+    axom::Array<int> shapeIds;
+
+    /// The primitives of shape s are in [offsets[s], offsets[s + 1])
+    std::vector<IndexType> offsets;
+  };
 
 private:
   RuntimePolicy m_execPolicy {RuntimePolicy::seq};
   int m_level {DEFAULT_CIRCLE_REFINEMENT_LEVEL};
+  bool m_classifyCells {true};
+  bool m_directHexClipping {true};
   double m_revolvedVolume {DEFAULT_REVOLVED_VOLUME};
   int m_num_elements {0};
   std::string m_free_mat_name;
@@ -2008,7 +2833,7 @@ private:
   axom::Array<HexahedronType> m_hexes;
   axom::Array<BoundingBoxType> m_hex_bbs;
 
-  std::vector<mfem::GridFunction*> m_vf_grid_functions;
+  std::vector<double*> m_vf_fields;
   std::vector<std::string> m_vf_material_names;
 #endif
 };
@@ -10,10 +10,17 @@
   #include "conduit_blueprint.hpp"
 
   #include "axom/core/execution/execution_space.hpp"
+  #include "axom/core/execution/for_all.hpp"
   #include "axom/quest/MarchingCubes.hpp"
   #include "axom/quest/detail/MarchingCubesImpl.hpp"
   #include "axom/fmt.hpp"
 
+  #include <algorithm>
+
+  #ifdef AXOM_USE_OPENMP
+    #include <omp.h>
+  #endif
+
 namespace axom
 {
 namespace quest
@@ -24,6 +31,8 @@ MarchingCubes::MarchingCubes(RuntimePolicy runtimePolicy,
                              const std::string& maskField)
   : m_runtimePolicy(runtimePolicy)
   , m_singles()
+  , m_domainParallel(false)
+  , m_weldNodes(false)
   , m_topologyName(topologyName)
   , m_fcnFieldName()
   , m_fcnPath()
@@ -35,10 +44,22 @@ MarchingCubes::MarchingCubes(RuntimePolicy runtimePolicy,
     isMultidomain,
     "MarchingCubes class input mesh must be in multidomain format.");
 
-  m_singles.reserve(conduit::blueprint::mesh::number_of_domains(bpMesh));
+  const axom::IndexType domainCount =
+    conduit::blueprint::mesh::number_of_domains(bpMesh);
+
+  // With many domains, run a sequential implementation on each domain
+  // and process the domains concurrently.
+  #ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+  m_domainParallel = m_runtimePolicy == RuntimePolicy::omp &&
+    domainCount > 1 && domainCount >= omp_get_max_threads();
+  #endif
+  const RuntimePolicy domainPolicy =
+    m_domainParallel ? RuntimePolicy::seq : m_runtimePolicy;
+
+  m_singles.reserve(domainCount);
   for(auto& dom : bpMesh.children())
   {
-    m_singles.emplace_back(new MarchingCubesSingleDomain(m_runtimePolicy,
+    m_singles.emplace_back(new MarchingCubesSingleDomain(domainPolicy,
                                                          dom,
                                                          m_topologyName,
                                                          maskField));
@@ -55,15 +76,49 @@ void MarchingCubes::setFunctionField(const std::string& fcnField)
   }
 }
 
+void MarchingCubes::setWeldNodes(bool weldNodes)
+{
+  m_weldNodes = weldNodes;
+  for(auto& s : m_singles)
+  {
+    s->setWeldNodes(weldNodes);
+  }
+}
+
+void MarchingCubes::setComputeNormals(bool computeNormals)
+{
+  for(auto& s : m_singles)
+  {
+    s->setComputeNormals(computeNormals);
+  }
+}
+
 void MarchingCubes::computeIsocontour(double contourVal)
+{
+  computeIsocontours(std::vector<double> {contourVal});
+}
+
+void MarchingCubes::computeIsocontours(const std::vector<double>& contourVals)
 {
   SLIC_ASSERT_MSG(!m_fcnFieldName.empty(),
                   "You must call setFunctionField before computeIsocontour.");
 
-  for(int dId = 0; dId < m_singles.size(); ++dId)
+  auto singlesView = m_singles.view();
+  auto computeDomain = [=, &contourVals](axom::IndexType dId) {
+    singlesView[dId]->computeIsocontours(contourVals);
+  };
+
+  #ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+  if(m_domainParallel)
+  {
+    axom::for_all<axom::OMP_EXEC>(0, m_singles.size(), computeDomain);
+    return;
+  }
+  #endif
+
+  for(axom::IndexType dId = 0; dId < m_singles.size(); ++dId)
   {
-    std::unique_ptr<MarchingCubesSingleDomain>& single = m_singles[dId];
-    single->computeIsocontour(contourVal);
+    computeDomain(dId);
   }
 }
 
@@ -90,7 +145,9 @@ axom::IndexType MarchingCubes::getContourNodeCount() const
 void MarchingCubes::populateContourMesh(
   axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE>& mesh,
   const std::string& cellIdField,
-  const std::string& domainIdField)
+  const std::string& domainIdField,
+  const std::string& normalField,
+  const std::string& valueIdField)
 {
   if(!cellIdField.empty() &&
      !mesh.hasField(cellIdField, axom::mint::CELL_CENTERED))
@@ -106,39 +163,198 @@ void MarchingCubes::populateContourMesh(
     mesh.createField<axom::IndexType>(domainIdField, axom::mint::CELL_CENTERED);
   }
 
-  // Reserve space once for all local domains.
-  const axom::IndexType contourCellCount = getContourCellCount();
-  const axom::IndexType contourNodeCount = getContourNodeCount();
-  mesh.reserveCells(contourCellCount);
-  mesh.reserveNodes(contourNodeCount);
+  if(!normalField.empty() &&
+     !mesh.hasField(normalField, axom::mint::NODE_CENTERED))
+  {
+    mesh.createField<double>(normalField,
+                             axom::mint::NODE_CENTERED,
+                             mesh.getDimension());
+  }
 
-  // Populate mesh from single domains and add domain id if requested.
-  for(int dId = 0; dId < m_singles.size(); ++dId)
+  if(!valueIdField.empty() &&
+     !mesh.hasField(valueIdField, axom::mint::CELL_CENTERED))
   {
-    std::unique_ptr<MarchingCubesSingleDomain>& single = m_singles[dId];
+    mesh.createField<axom::IndexType>(valueIdField, axom::mint::CELL_CENTERED);
+  }
+
+  // Scan the domains' contour sizes to find where each domain's contour
+  // goes, then size the mesh once for all local domains.
+  const axom::IndexType domainCount = m_singles.size();
+  axom::Array<axom::IndexType> cellOffsets(domainCount + 1, domainCount + 1);
+  axom::Array<axom::IndexType> nodeOffsets(domainCount + 1, domainCount + 1);
+  cellOffsets[0] = mesh.getNumberOfCells();
+  nodeOffsets[0] = mesh.getNumberOfNodes();
+  for(axom::IndexType dId = 0; dId < domainCount; ++dId)
+  {
+    cellOffsets[dId + 1] =
+      cellOffsets[dId] + m_singles[dId]->getContourCellCount();
+    nodeOffsets[dId + 1] =
+      nodeOffsets[dId] + m_singles[dId]->getContourNodeCount();
+  }
 
-    auto nPrev = mesh.getNumberOfCells();
-    single->populateContourMesh(mesh, cellIdField);
-    auto nNew = mesh.getNumberOfCells();
+  const axom::IndexType priorNodeCount = nodeOffsets[0];
+  const axom::IndexType priorCellCount = cellOffsets[0];
+  const axom::IndexType contourCellCount =
+    cellOffsets[domainCount] - priorCellCount;
+  const axom::IndexType contourNodeCount =
+    nodeOffsets[domainCount] - priorNodeCount;
+  mesh.resize(priorNodeCount + contourNodeCount,
+              priorCellCount + contourCellCount);
+
+  axom::IndexType* domainIdPtr = domainIdField.empty()
+    ? nullptr
+    : mesh.getFieldPtr<axom::IndexType>(domainIdField,
+                                        axom::mint::CELL_CENTERED);
+
+  // Copy each domain's contour into its range and add domain id if requested.
+  auto singlesView = m_singles.view();
+  auto cellOffsetsView = cellOffsets.view();
+  auto nodeOffsetsView = nodeOffsets.view();
+  auto writeDomain = [=, &mesh](axom::IndexType dId) {
+    const auto& single = singlesView[dId];
+    const axom::IndexType cellBegin = cellOffsetsView[dId];
+    const axom::IndexType cellEnd = cellOffsetsView[dId + 1];
+    const axom::IndexType nodeBegin = nodeOffsetsView[dId];
+
+    single->writeContourMesh(mesh,
+                             cellIdField,
+                             normalField,
+                             valueIdField,
+                             nodeBegin,
+                             cellBegin);
+
+    if(domainIdPtr != nullptr)
+    {
+      const axom::IndexType userDomainId = single->getDomainId(dId);
+      std::fill(domainIdPtr + cellBegin, domainIdPtr + cellEnd, userDomainId);
+    }
+  };
 
-    if(nNew > nPrev && !domainIdField.empty())
+  #ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+  if(m_runtimePolicy == RuntimePolicy::omp)
+  {
+    axom::for_all<axom::OMP_EXEC>(0, domainCount, writeDomain);
+  }
+  else
+  #endif
+  {
+    for(axom::IndexType dId = 0; dId < domainCount; ++dId)
     {
-      auto* domainIdPtr =
-        mesh.getFieldPtr<axom::IndexType>(domainIdField,
-                                          axom::mint::CELL_CENTERED);
-
-      int userDomainId = single->getDomainId(dId);
-
-      axom::detail::ArrayOps<axom::IndexType, MemorySpace::Dynamic>::fill(
-        domainIdPtr,
-        nPrev,
-        nNew - nPrev,
-        execution_space<axom::SEQ_EXEC>::allocatorID(),
-        userDomainId);
+      writeDomain(dId);
     }
   }
-  SLIC_ASSERT(mesh.getNumberOfNodes() == contourNodeCount);
-  SLIC_ASSERT(mesh.getNumberOfCells() == contourCellCount);
+
+  SLIC_ASSERT(mesh.getNumberOfNodes() == priorNodeCount + contourNodeCount);
+  SLIC_ASSERT(mesh.getNumberOfCells() == priorCellCount + contourCellCount);
+
+  // Each domain's nodes are already unique, so only nodes shared by
+  // domains remain to be merged.
+  if(m_weldNodes && domainCount > 1)
+  {
+    weldContourNodes(mesh, normalField, priorNodeCount, priorCellCount);
+  }
+}
+
+void MarchingCubes::weldContourNodes(
+  axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE>& mesh,
+  const std::string& normalField,
+  axom::IndexType nodeBegin,
+  axom::IndexType cellBegin) const
+{
+  const int dim = mesh.getDimension();
+  const axom::IndexType nodeCount = mesh.getNumberOfNodes() - nodeBegin;
+  if(nodeCount == 0)
+  {
+    return;
+  }
+
+  double* coords[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < dim; ++d)
+  {
+    coords[d] = mesh.getCoordinateArray(d) + nodeBegin;
+  }
+  double* normals = normalField.empty()
+    ? nullptr
+    : mesh.getFieldPtr<double>(normalField, axom::mint::NODE_CENTERED) +
+      nodeBegin * dim;
+
+  auto sameCoords = [&](axom::IndexType a, axom::IndexType b) {
+    for(int d = 0; d < dim; ++d)
+    {
+      if(coords[d][a] != coords[d][b])
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // Sort the nodes on their coordinates, so that coincident nodes are
+  // adjacent and ordered by node id.
+  axom::Array<axom::IndexType> sortedIds(nodeCount, nodeCount);
+  for(axom::IndexType n = 0; n < nodeCount; ++n)
+  {
+    sortedIds[n] = n;
+  }
+  std::sort(sortedIds.begin(),
+            sortedIds.end(),
+            [&](axom::IndexType a, axom::IndexType b) {
+              for(int d = 0; d < dim; ++d)
+              {
+                if(coords[d][a] != coords[d][b])
+                {
+                  return coords[d][a] < coords[d][b];
+                }
+              }
+              return a < b;
+            });
+
+  // Map each node to the first node with its coordinates.
+  axom::Array<axom::IndexType> firstIds(nodeCount, nodeCount);
+  axom::IndexType firstId = sortedIds[0];
+  for(axom::IndexType i = 0; i < nodeCount; ++i)
+  {
+    const axom::IndexType n = sortedIds[i];
+    if(i > 0 && !sameCoords(n, sortedIds[i - 1]))
+    {
+      firstId = n;
+    }
+    firstIds[n] = firstId;
+  }
+
+  // Number the first nodes in their original order and compact their
+  // data in place.  A node's new id never exceeds its old id.
+  axom::Array<axom::IndexType> newIds(nodeCount, nodeCount);
+  axom::IndexType uniqueCount = 0;
+  for(axom::IndexType n = 0; n < nodeCount; ++n)
+  {
+    if(firstIds[n] != n)
+    {
+      newIds[n] = newIds[firstIds[n]];
+      continue;
+    }
+    for(int d = 0; d < dim; ++d)
+    {
+      coords[d][uniqueCount] = coords[d][n];
+      if(normals != nullptr)
+      {
+        normals[uniqueCount * dim + d] = normals[n * dim + d];
+      }
+    }
+    newIds[n] = uniqueCount++;
+  }
+
+  const axom::IndexType connectivityBegin =
+    cellBegin * mesh.getNumberOfCellNodes();
+  const axom::IndexType connectivityEnd =
+    mesh.getNumberOfCells() * mesh.getNumberOfCellNodes();
+  axom::IndexType* cellNodes = mesh.getCellNodesArray();
+  for(axom::IndexType i = connectivityBegin; i < connectivityEnd; ++i)
+  {
+    cellNodes[i] = nodeBegin + newIds[cellNodes[i] - nodeBegin];
+  }
+
+  mesh.resizeNodes(nodeBegin + uniqueCount);
 }
 
 MarchingCubesSingleDomain::MarchingCubesSingleDomain(RuntimePolicy runtimePolicy,
@@ -211,16 +427,102 @@ int MarchingCubesSingleDomain::getDomainId(int defaultId) const
 }
 
 void MarchingCubesSingleDomain::computeIsocontour(double contourVal)
+{
+  computeIsocontours(std::vector<double> {contourVal});
+}
+
+void MarchingCubesSingleDomain::computeIsocontours(
+  const std::vector<double>& contourVals)
 {
   SLIC_ASSERT_MSG(!m_fcnFieldName.empty(),
                   "You must call setFunctionField before computeIsocontour.");
 
-  allocateImpl();
-  m_impl->initialize(*m_dom, m_topologyName, m_fcnFieldName, m_maskFieldName);
-  m_impl->setContourValue(contourVal);
-  m_impl->markCrossings();
-  m_impl->scanCrossings();
-  m_impl->computeContour();
+  // Set up the mesh data once and reuse it for later contours.
+  if(!m_impl)
+  {
+    allocateImpl();
+    m_impl->initialize(*m_dom, m_topologyName, m_maskFieldName);
+  }
+  m_impl->clear();
+  m_impl->setFunctionField(m_fcnFieldName);
+  m_impl->setWeldNodes(m_weldNodes);
+  m_impl->setComputeNormals(m_computeNormals);
+
+  // Cell ranges cost a pass over the function, so they only pay off
+  // when shared by multiple contour values.
+  if(contourVals.size() > 1)
+  {
+    m_impl->computeCellRanges();
+  }
+
+  const axom::IndexType valueCount = contourVals.size();
+  m_valueCellOffsets.resize(valueCount + 1);
+  m_valueCellOffsets[0] = 0;
+  for(axom::IndexType v = 0; v < valueCount; ++v)
+  {
+    m_impl->setContourValue(contourVals[v]);
+    m_impl->markCrossings();
+    m_impl->scanCrossings();
+    m_impl->computeContour();
+    m_valueCellOffsets[v + 1] = m_impl->getContourCellCount();
+  }
+}
+
+void MarchingCubesSingleDomain::populateContourMesh(
+  axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE>& mesh,
+  const std::string& cellIdField,
+  const std::string& normalField,
+  const std::string& valueIdField) const
+{
+  if(!valueIdField.empty() &&
+     !mesh.hasField(valueIdField, axom::mint::CELL_CENTERED))
+  {
+    mesh.createField<axom::IndexType>(valueIdField, axom::mint::CELL_CENTERED);
+  }
+
+  const axom::IndexType priorCellCount = mesh.getNumberOfCells();
+  m_impl->populateContourMesh(mesh, cellIdField, normalField);
+
+  if(!valueIdField.empty())
+  {
+    writeValueIds(mesh, valueIdField, priorCellCount);
+  }
+}
+
+void MarchingCubesSingleDomain::writeContourMesh(
+  axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE>& mesh,
+  const std::string& cellIdField,
+  const std::string& normalField,
+  const std::string& valueIdField,
+  axom::IndexType nodeOffset,
+  axom::IndexType cellOffset) const
+{
+  m_impl->writeContourMesh(mesh,
+                           cellIdField,
+                           normalField,
+                           nodeOffset,
+                           cellOffset);
+
+  if(!valueIdField.empty())
+  {
+    writeValueIds(mesh, valueIdField, cellOffset);
+  }
+}
+
+void MarchingCubesSingleDomain::writeValueIds(
+  axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE>& mesh,
+  const std::string& valueIdField,
+  axom::IndexType cellOffset) const
+{
+  axom::IndexType* valueIdPtr =
+    mesh.getFieldPtr<axom::IndexType>(valueIdField, axom::mint::CELL_CENTERED);
+  valueIdPtr += cellOffset;
+  for(axom::IndexType v = 0; v < m_valueCellOffsets.size() - 1; ++v)
+  {
+    std::fill(valueIdPtr + m_valueCellOffsets[v],
+              valueIdPtr + m_valueCellOffsets[v + 1],
+              v);
+  }
 }
 
 void MarchingCubesSingleDomain::allocateImpl()
@@ -27,6 +27,7 @@
 
   // C++ includes
   #include <string>
+  #include <vector>
 
 namespace axom
 {
@@ -78,6 +79,13 @@ class MarchingCubesSingleDomain;
  * To avoid confusion between the two meshes, we refer to the input
  * mesh with the scalar function as "parent" and the generated mesh
  * as the "contour".
+ *
+ * Data derived from the parent mesh is computed once and reused by
+ * later calls to setFunctionField() and computeIsocontour(), so
+ * contouring other functions or time steps on the same mesh only
+ * reads the function data.  To extract several contour values of a
+ * function, computeIsocontours() is faster than separate calls to
+ * computeIsocontour().
  */
 class MarchingCubes
 {
@@ -106,6 +114,9 @@ public:
    * conduit::blueprint::is_contiguous().  In the future, this
    * requirement may be relaxed, possibly at the cost of a
    * transformation and storage of the temporary contiguous layout.
+   *
+   * With RuntimePolicy::omp and many small domains, the domains are
+   * processed concurrently rather than one at a time.
    */
   MarchingCubes(RuntimePolicy runtimePolicy,
                 const conduit::Node &bpMesh,
@@ -115,19 +126,68 @@ public:
   /*!
     @brief Set the field containing the nodal function.
     \param [in] fcnField Name of node-based scalar function values.
+
+    The function data may change between calls to computeIsocontour()
+    without calling this method again.
   */
   void setFunctionField(const std::string &fcnField);
 
+  /*!
+    @brief Set whether contour cells share their nodes.
+
+    By default, each contour cell has its own DIM nodes, so nodes
+    on a parent edge crossed by the contour are duplicated by every
+    contour cell using them.  With welding on, each parent edge
+    crossing generates a single node, making the contour watertight.
+
+    Domains that abut share the contour nodes on their common
+    boundary: populateContourMesh() merges the nodes of all domains
+    that have the same coordinates, which is the case for crossings
+    of an edge shared by two domains, as long as the domains have
+    the same coordinates and function values at their shared nodes.
+  */
+  void setWeldNodes(bool weldNodes);
+
+  /*!
+    @brief Set whether to compute unit normals at the contour nodes.
+
+    Normals are computed from the gradient of the multilinear
+    interpolant of the function in the parent cell, and they point
+    toward increasing function values.  Use the \a normalField
+    argument of populateContourMesh() to get them.
+  */
+  void setComputeNormals(bool computeNormals);
+
   /*!
    \brief Computes the isocontour.
    \param [in] contourVal isocontour value
    */
   void computeIsocontour(double contourVal = 0.0);
 
+  /*!
+   \brief Computes the isocontours for several contour values.
+   \param [in] contourVals isocontour values
+
+   The contour mesh holds the contours of all the values, ordered by
+   value within each domain.  Use the \a valueIdField argument of
+   populateContourMesh() to tell them apart.
+
+   The function range in each parent cell is computed once and
+   shared by all the values, so each value only reads the function
+   at cells whose range includes the value.
+   */
+  void computeIsocontours(const std::vector<double> &contourVals);
+
   //!@brief Get number of cells in the generated contour mesh.
   axom::IndexType getContourCellCount() const;
 
-  //!@brief Get number of nodes in the generated contour mesh.
+  /*!
+    @brief Get number of nodes in the generated contour mesh.
+
+    With welding on, nodes on the boundary between domains are
+    counted once for each domain, so this is an upper bound on the
+    number of nodes added by populateContourMesh().
+  */
   axom::IndexType getContourNodeCount() const;
 
   /*!
@@ -137,9 +197,23 @@ public:
       parent cell ids. If omitted, the data is not provided.
     @param domainIdField Name of field to store the (axom::IndexType)
       parent domain ids. If omitted, the data is not provided.
+    @param normalField Name of node-centered field to store the
+      (double) contour normals.  If omitted, the data is not provided.
+      Requires setComputeNormals(true) before computeIsocontour().
+    @param valueIdField Name of field to store the (axom::IndexType)
+      index of each cell's contour value in the list given to
+      computeIsocontours().  If omitted, the data is not provided.
 
     If the fields aren't in the mesh, they will be created.
 
+    The contours of all domains are appended to \a mesh as one
+    contiguous block, ordered by domain.  The mesh is resized once
+    using a scan of the per-domain contour sizes, after which the
+    domains are copied into their ranges (concurrently, with the
+    OpenMP runtime policy).  With welding on, a final pass over the
+    contour nodes of all domains then merges the nodes that domains
+    share, and the mesh is shrunk to the merged node count.
+
     Blueprint allows users to specify ids for the domains.  If
     "state/domain_id" exists in the domains, it is used as the domain
     id.  Otherwise, the domain's interation index within the
@@ -148,13 +222,26 @@ public:
   void populateContourMesh(
     axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE> &mesh,
     const std::string &cellIdField = {},
-    const std::string &domainIdField = {});
+    const std::string &domainIdField = {},
+    const std::string &normalField = {},
+    const std::string &valueIdField = {});
 
 private:
   RuntimePolicy m_runtimePolicy;
 
   //! @brief Single-domain implementations.
   axom::Array<std::unique_ptr<MarchingCubesSingleDomain>> m_singles;
+  /*!
+    @brief Whether to process domains concurrently, each with a
+    sequential single-domain implementation.
+
+    This is used with the OpenMP runtime policy when there are at
+    least as many domains as threads, where per-domain overhead
+    would otherwise dominate.
+  */
+  bool m_domainParallel;
+  //!@brief Whether contour cells share nodes, including across domains.
+  bool m_weldNodes;
   const std::string m_topologyName;
   std::string m_fcnFieldName;
   std::string m_fcnPath;
@@ -162,6 +249,20 @@ private:
   std::string m_maskPath;
 
   void setMesh(const conduit::Node &bpMesh);
+
+  /*!
+    @brief Merge the contour nodes of \a mesh from \a nodeBegin on
+    that have the same coordinates, and renumber the nodes of the
+    cells from \a cellBegin on.
+
+    The remaining nodes keep their relative order, and each keeps
+    the normal of its first occurrence.
+  */
+  void weldContourNodes(
+    axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE> &mesh,
+    const std::string &normalField,
+    axom::IndexType nodeBegin,
+    axom::IndexType cellBegin) const;
 };
 
 /*!
@@ -214,6 +315,15 @@ public:
   */
   void setFunctionField(const std::string &fcnField);
 
+  //!@brief Set whether contour cells share nodes.  See MarchingCubes.
+  void setWeldNodes(bool weldNodes) { m_weldNodes = weldNodes; }
+
+  //!@brief Set whether to compute contour normals.  See MarchingCubes.
+  void setComputeNormals(bool computeNormals)
+  {
+    m_computeNormals = computeNormals;
+  }
+
   /*!
     @brief Get the Blueprint domain id specified in \a state/domain_id
     if it is provided, or use the given default if not provided.
@@ -230,6 +340,15 @@ public:
    */
   void computeIsocontour(double contourVal = 0.0);
 
+  /*!
+   * \brief Compute the isocontours for several contour values.
+   *
+   * \param [in] contourVals isocontour values
+   *
+   * \sa MarchingCubes::computeIsocontours()
+   */
+  void computeIsocontours(const std::vector<double> &contourVals);
+
   //!@brief Get number of cells in the generated contour mesh.
   axom::IndexType getContourCellCount() const
   {
@@ -243,7 +362,10 @@ public:
   //!@brief Get number of nodes in the generated contour mesh.
   axom::IndexType getContourNodeCount() const
   {
-    return m_ndim * getContourCellCount();
+    SLIC_ASSERT_MSG(
+      m_impl,
+      "There is no contour mesh until you call computeIsocontour()");
+    return m_impl->getContourNodeCount();
   }
 
   /*!
@@ -253,13 +375,43 @@ public:
     @param mesh Output mesh
     @param cellIdField Name of field to store the prent cell ids.
       If omitted, the data is not copied.
+    @param normalField Name of node-centered field to store the
+      contour normals.  If omitted, the data is not copied.
+    @param valueIdField Name of field to store the index of each
+      cell's contour value.  If omitted, the data is not copied.
   */
   void populateContourMesh(
     axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE> &mesh,
-    const std::string &cellIdField = {}) const
-  {
-    m_impl->populateContourMesh(mesh, cellIdField);
-  }
+    const std::string &cellIdField = {},
+    const std::string &normalField = {},
+    const std::string &valueIdField = {}) const;
+
+  /*!
+    @brief Copy generated contour surface into a range of nodes and
+    cells of a mint::UnstructuredMesh object.
+
+    @param mesh Output mesh, already sized to hold the contour at
+      the given offsets
+    @param cellIdField Name of existing field to store the parent cell
+      ids.  If empty, the data is not copied.
+    @param normalField Name of existing node-centered field to store
+      the contour normals.  If empty, the data is not copied.
+    @param valueIdField Name of existing field to store the index of
+      each cell's contour value.  If empty, the data is not copied.
+    @param nodeOffset Index of the first mesh node for this contour
+    @param cellOffset Index of the first mesh cell for this contour
+
+    Unlike populateContourMesh, this method does not resize \a mesh,
+    so contours from several domains can be written concurrently
+    into disjoint ranges of the same mesh.
+  */
+  void writeContourMesh(
+    axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE> &mesh,
+    const std::string &cellIdField,
+    const std::string &normalField,
+    const std::string &valueIdField,
+    axom::IndexType nodeOffset,
+    axom::IndexType cellOffset) const;
 
 private:
   RuntimePolicy m_runtimePolicy;
@@ -280,6 +432,17 @@ private:
   //!@brief Path to mask in m_dom.
   const std::string m_maskPath;
 
+  /*!
+    @brief Offsets of each contour value's cells in the contour, with
+    a final entry for the total contour cell count.
+  */
+  axom::Array<axom::IndexType> m_valueCellOffsets;
+
+  //!@brief Whether contour cells share nodes.
+  bool m_weldNodes = false;
+  //!@brief Whether to compute contour node normals.
+  bool m_computeNormals = false;
+
   /*!
     @brief Base class for implementations templated on dimension
     and execution space.
@@ -292,12 +455,21 @@ private:
     //!@brief Prepare internal data for operating on the given domain.
     virtual void initialize(const conduit::Node &dom,
                             const std::string &topologyName,
-                            const std::string &fcnPath,
                             const std::string &maskPath) = 0;
+    //!@brief Set the nodal function to contour.
+    virtual void setFunctionField(const std::string &fcnField) = 0;
+    //!@brief Clear the contour generated so far.
+    virtual void clear() = 0;
     //!@brief Set the contour value
     virtual void setContourValue(double contourVal) = 0;
+    //!@brief Set whether contour cells share nodes.
+    virtual void setWeldNodes(bool weldNodes) = 0;
+    //!@brief Set whether to compute contour node normals.
+    virtual void setComputeNormals(bool computeNormals) = 0;
     //@{
     //!@name Phases of the computation
+    //!@brief Compute function ranges for screening cells (optional).
+    virtual void computeCellRanges() = 0;
     //!@brief Mark domain cells that cross the contour.
     virtual void markCrossings() = 0;
     //!@brief Precompute some metadata for contour mesh.
@@ -307,6 +479,8 @@ private:
     //!@brief Get the number of contour mesh cells generated.
     //@}
     virtual axom::IndexType getContourCellCount() const = 0;
+    //!@brief Get the number of contour mesh nodes generated.
+    virtual axom::IndexType getContourNodeCount() const = 0;
     /*!
       @brief Populate output mesh object with generated contour.
 
@@ -315,7 +489,18 @@ private:
     */
     virtual void populateContourMesh(
       axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE> &mesh,
-      const std::string &cellIdField) const = 0;
+      const std::string &cellIdField,
+      const std::string &normalField) const = 0;
+    /*!
+      @brief Copy generated contour into a range of an output mesh
+      object already sized to hold it.
+    */
+    virtual void writeContourMesh(
+      axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE> &mesh,
+      const std::string &cellIdField,
+      const std::string &normalField,
+      axom::IndexType nodeOffset,
+      axom::IndexType cellOffset) const = 0;
     virtual ~ImplBase() { }
   };
 
@@ -323,6 +508,12 @@ private:
   //!@brief Allocate implementation object and set m_impl.
   void allocateImpl();
 
+  //!@brief Write the contour value index of each contour cell.
+  void writeValueIds(
+    axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE> &mesh,
+    const std::string &valueIdField,
+    axom::IndexType cellOffset) const;
+
   /*!
    * \brief Set the blueprint single-domain mesh.
    *
@@ -5,47 +5,70 @@
 
 // Axom includes
 #include "axom/quest/MeshTester.hpp"
+#include "axom/quest/detail/VertexWelding.hpp"
+
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
+#endif
+
+// C/C++ includes
+#include <cstdint>
 
 namespace axom
 {
 namespace quest
 {
-inline detail::SpatialBoundingBox compute_bounds(detail::UMesh* mesh)
+namespace
 {
-  SLIC_ASSERT(mesh != nullptr);
+#ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+using HostExecSpace = axom::OMP_EXEC;
+#else
+using HostExecSpace = axom::SEQ_EXEC;
+#endif
 
-  detail::SpatialBoundingBox meshBB;
-  detail::Point3 pt;
+using IndexArray = axom::Array<axom::IndexType>;
 
-  const double* x = mesh->getCoordinateArray(mint::X_COORDINATE);
-  const double* y = mesh->getCoordinateArray(mint::Y_COORDINATE);
-  const double* z = mesh->getCoordinateArray(mint::Z_COORDINATE);
+/// Returns the number of nonzero entries in \a flags
+axom::IndexType countFlags(const axom::IndexType* flags, axom::IndexType n)
+{
+#ifdef AXOM_USE_RAJA
+  using ReducePolicy =
+    typename axom::execution_space<HostExecSpace>::reduce_policy;
+  RAJA::ReduceSum<ReducePolicy, axom::IndexType> count(0);
+  axom::for_all<HostExecSpace>(n, [=](axom::IndexType i) {
+    count += (flags[i] != 0) ? 1 : 0;
+  });
+  return count.get();
+#else
+  return std::count_if(flags, flags + n, [](axom::IndexType f) {
+    return f != 0;
+  });
+#endif
+}
 
-  const axom::IndexType numNodes = mesh->getNumberOfNodes();
-  for(axom::IndexType i = 0; i < numNodes; ++i)
+/// Sorts \a keys in ascending order and permutes \a values along with them
+void sortPairs(std::int64_t* keys, axom::IndexType* values, axom::IndexType n)
+{
+#ifdef AXOM_USE_RAJA
+  using LoopPolicy = typename axom::execution_space<HostExecSpace>::loop_policy;
+  RAJA::sort_pairs<LoopPolicy>(RAJA::make_span(keys, n),
+                               RAJA::make_span(values, n));
+#else
+  std::vector<std::pair<std::int64_t, axom::IndexType>> pairs(n);
+  for(axom::IndexType i = 0; i < n; ++i)
   {
-    pt[0] = x[i];
-    pt[1] = y[i];
-    pt[2] = z[i];
-
-    meshBB.addPoint(pt);
-  }  // END for all nodes
-
-  if(numNodes > 0)
+    pairs[i] = std::make_pair(keys[i], values[i]);
+  }
+  std::sort(pairs.begin(), pairs.end());
+  for(axom::IndexType i = 0; i < n; ++i)
   {
-    SLIC_ASSERT(meshBB.isValid());
+    keys[i] = pairs[i].first;
+    values[i] = pairs[i].second;
   }
-
-  return meshBB;
+#endif
 }
 
-inline bool areTriangleIndicesDistinct(axom::IndexType* indices)
-{
-  SLIC_ASSERT(indices != nullptr);
-
-  return indices[0] != indices[1] && indices[1] != indices[2] &&
-    indices[2] != indices[0];
-}
+}  // namespace
 
 /* Find and report self-intersections and degenerate triangles
  * in a triangle surface mesh using a Uniform Grid. */
@@ -53,7 +76,8 @@ void findTriMeshIntersections(detail::UMesh* surface_mesh,
                               std::vector<std::pair<int, int>>& intersections,
                               std::vector<int>& degenerateIndices,
                               int spatialIndexResolution,
-                              double intersectionThreshold)
+                              double intersectionThreshold,
+                              bool useExactPredicates)
 {
   detail::Triangle3 t1 {};
   detail::Triangle3 t2 {};
@@ -132,7 +156,11 @@ void findTriMeshIntersections(detail::UMesh* surface_mesh,
     while(nit != nend)
     {
       t2 = detail::getMeshTriangle(*nit, surface_mesh);
-      if(primal::intersect(t1, t2, false, intersectionThreshold))
+      if(primal::intersect(t1,
+                           t2,
+                           false,
+                           intersectionThreshold,
+                           useExactPredicates))
       {
         intersections.push_back(std::make_pair(*idx, *nit));
       }
@@ -141,120 +169,105 @@ void findTriMeshIntersections(detail::UMesh* surface_mesh,
   }
 }
 
-/* Check a surface mesh for holes using its face relation. */
-WatertightStatus isSurfaceMeshWatertight(detail::UMesh* surface_mesh)
+/* Check a surface mesh for holes by matching the edges of its triangles. */
+WatertightStatus isSurfaceMeshWatertight(detail::UMesh* surface_mesh,
+                                         bool computeFaceRelation)
 {
   // Make sure the mesh is reasonable
   SLIC_ASSERT_MSG(surface_mesh != nullptr,
                   "surface_mesh must be a valid pointer to a triangle mesh");
-
-  // Calculate the face relations---this can take awhile
-  bool success = surface_mesh->initializeFaceConnectivity();
-
-  if(!success)
-  {
-    return WatertightStatus::CHECK_FAILED;
-  }
-
-  WatertightStatus retval = WatertightStatus::WATERTIGHT;
+  SLIC_ASSERT_MSG(surface_mesh->getCellType() == mint::TRIANGLE,
+                  "surface_mesh must be a triangle mesh");
 
   constexpr int ON_BOUNDARY = 1;
   constexpr int INTERNAL = 0;
+  constexpr int NUM_TRI_VERTS = 3;
 
-  // Create fields to store boundary
-  int* bndry_face =
-    surface_mesh->createField<int>("bndry_face", mint::FACE_CENTERED);
-  int* boundary = surface_mesh->createField<int>("boundary", mint::CELL_CENTERED);
-
-  // Mark boundary faces
-  const IndexType numFaces = surface_mesh->getNumberOfFaces();
-  for(IndexType iface = 0; iface < numFaces; ++iface)
-  {
-    IndexType c1, c2;
-    surface_mesh->getFaceCellIDs(iface, c1, c2);
-    SLIC_ASSERT(c1 != static_cast<IndexType>(mint::UNDEFINED_CELL));
-
-    if(c2 == static_cast<IndexType>(mint::UNDEFINED_CELL))
-    {
-      bndry_face[iface] = ON_BOUNDARY;
-      retval = WatertightStatus::NOT_WATERTIGHT;
-    }
-    else
-    {
-      bndry_face[iface] = INTERNAL;
-    }
-  }  // END for all faces
-
-  if(retval == WatertightStatus::WATERTIGHT)
+  const IndexType numCells = surface_mesh->getNumberOfCells();
+  const IndexType numNodes = surface_mesh->getNumberOfNodes();
+  const IndexType numEdges = NUM_TRI_VERTS * numCells;
+  const IndexType* conn = surface_mesh->getCellNodesArray();
+
+  // Key each edge of each triangle on its sorted pair of vertices.
+  // Edge e of the mesh is edge (e % 3) of triangle (e / 3).
+  axom::Array<std::int64_t> keysArray(numEdges, numEdges);
+  IndexArray edgesArray(numEdges, numEdges);
+  std::int64_t* keys = keysArray.data();
+  IndexType* edges = edgesArray.data();
+  axom::for_all<HostExecSpace>(numEdges, [=](IndexType e) {
+    const IndexType tri = e / NUM_TRI_VERTS;
+    const IndexType a = conn[e];
+    const IndexType b = conn[NUM_TRI_VERTS * tri + (e + 1) % NUM_TRI_VERTS];
+    keys[e] = static_cast<std::int64_t>(std::min(a, b)) * numNodes +
+      std::max(a, b);
+    edges[e] = e;
+  });
+
+  // Sort the edges on their keys, so the copies of an edge are adjacent
+  sortPairs(keys, edges, numEdges);
+
+  // Reduce over the runs of equal keys. An edge with one incident triangle is
+  // on the boundary.  The check fails on an edge with more than two incident
+  // triangles (non-manifold) or with a repeated vertex (degenerate triangle).
+  IndexArray invalidEdgeArray(numEdges, numEdges);
+  IndexArray bndryEdgeArray(numEdges, numEdges);
+  IndexType* invalidEdge = invalidEdgeArray.data();
+  IndexType* bndryEdge = bndryEdgeArray.data();
+  axom::for_all<HostExecSpace>(numEdges, [=](IndexType k) {
+    const bool sameAsPrev = (k > 0) && (keys[k - 1] == keys[k]);
+    const bool sameAsNext = (k + 1 < numEdges) && (keys[k + 1] == keys[k]);
+    const bool nonManifold = (k + 2 < numEdges) && (keys[k + 2] == keys[k]);
+    const bool degenerate = (keys[k] / numNodes) == (keys[k] % numNodes);
+    invalidEdge[k] = (nonManifold || degenerate) ? 1 : 0;
+    bndryEdge[edges[k]] = (!sameAsPrev && !sameAsNext) ? ON_BOUNDARY : INTERNAL;
+  });
+
+  if(countFlags(invalidEdge, numEdges) > 0)
   {
-    /* short-circuit */
-    const IndexType numCells = surface_mesh->getNumberOfCells();
-    std::memset(boundary, INTERNAL, sizeof(int) * numCells);
-    return retval;
+    return WatertightStatus::CHECK_FAILED;
   }
 
-  // Mark boundary cells
-  const IndexType numCells = surface_mesh->getNumberOfCells();
-  for(IndexType icell = 0; icell < numCells; ++icell)
+  // Optionally calculate the face relations---this can take awhile---and
+  // mark the boundary faces
+  if(computeFaceRelation)
   {
-    // NOTE: this check currently assumes triangles
-    SLIC_ASSERT(surface_mesh->getNumberOfCellFaces(icell) == 3);
-    const IndexType* faceids = surface_mesh->getCellFaceIDs(icell);
-
-    if((bndry_face[faceids[0]] == ON_BOUNDARY) ||
-       (bndry_face[faceids[1]] == ON_BOUNDARY) ||
-       (bndry_face[faceids[2]] == ON_BOUNDARY))
+    if(!surface_mesh->initializeFaceConnectivity())
     {
-      boundary[icell] = ON_BOUNDARY;
+      return WatertightStatus::CHECK_FAILED;
     }
-    else
+
+    int* bndry_face =
+      surface_mesh->createField<int>("bndry_face", mint::FACE_CENTERED);
+    const IndexType numFaces = surface_mesh->getNumberOfFaces();
+    for(IndexType iface = 0; iface < numFaces; ++iface)
     {
-      boundary[icell] = INTERNAL;
+      IndexType c1, c2;
+      surface_mesh->getFaceCellIDs(iface, c1, c2);
+      SLIC_ASSERT(c1 != static_cast<IndexType>(mint::UNDEFINED_CELL));
+      bndry_face[iface] = (c2 == static_cast<IndexType>(mint::UNDEFINED_CELL))
+        ? ON_BOUNDARY
+        : INTERNAL;
     }
+  }
 
-  }  // END for all cells
-
-  return retval;
+  // Mark the cells with a boundary edge
+  int* boundary = surface_mesh->createField<int>("boundary", mint::CELL_CENTERED);
+  axom::for_all<HostExecSpace>(numCells, [=](IndexType icell) {
+    const IndexType* cellEdges = bndryEdge + NUM_TRI_VERTS * icell;
+    boundary[icell] =
+      (cellEdges[0] == ON_BOUNDARY || cellEdges[1] == ON_BOUNDARY ||
+       cellEdges[2] == ON_BOUNDARY)
+      ? ON_BOUNDARY
+      : INTERNAL;
+  });
+
+  return countFlags(bndryEdge, numEdges) > 0 ? WatertightStatus::NOT_WATERTIGHT
+                                             : WatertightStatus::WATERTIGHT;
 }
 
 /* Weld vertices of a triangle mesh that are closer than \a eps  */
 void weldTriMeshVertices(detail::UMesh** surface_mesh, double eps)
 {
-  // Note: Use 64-bit index to accomodate small values of epsilon
-  using IdxType = std::int64_t;
-  using Lattice3 = spin::RectangularLattice<3, double, IdxType>;
-  using GridCell = Lattice3::GridCell;
-
-  // Define a lambda for hashing points
-  // implementation of hash combiner is from boost's hash_combine()
-  auto point_hash = [](const GridCell& pt) {
-    auto seed = std::hash<IdxType> {}(pt[0]);
-    for(int i = 1; i < GridCell::DIMENSION; ++i)
-    {
-      seed ^=
-        std::hash<IdxType> {}(pt[i]) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-    return seed;
-  };
-
-  using GridCellToIndexMap =
-    std::unordered_map<GridCell, IdxType, decltype(point_hash)>;
-
-  /// Implementation notes:
-  ///
-  /// This function welds vertices in the triangle mesh by
-  /// quantizing them to an integer lattice with spacing \a eps.
-  ///
-  /// To avoid searching neighbor elements on the grid, we run the
-  /// algorithm twice. Once on the original lattice, and once on a
-  /// lattice that is shifted by half the grid spacing.
-  ///
-  /// Due to running this algorithm twice, it is possible in extreme cases
-  /// for vertices that are at distances up to (1.5 * eps)
-  /// (under the max norm) to be identified in this process.
-  /// This can correspond to distances of at most 1.5 * eps * \sqrt(2)
-  /// in the Euclidean norm.
-
   SLIC_ASSERT_MSG(eps > 0.,
                   "Epsilon must be greater than 0. Passed in value was " << eps);
   SLIC_ASSERT_MSG(
@@ -264,85 +277,52 @@ void weldTriMeshVertices(detail::UMesh** surface_mesh, double eps)
   int const DIM = 3;
   detail::UMesh* oldMesh = *surface_mesh;
 
-  detail::SpatialBoundingBox meshBB = compute_bounds(oldMesh).expand(eps);
-
-  // Run the algorithm twice -- on the original grid and a translated grid
-  std::vector<double> offsets;
-  offsets.push_back(0);
-  offsets.push_back(eps / 2.);
-  for(std::vector<double>::const_iterator it = offsets.begin();
-      it != offsets.end();
-      ++it)
-  {
-    // We will build up a new triangle mesh with the welded indices
-    detail::UMesh* newMesh = new detail::UMesh(DIM, mint::TRIANGLE);
-
-    // Set up the lattice for quantizing points to an integer lattice
-    detail::Point3 origin(meshBB.getMin().array() - detail::Point3(*it).array());
-    Lattice3 lattice(origin, Lattice3::SpaceVector(detail::Point3(eps)));
-
-    // First, find unique indices for the welded vertices
-    const int numVerts = oldMesh->getNumberOfNodes();
-    int uniqueVertCount = 0;
-
-    // A map from GridCells to the new vertex indices
-    GridCellToIndexMap vertexIndexMap(numVerts, point_hash);
-
-    std::vector<int> vertex_remap;  // stores the new vertex indices
-    vertex_remap.resize(numVerts);  // for each old vertex
-
-    detail::Point3 vert;
-    const double* x = oldMesh->getCoordinateArray(mint::X_COORDINATE);
-    const double* y = oldMesh->getCoordinateArray(mint::Y_COORDINATE);
-    const double* z = oldMesh->getCoordinateArray(mint::Z_COORDINATE);
-
-    for(int i = 0; i < numVerts; ++i)
-    {
-      // get the vertex from the mesh
-      vert[0] = x[i];
-      vert[1] = y[i];
-      vert[2] = z[i];
-
-      // find the new vertex index; if not present, insert vertex into new mesh
-      auto res = vertexIndexMap.insert(
-        std::make_pair(lattice.gridCell(vert), uniqueVertCount));
-      if(res.second == true)
-      {
-        uniqueVertCount++;
-        newMesh->appendNodes(vert.data());
-      }
-      vertex_remap[i] = static_cast<int>(res.first->second);
-    }
-
-    // Next, add triangles into the new mesh using the unique vertex indices
-    const int NUM_TRI_VERTS = 3;
-    axom::IndexType triInds[NUM_TRI_VERTS];
-    const axom::IndexType numTris = oldMesh->getNumberOfCells();
-    for(axom::IndexType i = 0; i < numTris; ++i)
-    {
-      memcpy(triInds,
-             oldMesh->getCellNodeIDs(i),
-             NUM_TRI_VERTS * sizeof(axom::IndexType));
-
-      for(int d = 0; d < NUM_TRI_VERTS; ++d)
-      {
-        triInds[d] = vertex_remap[triInds[d]];
-      }
-
-      // Degeneracy check -- vertices need to be distinct
-      if(areTriangleIndicesDistinct(triInds))
-      {
-        newMesh->appendCell(triInds, mint::TRIANGLE);
-      }
-    }
-
-    // Finally, delete old mesh and swap pointers
-    delete oldMesh;
-    oldMesh = newMesh;
-  }
-
-  // Update the original mesh pointer to the new mesh
-  *surface_mesh = oldMesh;
+  const double* x = oldMesh->getCoordinateArray(mint::X_COORDINATE);
+  const double* y = oldMesh->getCoordinateArray(mint::Y_COORDINATE);
+  const double* z = oldMesh->getCoordinateArray(mint::Z_COORDINATE);
+
+  // Identify the vertices to weld by sorting them on their lattice cells,
+  // then reindex the triangles and drop the ones that became degenerate
+  IndexArray vertexMap, weldedVerts, weldedConn, sourceTris;
+  detail::weldVertices(x,
+                       y,
+                       z,
+                       1,
+                       oldMesh->getNumberOfNodes(),
+                       eps,
+                       vertexMap,
+                       weldedVerts);
+  detail::remapTriangles(oldMesh->getCellNodesArray(),
+                         oldMesh->getNumberOfCells(),
+                         vertexMap,
+                         weldedConn,
+                         sourceTris);
+
+  // Build the welded mesh
+  const IndexType numWeldedVerts = weldedVerts.size();
+  const IndexType numWeldedTris = sourceTris.size();
+  detail::UMesh* newMesh = new detail::UMesh(DIM, mint::TRIANGLE);
+  newMesh->resize(numWeldedVerts, numWeldedTris);
+
+  double* newX = newMesh->getCoordinateArray(mint::X_COORDINATE);
+  double* newY = newMesh->getCoordinateArray(mint::Y_COORDINATE);
+  double* newZ = newMesh->getCoordinateArray(mint::Z_COORDINATE);
+  const IndexType* welded = weldedVerts.data();
+  axom::for_all<HostExecSpace>(numWeldedVerts, [=](IndexType i) {
+    newX[i] = x[welded[i]];
+    newY[i] = y[welded[i]];
+    newZ[i] = z[welded[i]];
+  });
+
+  IndexType* newConn = newMesh->getCellNodesArray();
+  const IndexType* conn = weldedConn.data();
+  axom::for_all<HostExecSpace>(3 * numWeldedTris, [=](IndexType i) {
+    newConn[i] = conn[i];
+  });
+
+  // Finally, delete old mesh and update the original mesh pointer
+  delete oldMesh;
+  *surface_mesh = newMesh;
 }
 
 }  // end namespace quest
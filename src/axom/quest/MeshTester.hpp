@@ -55,6 +55,9 @@ enum class WatertightStatus : signed char
  * \param [out] degenerateIndices indices of degenerate mesh triangles
  * \param [in] intersectionThreshold Tolerance threshold for triangle 
  * intersection tests (default: 1E-8)
+ * \param [in] useExactPredicates Use the filtered exact predicates of primal
+ * instead of \a intersectionThreshold for the triangle intersection tests
+ * (default: false)
  * After running this function over a surface mesh, intersection will be filled
  * with pairs of indices of intersecting triangles and degenerateIndices will
  * be filled with the indices of the degenerate triangles in the mesh.
@@ -68,7 +71,8 @@ void findTriMeshIntersectionsBVH(
   mint::UnstructuredMesh<mint::SINGLE_SHAPE>* surface_mesh,
   std::vector<std::pair<int, int>>& intersections,
   std::vector<int>& degenerateIndices,
-  double intersectionThreshold = 1E-8)
+  double intersectionThreshold = 1E-8,
+  bool useExactPredicates = false)
 {
   AXOM_PERF_MARK_FUNCTION("findTriMeshIntersectionsBVH");
 
@@ -78,7 +82,7 @@ void findTriMeshIntersectionsBVH(
 
   constexpr detail::AccelType UseBVH = detail::AccelType::BVH;
   using CandidateFinder = detail::CandidateFinder<UseBVH, ExecSpace, FloatType>;
-  CandidateFinder impl(surface_mesh, intersectionThreshold);
+  CandidateFinder impl(surface_mesh, intersectionThreshold, useExactPredicates);
   impl.initialize();
   axom::Array<IndexType> intersectFirst, intersectSecond, degenerate;
   impl.findTriMeshIntersections(intersectFirst, intersectSecond, degenerate);
@@ -102,6 +106,9 @@ void findTriMeshIntersectionsBVH(
  * structure (default: 0)
  * \param [in] intersectionThreshold Tolerance threshold for triangle
  * intersection tests (default: 1E-8)
+ * \param [in] useExactPredicates Use the filtered exact predicates of primal
+ * instead of \a intersectionThreshold for the triangle intersection tests
+ * (default: false)
  * After running this function over a surface mesh, intersection will be filled
  * with pairs of indices of intersecting triangles and degenerateIndices will
  * be filled with the indices of the degenerate triangles in the mesh.
@@ -120,7 +127,8 @@ void findTriMeshIntersectionsImplicitGrid(
   std::vector<std::pair<int, int>>& intersections,
   std::vector<int>& degenerateIndices,
   int spatialIndexResolution = 0,
-  double intersectionThreshold = 1E-8)
+  double intersectionThreshold = 1E-8,
+  bool useExactPredicates = false)
 {
   AXOM_PERF_MARK_FUNCTION("findTriMeshIntersectionsImplicitGrid");
 
@@ -131,7 +139,7 @@ void findTriMeshIntersectionsImplicitGrid(
   constexpr detail::AccelType UseImplicit = detail::AccelType::ImplicitGrid;
   using CandidateFinder =
     detail::CandidateFinder<UseImplicit, ExecSpace, FloatType>;
-  CandidateFinder impl(surface_mesh, intersectionThreshold);
+  CandidateFinder impl(surface_mesh, intersectionThreshold, useExactPredicates);
   impl.initialize(spatialIndexResolution);
   axom::Array<IndexType> intersectFirst, intersectSecond, degenerate;
   impl.findTriMeshIntersections(intersectFirst, intersectSecond, degenerate);
@@ -155,6 +163,9 @@ void findTriMeshIntersectionsImplicitGrid(
  * structure (default: 0)
  * \param [in] intersectionThreshold Tolerance threshold for triangle
  * intersection tests (default: 1E-8)
+ * \param [in] useExactPredicates Use the filtered exact predicates of primal
+ * instead of \a intersectionThreshold for the triangle intersection tests
+ * (default: false)
  * After running this function over a surface mesh, intersection will be filled
  * with pairs of indices of intersecting triangles and degenerateIndices will
  * be filled with the indices of the degenerate triangles in the mesh.
@@ -173,7 +184,8 @@ void findTriMeshIntersectionsUniformGrid(
   std::vector<std::pair<int, int>>& intersections,
   std::vector<int>& degenerateIndices,
   int spatialIndexResolution = 0,
-  double intersectionThreshold = 1E-8)
+  double intersectionThreshold = 1E-8,
+  bool useExactPredicates = false)
 {
   AXOM_PERF_MARK_FUNCTION("findTriMeshIntersectionsUniformGrid");
 
@@ -184,7 +196,7 @@ void findTriMeshIntersectionsUniformGrid(
   constexpr detail::AccelType UseUniform = detail::AccelType::UniformGrid;
   using CandidateFinder =
     detail::CandidateFinder<UseUniform, ExecSpace, FloatType>;
-  CandidateFinder impl(surface_mesh, intersectionThreshold);
+  CandidateFinder impl(surface_mesh, intersectionThreshold, useExactPredicates);
   impl.initialize(spatialIndexResolution);
   axom::Array<IndexType> intersectFirst, intersectSecond, degenerate;
   impl.findTriMeshIntersections(intersectFirst, intersectSecond, degenerate);
@@ -208,6 +220,9 @@ void findTriMeshIntersectionsUniformGrid(
  * structure (default: 0)
  * \param [in] intersectionThreshold Tolerance threshold for triangle 
  * intersection tests (default: 1E-8)
+ * \param [in] useExactPredicates Use the filtered exact predicates of primal
+ * instead of \a intersectionThreshold for the triangle intersection tests
+ * (default: false)
  *
  * After running this function over a surface mesh, intersection will be filled
  * with pairs of indices of intersecting triangles and degenerateIndices will
@@ -225,26 +240,38 @@ void findTriMeshIntersections(mint::UnstructuredMesh<mint::SINGLE_SHAPE>* surfac
                               std::vector<std::pair<int, int>>& intersections,
                               std::vector<int>& degenerateIndices,
                               int spatialIndexResolution = 0,
-                              double intersectionThreshold = 1E-8);
+                              double intersectionThreshold = 1E-8,
+                              bool useExactPredicates = false);
 
 /*!
- * \brief Check a surface mesh for holes using its face relation.
+ * \brief Check a triangle surface mesh for holes by matching its edges.
  *
- * \param [in] surface_mesh A surface mesh in three dimensions
+ * \param [in] surface_mesh A triangle surface mesh in three dimensions
+ * \param [in] computeFaceRelation If true, also compute the mesh's
+ *  cell-face and face-vertex relations and mark its boundary faces
  *
  * \returns status If the mesh is watertight, is not watertight, or
- *    if an error occurred (possibly due to non-manifold mesh).
+ *    if an error occurred (an edge shared by more than two triangles,
+ *    or a degenerate triangle, i.e. one that repeats a vertex).
  *
  * \note This method marks the cells on the boundary by creating a new
  *  cell-centered field variable, called "boundary", on the given input mesh.
+ *  The field is not created when the check fails.
  *
- * \note This function computes the mesh's cell-face and face-vertex relations.
- * For large meshes, this can take a long time.  The relations are used to
- * check for holes, and remain cached with the mesh after this function
- * finishes.
+ * \note The edges are keyed on their vertex pairs and sorted in parallel
+ * (with OpenMP, when available), so that each run of equal keys gives the
+ * triangles incident on an edge.
+ *
+ * \note When \a computeFaceRelation is true and the check does not fail,
+ * the face relations are computed and remain cached with the mesh after
+ * this function finishes, and the boundary faces are marked in a new
+ * face-centered field called "bndry_face".  The face relations are computed
+ * serially, which can take a long time for large meshes, so they are only
+ * computed on request.
  */
 WatertightStatus isSurfaceMeshWatertight(
-  mint::UnstructuredMesh<mint::SINGLE_SHAPE>* surface_mesh);
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE>* surface_mesh,
+  bool computeFaceRelation = false);
 
 /*!
  * \brief Mesh repair function to weld vertices that are closer than \a eps
@@ -35,6 +35,7 @@
 
 #include "axom/fmt.hpp"
 
+#include <cmath>
 #include <functional>
 
 namespace axom
@@ -89,6 +90,25 @@ public:
 
   mint::Mesh* getSurfaceMesh() const { return m_surfaceMesh; }
 
+  /**
+   * \brief Sets whether sampleInOutField() samples adaptively
+   *
+   * Adaptive sampling first queries a coarse subset of the sample points of
+   * each element. When all the coarse samples agree, the other points get
+   * the same value without being queried. Otherwise, all the points of the
+   * element are queried.
+   */
+  void setAdaptiveSampling(bool adaptive) { m_adaptive = adaptive; }
+
+  /// Returns the number of inout queries of the last call to sampleInOutField()
+  axom::IndexType getNumQueries() const { return m_numQueries; }
+
+  /// Returns the number of sample points of the last call to sampleInOutField()
+  axom::IndexType getNumSamples() const { return m_numSamples; }
+
+  /// Returns the time in seconds of the last call to sampleInOutField()
+  double getSamplingTime() const { return m_samplingTime; }
+
   /// Computes the bounding box of the surface mesh
   void computeBounds()
   {
@@ -174,32 +194,70 @@ public:
     mfem::DenseMatrix m;
     mfem::Vector res;
 
+    // Queries the inout field at point p of the current element
+    auto sample = [&](int p) -> double {
+      const bool in = projector
+        ? m_octree->within(projector(FromPoint(m.GetColumn(p), dim)))
+        : m_octree->within(ToPoint(m.GetColumn(p), dim));
+      return in ? 1. : 0.;
+    };
+
+    // Adaptive sampling starts from the points closest to the vertices and
+    // the center of the element
+    std::vector<int> coarse;
+    std::vector<bool> isCoarse(nq, false);
+    if(m_adaptive && NE > 0)
+    {
+      coarse = shaping::coarseSampleIndices(sp->GetIntRule(0),
+                                            mesh->GetElementBaseGeometry(0));
+      for(int p : coarse)
+      {
+        isCoarse[p] = true;
+      }
+    }
+
+    m_numQueries = 0;
+    m_numSamples = static_cast<axom::IndexType>(NE) * nq;
+    m_samplingTime = 0.;
+
     axom::utilities::Timer timer(true);
     for(int i = 0; i < NE; ++i)
     {
       pos_coef->GetValues(i, m);
       inout->GetValues(i, res);
 
-      if(projector)
+      if(!coarse.empty())
       {
-        for(int p = 0; p < nq; ++p)
+        bool agree = true;
+        for(int p : coarse)
         {
-          const ToPoint pt = projector(FromPoint(m.GetColumn(p), dim));
-          const bool in = m_octree->within(pt);
-          res(p) = in ? 1. : 0.;
+          res(p) = sample(p);
+          agree = agree && res(p) == res(coarse[0]);
+        }
+        m_numQueries += coarse.size();
+
+        if(agree)
+        {
+          for(int p = 0; p < nq; ++p)
+          {
+            res(p) = res(coarse[0]);
+          }
+          continue;
         }
       }
-      else
+
+      // Refine to all the points of the element
+      for(int p = 0; p < nq; ++p)
       {
-        for(int p = 0; p < nq; ++p)
+        if(!isCoarse[p])
         {
-          const ToPoint pt(m.GetColumn(p), dim);
-          const bool in = m_octree->within(pt);
-          res(p) = in ? 1. : 0.;
+          res(p) = sample(p);
+          ++m_numQueries;
         }
       }
     }
     timer.stop();
+    m_samplingTime = timer.elapsedTimeInSec();
 
     SLIC_INFO(
       axom::fmt::format(axom::utilities::locale(),
@@ -207,7 +265,16 @@ public:
                         "{:L} queries per second)",
                         inoutName,
                         timer.elapsed(),
-                        static_cast<int>((NE * nq) / timer.elapsed())));
+                        static_cast<int>(m_numQueries / timer.elapsed())));
+
+    if(m_adaptive)
+    {
+      SLIC_INFO(axom::fmt::format(
+        axom::utilities::locale(),
+        "\t Adaptive sampling queried {:L} of {:L} sample points",
+        m_numQueries,
+        m_numSamples));
+    }
   }
 
   /** 
@@ -305,6 +372,11 @@ private:
   GeometricBoundingBox m_bbox;
   mint::Mesh* m_surfaceMesh {nullptr};
   InOutOctreeType* m_octree {nullptr};
+
+  bool m_adaptive {false};
+  axom::IndexType m_numQueries {0};
+  axom::IndexType m_numSamples {0};
+  double m_samplingTime {0.};
 };
 
 }  // end namespace shaping
@@ -338,6 +410,36 @@ public:
     m_volfracOrder = volfracOrder;
   }
 
+  /**
+   * \brief Sets a target error for the sampled volume fractions, which
+   * enables adaptive sampling at quadrature points
+   *
+   * \param [in] errorTarget The target error, relative to the element size.
+   * A non-positive value disables adaptive sampling.
+   *
+   * The target replaces the quadrature order: elements are sampled with
+   * the smallest number of points per dimension \a n such that
+   * 1/n <= \a errorTarget. Each element is first sampled at a coarse subset
+   * of its points, and only elements whose coarse samples disagree are
+   * sampled at all of them.
+   *
+   * \note Features smaller than the spacing of the coarse samples can be
+   * missed in elements whose coarse samples agree
+   */
+  void setSamplingErrorTarget(double errorTarget)
+  {
+    m_samplingErrorTarget = errorTarget;
+  }
+
+  /// Returns the number of inout queries over all the shapes
+  axom::IndexType getNumSampleQueries() const { return m_numSampleQueries; }
+
+  /// Returns the number of sample points over all the shapes
+  axom::IndexType getNumSamplePoints() const { return m_numSamplePoints; }
+
+  /// Returns the time in seconds spent querying the samples of all the shapes
+  double getSamplingTime() const { return m_samplingTime; }
+
   /// Registers a function to project from 2D input points to 2D query points
   void setPointProjector(shaping::PointProjector<2, 2> projector)
   {
@@ -375,6 +477,16 @@ private:
     return has2D ? klee::Dimensions::Two : klee::Dimensions::Three;
   }
 
+  bool isAdaptive() const { return m_samplingErrorTarget > 0.; }
+
+  /// Returns the number of samples per dimension in each element
+  int getSampleResolution() const
+  {
+    return isAdaptive()
+      ? static_cast<int>(std::ceil(1. / m_samplingErrorTarget))
+      : m_quadratureOrder;
+  }
+
 public:
   //@{
   //!  @name Functions related to the stages for a given shape
@@ -401,6 +513,7 @@ public:
       m_inoutSampler2D = new shaping::InOutSampler<2>(shapeName, m_surfaceMesh);
       m_inoutSampler2D->computeBounds();
       m_inoutSampler2D->initSpatialIndex(this->m_vertexWeldThreshold);
+      m_inoutSampler2D->setAdaptiveSampling(isAdaptive());
       m_surfaceMesh = m_inoutSampler2D->getSurfaceMesh();
       break;
 
@@ -408,6 +521,7 @@ public:
       m_inoutSampler3D = new shaping::InOutSampler<3>(shapeName, m_surfaceMesh);
       m_inoutSampler3D->computeBounds();
       m_inoutSampler3D->initSpatialIndex(this->m_vertexWeldThreshold);
+      m_inoutSampler3D->setAdaptiveSampling(isAdaptive());
       m_surfaceMesh = m_inoutSampler3D->getSurfaceMesh();
       break;
 
@@ -455,9 +569,15 @@ public:
     {
     case klee::Dimensions::Two:
       runShapeQueryImpl(m_inoutSampler2D);
+      m_numSampleQueries += m_inoutSampler2D->getNumQueries();
+      m_numSamplePoints += m_inoutSampler2D->getNumSamples();
+      m_samplingTime += m_inoutSampler2D->getSamplingTime();
       break;
     case klee::Dimensions::Three:
       runShapeQueryImpl(m_inoutSampler3D);
+      m_numSampleQueries += m_inoutSampler3D->getNumQueries();
+      m_numSamplePoints += m_inoutSampler3D->getNumSamples();
+      m_samplingTime += m_inoutSampler3D->getSamplingTime();
       break;
     }
   }
@@ -592,7 +712,7 @@ public:
     {
       shaping::generatePositionsQFunction(mesh,
                                           m_inoutShapeQFuncs,
-                                          m_quadratureOrder);
+                                          getSampleResolution());
     }
     auto* positionsQSpace = m_inoutShapeQFuncs.Get("positions")->GetSpace();
 
@@ -698,6 +818,7 @@ private:
   {
     // Sample the InOut field at the mesh quadrature points
     const int meshDim = m_dc->GetMesh()->Dimension();
+    const int sampleRes = getSampleResolution();
     switch(m_vfSampling)
     {
     case shaping::VolFracSampling::SAMPLE_AT_QPTS:
@@ -709,22 +830,22 @@ private:
           m_projector22
             ? shaper->template sampleInOutField<2>(m_dc,
                                                    m_inoutShapeQFuncs,
-                                                   m_quadratureOrder,
+                                                   sampleRes,
                                                    m_projector22)
             : shaper->template sampleInOutField<2>(m_dc,
                                                    m_inoutShapeQFuncs,
-                                                   m_quadratureOrder);
+                                                   sampleRes);
         }
         else if(meshDim == 3)
         {
           m_projector32
             ? shaper->template sampleInOutField<3>(m_dc,
                                                    m_inoutShapeQFuncs,
-                                                   m_quadratureOrder,
+                                                   sampleRes,
                                                    m_projector32)
             : shaper->template sampleInOutField<3>(m_dc,
                                                    m_inoutShapeQFuncs,
-                                                   m_quadratureOrder);
+                                                   sampleRes);
         }
         break;
       case 3:
@@ -733,22 +854,22 @@ private:
           m_projector23
             ? shaper->template sampleInOutField<2>(m_dc,
                                                    m_inoutShapeQFuncs,
-                                                   m_quadratureOrder,
+                                                   sampleRes,
                                                    m_projector23)
             : shaper->template sampleInOutField<2>(m_dc,
                                                    m_inoutShapeQFuncs,
-                                                   m_quadratureOrder);
+                                                   sampleRes);
         }
         else if(meshDim == 3)
         {
           m_projector33
             ? shaper->template sampleInOutField<3>(m_dc,
                                                    m_inoutShapeQFuncs,
-                                                   m_quadratureOrder,
+                                                   sampleRes,
                                                    m_projector33)
             : shaper->template sampleInOutField<3>(m_dc,
                                                    m_inoutShapeQFuncs,
-                                                   m_quadratureOrder);
+                                                   sampleRes);
         }
         break;
       }
@@ -779,6 +900,11 @@ private:
   shaping::VolFracSampling m_vfSampling {shaping::VolFracSampling::SAMPLE_AT_QPTS};
   int m_quadratureOrder {5};
   int m_volfracOrder {2};
+
+  double m_samplingErrorTarget {0.};
+  axom::IndexType m_numSampleQueries {0};
+  axom::IndexType m_numSamplePoints {0};
+  double m_samplingTime {0.};
 };
 
 }  // namespace quest
@@ -249,106 +249,19 @@ public:
   using CoordType = typename PointType::CoordType;
 
 private:
-  using MortonIndexType = std::uint64_t;
+#ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+  using HostExecSpace = axom::OMP_EXEC;
+#else
+  using HostExecSpace = axom::SEQ_EXEC;
+#endif
+
+  /// Number of input points supporting each query point
+  static constexpr int WEIGHTS_PER_POINT = NDIMS + 1;
 
   using VertexSet = typename DelaunayTriangulation::IAMeshType::VertexSet;
   using VertexIndirectionSet =
     slam::ArrayIndirectionSet<typename VertexSet::PositionType, axom::IndexType>;
 
-private:
-  /**
-   *  \brief Helper struct for sorting input points in the Biased Randomized Incremental Order (BRIO)
-   *
-   *  BRIO helps improve worst-case performance on poorly ordered point sets.
-   *  It was introduced in the following paper:
-   *    N. Amenta, S. Choi, and G. Rote. "Incremental constructions con BRIO."
-   *    Proceedings of the 19th annual symposium on Computational geometry, 2003.
-   */
-  struct BrioComparator
-  {
-    axom::IndexType m_index;
-    int m_level;
-    MortonIndexType m_morton;
-
-    BrioComparator(IndexType index, int level, MortonIndexType morton)
-      : m_index(index)
-      , m_level(level)
-      , m_morton(morton)
-    { }
-
-    friend bool operator<(const BrioComparator& lhs, const BrioComparator& rhs)
-    {
-      return (lhs.m_level == rhs.m_level) ? lhs.m_morton < rhs.m_morton
-                                          : lhs.m_level < rhs.m_level;
-    }
-  };
-
-  /**
-   * \brief Generates a permutation of [0, pts.size()) following BRIO 
-   * 
-   * \sa BrioComparator
-   */
-  template <typename PointArray>
-  axom::Array<axom::IndexType> computeInsertionOrder(const PointArray& pts,
-                                                     const BoundingBoxType& bb)
-  {
-    // This function will compute a permutation of pts following BRIO.
-    // Each point gets a level from the computeLevel() lambda
-    // and a quantized Morton index from a rectangular lattice over the bounding box
-
-    const int npts = pts.size();
-    const int nlevels =
-      axom::utilities::ceil(axom::utilities::log2<CoordType>(npts));
-
-    // Each point has a 50% chance of being at the max level; of the remaining points
-    // from the previous level, there's a 50% chance of being at the current level.
-    // Any remaining points are at level 0.
-    auto computeLevel = [nlevels]() {
-      for(int level = nlevels; level > 0; --level)
-      {
-        if(axom::utilities::random_real(0., 1.) <= 0.5)
-        {
-          return level;
-        }
-      }
-      return 0;
-    };
-
-    // We use a Morton index, quantized over the mesh bounding box to
-    // order the points on each level
-    using QuantizedCoordType = std::uint32_t;
-    using MortonizerType =
-      spin::Mortonizer<QuantizedCoordType, MortonIndexType, DIM>;
-
-    // Fit as many bits as possible per dimension into an int64, i.e. floor(63/DIM)
-    constexpr int shift_bits = (DIM == 2) ? 31 : 21;
-    primal::NumericArray<QuantizedCoordType, DIM> res(1 << shift_bits, DIM);
-    auto quantizer =
-      spin::rectangular_lattice_from_bounding_box<DIM, CoordType, QuantizedCoordType>(
-        bb,
-        res);
-
-    // Add points and sort following BRIO
-    axom::Array<BrioComparator> brio(0, npts);
-    for(int idx = 0; idx < npts; ++idx)
-    {
-      brio.emplace_back(BrioComparator(
-        idx,
-        computeLevel(),
-        MortonizerType::mortonize(quantizer.gridCell(pts[idx]))));
-    }
-    std::sort(brio.begin(), brio.end());
-
-    // extract and return the reordered points
-    axom::Array<axom::IndexType> reordered(0, npts);
-    for(int idx = 0; idx < npts; ++idx)
-    {
-      reordered.push_back(brio[idx].m_index);
-    }
-
-    return reordered;
-  }
-
 public:
   /**
    * \brief Builds a Delaunay triangulation over the point set from \a mesh_node
@@ -377,7 +290,8 @@ public:
 
     // Reorder the points according to the Biased Random Insertion Order (BRIO) algorithm
     // and store the mapping since we'll need to apply it during interpolation
-    m_brio_data = computeInsertionOrder(coords, m_bounding_box);
+    m_brio_data =
+      DelaunayTriangulation::computeInsertionOrder(coords, m_bounding_box);
     m_brio = VertexIndirectionSet(
       typename VertexIndirectionSet::SetBuilder().size(npts).data(&m_brio_data));
 
@@ -386,10 +300,7 @@ public:
     bb.scale(1.5);
 
     m_delaunay.initializeBoundary(bb);
-    for(int i = 0; i < npts; ++i)
-    {
-      m_delaunay.insertPoint(coords[m_brio[i]]);
-    }
+    m_delaunay.insertPoints(coords, m_brio_data.view());
 
     m_delaunay.removeBoundary();
   }
@@ -539,6 +450,127 @@ public:
     }
   }
 
+  /**
+   * \brief Precomputes a sparse interpolation operator from the input points
+   * to the points of \a query_mesh
+   *
+   * For each query point, stores the indices of the input points at the
+   * vertices of its containing simplex and their barycentric weights, so
+   * that fields sharing the same input and query points can be interpolated
+   * with \a interpolateFieldWithWeights() without relocating the points.
+   *
+   * \param [in] query_mesh Root node of mesh (in blueprint format) for the query points
+   * \param [in] coordset The name of the coords for query points in \a query_mesh
+   *
+   * \pre \a query_mesh must contain a nodal scalar field named \a cell_idx
+   * computed by \a locatePoints()
+   */
+  void computeInterpolationWeights(conduit::Node& query_mesh,
+                                   const std::string& coordset)
+  {
+    constexpr auto INVALID_INDEX = DelaunayTriangulation::INVALID_INDEX;
+
+    SLIC_ASSERT(::isValidBlueprint(query_mesh));
+
+    auto containing_cell = ::getField<axom::IndexType>(query_mesh, "cell_idx");
+
+    const auto valuesPath = fmt::format("coordsets/{}/values", coordset);
+    SLIC_ASSERT(query_mesh.has_path(valuesPath));
+    auto coords =
+      detail::InterleavedOrStridedPoints<CoordType, DIM>(query_mesh[valuesPath]);
+
+    const int npts = coords.size();
+    m_weight_indices.resize(npts * WEIGHTS_PER_POINT);
+    m_weights.resize(npts * WEIGHTS_PER_POINT);
+
+    auto indices = m_weight_indices.view();
+    auto weights = m_weights.view();
+    const auto& delaunay = m_delaunay;
+    const auto& brio = m_brio;
+    axom::for_all<HostExecSpace>(npts, [=, &delaunay, &brio](axom::IndexType idx) {
+      const axom::IndexType offset = idx * WEIGHTS_PER_POINT;
+      const auto cell_id = containing_cell[idx];
+      if(cell_id == INVALID_INDEX)
+      {
+        for(int i = 0; i < WEIGHTS_PER_POINT; ++i)
+        {
+          indices[offset + i] = INVALID_INDEX;
+          weights[offset + i] = 0.;
+        }
+        return;
+      }
+
+      const auto baryCoords = delaunay.getBaryCoords(cell_id, coords[idx]);
+      const auto verts = delaunay.getMeshData()->boundaryVertices(cell_id);
+      for(auto it = verts.begin(); it < verts.end(); ++it)
+      {
+        // apply BRIO mapping to input vertex indices to match Delaunay insertion order
+        indices[offset + it.index()] = brio[*it];
+        weights[offset + it.index()] = baryCoords[it.index()];
+      }
+    });
+  }
+
+  /**
+   * \brief Interpolates a field from an \a input_mesh to one on a \a query_mesh
+   * using the operator precomputed by \a computeInterpolationWeights()
+   *
+   * Each output value is the weighted sum of the input values at the
+   * vertices of the containing simplex, computed in parallel when OpenMP
+   * is available.
+   *
+   * \param [inout] query_mesh Root node of mesh (in blueprint format) containing field to generate
+   * \param [in] input_mesh Root node of mesh (in blueprint format) containing the field to interpolate
+   * \param [in] input_field_name Name of field on \a input_mesh
+   * \param [in] output_field_name Name of field on \a query_mesh
+   * \param [in] INVALID_VALUE Value to use for points that are not in the \a input_mesh
+   *
+   * \pre \a computeInterpolationWeights() was called for the points of \a query_mesh
+   * \pre \a input_mesh must contain a nodal scalar field named \a input_field_name
+   * \pre \a query_mesh must contain a nodal scalar field named \a output_field_name
+   */
+  void interpolateFieldWithWeights(
+    conduit::Node& query_mesh,
+    conduit::Node& input_mesh,
+    const std::string& input_field_name,
+    const std::string& output_field_name,
+    const double INVALID_VALUE = std::numeric_limits<double>::quiet_NaN()) const
+  {
+    constexpr auto INVALID_INDEX = DelaunayTriangulation::INVALID_INDEX;
+
+    SLIC_ASSERT(::isValidBlueprint(query_mesh));
+    SLIC_ASSERT(::isValidBlueprint(input_mesh));
+
+    // Extract the required fields from the input and query meshes
+    auto in_fld = ::getField<double>(input_mesh, input_field_name);
+    auto out_fld = ::getField<double>(query_mesh, output_field_name);
+
+    SLIC_ERROR_IF(
+      out_fld.size() * WEIGHTS_PER_POINT != m_weights.size(),
+      fmt::format("Field '{}' does not match the query points of the "
+                  "interpolation weights. Call computeInterpolationWeights() "
+                  "for its mesh first.",
+                  output_field_name));
+
+    const auto indices = m_weight_indices.view();
+    const auto weights = m_weights.view();
+    axom::for_all<HostExecSpace>(out_fld.size(), [=](axom::IndexType idx) {
+      const axom::IndexType offset = idx * WEIGHTS_PER_POINT;
+      if(indices[offset] == INVALID_INDEX)
+      {
+        out_fld[idx] = INVALID_VALUE;
+        return;
+      }
+
+      double res = 0.;
+      for(int i = 0; i < WEIGHTS_PER_POINT; ++i)
+      {
+        res += in_fld[indices[offset + i]] * weights[offset + i];
+      }
+      out_fld[idx] = res;
+    });
+  }
+
   /**
    * \brief Exports the Delaunay complex with scalar fields as a vtk file
    * 
@@ -621,12 +653,20 @@ private:
 
   axom::Array<axom::IndexType> m_brio_data;
   VertexIndirectionSet m_brio;
+
+  /// Interpolation operator from computeInterpolationWeights(), with
+  /// WEIGHTS_PER_POINT input point indices and weights per query point
+  axom::Array<axom::IndexType> m_weight_indices;
+  axom::Array<double> m_weights;
   BoundingBoxType m_bounding_box;
 };
 
 template <int NDIMS>
 constexpr int ScatteredInterpolation<NDIMS>::DIM;
 
+template <int NDIMS>
+constexpr int ScatteredInterpolation<NDIMS>::WEIGHTS_PER_POINT;
+
 }  // namespace quest
 }  // namespace axom
 
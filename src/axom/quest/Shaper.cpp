@@ -11,12 +11,10 @@
 
 #include "axom/fmt.hpp"
 
-#ifndef AXOM_USE_MFEM
-  #error Shaping functionality requires Axom to be configured with MFEM and the AXOM_ENABLE_MFEM_SIDRE_DATACOLLECTION option
+#if defined(AXOM_USE_MFEM)
+  #include "mfem.hpp"
 #endif
 
-#include "mfem.hpp"
-
 namespace axom
 {
 namespace quest
@@ -82,15 +80,40 @@ constexpr double Shaper::MINIMUM_PERCENT_ERROR;
 constexpr double Shaper::MAXIMUM_PERCENT_ERROR;
 constexpr double Shaper::DEFAULT_VERTEX_WELD_THRESHOLD;
 
+#if defined(AXOM_USE_MFEM)
 Shaper::Shaper(const klee::ShapeSet& shapeSet, sidre::MFEMSidreDataCollection* dc)
   : m_shapeSet(shapeSet)
   , m_dc(dc)
 {
-#if defined(AXOM_USE_MPI) && defined(MFEM_USE_MPI)
+  #if defined(AXOM_USE_MPI) && defined(MFEM_USE_MPI)
   m_comm = m_dc->GetComm();
+  #endif
+}
 #endif
+
+Shaper::Shaper(const klee::ShapeSet& shapeSet,
+               mint::Mesh* cellMesh,
+               MPI_Comm comm)
+  : m_shapeSet(shapeSet)
+  , m_cellMesh(cellMesh)
+  , m_comm(comm)
+{
+  SLIC_ERROR_IF(m_cellMesh == nullptr, "Shaper requires a non-null mesh");
+  SLIC_ERROR_IF(m_cellMesh->getDimension() != 3,
+                "Shaper requires a three-dimensional mesh");
 }
 
+#if defined(AXOM_MINT_USE_SIDRE)
+Shaper::Shaper(const klee::ShapeSet& shapeSet,
+               sidre::Group* bpGroup,
+               const std::string& topo,
+               MPI_Comm comm)
+  : Shaper(shapeSet, mint::getMesh(bpGroup, topo), comm)
+{
+  m_ownedCellMesh.reset(m_cellMesh);
+}
+#endif
+
 void Shaper::setSamplesPerKnotSpan(int nSamples)
 {
   using axom::utilities::clampLower;
@@ -323,9 +346,20 @@ void Shaper::applyTransforms(const numerics::Matrix<double>& transformation)
 int Shaper::getRank() const
 {
 #if defined(AXOM_USE_MPI) && defined(MFEM_USE_MPI)
-  if(auto* pmesh = static_cast<mfem::ParMesh*>(m_dc->GetMesh()))
+  if(m_dc != nullptr)
   {
-    return pmesh->GetMyRank();
+    if(auto* pmesh = static_cast<mfem::ParMesh*>(m_dc->GetMesh()))
+    {
+      return pmesh->GetMyRank();
+    }
+  }
+#endif
+#if defined(AXOM_USE_MPI)
+  if(m_cellMesh != nullptr)
+  {
+    int rank = 0;
+    MPI_Comm_rank(m_comm, &rank);
+    return rank;
   }
 #endif
   return 0;
@@ -333,9 +367,23 @@ int Shaper::getRank() const
 
 double Shaper::allReduceSum(double val) const
 {
-  if(m_dc != nullptr && m_dc->GetNumProcs() > 1)
+  int numProcs = 1;
+#if defined(AXOM_USE_MFEM)
+  if(m_dc != nullptr)
   {
-#if defined(AXOM_USE_MPI) && defined(MFEM_USE_MPI)
+    numProcs = m_dc->GetNumProcs();
+  }
+#endif
+#if defined(AXOM_USE_MPI)
+  if(m_cellMesh != nullptr)
+  {
+    MPI_Comm_size(m_comm, &numProcs);
+  }
+#endif
+
+  if(numProcs > 1)
+  {
+#if defined(AXOM_USE_MPI)
     double global;
     MPI_Allreduce(&val, &global, 1, MPI_DOUBLE, MPI_SUM, m_comm);
     return global;
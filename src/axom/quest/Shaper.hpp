@@ -16,8 +16,8 @@
 #ifndef AXOM_USE_KLEE
   #error Shaping functionality requires Axom to be configured with the Klee component
 #endif
-#ifndef AXOM_USE_MFEM
-  #error Shaping functionality requires Axom to be configured with MFEM and the AXOM_ENABLE_MFEM_SIDRE_DATACOLLECTION option
+#ifndef AXOM_USE_SIDRE
+  #error Shaping functionality requires Axom to be configured with the Sidre component
 #endif
 
 #include "axom/sidre.hpp"
@@ -26,6 +26,8 @@
 
 #include "axom/quest/interface/internal/mpicomm_wrapper.hpp"
 
+#include <memory>
+
 namespace axom
 {
 namespace quest
@@ -36,7 +38,44 @@ namespace quest
 class Shaper
 {
 public:
+#if defined(AXOM_USE_MFEM)
   Shaper(const klee::ShapeSet& shapeSet, sidre::MFEMSidreDataCollection* dc);
+#endif
+
+  /*!
+   * \brief Constructs a shaper over the cells of a mint mesh
+   *
+   * \param shapeSet The shapes to apply to the mesh
+   * \param cellMesh The mesh whose cells are shaped. Volume fractions are
+   *  written into its cell-centered fields. The shaper does not take
+   *  ownership of the mesh.
+   * \param comm The communicator of the ranks sharing the mesh
+   *
+   * \note This mode does not require MFEM.
+   */
+  Shaper(const klee::ShapeSet& shapeSet,
+         mint::Mesh* cellMesh,
+         MPI_Comm comm = MPI_COMM_SELF);
+
+#if defined(AXOM_MINT_USE_SIDRE)
+  /*!
+   * \brief Constructs a shaper over a mesh stored as a blueprint in sidre
+   *
+   * \param shapeSet The shapes to apply to the mesh
+   * \param bpGroup The root group of the blueprint mesh
+   * \param topo The name of the topology to shape. The first topology of
+   *  the group is used when it is empty.
+   * \param comm The communicator of the ranks sharing the mesh
+   *
+   * The mesh is accessed in place through mint, so the coordinates and
+   * connectivity are not copied and the volume fractions are written as
+   * blueprint element fields of the group.
+   */
+  Shaper(const klee::ShapeSet& shapeSet,
+         sidre::Group* bpGroup,
+         const std::string& topo = "",
+         MPI_Comm comm = MPI_COMM_SELF);
+#endif
 
   virtual ~Shaper() = default;
 
@@ -67,7 +106,10 @@ public:
 
   bool isVerbose() const { return m_verboseOutput; }
 
+#if defined(AXOM_USE_MFEM)
   sidre::MFEMSidreDataCollection* getDC() { return m_dc; }
+#endif
+  mint::Mesh* getCellMesh() const { return m_cellMesh; }
   mint::Mesh* getSurfaceMesh() const { return m_surfaceMesh; }
 
   /*!
@@ -156,7 +198,13 @@ protected:
 
 protected:
   const klee::ShapeSet& m_shapeSet;
-  sidre::MFEMSidreDataCollection* m_dc;
+#if defined(AXOM_USE_MFEM)
+  sidre::MFEMSidreDataCollection* m_dc {nullptr};
+#endif
+
+  /// The mesh being shaped when the shaper is not given a data collection
+  mint::Mesh* m_cellMesh {nullptr};
+  std::unique_ptr<mint::Mesh> m_ownedCellMesh;
 
   mint::Mesh* m_surfaceMesh {nullptr};
 
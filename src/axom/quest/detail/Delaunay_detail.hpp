@@ -0,0 +1,162 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_QUEST_DELAUNAY_DETAIL_HPP_
+#define AXOM_QUEST_DELAUNAY_DETAIL_HPP_
+
+#include "axom/config.hpp"
+#include "axom/core.hpp"
+
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>
+#endif
+
+#include <cstdint>
+#include <utility>
+
+namespace axom
+{
+namespace quest
+{
+namespace detail
+{
+/*!
+ * \brief Sorts 64-bit keys in ascending order with a stable LSD radix sort,
+ *  applying the same permutation to the associated values
+ *
+ * \param [inout] keys The keys to sort
+ * \param [inout] values The values associated with the keys
+ * \param [in] n The number of keys and values
+ *
+ * The keys are sorted one byte at a time, from the least to the most
+ * significant byte.  Bytes that are the same in all the keys are skipped,
+ * e.g. the unused high bits of a Morton index.  With OpenMP, each thread
+ * counts and scatters a contiguous block of the keys, so the result is the
+ * same for any number of threads.
+ */
+template <typename ValueType>
+void radixSortPairs(std::uint64_t* keys, ValueType* values, IndexType n)
+{
+  constexpr int RADIX_BITS = 8;
+  constexpr int NUM_BUCKETS = 1 << RADIX_BITS;
+  constexpr std::uint64_t DIGIT_MASK = NUM_BUCKETS - 1;
+  constexpr int NUM_PASSES = 64 / RADIX_BITS;
+
+  if(n < 2)
+  {
+    return;
+  }
+
+  // Find the bits that differ between the keys
+  std::uint64_t differingBits = 0;
+  const std::uint64_t firstKey = keys[0];
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for reduction(| : differingBits) schedule(static)
+#endif
+  for(IndexType i = 1; i < n; ++i)
+  {
+    differingBits |= keys[i] ^ firstKey;
+  }
+
+#ifdef AXOM_USE_OPENMP
+  const int maxThreads = omp_get_max_threads();
+#else
+  const int maxThreads = 1;
+#endif
+  axom::Array<std::uint64_t> keysBuffer(n, n);
+  axom::Array<ValueType> valuesBuffer(n, n);
+  axom::Array<IndexType> bucketOffsets(maxThreads * NUM_BUCKETS,
+                                       maxThreads * NUM_BUCKETS);
+
+  std::uint64_t* srcKeys = keys;
+  std::uint64_t* dstKeys = keysBuffer.data();
+  ValueType* srcValues = values;
+  ValueType* dstValues = valuesBuffer.data();
+  IndexType* offsets = bucketOffsets.data();
+
+  for(int pass = 0; pass < NUM_PASSES; ++pass)
+  {
+    const int shift = pass * RADIX_BITS;
+    if(((differingBits >> shift) & DIGIT_MASK) == 0)
+    {
+      continue;
+    }
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel num_threads(maxThreads)
+#endif
+    {
+#ifdef AXOM_USE_OPENMP
+      const int thread = omp_get_thread_num();
+      const int numThreads = omp_get_num_threads();
+#else
+      const int thread = 0;
+      const int numThreads = 1;
+#endif
+      const IndexType begin = n * thread / numThreads;
+      const IndexType end = n * (thread + 1) / numThreads;
+
+      // Count the keys of this thread's block in each bucket
+      IndexType* threadOffsets = offsets + thread * NUM_BUCKETS;
+      for(int b = 0; b < NUM_BUCKETS; ++b)
+      {
+        threadOffsets[b] = 0;
+      }
+      for(IndexType i = begin; i < end; ++i)
+      {
+        ++threadOffsets[(srcKeys[i] >> shift) & DIGIT_MASK];
+      }
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp barrier
+  #pragma omp single
+#endif
+      {
+        // Each thread's block starts after the same bucket of the earlier
+        // blocks, which keeps the sort stable
+        IndexType offset = 0;
+        for(int b = 0; b < NUM_BUCKETS; ++b)
+        {
+          for(int t = 0; t < numThreads; ++t)
+          {
+            const IndexType count = offsets[t * NUM_BUCKETS + b];
+            offsets[t * NUM_BUCKETS + b] = offset;
+            offset += count;
+          }
+        }
+      }
+
+      for(IndexType i = begin; i < end; ++i)
+      {
+        const int bucket = (srcKeys[i] >> shift) & DIGIT_MASK;
+        const IndexType pos = threadOffsets[bucket]++;
+        dstKeys[pos] = srcKeys[i];
+        dstValues[pos] = srcValues[i];
+      }
+    }
+
+    std::swap(srcKeys, dstKeys);
+    std::swap(srcValues, dstValues);
+  }
+
+  // Copy back when the result ended up in the buffers
+  if(srcKeys != keys)
+  {
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+    for(IndexType i = 0; i < n; ++i)
+    {
+      keys[i] = srcKeys[i];
+      values[i] = srcValues[i];
+    }
+  }
+}
+
+}  // namespace detail
+}  // namespace quest
+}  // namespace axom
+
+#endif  // AXOM_QUEST_DELAUNAY_DETAIL_HPP_
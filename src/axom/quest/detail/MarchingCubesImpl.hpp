@@ -14,10 +14,17 @@
   #include "axom/quest/detail/marching_cubes_lookup.hpp"
   #include "axom/quest/MeshViewUtil.hpp"
   #include "axom/primal/geometry/Point.hpp"
+  #include "axom/primal/geometry/Vector.hpp"
   #include "axom/primal/constants.hpp"
   #include "axom/mint/execution/internal/structured_exec.hpp"
   #include "axom/fmt.hpp"
 
+  #include <algorithm>
+  #include <limits>
+  #include <memory>
+  #include <utility>
+  #include <vector>
+
 namespace axom
 {
 namespace quest
@@ -51,6 +58,7 @@ class MarchingCubesImpl : public MarchingCubesSingleDomain::ImplBase
 {
 public:
   using Point = axom::primal::Point<double, DIM>;
+  using Vector = axom::primal::Vector<double, DIM>;
   using MIdx = axom::StackArray<axom::IndexType, DIM>;
   using LoopPolicy = typename execution_space<ExecSpace>::loop_policy;
   using ReducePolicy = typename execution_space<ExecSpace>::reduce_policy;
@@ -62,30 +70,29 @@ public:
     @param dom Blueprint structured mesh domain
     @param topologyName Name of mesh topology (see blueprint
            mesh documentation)
-    @param fcnFieldName Name of nodal function in dom
     @param maskFieldName Name of integer cell mask function is in dom
 
-    Set up views to domain data and allocate other data to work on the
-    given domain.
+    Set up views to domain mesh data and allocate other data to work
+    on the given domain.  This is done once per domain.  The mesh
+    data is reused for all function fields and contour values.
 
     The above data from the domain MUST be in a memory space
     compatible with ExecSpace.
   */
   AXOM_HOST void initialize(const conduit::Node& dom,
                             const std::string& topologyName,
-                            const std::string& fcnFieldName,
                             const std::string& maskFieldName = {}) override
   {
     clear();
 
-    axom::quest::MeshViewUtil<DIM, MemorySpace> mvu(dom, topologyName);
+    m_mvu.reset(
+      new axom::quest::MeshViewUtil<DIM, MemorySpace>(dom, topologyName));
 
-    m_bShape = mvu.getCellShape();
-    m_coordsViews = mvu.getConstCoordsViews(false);
-    m_fcnView = mvu.template getConstFieldView<double>(fcnFieldName, false);
+    m_bShape = m_mvu->getCellShape();
+    m_coordsViews = m_mvu->getConstCoordsViews(false);
     if(!maskFieldName.empty())
     {
-      m_maskView = mvu.template getConstFieldView<int>(maskFieldName, false);
+      m_maskView = m_mvu->template getConstFieldView<int>(maskFieldName, false);
     }
 
     /*
@@ -97,96 +104,54 @@ public:
     m_caseIds.fill(0);
   }
 
-  //!@brief Set a value to find the contour for.
-  void setContourValue(double contourVal) override
-  {
-    m_contourVal = contourVal;
-  }
-
   /*!
-    @brief Implementation of virtual markCrossings.
+    @brief Set the nodal function to contour.
+    @param fcnFieldName Name of nodal function in the domain
 
-    Virtual methods cannot be templated, so this implementation
-    delegates to a name templated on DIM.
+    Only the view of the function data is updated, so this is cheap
+    enough to call for every new function or time step.  Function
+    ranges from computeCellRanges() are invalidated.
   */
-  void markCrossings() override { markCrossings_dim(); }
-
-  //!@brief Populate m_caseIds with crossing indices.
-  template <int TDIM = DIM>
-  typename std::enable_if<TDIM == 2>::type markCrossings_dim()
+  AXOM_HOST void setFunctionField(const std::string& fcnFieldName) override
   {
-    MarkCrossings_Util mcu(m_caseIds, m_fcnView, m_maskView, m_contourVal);
-
-  #if defined(AXOM_USE_RAJA)
-    RAJA::RangeSegment jRange(0, m_bShape[1]);
-    RAJA::RangeSegment iRange(0, m_bShape[0]);
-    using EXEC_POL =
-      typename axom::mint::internal::structured_exec<ExecSpace>::loop2d_policy;
-    RAJA::kernel<EXEC_POL>(
-      RAJA::make_tuple(iRange, jRange),
-      AXOM_LAMBDA(axom::IndexType i, axom::IndexType j) {
-        mcu.computeCaseId(i, j);
-      });
-  #else
-    for(int j = 0; j < m_bShape[1]; ++j)
-    {
-      for(int i = 0; i < m_bShape[0]; ++i)
-      {
-        mcu.computeCaseId(i, j);
-      }
-    }
-  #endif
+    SLIC_ASSERT_MSG(m_mvu, "MarchingCubesImpl must be initialized first.");
+    m_fcnView = m_mvu->template getConstFieldView<double>(fcnFieldName, false);
+    m_useCellRanges = false;
   }
 
-  //!@brief Populate m_caseIds with crossing indices.
-  template <int TDIM = DIM>
-  typename std::enable_if<TDIM == 3>::type markCrossings_dim()
+  //!@brief Set a value to find the contour for.
+  void setContourValue(double contourVal) override
   {
-    MarkCrossings_Util mcu(m_caseIds, m_fcnView, m_maskView, m_contourVal);
-
-  #if defined(AXOM_USE_RAJA)
-    RAJA::RangeSegment kRange(0, m_bShape[2]);
-    RAJA::RangeSegment jRange(0, m_bShape[1]);
-    RAJA::RangeSegment iRange(0, m_bShape[0]);
-    using EXEC_POL =
-      typename axom::mint::internal::structured_exec<ExecSpace>::loop3d_policy;
-    RAJA::kernel<EXEC_POL>(
-      RAJA::make_tuple(iRange, jRange, kRange),
-      AXOM_LAMBDA(axom::IndexType i, axom::IndexType j, axom::IndexType k) {
-        mcu.computeCaseId(i, j, k);
-      });
-  #else
-    for(int k = 0; k < m_bShape[2]; ++k)
-    {
-      for(int j = 0; j < m_bShape[1]; ++j)
-      {
-        for(int i = 0; i < m_bShape[0]; ++i)
-        {
-          mcu.computeCaseId(i, j, k);
-        }
-      }
-    }
-  #endif
+    m_contourVal = contourVal;
   }
 
   /*!
     @brief Implementation used by MarchingCubesImpl::markCrossings_dim()
-    containing just the objects needed for that part, to be made available
-    on devices.
+    and computeCellRanges_dim() containing just the objects needed for
+    those parts, to be made available on devices.
   */
   struct MarkCrossings_Util
   {
     axom::ArrayView<std::uint16_t, DIM, MemorySpace> caseIdsView;
     axom::ArrayView<const double, DIM, MemorySpace> fcnView;
     axom::ArrayView<const int, DIM, MemorySpace> maskView;
+    axom::ArrayView<double, DIM, MemorySpace> cellMinView;
+    axom::ArrayView<double, DIM, MemorySpace> cellMaxView;
+    bool useCellRanges;
     double contourVal;
     MarkCrossings_Util(axom::Array<std::uint16_t, DIM, MemorySpace>& caseIds,
                        axom::ArrayView<const double, DIM, MemorySpace>& fcnView_,
                        axom::ArrayView<const int, DIM, MemorySpace>& maskView_,
+                       axom::Array<double, DIM, MemorySpace>& cellMin,
+                       axom::Array<double, DIM, MemorySpace>& cellMax,
+                       bool useCellRanges_,
                        double contourVal_)
       : caseIdsView(caseIds.view())
       , fcnView(fcnView_)
       , maskView(maskView_)
+      , cellMinView(cellMin.view())
+      , cellMaxView(cellMax.view())
+      , useCellRanges(useCellRanges_)
       , contourVal(contourVal_)
     { }
 
@@ -205,22 +170,76 @@ public:
       return index;
     }
 
+    //!@brief Whether the range of a cell can include contourVal.
+    AXOM_HOST_DEVICE inline bool rangeCrosses(double cellMin,
+                                              double cellMax) const
+    {
+      // Cells with all values below or all at or above contourVal
+      // have the empty crossing case.
+      return cellMin < contourVal && contourVal <= cellMax;
+    }
+
+    //!@brief Compute the range of a cell's nodal values.
+    AXOM_HOST_DEVICE inline void computeRangeFromValues(const double* f,
+                                                        double& cellMin,
+                                                        double& cellMax) const
+    {
+      cellMin = f[0];
+      cellMax = f[0];
+      for(int n = 1; n < CELL_CORNER_COUNT; ++n)
+      {
+        cellMin = f[n] < cellMin ? f[n] : cellMin;
+        cellMax = f[n] > cellMax ? f[n] : cellMax;
+      }
+    }
+
+    template <int TDIM = DIM>
+    AXOM_HOST_DEVICE inline typename std::enable_if<TDIM == 2>::type
+    getNodalValues(axom::IndexType i,
+                   axom::IndexType j,
+                   double* nodalValues) const
+    {
+      nodalValues[0] = fcnView(i, j);
+      nodalValues[1] = fcnView(i + 1, j);
+      nodalValues[2] = fcnView(i + 1, j + 1);
+      nodalValues[3] = fcnView(i, j + 1);
+    }
+
+    template <int TDIM = DIM>
+    AXOM_HOST_DEVICE inline typename std::enable_if<TDIM == 3>::type
+    getNodalValues(axom::IndexType i,
+                   axom::IndexType j,
+                   axom::IndexType k,
+                   double* nodalValues) const
+    {
+      nodalValues[0] = fcnView(i + 1, j, k);
+      nodalValues[1] = fcnView(i + 1, j + 1, k);
+      nodalValues[2] = fcnView(i, j + 1, k);
+      nodalValues[3] = fcnView(i, j, k);
+      nodalValues[4] = fcnView(i + 1, j, k + 1);
+      nodalValues[5] = fcnView(i + 1, j + 1, k + 1);
+      nodalValues[6] = fcnView(i, j + 1, k + 1);
+      nodalValues[7] = fcnView(i, j, k + 1);
+    }
+
     template <int TDIM = DIM>
     AXOM_HOST_DEVICE inline typename std::enable_if<TDIM == 2>::type
     computeCaseId(axom::IndexType i, axom::IndexType j) const
     {
-      const bool useZone = maskView.empty() || bool(maskView(i, j));
+      // Cell ranges already account for the mask.
+      const bool useZone = useCellRanges
+        ? rangeCrosses(cellMinView(i, j), cellMaxView(i, j))
+        : maskView.empty() || bool(maskView(i, j));
       if(useZone)
       {
-        // clang-format off
-          double nodalValues[CELL_CORNER_COUNT] =
-            {fcnView(i    , j    ),
-             fcnView(i + 1, j    ),
-             fcnView(i + 1, j + 1),
-             fcnView(i    , j + 1)};
-        // clang-format on
+        double nodalValues[CELL_CORNER_COUNT];
+        getNodalValues(i, j, nodalValues);
         caseIdsView(i, j) = computeCrossingCase(nodalValues);
       }
+      else
+      {
+        caseIdsView(i, j) = 0;
+      }
     }
 
     //!@brief Populate m_caseIds with crossing indices.
@@ -228,34 +247,217 @@ public:
     AXOM_HOST_DEVICE inline typename std::enable_if<TDIM == 3>::type
     computeCaseId(axom::IndexType i, axom::IndexType j, axom::IndexType k) const
     {
-      const bool useZone = maskView.empty() || bool(maskView(i, j, k));
+      // Cell ranges already account for the mask.
+      const bool useZone = useCellRanges
+        ? rangeCrosses(cellMinView(i, j, k), cellMaxView(i, j, k))
+        : maskView.empty() || bool(maskView(i, j, k));
       if(useZone)
       {
-        // clang-format off
-          double nodalValues[CELL_CORNER_COUNT] =
-            {fcnView(i + 1, j    , k    ),
-             fcnView(i + 1, j + 1, k    ),
-             fcnView(i    , j + 1, k    ),
-             fcnView(i    , j    , k    ),
-             fcnView(i + 1, j    , k + 1),
-             fcnView(i + 1, j + 1, k + 1),
-             fcnView(i    , j + 1, k + 1),
-             fcnView(i    , j    , k + 1)};
-        // clang-format on
+        double nodalValues[CELL_CORNER_COUNT];
+        getNodalValues(i, j, k, nodalValues);
         caseIdsView(i, j, k) = computeCrossingCase(nodalValues);
       }
+      else
+      {
+        caseIdsView(i, j, k) = 0;
+      }
+    }
+
+    template <int TDIM = DIM>
+    AXOM_HOST_DEVICE inline typename std::enable_if<TDIM == 2>::type
+    computeRange(axom::IndexType i, axom::IndexType j) const
+    {
+      const bool useZone = maskView.empty() || bool(maskView(i, j));
+      if(useZone)
+      {
+        double nodalValues[CELL_CORNER_COUNT];
+        getNodalValues(i, j, nodalValues);
+        computeRangeFromValues(nodalValues,
+                               cellMinView(i, j),
+                               cellMaxView(i, j));
+      }
+      else
+      {
+        cellMinView(i, j) = std::numeric_limits<double>::max();
+        cellMaxView(i, j) = std::numeric_limits<double>::lowest();
+      }
+    }
+
+    template <int TDIM = DIM>
+    AXOM_HOST_DEVICE inline typename std::enable_if<TDIM == 3>::type
+    computeRange(axom::IndexType i, axom::IndexType j, axom::IndexType k) const
+    {
+      const bool useZone = maskView.empty() || bool(maskView(i, j, k));
+      if(useZone)
+      {
+        double nodalValues[CELL_CORNER_COUNT];
+        getNodalValues(i, j, k, nodalValues);
+        computeRangeFromValues(nodalValues,
+                               cellMinView(i, j, k),
+                               cellMaxView(i, j, k));
+      }
+      else
+      {
+        cellMinView(i, j, k) = std::numeric_limits<double>::max();
+        cellMaxView(i, j, k) = std::numeric_limits<double>::lowest();
+      }
     }
   };  // MarkCrossings_Util
 
+  /*!
+    @brief Implementation of virtual markCrossings.
+
+    Virtual methods cannot be templated, so this implementation
+    delegates to a name templated on DIM.
+  */
+  void markCrossings() override
+  {
+    MarkCrossings_Util mcu(m_caseIds,
+                           m_fcnView,
+                           m_maskView,
+                           m_cellFcnMin,
+                           m_cellFcnMax,
+                           m_useCellRanges,
+                           m_contourVal);
+    markCrossings_dim(mcu);
+  }
+
+  /*!
+    @brief Compute the range of the function in each parent cell.
+
+    With the ranges, markCrossings() skips reading the corner values
+    of cells whose range excludes the contour value.  This pays off
+    when contouring several values of the same function, because all
+    the values share the ranges.  Masked cells get empty ranges.
+  */
+  void computeCellRanges() override
+  {
+    if(m_cellFcnMin.shape() != m_bShape)
+    {
+      m_cellFcnMin = axom::Array<double, DIM, MemorySpace>(m_bShape);
+      m_cellFcnMax = axom::Array<double, DIM, MemorySpace>(m_bShape);
+    }
+    m_useCellRanges = false;
+    MarkCrossings_Util mcu(m_caseIds,
+                           m_fcnView,
+                           m_maskView,
+                           m_cellFcnMin,
+                           m_cellFcnMax,
+                           m_useCellRanges,
+                           m_contourVal);
+    computeCellRanges_dim(mcu);
+    m_useCellRanges = true;
+  }
+
+  //!@brief Populate m_caseIds with crossing indices.
+  template <int TDIM = DIM>
+  typename std::enable_if<TDIM == 2>::type markCrossings_dim(
+    const MarkCrossings_Util& mcu)
+  {
+    forEachParentCell(
+      AXOM_LAMBDA(axom::IndexType i, axom::IndexType j) {
+        mcu.computeCaseId(i, j);
+      });
+  }
+
+  //!@brief Populate m_caseIds with crossing indices.
+  template <int TDIM = DIM>
+  typename std::enable_if<TDIM == 3>::type markCrossings_dim(
+    const MarkCrossings_Util& mcu)
+  {
+    forEachParentCell(
+      AXOM_LAMBDA(axom::IndexType i, axom::IndexType j, axom::IndexType k) {
+        mcu.computeCaseId(i, j, k);
+      });
+  }
+
+  //!@brief Populate m_cellFcnMin and m_cellFcnMax.
+  template <int TDIM = DIM>
+  typename std::enable_if<TDIM == 2>::type computeCellRanges_dim(
+    const MarkCrossings_Util& mcu)
+  {
+    forEachParentCell(
+      AXOM_LAMBDA(axom::IndexType i, axom::IndexType j) {
+        mcu.computeRange(i, j);
+      });
+  }
+
+  //!@brief Populate m_cellFcnMin and m_cellFcnMax.
+  template <int TDIM = DIM>
+  typename std::enable_if<TDIM == 3>::type computeCellRanges_dim(
+    const MarkCrossings_Util& mcu)
+  {
+    forEachParentCell(
+      AXOM_LAMBDA(axom::IndexType i, axom::IndexType j, axom::IndexType k) {
+        mcu.computeRange(i, j, k);
+      });
+  }
+
+  //!@brief Apply a functor of (i, j) to each parent cell.
+  template <int TDIM = DIM, typename CellOp>
+  typename std::enable_if<TDIM == 2>::type forEachParentCell(
+    const CellOp& cellOp)
+  {
+  #if defined(AXOM_USE_RAJA)
+    RAJA::RangeSegment jRange(0, m_bShape[1]);
+    RAJA::RangeSegment iRange(0, m_bShape[0]);
+    using EXEC_POL =
+      typename axom::mint::internal::structured_exec<ExecSpace>::loop2d_policy;
+    RAJA::kernel<EXEC_POL>(
+      RAJA::make_tuple(iRange, jRange),
+      AXOM_LAMBDA(axom::IndexType i, axom::IndexType j) { cellOp(i, j); });
+  #else
+    for(int j = 0; j < m_bShape[1]; ++j)
+    {
+      for(int i = 0; i < m_bShape[0]; ++i)
+      {
+        cellOp(i, j);
+      }
+    }
+  #endif
+  }
+
+  //!@brief Apply a functor of (i, j, k) to each parent cell.
+  template <int TDIM = DIM, typename CellOp>
+  typename std::enable_if<TDIM == 3>::type forEachParentCell(
+    const CellOp& cellOp)
+  {
+  #if defined(AXOM_USE_RAJA)
+    RAJA::RangeSegment kRange(0, m_bShape[2]);
+    RAJA::RangeSegment jRange(0, m_bShape[1]);
+    RAJA::RangeSegment iRange(0, m_bShape[0]);
+    using EXEC_POL =
+      typename axom::mint::internal::structured_exec<ExecSpace>::loop3d_policy;
+    RAJA::kernel<EXEC_POL>(
+      RAJA::make_tuple(iRange, jRange, kRange),
+      AXOM_LAMBDA(axom::IndexType i, axom::IndexType j, axom::IndexType k) {
+        cellOp(i, j, k);
+      });
+  #else
+    for(int k = 0; k < m_bShape[2]; ++k)
+    {
+      for(int j = 0; j < m_bShape[1]; ++j)
+      {
+        for(int i = 0; i < m_bShape[0]; ++i)
+        {
+          cellOp(i, j, k);
+        }
+      }
+    }
+  #endif
+  }
+
   /*!
     @brief Populate the 1D m_crossings array, one entry for each
     parent cell that crosses the contour.
 
     We sum up the number of contour surface cells from the crossings,
-    allocate space, then populate it.
+    allocate space, then populate it.  Contour cells from this contour
+    value are numbered after those from earlier contour values.
   */
   void scanCrossings() override
   {
+    const axom::IndexType priorCellCount = m_contourCellCount;
     const axom::IndexType parentCellCount = m_caseIds.size();
     auto caseIdsView = m_caseIds.view();
   #if defined(AXOM_USE_RAJA)
@@ -332,7 +534,7 @@ public:
 
     auto copyFirstSurfaceCellId = AXOM_LAMBDA(axom::IndexType n)
     {
-      crossingsView[n].firstSurfaceCellId = prefixSumView[n];
+      crossingsView[n].firstSurfaceCellId = priorCellCount + prefixSumView[n];
     };
   #if defined(AXOM_USE_RAJA)
         // Intel oneAPI compiler segfaults with OpenMP RAJA scan
@@ -366,7 +568,7 @@ public:
     // Data from the last crossing tells us how many contour cells there are.
     if(m_crossings.empty())
     {
-      m_contourCellCount = 0;
+      m_contourCellCount = priorCellCount;
     }
     else
     {
@@ -389,11 +591,14 @@ public:
     double contourVal;
     MIdx bStrides;
     axom::ArrayIndexer<axom::IndexType, DIM> indexer;
+    //!@brief Strides for numbering parent mesh nodes, for node keys.
+    MIdx nodeStrides;
     axom::ArrayView<const double, DIM, MemorySpace> fcnView;
     axom::StackArray<axom::ArrayView<const double, DIM, MemorySpace>, DIM> coordsViews;
     ComputeContour_Util(
       double contourVal_,
       const MIdx& bStrides_,
+      const MIdx& bShape_,
       const axom::ArrayView<const double, DIM, MemorySpace>& fcnView_,
       const axom::StackArray<axom::ArrayView<const double, DIM, MemorySpace>, DIM>
         coordsViews_)
@@ -402,7 +607,13 @@ public:
       , indexer(bStrides_)
       , fcnView(fcnView_)
       , coordsViews(coordsViews_)
-    { }
+    {
+      nodeStrides[0] = 1;
+      for(int d = 1; d < DIM; ++d)
+      {
+        nodeStrides[d] = nodeStrides[d - 1] * (bShape_[d - 1] + 1);
+      }
+    }
 
     template <int TDIM = DIM>
     AXOM_HOST_DEVICE typename std::enable_if<TDIM == 2>::type
@@ -465,21 +676,113 @@ public:
       // clang-format on
     }
 
-    //!@brief Interpolate for the contour location crossing a parent edge.
+    //!@brief Get the two parent cell corners at the ends of a parent edge.
     template <int TDIM = DIM>
-    AXOM_HOST_DEVICE typename std::enable_if<TDIM == 2>::type linear_interp(
+    AXOM_HOST_DEVICE typename std::enable_if<TDIM == 2>::type edge_corners(
       int edgeIdx,
-      const Point cornerCoords[4],
-      const double nodeValues[4],
-      Point& crossingPt) const
+      int& n1,
+      int& n2) const
+    {
+      n1 = edgeIdx;
+      n2 = (edgeIdx == 3) ? 0 : edgeIdx + 1;
+    }
+
+    //!@brief Get the two parent cell corners at the ends of a parent edge.
+    template <int TDIM = DIM>
+    AXOM_HOST_DEVICE typename std::enable_if<TDIM == 3>::type edge_corners(
+      int edgeIdx,
+      int& n1,
+      int& n2) const
+    {
+      // There is an agreed-on ordering of these indices in the arrays
+      // cornerCoords, nodeValues, hex_edge_table.
+      const int hex_edge_table[] = {
+        0, 1, 1, 2, 2, 3, 3, 0,  // base
+        4, 5, 5, 6, 6, 7, 7, 4,  // top
+        0, 4, 1, 5, 2, 6, 3, 7   // vertical
+      };
+
+      n1 = hex_edge_table[edgeIdx * 2];
+      n2 = hex_edge_table[edgeIdx * 2 + 1];
+    }
+
+    /*!
+      @brief Get the two parent cell corners at the ends of a parent
+      edge, ordered from the edge's lower to its upper corner.
+
+      Neighboring cells see a shared parent edge with different local
+      corner orders, so computations that must agree between cells
+      use this canonical order.
+    */
+    AXOM_HOST_DEVICE void ordered_edge_corners(int edgeIdx,
+                                               int& n1,
+                                               int& n2) const
+    {
+      edge_corners(edgeIdx, n1, n2);
+      for(int d = 0; d < DIM; ++d)
+      {
+        if(corner_offset(n1, d) > corner_offset(n2, d))
+        {
+          const int tmp = n1;
+          n1 = n2;
+          n2 = tmp;
+          break;
+        }
+      }
+    }
+
+    /*!
+      @brief Get the offset of a parent cell corner from the cell's
+      lowest corner, i.e. its parametric coordinates in the cell.
+    */
+    template <int TDIM = DIM>
+    AXOM_HOST_DEVICE typename std::enable_if<TDIM == 2, int>::type
+    corner_offset(int corner, int d) const
+    {
+      // clang-format off
+      const int offsets[4][2] = { {0, 0}, {1, 0}, {1, 1}, {0, 1} };
+      // clang-format on
+      return offsets[corner][d];
+    }
+
+    /*!
+      @brief Get the offset of a parent cell corner from the cell's
+      lowest corner, i.e. its parametric coordinates in the cell.
+    */
+    template <int TDIM = DIM>
+    AXOM_HOST_DEVICE typename std::enable_if<TDIM == 3, int>::type
+    corner_offset(int corner, int d) const
+    {
+      // clang-format off
+      const int offsets[8][3] = { {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0, 0, 0},
+                                  {1, 0, 1}, {1, 1, 1}, {0, 1, 1}, {0, 0, 1} };
+      // clang-format on
+      return offsets[corner][d];
+    }
+
+    /*!
+      @brief Interpolate for the contour location crossing a parent edge.
+
+      @param [out] weight Parametric location of the crossing between
+        the edge's lower (0) and upper (1) corners.
+      @return The parent cell corner that the crossing snapped to,
+        or -1 if the crossing is in the interior of the edge.
+
+      The edge is always traversed from its lower to its upper corner,
+      so all cells sharing the edge compute the same crossing and snap
+      it to the same corner.
+    */
+    AXOM_HOST_DEVICE int linear_interp(int edgeIdx,
+                                       const Point cornerCoords[],
+                                       const double nodeValues[],
+                                       Point& crossingPt,
+                                       double& weight) const
     {
       // STEP 0: get the edge node indices
       // 2 nodes define the edge.  n1 and n2 are the indices of
-      // the nodes w.r.t. the square or cubic zone.  There is a
-      // agreed-on ordering of these indices in the arrays xx, yy,
-      // zz, nodeValues, crossingPt.
-      int n1 = edgeIdx;
-      int n2 = (edgeIdx == 3) ? 0 : edgeIdx + 1;
+      // the nodes w.r.t. the square or cubic zone.
+      int n1, n2;
+      ordered_edge_corners(edgeIdx, n1, n2);
 
       // STEP 1: get the fields and coordinates from the two points
       const double f1 = nodeValues[n1];
@@ -493,77 +796,149 @@ public:
          axom::utilities::isNearlyEqual(f1, f2))
       {
         crossingPt = p1;
-        return;
+        weight = 0.0;
+        return n1;
       }
 
       if(axom::utilities::isNearlyEqual(contourVal, f2))
       {
         crossingPt = p2;
-        return;
+        weight = 1.0;
+        return n2;
       }
 
-      // STEP 3: point is in between the edge points, interpolate its position
+      // STEP 3: point is not at corner; interpolate its position
       constexpr double ptiny = axom::primal::PRIMAL_TINY;
       const double df = f2 - f1 + ptiny;  //add ptiny to avoid division by zero
-      const double w = (contourVal - f1) / df;
+      weight = (contourVal - f1) / df;
       for(int d = 0; d < DIM; ++d)
       {
-        crossingPt[d] = p1[d] + w * (p2[d] - p1[d]);
+        crossingPt[d] = p1[d] + weight * (p2[d] - p1[d]);
       }
+      return -1;
     }
 
-    //!@brief Interpolate for the contour location crossing a parent edge.
-    template <int TDIM = DIM>
-    AXOM_HOST_DEVICE typename std::enable_if<TDIM == 3>::type linear_interp(
-      int edgeIdx,
-      const Point cornerCoords[8],
-      const double nodeValues[8],
-      Point& crossingPt) const
+    /*!
+      @brief Compute a key identifying a contour node by the parent
+      mesh edge (or node) it lies on, for sharing contour nodes.
+
+      Keys are unique within the domain: A node on an edge is keyed by
+      the edge's lower parent node and direction, and a node snapped
+      to a corner is keyed by that parent node.
+    */
+    AXOM_HOST_DEVICE axom::IndexType node_key(axom::IndexType cellNum,
+                                              int edgeIdx,
+                                              int snappedCorner) const
     {
-      // STEP 0: get the edge node indices
-      // 2 nodes define the edge.  n1 and n2 are the indices of
-      // the nodes w.r.t. the square or cubic zone.  There is a
-      // agreed-on ordering of these indices in the arrays
-      // cornerCoords, nodeValues, hex_edge_table.
-      const int hex_edge_table[] = {
-        0, 1, 1, 2, 2, 3, 3, 0,  // base
-        4, 5, 5, 6, 6, 7, 7, 4,  // top
-        0, 4, 1, 5, 2, 6, 3, 7   // vertical
-      };
+      const auto c = indexer.toMultiIndex(cellNum);
 
-      int n1 = hex_edge_table[edgeIdx * 2];
-      int n2 = hex_edge_table[edgeIdx * 2 + 1];
+      int n1, n2;
+      ordered_edge_corners(edgeIdx, n1, n2);
 
-      // STEP 1: get the fields and coordinates from the two points
-      const double f1 = nodeValues[n1];
-      const double f2 = nodeValues[n2];
+      int corner = snappedCorner;
+      int keyDir = DIM;
+      if(snappedCorner < 0)
+      {
+        // Use the edge's lower corner and the direction along the edge.
+        corner = n1;
+        for(int d = 0; d < DIM; ++d)
+        {
+          if(corner_offset(n1, d) != corner_offset(n2, d))
+          {
+            keyDir = d;
+          }
+        }
+      }
 
-      const Point& p1 = cornerCoords[n1];
-      const Point& p2 = cornerCoords[n2];
+      axom::IndexType parentNodeId = 0;
+      for(int d = 0; d < DIM; ++d)
+      {
+        parentNodeId += (c[d] + corner_offset(corner, d)) * nodeStrides[d];
+      }
+      return parentNodeId * (DIM + 1) + keyDir;
+    }
 
-      // STEP 2: check whether the interpolated point is at one of the two corners.
-      if(axom::utilities::isNearlyEqual(contourVal, f1) ||
-         axom::utilities::isNearlyEqual(f1, f2))
+    /*!
+      @brief Compute the gradient of the function at a location in
+      the parent cell, given by parametric coordinates \a xi.
+
+      Uses the derivatives of the multilinear interpolant of the
+      corner values and coordinates, so it is also valid for
+      curvilinear cells.  Returns a zero vector for degenerate cells.
+    */
+    AXOM_HOST_DEVICE void compute_gradient(const double xi[DIM],
+                                           const Point cornerCoords[],
+                                           const double cornerValues[],
+                                           Vector& grad) const
+    {
+      // Derivatives of function (df) and coordinates (jac) w.r.t. xi.
+      double df[DIM];
+      double jac[DIM][DIM];
+      for(int a = 0; a < DIM; ++a)
       {
-        crossingPt = p1;
-        return;
+        df[a] = 0.0;
+        for(int d = 0; d < DIM; ++d)
+        {
+          jac[a][d] = 0.0;
+        }
       }
 
-      if(axom::utilities::isNearlyEqual(contourVal, f2))
+      for(int n = 0; n < CELL_CORNER_COUNT; ++n)
       {
-        crossingPt = p2;
-        return;
+        for(int a = 0; a < DIM; ++a)
+        {
+          double dShape = corner_offset(n, a) ? 1.0 : -1.0;
+          for(int b = 0; b < DIM; ++b)
+          {
+            if(b != a)
+            {
+              dShape *= corner_offset(n, b) ? xi[b] : 1.0 - xi[b];
+            }
+          }
+          df[a] += dShape * cornerValues[n];
+          for(int d = 0; d < DIM; ++d)
+          {
+            jac[a][d] += dShape * cornerCoords[n][d];
+          }
+        }
       }
 
-      // STEP 3: point is not at corner; interpolate its position
-      constexpr double ptiny = axom::primal::PRIMAL_TINY;
-      const double df = f2 - f1 + ptiny;  //add ptiny to avoid division by zero
-      const double w = (contourVal - f1) / df;
+      // Solve jac * grad = df by Cramer's rule.
+      const double det = determinant(jac);
+      if(axom::utilities::isNearlyEqual(det, 0.0))
+      {
+        grad = Vector();
+        return;
+      }
       for(int d = 0; d < DIM; ++d)
       {
-        crossingPt[d] = p1[d] + w * (p2[d] - p1[d]);
+        double jacD[DIM][DIM];
+        for(int a = 0; a < DIM; ++a)
+        {
+          for(int e = 0; e < DIM; ++e)
+          {
+            jacD[a][e] = (e == d) ? df[a] : jac[a][e];
+          }
+        }
+        grad[d] = determinant(jacD) / det;
       }
     }
+
+    template <int TDIM = DIM>
+    AXOM_HOST_DEVICE static typename std::enable_if<TDIM == 2, double>::type
+    determinant(const double m[DIM][DIM])
+    {
+      return m[0][0] * m[1][1] - m[0][1] * m[1][0];
+    }
+
+    template <int TDIM = DIM>
+    AXOM_HOST_DEVICE static typename std::enable_if<TDIM == 3, double>::type
+    determinant(const double m[DIM][DIM])
+    {
+      return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+        m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+        m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+    }
   };  // ComputeContour_Util
 
   void computeContour() override
@@ -572,19 +947,34 @@ public:
 
     /*
       Reserve contour mesh data space so we can add data without
-      reallocation.
+      reallocation.  The new cells and nodes go after those from
+      earlier contour values.
     */
-    const axom::IndexType contourNodeCount = DIM * m_contourCellCount;
-    m_contourNodeCoords.resize(contourNodeCount);
+    const axom::IndexType cellBase = m_contourCellCorners.size();
+    const axom::IndexType nodeBase = m_contourNodeCoords.size();
+    const axom::IndexType addedNodeCount =
+      DIM * (m_contourCellCount - cellBase);
+    m_contourNodeCoords.resize(nodeBase + addedNodeCount);
     m_contourCellCorners.resize(m_contourCellCount);
     m_contourCellParents.resize(m_contourCellCount);
+    m_contourNodeKeys.resize(m_weldNodes ? addedNodeCount : 0);
+    if(m_computeNormals)
+    {
+      m_contourNodeNormals.resize(nodeBase + addedNodeCount);
+    }
+    m_contourNodeCount = nodeBase + addedNodeCount;
 
     auto nodeCoordsView = m_contourNodeCoords.view();
     auto cellCornersView = m_contourCellCorners.view();
     auto cellParentsView = m_contourCellParents.view();
+    auto nodeKeysView = m_contourNodeKeys.view();
+    auto nodeNormalsView = m_contourNodeNormals.view();
+    const bool weldNodes = m_weldNodes;
+    const bool computeNormals = m_computeNormals;
 
     ComputeContour_Util ccu(m_contourVal,
                             m_caseIds.strides(),
+                            m_bShape,
                             m_fcnView,
                             m_coordsViews);
 
@@ -616,18 +1006,207 @@ public:
         cellParentsView[contourCellId] = crossingInfo.parentCellNum;
         for(int d = 0; d < DIM; ++d)
         {
-          IndexType contourNodeId = contourCellId * DIM + d;
+          const IndexType addedNodeId = (contourCellId - cellBase) * DIM + d;
+          const IndexType contourNodeId = nodeBase + addedNodeId;
           cellCornersView[contourCellId][d] = contourNodeId;
 
           const int edge = cases_table(crossingInfo.caseNum, iCell * DIM + d);
-          ccu.linear_interp(edge,
-                            cornerCoords,
-                            cornerValues,
-                            nodeCoordsView[contourNodeId]);
+          double weight = 0.0;
+          const int snappedCorner =
+            ccu.linear_interp(edge,
+                              cornerCoords,
+                              cornerValues,
+                              nodeCoordsView[contourNodeId],
+                              weight);
+
+          if(weldNodes)
+          {
+            nodeKeysView[addedNodeId] =
+              ccu.node_key(crossingInfo.parentCellNum, edge, snappedCorner);
+          }
+
+          if(computeNormals)
+          {
+            // Parametric coordinates of the new node in the parent cell.
+            int n1, n2;
+            ccu.ordered_edge_corners(edge, n1, n2);
+            double xi[DIM];
+            for(int k = 0; k < DIM; ++k)
+            {
+              xi[k] = ccu.corner_offset(n1, k) +
+                weight * (ccu.corner_offset(n2, k) - ccu.corner_offset(n1, k));
+            }
+
+            Vector& normal = nodeNormalsView[contourNodeId];
+            ccu.compute_gradient(xi, cornerCoords, cornerValues, normal);
+            const double norm = normal.norm();
+            if(norm > 0.0)
+            {
+              normal /= norm;
+            }
+          }
         }
       }
     };
     axom::for_all<ExecSpace>(0, m_crossingCount, loopBody);
+
+    if(m_weldNodes)
+    {
+      weldContourNodes(nodeBase, cellBase);
+    }
+  }
+
+  /*!
+    @brief Share contour nodes that lie on the same parent mesh edge
+    (or parent node), making the contour in this domain watertight.
+    @param nodeBase First contour node of the current contour value
+    @param cellBase First contour cell of the current contour value
+
+    Sorts the contour nodes by their keys, assigns consecutive ids to
+    the unique keys, then compacts the node data and renumbers the
+    contour cell corners.  Only nodes and cells of the current contour
+    value are affected.
+  */
+  void weldContourNodes(axom::IndexType nodeBase, axom::IndexType cellBase)
+  {
+    const axom::IndexType soupNodeCount = m_contourNodeCount - nodeBase;
+    if(soupNodeCount == 0)
+    {
+      return;
+    }
+
+    // Sort (key, soup node id) pairs by key.
+    axom::Array<axom::IndexType, 1, MemorySpace> sortedKeys(m_contourNodeKeys);
+    axom::Array<axom::IndexType, 1, MemorySpace> sortedIds(soupNodeCount,
+                                                           soupNodeCount);
+    auto sortedKeysView = sortedKeys.view();
+    auto sortedIdsView = sortedIds.view();
+    axom::for_all<ExecSpace>(
+      0,
+      soupNodeCount,
+      AXOM_LAMBDA(axom::IndexType n) { sortedIdsView[n] = n; });
+
+  #if defined(AXOM_USE_RAJA)
+    RAJA::sort_pairs<LoopPolicy>(
+      RAJA::make_span(sortedKeysView.data(), soupNodeCount),
+      RAJA::make_span(sortedIdsView.data(), soupNodeCount));
+  #else
+    {
+      std::vector<std::pair<axom::IndexType, axom::IndexType>> pairs(
+        soupNodeCount);
+      for(axom::IndexType n = 0; n < soupNodeCount; ++n)
+      {
+        pairs[n] = {sortedKeysView[n], n};
+      }
+      std::sort(pairs.begin(), pairs.end());
+      for(axom::IndexType n = 0; n < soupNodeCount; ++n)
+      {
+        sortedKeysView[n] = pairs[n].first;
+        sortedIdsView[n] = pairs[n].second;
+      }
+    }
+  #endif
+
+    // Flag the first of each run of equal keys and scan the flags
+    // to number the unique nodes.
+    axom::Array<axom::IndexType, 1, MemorySpace> uniqueFlags(soupNodeCount,
+                                                             soupNodeCount);
+    axom::Array<axom::IndexType, 1, MemorySpace> uniqueIds(soupNodeCount,
+                                                           soupNodeCount);
+    auto uniqueFlagsView = uniqueFlags.view();
+    auto uniqueIdsView = uniqueIds.view();
+    axom::for_all<ExecSpace>(
+      0,
+      soupNodeCount,
+      AXOM_LAMBDA(axom::IndexType n) {
+        uniqueFlagsView[n] =
+          (n == 0 || sortedKeysView[n] != sortedKeysView[n - 1]) ? 1 : 0;
+      });
+
+  #if defined(AXOM_USE_RAJA)
+    RAJA::exclusive_scan<LoopPolicy>(
+      RAJA::make_span(uniqueFlagsView.data(), soupNodeCount),
+      RAJA::make_span(uniqueIdsView.data(), soupNodeCount),
+      RAJA::operators::plus<axom::IndexType> {});
+  #else
+    uniqueIdsView[0] = 0;
+    for(axom::IndexType n = 1; n < soupNodeCount; ++n)
+    {
+      uniqueIdsView[n] = uniqueIdsView[n - 1] + uniqueFlagsView[n - 1];
+    }
+  #endif
+
+    axom::IndexType lastId = 0;
+    axom::IndexType lastFlag = 0;
+    axom::copy(&lastId,
+               uniqueIds.data() + soupNodeCount - 1,
+               sizeof(axom::IndexType));
+    axom::copy(&lastFlag,
+               uniqueFlags.data() + soupNodeCount - 1,
+               sizeof(axom::IndexType));
+    const axom::IndexType uniqueNodeCount = lastId + lastFlag;
+
+    // Map each soup node to its unique node, keeping the data of the
+    // first soup node with each key.  Soup and unique node ids here
+    // are relative to nodeBase.
+    axom::Array<axom::IndexType, 1, MemorySpace> soupToUnique(soupNodeCount,
+                                                              soupNodeCount);
+    axom::Array<Point, 1, MemorySpace> uniqueCoords(uniqueNodeCount,
+                                                    uniqueNodeCount);
+    const axom::IndexType normalCount = m_computeNormals ? uniqueNodeCount : 0;
+    axom::Array<Vector, 1, MemorySpace> uniqueNormals(normalCount, normalCount);
+    auto soupToUniqueView = soupToUnique.view();
+    auto soupCoordsView = m_contourNodeCoords.view();
+    auto soupNormalsView = m_contourNodeNormals.view();
+    auto uniqueCoordsView = uniqueCoords.view();
+    auto uniqueNormalsView = uniqueNormals.view();
+    const bool computeNormals = m_computeNormals;
+    axom::for_all<ExecSpace>(
+      0,
+      soupNodeCount,
+      AXOM_LAMBDA(axom::IndexType n) {
+        // The exclusive scan counts the run's first node for the
+        // other nodes in the run, so take it back out.
+        const axom::IndexType soupId = sortedIdsView[n];
+        const axom::IndexType uniqueId =
+          uniqueIdsView[n] + uniqueFlagsView[n] - 1;
+        soupToUniqueView[soupId] = uniqueId;
+        if(uniqueFlagsView[n])
+        {
+          uniqueCoordsView[uniqueId] = soupCoordsView[nodeBase + soupId];
+          if(computeNormals)
+          {
+            uniqueNormalsView[uniqueId] = soupNormalsView[nodeBase + soupId];
+          }
+        }
+      });
+
+    auto cellCornersView = m_contourCellCorners.view();
+    axom::for_all<ExecSpace>(
+      cellBase,
+      m_contourCellCount,
+      AXOM_LAMBDA(axom::IndexType c) {
+        for(int d = 0; d < DIM; ++d)
+        {
+          cellCornersView[c][d] =
+            nodeBase + soupToUniqueView[cellCornersView[c][d] - nodeBase];
+        }
+      });
+
+    // Replace the soup nodes with the unique nodes.
+    m_contourNodeCoords.resize(nodeBase + uniqueNodeCount);
+    axom::copy(m_contourNodeCoords.data() + nodeBase,
+               uniqueCoords.data(),
+               uniqueNodeCount * sizeof(Point));
+    if(m_computeNormals)
+    {
+      m_contourNodeNormals.resize(nodeBase + uniqueNodeCount);
+      axom::copy(m_contourNodeNormals.data() + nodeBase,
+                 uniqueNormals.data(),
+                 uniqueNodeCount * sizeof(Vector));
+    }
+    m_contourNodeKeys.clear();
+    m_contourNodeCount = nodeBase + uniqueNodeCount;
   }
 
   // These 4 functions provide access to the look-up table
@@ -680,10 +1259,50 @@ public:
 
   /*!
     @brief Output contour mesh to a mint::UnstructuredMesh object.
+
+    The contour is appended to the nodes and cells already in \a mesh.
   */
   void populateContourMesh(
     axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE>& mesh,
-    const std::string& cellIdField) const override
+    const std::string& cellIdField,
+    const std::string& normalField) const override
+  {
+    if(!cellIdField.empty() &&
+       !mesh.hasField(cellIdField, axom::mint::CELL_CENTERED))
+    {
+      mesh.createField<axom::IndexType>(cellIdField,
+                                        axom::mint::CELL_CENTERED,
+                                        DIM);
+    }
+
+    if(!normalField.empty() &&
+       !mesh.hasField(normalField, axom::mint::NODE_CENTERED))
+    {
+      mesh.createField<double>(normalField, axom::mint::NODE_CENTERED, DIM);
+    }
+
+    const axom::IndexType priorCellCount = mesh.getNumberOfCells();
+    const axom::IndexType priorNodeCount = mesh.getNumberOfNodes();
+    mesh.resize(priorNodeCount + m_contourNodeCoords.size(),
+                priorCellCount + m_contourCellCorners.size());
+
+    writeContourMesh(mesh,
+                     cellIdField,
+                     normalField,
+                     priorNodeCount,
+                     priorCellCount);
+  }
+
+  /*!
+    @brief Copy contour mesh into a range of a mint::UnstructuredMesh
+    object that is already sized to hold it.
+  */
+  void writeContourMesh(
+    axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE>& mesh,
+    const std::string& cellIdField,
+    const std::string& normalField,
+    axom::IndexType nodeOffset,
+    axom::IndexType cellOffset) const override
   {
     auto internalAllocatorID = axom::execution_space<ExecSpace>::allocatorID();
     auto hostAllocatorID = axom::execution_space<axom::SEQ_EXEC>::allocatorID();
@@ -694,11 +1313,15 @@ public:
     */
     if(internalAllocatorID == hostAllocatorID)
     {
-      populateContourMesh(mesh,
-                          cellIdField,
-                          m_contourNodeCoords,
-                          m_contourCellCorners,
-                          m_contourCellParents);
+      writeContourMesh(mesh,
+                       cellIdField,
+                       normalField,
+                       nodeOffset,
+                       cellOffset,
+                       m_contourNodeCoords,
+                       m_contourCellCorners,
+                       m_contourCellParents,
+                       m_contourNodeNormals);
     }
     else
     {
@@ -711,63 +1334,103 @@ public:
       axom::Array<IndexType, 1, MemorySpace::Dynamic> contourCellParents(
         m_contourCellParents,
         hostAllocatorID);
-
-      populateContourMesh(mesh,
-                          cellIdField,
-                          contourNodeCoords,
-                          contourCellCorners,
-                          contourCellParents);
+      axom::Array<Vector, 1, MemorySpace::Dynamic> contourNodeNormals(
+        m_contourNodeNormals,
+        hostAllocatorID);
+      writeContourMesh(mesh,
+                       cellIdField,
+                       normalField,
+                       nodeOffset,
+                       cellOffset,
+                       contourNodeCoords,
+                       contourCellCorners,
+                       contourCellParents,
+                       contourNodeNormals);
     }
   }
 
-  //!@brief Output contour mesh to a mint::UnstructuredMesh object.
-  void populateContourMesh(
+  //!@brief Copy host contour data into a range of a mint::UnstructuredMesh.
+  template <axom::MemorySpace HostSpace>
+  void writeContourMesh(
     axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE>& mesh,
     const std::string& cellIdField,
-    const axom::Array<Point, 1, MemorySpace::Dynamic> contourNodeCoords,
-    const axom::Array<MIdx, 1, MemorySpace::Dynamic> contourCellCorners,
-    const axom::Array<IndexType, 1, MemorySpace::Dynamic> contourCellParents) const
+    const std::string& normalField,
+    axom::IndexType nodeOffset,
+    axom::IndexType cellOffset,
+    const axom::Array<Point, 1, HostSpace>& contourNodeCoords,
+    const axom::Array<MIdx, 1, HostSpace>& contourCellCorners,
+    const axom::Array<IndexType, 1, HostSpace>& contourCellParents,
+    const axom::Array<Vector, 1, HostSpace>& contourNodeNormals) const
   {
-    if(!cellIdField.empty() &&
-       !mesh.hasField(cellIdField, axom::mint::CELL_CENTERED))
+    const axom::IndexType addedCellCount = contourCellCorners.size();
+    const axom::IndexType addedNodeCount = contourNodeCoords.size();
+    if(addedCellCount == 0)
     {
-      mesh.createField<axom::IndexType>(cellIdField,
-                                        axom::mint::CELL_CENTERED,
-                                        DIM);
+      return;
     }
 
-    const axom::IndexType addedCellCount = contourCellCorners.size();
-    const axom::IndexType addedNodeCount = contourNodeCoords.size();
-    if(addedCellCount != 0)
+    SLIC_ASSERT(nodeOffset + addedNodeCount <= mesh.getNumberOfNodes());
+    SLIC_ASSERT(cellOffset + addedCellCount <= mesh.getNumberOfCells());
+
+    // mint stores each coordinate component contiguously.
+    for(int d = 0; d < DIM; ++d)
+    {
+      double* coords = mesh.getCoordinateArray(d) + nodeOffset;
+      for(axom::IndexType n = 0; n < addedNodeCount; ++n)
+      {
+        coords[n] = contourNodeCoords[n][d];
+      }
+    }
+
+    // Bump corner indices by nodeOffset to avoid indices
+    // used by other parents domains.
+    axom::IndexType* cellNodes = mesh.getCellNodesArray() + cellOffset * DIM;
+    for(axom::IndexType n = 0; n < addedCellCount; ++n)
+    {
+      for(int d = 0; d < DIM; ++d)
+      {
+        cellNodes[n * DIM + d] = contourCellCorners[n][d] + nodeOffset;
+      }
+    }
+
+    if(!normalField.empty())
     {
-      const axom::IndexType priorCellCount = mesh.getNumberOfCells();
-      const axom::IndexType priorNodeCount = mesh.getNumberOfNodes();
-      mesh.reserveNodes(priorNodeCount + addedNodeCount);
-      mesh.reserveCells(priorCellCount + addedCellCount);
+      SLIC_ASSERT_MSG(contourNodeNormals.size() == addedNodeCount,
+                      "Normals are only available after computing the "
+                      "contour with normals enabled.");
+
+      axom::IndexType numComponents = -1;
+      double* normalPtr = mesh.getFieldPtr<double>(normalField,
+                                                   axom::mint::NODE_CENTERED,
+                                                   numComponents);
+      SLIC_ASSERT(numComponents == DIM);
 
-      mesh.appendNodes((double*)contourNodeCoords.data(),
-                       contourNodeCoords.size());
-      for(int n = 0; n < addedCellCount; ++n)
+      normalPtr += nodeOffset * DIM;
+      for(axom::IndexType n = 0; n < contourNodeNormals.size(); ++n)
       {
-        MIdx cornerIds = contourCellCorners[n];
-        // Bump corner indices by priorNodeCount to avoid indices
-        // used by other parents domains.
-        add_to_StackArray(cornerIds, priorNodeCount);
-        mesh.appendCell(cornerIds);
+        for(int d = 0; d < DIM; ++d)
+        {
+          normalPtr[n * DIM + d] = contourNodeNormals[n][d];
+        }
       }
+    }
+
+    if(!cellIdField.empty())
+    {
       axom::IndexType numComponents = -1;
       axom::IndexType* cellIdPtr =
         mesh.getFieldPtr<axom::IndexType>(cellIdField,
                                           axom::mint::CELL_CENTERED,
                                           numComponents);
       SLIC_ASSERT(numComponents == DIM);
+
       axom::ArrayView<axom::StackArray<axom::IndexType, DIM>> cellIdView(
-        (axom::StackArray<axom::IndexType, DIM>*)cellIdPtr,
-        priorCellCount + addedCellCount);
+        (axom::StackArray<axom::IndexType, DIM>*)cellIdPtr + cellOffset,
+        addedCellCount);
       axom::ArrayIndexer<axom::IndexType, DIM> si(m_caseIds.shape(), 'c');
       for(axom::IndexType i = 0; i < addedCellCount; ++i)
       {
-        cellIdView[priorCellCount + i] = si.toMultiIndex(contourCellParents[i]);
+        cellIdView[i] = si.toMultiIndex(contourCellParents[i]);
       }
     }
   }
@@ -787,14 +1450,20 @@ public:
     return index;
   }
 
-  //!@brief Clear data so you can rerun with a different contour value.
-  void clear()
+  /*!
+    @brief Clear the generated contour so you can rerun with different
+    contour values.  Mesh data from initialize() is kept.
+  */
+  void clear() override
   {
     m_contourNodeCoords.clear();
     m_contourCellCorners.clear();
     m_contourCellParents.clear();
+    m_contourNodeNormals.clear();
+    m_contourNodeKeys.clear();
     m_crossingCount = 0;
     m_contourCellCount = 0;
+    m_contourNodeCount = 0;
   }
 
   /*!
@@ -805,6 +1474,8 @@ public:
     , m_contourNodeCoords(0, 0)
     , m_contourCellCorners(0, 0)
     , m_contourCellParents(0, 0)
+    , m_contourNodeNormals(0, 0)
+    , m_contourNodeKeys(0, 0)
   { }
 
   /*!
@@ -826,6 +1497,9 @@ public:
 private:
   MIdx m_bShape;  //!< @brief Blueprint cell data shape.
 
+  //!@brief Views of the domain set up by initialize(), for field access.
+  std::unique_ptr<axom::quest::MeshViewUtil<DIM, MemorySpace>> m_mvu;
+
   // Views of parent domain data.
   // DIM coordinate components, each on a DIM-dimensional mesh.
   using CoordViews =
@@ -837,6 +1511,14 @@ private:
   //!@brief Crossing case for each computational mesh cell.
   axom::Array<std::uint16_t, DIM, MemorySpace> m_caseIds;
 
+  //!@name Function range in each computational mesh cell.
+  //@{
+  axom::Array<double, DIM, MemorySpace> m_cellFcnMin;
+  axom::Array<double, DIM, MemorySpace> m_cellFcnMax;
+  //!@brief Whether the ranges are current for the function.
+  bool m_useCellRanges = false;
+  //@}
+
   //!@brief Info on every parent cell that crosses the contour surface.
   axom::Array<CrossingInfo, 1, MemorySpace> m_crossings;
 
@@ -850,6 +1532,24 @@ private:
     return m_contourCellCount;
   }
 
+  //!@brief Number of contour surface nodes, after any node sharing.
+  axom::IndexType m_contourNodeCount = 0;
+  axom::IndexType getContourNodeCount() const override
+  {
+    return m_contourNodeCount;
+  }
+
+  //!@brief Whether to share contour nodes on the same parent edge.
+  bool m_weldNodes = false;
+  void setWeldNodes(bool weldNodes) override { m_weldNodes = weldNodes; }
+
+  //!@brief Whether to compute unit normals at contour nodes.
+  bool m_computeNormals = false;
+  void setComputeNormals(bool computeNormals) override
+  {
+    m_computeNormals = computeNormals;
+  }
+
   //!@brief Number of corners (nodes) on each parent cell.
   static constexpr std::uint8_t CELL_CORNER_COUNT = (DIM == 3) ? 8 : 4;
 
@@ -863,6 +1563,12 @@ private:
 
   //!@brief Flat index of computational cell crossing the contour cell.
   axom::Array<IndexType, 1, MemorySpace> m_contourCellParents;
+
+  //!@brief Unit normals (function gradient directions) at contour nodes.
+  axom::Array<Vector, 1, MemorySpace> m_contourNodeNormals;
+
+  //!@brief Parent edge keys of contour nodes, used for sharing nodes.
+  axom::Array<IndexType, 1, MemorySpace> m_contourNodeKeys;
   //@}
 
   double m_contourVal = 0.0;
@@ -105,11 +105,15 @@ struct CandidateFinderBase
    * \param [in] surface_mesh The triangular surface mesh to query.
    * \param [in] intersectionThreshold The tolerance threshold to use for
    *  triangle intersection tests.
+   * \param [in] useExactPredicates Whether the triangle intersection tests
+   *  use filtered exact predicates instead of the tolerance threshold.
    */
   CandidateFinderBase(mint::UnstructuredMesh<mint::SINGLE_SHAPE>* surface_mesh,
-                      double intersectionThreshold)
+                      double intersectionThreshold,
+                      bool useExactPredicates = false)
     : m_surfaceMesh(surface_mesh)
     , m_intersectionThreshold(intersectionThreshold)
+    , m_useExactPredicates(useExactPredicates)
   { }
 
   /*!
@@ -152,6 +156,7 @@ protected:
 
   mint::UnstructuredMesh<mint::SINGLE_SHAPE>* m_surfaceMesh;
   double m_intersectionThreshold;
+  bool m_useExactPredicates;
   int m_ncells;
   axom::Array<detail::Triangle3, 1, Space> m_tris;
   axom::Array<BoxType, 1, Space> m_aabbs;
@@ -271,6 +276,7 @@ void CandidateFinderBase<ExecSpace, FloatType>::findTriMeshIntersections(
     auto v_tris = m_tris.view();
 
     double intersectionThreshold = m_intersectionThreshold;
+    bool useExactPredicates = m_useExactPredicates;
 
     // Perform triangle-triangle tests
     for_all<ExecSpace>(
@@ -281,7 +287,8 @@ void CandidateFinderBase<ExecSpace, FloatType>::findTriMeshIntersections(
         if(primal::intersect(v_tris[index],
                              v_tris[candidate],
                              false,
-                             intersectionThreshold))
+                             intersectionThreshold,
+                             useExactPredicates))
         {
 #ifdef AXOM_USE_RAJA
           auto idx =
@@ -0,0 +1,360 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/quest/detail/VertexWelding.hpp"
+
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/slic/interface/slic.hpp"
+
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
+#endif
+
+// C/C++ includes
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace axom
+{
+namespace quest
+{
+namespace detail
+{
+namespace
+{
+#ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+using HostExecSpace = axom::OMP_EXEC;
+#else
+using HostExecSpace = axom::SEQ_EXEC;
+#endif
+
+using IndexArray = axom::Array<axom::IndexType>;
+using CellIndex = std::int64_t;
+
+/// Bound on the lattice cells along each axis, so that they fit a CellIndex
+const double MAX_LATTICE_CELLS = std::ldexp(1., 62);
+
+/// Writes the exclusive prefix sums of \a in to \a out
+void exclusiveSum(axom::IndexType* in, axom::IndexType* out, axom::IndexType n)
+{
+#ifdef AXOM_USE_RAJA
+  using LoopPolicy = typename axom::execution_space<HostExecSpace>::loop_policy;
+  RAJA::exclusive_scan<LoopPolicy>(RAJA::make_span(in, n),
+                                   RAJA::make_span(out, n),
+                                   RAJA::operators::plus<axom::IndexType> {});
+#else
+  axom::IndexType sum = 0;
+  for(axom::IndexType i = 0; i < n; ++i)
+  {
+    out[i] = sum;
+    sum += in[i];
+  }
+#endif
+}
+
+/// Replaces \a data with its inclusive prefix maxima
+void inclusiveMaxInPlace(axom::IndexType* data, axom::IndexType n)
+{
+#ifdef AXOM_USE_RAJA
+  using LoopPolicy = typename axom::execution_space<HostExecSpace>::loop_policy;
+  RAJA::inclusive_scan_inplace<LoopPolicy>(
+    RAJA::make_span(data, n),
+    RAJA::operators::maximum<axom::IndexType> {});
+#else
+  for(axom::IndexType i = 1; i < n; ++i)
+  {
+    data[i] = std::max(data[i - 1], data[i]);
+  }
+#endif
+}
+
+/// Computes the bounds \a lo and \a hi of the vertices along each axis
+void vertexBounds(const double* x,
+                  const double* y,
+                  const double* z,
+                  axom::IndexType stride,
+                  axom::IndexType n,
+                  double lo[3],
+                  double hi[3])
+{
+  const double* coords[3] = {x, y, z};
+#ifdef AXOM_USE_RAJA
+  using ReducePolicy =
+    typename axom::execution_space<HostExecSpace>::reduce_policy;
+  for(int d = 0; d < 3; ++d)
+  {
+    RAJA::ReduceMin<ReducePolicy, double> lo_d(
+      std::numeric_limits<double>::max());
+    RAJA::ReduceMax<ReducePolicy, double> hi_d(
+      std::numeric_limits<double>::lowest());
+    const double* c = coords[d];
+    axom::for_all<HostExecSpace>(n, [=](axom::IndexType i) {
+      lo_d.min(c[i * stride]);
+      hi_d.max(c[i * stride]);
+    });
+    lo[d] = lo_d.get();
+    hi[d] = hi_d.get();
+  }
+#else
+  for(int d = 0; d < 3; ++d)
+  {
+    lo[d] = std::numeric_limits<double>::max();
+    hi[d] = std::numeric_limits<double>::lowest();
+    for(axom::IndexType i = 0; i < n; ++i)
+    {
+      lo[d] = std::min(lo[d], coords[d][i * stride]);
+      hi[d] = std::max(hi[d], coords[d][i * stride]);
+    }
+  }
+#endif
+}
+
+/*!
+ * \brief Identifies vertices in the same cell of a lattice with spacing
+ *  1 / \a invEps, origin \a origin, shifted by \a shift cells
+ *
+ * Operates on vertices \a subset[k] (or k when \a subset is null),
+ * for 0 <= k < n.  Sets \a pointMap[k] to the welded vertex of vertex k and
+ * \a weldedVerts to the (input) index of each welded vertex's first vertex.
+ *
+ * \return the number of welded vertices
+ */
+axom::IndexType weldOnLattice(const double* x,
+                              const double* y,
+                              const double* z,
+                              axom::IndexType stride,
+                              const axom::IndexType* subset,
+                              axom::IndexType n,
+                              const double origin[3],
+                              double invEps,
+                              double shift,
+                              axom::IndexType* pointMap,
+                              IndexArray& weldedVerts)
+{
+  if(n == 0)
+  {
+    weldedVerts.clear();
+    return 0;
+  }
+
+  // Quantize the vertices relative to the origin; the caller ensures that
+  // the cells are in [0, MAX_LATTICE_CELLS]
+  axom::Array<CellIndex> cellsArray(3 * n, 3 * n);
+  CellIndex* cells = cellsArray.data();
+  const double ox = origin[0], oy = origin[1], oz = origin[2];
+  auto quantize = [=](double coord, double orig) {
+    return static_cast<CellIndex>(std::floor((coord - orig) * invEps + shift));
+  };
+  axom::for_all<HostExecSpace>(n, [=](axom::IndexType k) {
+    const axom::IndexType v = (subset != nullptr ? subset[k] : k) * stride;
+    cells[3 * k] = quantize(x[v], ox);
+    cells[3 * k + 1] = quantize(y[v], oy);
+    cells[3 * k + 2] = quantize(z[v], oz);
+  });
+
+  // Sort the vertices on their cells; ties are broken by index, so the first
+  // vertex of each cell leads its run
+  IndexArray orderArray(n, n);
+  axom::IndexType* order = orderArray.data();
+  axom::for_all<HostExecSpace>(n, [=](axom::IndexType k) { order[k] = k; });
+
+  auto sameCell = [=](axom::IndexType a, axom::IndexType b) {
+    return cells[3 * a] == cells[3 * b] &&
+      cells[3 * a + 1] == cells[3 * b + 1] &&
+      cells[3 * a + 2] == cells[3 * b + 2];
+  };
+  auto cellLess = [=](axom::IndexType a, axom::IndexType b) {
+    for(int d = 0; d < 3; ++d)
+    {
+      if(cells[3 * a + d] != cells[3 * b + d])
+      {
+        return cells[3 * a + d] < cells[3 * b + d];
+      }
+    }
+    return a < b;
+  };
+#ifdef AXOM_USE_RAJA
+  using LoopPolicy = typename axom::execution_space<HostExecSpace>::loop_policy;
+  RAJA::sort<LoopPolicy>(RAJA::make_span(order, n), cellLess);
+#else
+  std::sort(order, order + n, cellLess);
+#endif
+
+  // Find the start of each vertex's run and its first vertex
+  IndexArray runStartArray(n, n);
+  axom::IndexType* runStart = runStartArray.data();
+  axom::for_all<HostExecSpace>(n, [=](axom::IndexType k) {
+    runStart[k] = (k == 0 || !sameCell(order[k - 1], order[k])) ? k : 0;
+  });
+  inclusiveMaxInPlace(runStart, n);
+
+  IndexArray firstArray(n, n);
+  axom::IndexType* first = firstArray.data();
+  axom::for_all<HostExecSpace>(n, [=](axom::IndexType k) {
+    first[order[k]] = order[runStart[k]];
+  });
+
+  // Number the first vertices in input order
+  IndexArray isFirstArray(n, n);
+  IndexArray weldedIdArray(n, n);
+  axom::IndexType* isFirst = isFirstArray.data();
+  axom::IndexType* weldedId = weldedIdArray.data();
+  axom::for_all<HostExecSpace>(n, [=](axom::IndexType k) {
+    isFirst[k] = (first[k] == k) ? 1 : 0;
+  });
+  exclusiveSum(isFirst, weldedId, n);
+
+  const axom::IndexType numWelded = weldedId[n - 1] + isFirst[n - 1];
+  weldedVerts.resize(numWelded);
+  axom::IndexType* welded = weldedVerts.data();
+  axom::for_all<HostExecSpace>(n, [=](axom::IndexType k) {
+    pointMap[k] = weldedId[first[k]];
+    if(isFirst[k])
+    {
+      welded[weldedId[k]] = (subset != nullptr) ? subset[k] : k;
+    }
+  });
+
+  return numWelded;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+void weldVertices(const double* x,
+                  const double* y,
+                  const double* z,
+                  axom::IndexType stride,
+                  axom::IndexType numVerts,
+                  double eps,
+                  IndexArray& vertexMap,
+                  IndexArray& weldedVerts)
+{
+  SLIC_ASSERT_MSG(
+    eps > 0.,
+    "Epsilon must be greater than 0. Passed in value was " << eps);
+
+  vertexMap.resize(numVerts);
+  if(numVerts == 0)
+  {
+    weldedVerts.clear();
+    return;
+  }
+
+  // Put the lattice origin at the lower corner of the vertices' bounding box
+  // and coarsen the lattice if its cells would not fit a CellIndex
+  double lo[3], hi[3];
+  vertexBounds(x, y, z, stride, numVerts, lo, hi);
+  double maxRange = 0.;
+  for(int d = 0; d < 3; ++d)
+  {
+    maxRange = std::max(maxRange, hi[d] - lo[d]);
+  }
+  SLIC_ERROR_IF(!std::isfinite(maxRange),
+                "Cannot weld vertices with non-finite coordinates");
+
+  double invEps = 1. / eps;
+  if(maxRange * invEps >= MAX_LATTICE_CELLS)
+  {
+    invEps = MAX_LATTICE_CELLS / (2. * maxRange);
+    SLIC_WARNING("Welding threshold "
+                 << eps << " is too small for vertices spanning " << maxRange
+                 << ". Using threshold " << 1. / invEps << " instead.");
+  }
+
+  // Weld on the lattice, then weld the results on the shifted lattice
+  IndexArray latticeVerts;
+  const axom::IndexType numLatticeVerts = weldOnLattice(x,
+                                                        y,
+                                                        z,
+                                                        stride,
+                                                        nullptr,
+                                                        numVerts,
+                                                        lo,
+                                                        invEps,
+                                                        0.,
+                                                        vertexMap.data(),
+                                                        latticeVerts);
+
+  IndexArray shiftedMap(numLatticeVerts, numLatticeVerts);
+  weldOnLattice(x,
+                y,
+                z,
+                stride,
+                latticeVerts.data(),
+                numLatticeVerts,
+                lo,
+                invEps,
+                0.5,
+                shiftedMap.data(),
+                weldedVerts);
+
+  axom::IndexType* map = vertexMap.data();
+  const axom::IndexType* shifted = shiftedMap.data();
+  axom::for_all<HostExecSpace>(numVerts, [=](axom::IndexType i) {
+    map[i] = shifted[map[i]];
+  });
+}
+
+//------------------------------------------------------------------------------
+void remapTriangles(const axom::IndexType* conn,
+                    axom::IndexType numTris,
+                    const IndexArray& vertexMap,
+                    IndexArray& weldedConn,
+                    IndexArray& sourceTris)
+{
+  if(numTris == 0)
+  {
+    weldedConn.clear();
+    sourceTris.clear();
+    return;
+  }
+
+  // Map the vertices and flag the triangles that remain non-degenerate
+  IndexArray mappedArray(3 * numTris, 3 * numTris);
+  IndexArray keepArray(numTris, numTris);
+  IndexArray offsetArray(numTris, numTris);
+  axom::IndexType* mapped = mappedArray.data();
+  axom::IndexType* keep = keepArray.data();
+  axom::IndexType* offsets = offsetArray.data();
+  const axom::IndexType* map = vertexMap.data();
+
+  axom::for_all<HostExecSpace>(numTris, [=](axom::IndexType t) {
+    axom::IndexType* tri = mapped + 3 * t;
+    for(int j = 0; j < 3; ++j)
+    {
+      tri[j] = map[conn != nullptr ? conn[3 * t + j] : 3 * t + j];
+    }
+    const bool isDistinct =
+      (tri[0] != tri[1] && tri[1] != tri[2] && tri[2] != tri[0]);
+    keep[t] = isDistinct ? 1 : 0;
+  });
+  exclusiveSum(keep, offsets, numTris);
+
+  // Compact the remaining triangles
+  const axom::IndexType numKept = offsets[numTris - 1] + keep[numTris - 1];
+  weldedConn.resize(3 * numKept);
+  sourceTris.resize(numKept);
+  axom::IndexType* outConn = weldedConn.data();
+  axom::IndexType* source = sourceTris.data();
+  axom::for_all<HostExecSpace>(numTris, [=](axom::IndexType t) {
+    if(keep[t])
+    {
+      const axom::IndexType o = offsets[t];
+      for(int j = 0; j < 3; ++j)
+      {
+        outConn[3 * o + j] = mapped[3 * t + j];
+      }
+      source[o] = t;
+    }
+  });
+}
+
+}  // namespace detail
+}  // namespace quest
+}  // namespace axom
@@ -0,0 +1,86 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * \file VertexWelding.hpp
+ *
+ * \brief Helper functions for welding nearby vertices of triangle meshes
+ */
+
+#ifndef AXOM_QUEST_VERTEX_WELDING_HPP_
+#define AXOM_QUEST_VERTEX_WELDING_HPP_
+
+#include "axom/config.hpp"
+#include "axom/core/Array.hpp"
+#include "axom/core/Types.hpp"
+
+namespace axom
+{
+namespace quest
+{
+namespace detail
+{
+/*!
+ * \brief Identifies vertices that are closer than \a eps
+ *
+ * \param [in] x pointer to the x-coordinate of the first vertex
+ * \param [in] y pointer to the y-coordinate of the first vertex
+ * \param [in] z pointer to the z-coordinate of the first vertex
+ * \param [in] stride the distance between the coordinates of consecutive
+ *  vertices, e.g. 1 for separate coordinate arrays, 3 for interleaved ones
+ * \param [in] numVerts the number of vertices
+ * \param [in] eps the welding threshold (under the max norm)
+ * \param [out] vertexMap the index of the welded vertex of each input vertex
+ * \param [out] weldedVerts the input vertex whose coordinates each welded
+ *  vertex takes
+ *
+ * The vertices are quantized to an integer lattice with spacing \a eps, and
+ * vertices in the same lattice cell are identified by sorting them on their
+ * cells.  This is done twice, the second time on a lattice shifted by half
+ * the spacing, so vertices up to 1.5 * \a eps apart may be identified.
+ * The lattice origin is the lower corner of the vertices' bounding box.  If
+ * the box is more than 2^62 * \a eps wide, the lattice cells would overflow a
+ * 64-bit index, so a warning is logged and a larger spacing is used instead.
+ *
+ * Each welded vertex takes the coordinates of the first of its input vertices
+ * and the welded vertices are numbered in the order of their first input
+ * vertex, so the results do not depend on the number of threads.  The work is
+ * done in parallel when Axom is configured with OpenMP.
+ *
+ * \pre eps > 0
+ */
+void weldVertices(const double* x,
+                  const double* y,
+                  const double* z,
+                  axom::IndexType stride,
+                  axom::IndexType numVerts,
+                  double eps,
+                  axom::Array<axom::IndexType>& vertexMap,
+                  axom::Array<axom::IndexType>& weldedVerts);
+
+/*!
+ * \brief Reindexes triangles through a vertex map, removing degenerate ones
+ *
+ * \param [in] conn the triangle connectivity, or nullptr for a "soup of
+ *  triangles" where the vertices of triangle i are 3i, 3i+1 and 3i+2
+ * \param [in] numTris the number of triangles
+ * \param [in] vertexMap the new index of each vertex
+ * \param [out] weldedConn the connectivity of the remaining triangles
+ * \param [out] sourceTris the input triangle of each remaining triangle
+ *
+ * Triangles without three distinct vertices after the mapping are removed.
+ * The remaining triangles keep their relative order.
+ */
+void remapTriangles(const axom::IndexType* conn,
+                    axom::IndexType numTris,
+                    const axom::Array<axom::IndexType>& vertexMap,
+                    axom::Array<axom::IndexType>& weldedConn,
+                    axom::Array<axom::IndexType>& sourceTris);
+
+}  // namespace detail
+}  // namespace quest
+}  // namespace axom
+
+#endif  // AXOM_QUEST_VERTEX_WELDING_HPP_
@@ -0,0 +1,561 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * \file InOutOctreeSerializer.hpp
+ *
+ * \brief Defines helper class to save and load a generated InOutOctree
+ */
+
+#ifndef AXOM_QUEST_INOUT_OCTREE_SERIALIZER__HPP_
+#define AXOM_QUEST_INOUT_OCTREE_SERIALIZER__HPP_
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/primal.hpp"
+
+#include "BlockData.hpp"
+#include "MeshWrapper.hpp"
+
+#include "axom/fmt.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace axom
+{
+namespace quest
+{
+// Predeclare InOutOctree class
+template <int DIM>
+class InOutOctree;
+
+namespace detail
+{
+/**
+ * \class InOutOctreeSerializer
+ * \brief Writes a generated InOutOctree to a binary file and restores it
+ *
+ * The file contains a header, the reindexed surface mesh (vertex positions
+ * and cell connectivity), the blocks of each octree level along with their
+ * InOutBlockData, the vertex-to-block map, and the relations from
+ * the gray leaf blocks of each level to the mesh vertices and cells.
+ *
+ * The header records a hash of the input surface mesh, as well as the
+ * octree's bounding box and vertex welding threshold. A file is only
+ * loaded when these match the octree being restored, so stale caches are
+ * rejected and the caller can fall back to InOutOctree::generateIndex().
+ *
+ * \note The format uses the native byte order and type sizes, which are
+ * checked when the file is read.
+ */
+template <int DIM>
+class InOutOctreeSerializer
+{
+public:
+  using InOutOctreeType = InOutOctree<DIM>;
+  using GeometricBoundingBox = typename InOutOctreeType::GeometricBoundingBox;
+  using SpacePt = typename InOutOctreeType::SpacePt;
+  using GridPt = typename InOutOctreeType::GridPt;
+  using BlockIndex = typename InOutOctreeType::BlockIndex;
+  using CoordType = typename GridPt::CoordType;
+  using VertexIndex = typename InOutOctreeType::VertexIndex;
+
+  /// Increment when the file layout changes
+  static constexpr std::int32_t FORMAT_VERSION = 1;
+
+private:
+  static constexpr char MAGIC[8] = {'A', 'X', 'O', 'M', 'I', 'O', 'O', 'T'};
+
+  /// Fixed-size header of a serialized InOutOctree
+  struct Header
+  {
+    char magic[8];
+    std::int32_t version;
+    std::int32_t dimension;
+    std::int32_t indexTypeSize;
+    std::int32_t coordTypeSize;
+    std::uint64_t meshHash;
+    double vertexWeldThresholdSquared;
+    double boundingBoxScaleFactor;
+    double bbMin[DIM];
+    double bbMax[DIM];
+  };
+
+  /// The blocks and gray leaf relations for one level of the octree
+  struct LevelData
+  {
+    std::vector<CoordType> gridPts;
+    std::vector<std::int32_t> blockData;
+    std::vector<VertexIndex> grayVertices;
+    std::vector<VertexIndex> grayCellOffsets;
+    std::vector<VertexIndex> grayCells;
+  };
+
+public:
+  /**
+   * \brief Writes the octree to the binary file \a fileName
+   *
+   * \param [in] octree A generated InOutOctree
+   * \param [in] fileName The path to the output file
+   * \return True if the file was written successfully, false otherwise
+   */
+  static bool write(const InOutOctreeType& octree, const std::string& fileName)
+  {
+    if(octree.m_generationState != InOutOctreeType::INOUTOCTREE_LEAVES_COLORED)
+    {
+      SLIC_WARNING("Can only save an InOutOctree after generating its index.");
+      return false;
+    }
+
+    std::ofstream ofs(fileName, std::ios::binary);
+    if(!ofs)
+    {
+      SLIC_WARNING(
+        fmt::format("Could not open file '{}' to save InOutOctree", fileName));
+      return false;
+    }
+
+    // Header
+    Header header = makeHeader(octree, octree.m_meshHash);
+    writeValue(ofs, header);
+
+    // Reindexed surface mesh
+    const auto& meshWrapper = octree.m_meshWrapper;
+    const int numVerts = meshWrapper.numMeshVertices();
+    std::vector<double> positions(DIM * numVerts);
+    for(int i = 0; i < numVerts; ++i)
+    {
+      const SpacePt& pt = meshWrapper.vertexPosition(i);
+      for(int d = 0; d < DIM; ++d)
+      {
+        positions[DIM * i + d] = pt[d];
+      }
+    }
+    writeVector(ofs, positions);
+    writeVector(ofs, meshWrapper.cellVertexData());
+
+    // Octree blocks and gray leaf relations, level by level
+    std::int32_t numLevels = 0;
+    while(numLevels < octree.maxLeafLevel() &&
+          !octree.getOctreeLevel(numLevels).empty())
+    {
+      ++numLevels;
+    }
+    writeValue(ofs, numLevels);
+
+    for(int lev = 0; lev < numLevels; ++lev)
+    {
+      LevelData levelData;
+
+      const auto& levelMap = octree.getOctreeLevel(lev);
+      for(auto it = levelMap.begin(); it != levelMap.end(); ++it)
+      {
+        const GridPt pt = it.pt();
+        for(int d = 0; d < DIM; ++d)
+        {
+          levelData.gridPts.push_back(pt[d]);
+        }
+        levelData.blockData.push_back((*it).dataIndex());
+      }
+
+      const auto& grayLeafs = octree.m_grayLeafsMap[lev];
+      const auto& gvRel = octree.m_grayLeafToVertexRelationLevelMap[lev];
+      const auto& geRel = octree.m_grayLeafToElementRelationLevelMap[lev];
+      levelData.grayCellOffsets.push_back(0);
+      for(int i = 0; i < grayLeafs.size(); ++i)
+      {
+        levelData.grayVertices.push_back(gvRel[i][0]);
+        for(auto cIdx : geRel[i])
+        {
+          levelData.grayCells.push_back(cIdx);
+        }
+        levelData.grayCellOffsets.push_back(
+          static_cast<VertexIndex>(levelData.grayCells.size()));
+      }
+
+      writeVector(ofs, levelData.gridPts);
+      writeVector(ofs, levelData.blockData);
+      writeVector(ofs, levelData.grayVertices);
+      writeVector(ofs, levelData.grayCellOffsets);
+      writeVector(ofs, levelData.grayCells);
+    }
+
+    // Map from mesh vertices to their octree blocks
+    std::vector<CoordType> vertexBlocks((DIM + 1) * numVerts);
+    for(int i = 0; i < numVerts; ++i)
+    {
+      const BlockIndex& blk = octree.m_vertexToBlockMap[i];
+      for(int d = 0; d < DIM; ++d)
+      {
+        vertexBlocks[(DIM + 1) * i + d] = blk.pt()[d];
+      }
+      vertexBlocks[(DIM + 1) * i + DIM] = blk.level();
+    }
+    writeVector(ofs, vertexBlocks);
+
+    if(!ofs)
+    {
+      SLIC_WARNING(
+        fmt::format("Error while saving InOutOctree to file '{}'", fileName));
+      return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief Restores the octree from the binary file \a fileName
+   *
+   * \param [inout] octree An InOutOctree whose index has not been generated
+   * \param [in] fileName The path to the input file
+   * \return True if the octree was restored, false otherwise. The octree is
+   * not modified when this function returns false, e.g. when the file is
+   * missing, corrupt or was generated from a different surface mesh
+   */
+  static bool read(InOutOctreeType& octree, const std::string& fileName)
+  {
+    if(octree.m_generationState != InOutOctreeType::INOUTOCTREE_UNINITIALIZED)
+    {
+      SLIC_WARNING("Can only load an InOutOctree before generating its index.");
+      return false;
+    }
+
+    std::ifstream ifs(fileName, std::ios::binary);
+    if(!ifs)
+    {
+      SLIC_INFO(fmt::format("Could not open InOutOctree file '{}' for reading",
+                            fileName));
+      return false;
+    }
+
+    // Read and validate the header
+    Header header;
+    if(!readValue(ifs, header) ||
+       std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+       header.version != FORMAT_VERSION)
+    {
+      SLIC_WARNING(fmt::format(
+        "File '{}' is not a valid (version {}) InOutOctree file",
+        fileName,
+        FORMAT_VERSION));
+      return false;
+    }
+
+    const std::uint64_t meshHash = octree.m_meshWrapper.computeMeshHash();
+    const Header expected = makeHeader(octree, meshHash);
+    if(header.dimension != expected.dimension ||
+       header.indexTypeSize != expected.indexTypeSize ||
+       header.coordTypeSize != expected.coordTypeSize)
+    {
+      SLIC_WARNING(fmt::format(
+        "InOutOctree file '{}' was generated with different dimension or "
+        "type sizes",
+        fileName));
+      return false;
+    }
+    if(header.meshHash != expected.meshHash ||
+       header.vertexWeldThresholdSquared !=
+         expected.vertexWeldThresholdSquared ||
+       header.boundingBoxScaleFactor != expected.boundingBoxScaleFactor ||
+       std::memcmp(header.bbMin, expected.bbMin, sizeof(header.bbMin)) != 0 ||
+       std::memcmp(header.bbMax, expected.bbMax, sizeof(header.bbMax)) != 0)
+    {
+      SLIC_WARNING(fmt::format(
+        "InOutOctree file '{}' is stale: it does not match the current "
+        "surface mesh, bounding box or vertex welding threshold",
+        fileName));
+      return false;
+    }
+
+    // Read all data before modifying the octree
+    std::vector<double> positions;
+    std::vector<VertexIndex> cellVertices;
+    std::int32_t numLevels = 0;
+    bool ok = readVector(ifs, positions) && readVector(ifs, cellVertices) &&
+      readValue(ifs, numLevels);
+    ok = ok && numLevels > 0 && numLevels <= octree.maxLeafLevel() &&
+      positions.size() % DIM == 0;
+
+    std::vector<LevelData> levels(ok ? numLevels : 0);
+    for(auto& levelData : levels)
+    {
+      ok = ok && readVector(ifs, levelData.gridPts) &&
+        readVector(ifs, levelData.blockData) &&
+        readVector(ifs, levelData.grayVertices) &&
+        readVector(ifs, levelData.grayCellOffsets) &&
+        readVector(ifs, levelData.grayCells);
+      ok = ok &&
+        levelData.gridPts.size() == DIM * levelData.blockData.size() &&
+        levelData.grayCellOffsets.size() == levelData.grayVertices.size() + 1;
+    }
+
+    std::vector<CoordType> vertexBlocks;
+    ok = ok && readVector(ifs, vertexBlocks) &&
+      vertexBlocks.size() == (DIM + 1) * (positions.size() / DIM);
+
+    // Check the indices before they are used to restore the octree
+    ok = ok &&
+      hasValidContents(octree, positions, cellVertices, levels, vertexBlocks);
+
+    if(!ok)
+    {
+      SLIC_WARNING(
+        fmt::format("Error while reading InOutOctree file '{}'", fileName));
+      return false;
+    }
+
+    // Restore the reindexed mesh
+    const int numVerts = static_cast<int>(positions.size() / DIM);
+    octree.m_meshWrapper.restoreMesh(numVerts,
+                                     positions,
+                                     std::move(cellVertices));
+
+    // Restore the octree blocks; refining internal blocks adds their children
+    for(int lev = 0; lev < numLevels; ++lev)
+    {
+      LevelData& levelData = levels[lev];
+
+      const int numBlocks = static_cast<int>(levelData.blockData.size());
+      for(int i = 0; i < numBlocks; ++i)
+      {
+        const BlockIndex blk(GridPt(&levelData.gridPts[DIM * i], DIM), lev);
+        const InOutBlockData data(levelData.blockData[i]);
+
+        if(!data.isBlock())
+        {
+          continue;
+        }
+        else if(!data.isLeaf())
+        {
+          octree.refineLeaf(blk);
+        }
+        else
+        {
+          octree[blk] = data;
+        }
+      }
+
+      // The relations reference buffers owned by the octree's registry
+      auto& gvRelData = octree.m_indexRegistry.addNamelessBuffer();
+      auto& geIndRelData = octree.m_indexRegistry.addNamelessBuffer();
+      auto& geSizeRelData = octree.m_indexRegistry.addNamelessBuffer();
+      gvRelData.swap(levelData.grayVertices);
+      geIndRelData.swap(levelData.grayCells);
+      geSizeRelData.swap(levelData.grayCellOffsets);
+
+      octree.bindGrayLeafRelations(lev, gvRelData, geIndRelData, geSizeRelData);
+    }
+
+    // Restore the map from mesh vertices to their octree blocks
+    octree.m_vertexToBlockMap = typename InOutOctreeType::VertexBlockMap(
+      &octree.m_meshWrapper.vertexSet());
+    for(int i = 0; i < numVerts; ++i)
+    {
+      const CoordType* blk = &vertexBlocks[(DIM + 1) * i];
+      octree.m_vertexToBlockMap[i] =
+        BlockIndex(GridPt(blk, DIM), static_cast<int>(blk[DIM]));
+    }
+
+    octree.m_meshHash = meshHash;
+    octree.m_generationState = InOutOctreeType::INOUTOCTREE_LEAVES_COLORED;
+
+    return true;
+  }
+
+private:
+  /// Fills in a header for \a octree using the given mesh hash
+  static Header makeHeader(const InOutOctreeType& octree,
+                           std::uint64_t meshHash)
+  {
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = FORMAT_VERSION;
+    header.dimension = DIM;
+    header.indexTypeSize = sizeof(VertexIndex);
+    header.coordTypeSize = sizeof(CoordType);
+    header.meshHash = meshHash;
+    header.vertexWeldThresholdSquared = octree.m_vertexWeldThresholdSquared;
+    header.boundingBoxScaleFactor = octree.m_boundingBoxScaleFactor;
+
+    const GeometricBoundingBox& bb = octree.boundingBox();
+    for(int d = 0; d < DIM; ++d)
+    {
+      header.bbMin[d] = bb.getMin()[d];
+      header.bbMax[d] = bb.getMax()[d];
+    }
+
+    return header;
+  }
+
+  /**
+   * \brief Checks that the indices read from a file are in range
+   *
+   * The reindexed mesh can have at most as many vertices and cells as the
+   * octree's surface mesh. Cell vertices, gray leaf vertices and gray leaf
+   * cells must index into the reindexed mesh, the gray leaf cell offsets
+   * must be nondecreasing and cover all gray leaf cells, and the blocks must
+   * lie on the levels and grids of the octree.
+   */
+  static bool hasValidContents(const InOutOctreeType& octree,
+                               const std::vector<double>& positions,
+                               const std::vector<VertexIndex>& cellVertices,
+                               const std::vector<LevelData>& levels,
+                               const std::vector<CoordType>& vertexBlocks)
+  {
+    constexpr int NUM_CELL_VERTS = MeshWrapper<DIM>::NUM_CELL_VERTS;
+    const auto& meshWrapper = octree.m_meshWrapper;
+
+    const std::size_t numVerts = positions.size() / DIM;
+    const std::size_t numCells = cellVertices.size() / NUM_CELL_VERTS;
+    if(cellVertices.size() % NUM_CELL_VERTS != 0 ||
+       numVerts > static_cast<std::size_t>(meshWrapper.numMeshVertices()) ||
+       numCells > static_cast<std::size_t>(meshWrapper.numMeshCells()))
+    {
+      return false;
+    }
+
+    auto inRange = [](VertexIndex idx, std::size_t size) {
+      return idx >= 0 && static_cast<std::size_t>(idx) < size;
+    };
+    auto isValidBlock = [](const CoordType* pt, int lev) {
+      for(int d = 0; d < DIM; ++d)
+      {
+        if(pt[d] < 0 || pt[d] >= (CoordType(1) << lev))
+        {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    for(auto vIdx : cellVertices)
+    {
+      if(!inRange(vIdx, numVerts))
+      {
+        return false;
+      }
+    }
+
+    const int numLevels = static_cast<int>(levels.size());
+    for(int lev = 0; lev < numLevels; ++lev)
+    {
+      const LevelData& levelData = levels[lev];
+      const std::size_t numGrayLeaves = levelData.grayVertices.size();
+
+      for(std::size_t i = 0; i < levelData.blockData.size(); ++i)
+      {
+        const InOutBlockData data(levelData.blockData[i]);
+        if(!isValidBlock(&levelData.gridPts[DIM * i], lev) ||
+           (data.hasData() && !inRange(data.dataIndex(), numGrayLeaves)))
+        {
+          return false;
+        }
+      }
+
+      for(auto vIdx : levelData.grayVertices)
+      {
+        if(vIdx != MeshWrapper<DIM>::NO_VERTEX && !inRange(vIdx, numVerts))
+        {
+          return false;
+        }
+      }
+
+      const auto& offsets = levelData.grayCellOffsets;
+      if(offsets.front() != 0 ||
+         static_cast<std::size_t>(offsets.back()) !=
+           levelData.grayCells.size() ||
+         !std::is_sorted(offsets.begin(), offsets.end()))
+      {
+        return false;
+      }
+
+      for(auto cIdx : levelData.grayCells)
+      {
+        if(!inRange(cIdx, numCells))
+        {
+          return false;
+        }
+      }
+    }
+
+    for(std::size_t i = 0; i < numVerts; ++i)
+    {
+      const CoordType* blk = &vertexBlocks[(DIM + 1) * i];
+      if(blk[DIM] < 0 || blk[DIM] >= numLevels || !isValidBlock(blk, blk[DIM]))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  template <typename T>
+  static void writeValue(std::ostream& os, const T& val)
+  {
+    os.write(reinterpret_cast<const char*>(&val), sizeof(T));
+  }
+
+  template <typename T>
+  static void writeVector(std::ostream& os, const std::vector<T>& vec)
+  {
+    const std::uint64_t size = vec.size();
+    writeValue(os, size);
+    if(size > 0)
+    {
+      os.write(reinterpret_cast<const char*>(vec.data()), size * sizeof(T));
+    }
+  }
+
+  template <typename T>
+  static bool readValue(std::istream& is, T& val)
+  {
+    is.read(reinterpret_cast<char*>(&val), sizeof(T));
+    return static_cast<bool>(is);
+  }
+
+  template <typename T>
+  static bool readVector(std::istream& is, std::vector<T>& vec)
+  {
+    std::uint64_t size = 0;
+    if(!readValue(is, size))
+    {
+      return false;
+    }
+
+    // Guard against corrupt sizes before allocating
+    const auto pos = is.tellg();
+    is.seekg(0, std::ios::end);
+    const auto remaining = static_cast<std::uint64_t>(is.tellg() - pos);
+    is.seekg(pos);
+    if(size > remaining / sizeof(T))
+    {
+      return false;
+    }
+
+    vec.resize(size);
+    if(size > 0)
+    {
+      is.read(reinterpret_cast<char*>(vec.data()), size * sizeof(T));
+    }
+    return static_cast<bool>(is);
+  }
+};
+
+template <int DIM>
+constexpr char InOutOctreeSerializer<DIM>::MAGIC[8];
+
+}  // namespace detail
+}  // namespace quest
+}  // namespace axom
+
+#endif  // AXOM_QUEST_INOUT_OCTREE_SERIALIZER__HPP_
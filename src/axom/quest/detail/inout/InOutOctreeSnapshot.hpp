@@ -0,0 +1,326 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * \file InOutOctreeSnapshot.hpp
+ *
+ * \brief Defines a flattened, read-only snapshot of a generated InOutOctree
+ * for batched containment queries
+ */
+
+#ifndef AXOM_QUEST_INOUT_OCTREE_SNAPSHOT__HPP_
+#define AXOM_QUEST_INOUT_OCTREE_SNAPSHOT__HPP_
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/primal.hpp"
+#include "axom/spin.hpp"
+
+#include "BlockData.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace axom
+{
+namespace quest
+{
+// Predeclare InOutOctree class
+template <int DIM>
+class InOutOctree;
+
+namespace detail
+{
+/**
+ * \class InOutOctreeSnapshot
+ * \brief A flattened, read-only copy of the blocks of a generated InOutOctree
+ *
+ * The blocks of each octree level are stored in a pair of parallel arrays
+ * (Morton keys and block data) sorted by their Morton keys. Since the Morton
+ * key of a block at a coarser level is a bit-shift of the Morton key of its
+ * descendants, a query point only needs to be quantized once, at the finest
+ * level of the tree.
+ *
+ * Batched queries sort their points along the Morton curve and process them
+ * in contiguous chunks. Consecutive points in a chunk tend to fall in the
+ * same leaf block, so each chunk caches its most recent leaf and reuses it
+ * whenever the next point's key shares its prefix. Gray leaf blocks are
+ * resolved using the octree's (already flattened) gray leaf relations.
+ *
+ * \note The snapshot is only valid when the deepest level of the octree can
+ * be represented in a 64-bit Morton index. Callers should check isValid()
+ * and fall back to InOutOctree::within() for individual points otherwise.
+ */
+template <int DIM>
+class InOutOctreeSnapshot
+{
+public:
+  using InOutOctreeType = InOutOctree<DIM>;
+  using SpacePt = typename InOutOctreeType::SpacePt;
+  using GridPt = typename InOutOctreeType::GridPt;
+  using BlockIndex = typename InOutOctreeType::BlockIndex;
+  using CoordType = typename GridPt::CoordType;
+
+  using MortonIndexType = std::uint64_t;
+  using Mortonizer = spin::Mortonizer<CoordType, MortonIndexType, DIM>;
+
+  /// Number of sorted points processed by each task in a batched query
+  static constexpr IndexType CHUNK_SIZE = 1024;
+
+private:
+  /// Sorted Morton keys and associated block data for one level of the octree
+  struct LevelData
+  {
+    std::vector<MortonIndexType> keys;
+    std::vector<InOutBlockData> data;
+  };
+
+  /// The most recently found leaf block within a chunk of sorted queries
+  struct CachedLeaf
+  {
+    int level {-1};
+    MortonIndexType key {0};
+    InOutBlockData data;
+  };
+
+public:
+  /**
+   * \brief Constructs a snapshot from the blocks of a generated octree
+   *
+   * \param [in] octree The InOutOctree whose blocks we are copying
+   * \pre The octree's leaves have all been colored
+   */
+  InOutOctreeSnapshot(const InOutOctreeType& octree) : m_octree(octree)
+  {
+    using Timer = axom::utilities::Timer;
+    Timer timer(true);
+
+    const int maxBits = Mortonizer::maxBitsPerCoord();
+    for(int lev = 0; lev < m_octree.maxLeafLevel(); ++lev)
+    {
+      const auto& levelMap = m_octree.getOctreeLevel(lev);
+      if(levelMap.empty())
+      {
+        break;
+      }
+
+      if(lev >= maxBits)
+      {
+        SLIC_DEBUG(
+          fmt::format("InOutOctree has blocks at level {}, which is too deep "
+                      "for a {}-bit Morton index. Batched queries will use the "
+                      "standard point-wise query.",
+                      lev,
+                      8 * sizeof(MortonIndexType)));
+        m_levels.clear();
+        return;
+      }
+
+      // Gather the (key, data) pairs for the blocks of this level
+      std::vector<std::pair<MortonIndexType, InOutBlockData>> blocks;
+      blocks.reserve(levelMap.numBlocks());
+      for(auto it = levelMap.begin(); it != levelMap.end(); ++it)
+      {
+        blocks.emplace_back(Mortonizer::mortonize(it.pt()), *it);
+      }
+      std::sort(blocks.begin(),
+                blocks.end(),
+                [](const std::pair<MortonIndexType, InOutBlockData>& a,
+                   const std::pair<MortonIndexType, InOutBlockData>& b) {
+                  return a.first < b.first;
+                });
+
+      m_levels.emplace_back();
+      LevelData& levelData = m_levels.back();
+      levelData.keys.reserve(blocks.size());
+      levelData.data.reserve(blocks.size());
+      for(const auto& blk : blocks)
+      {
+        levelData.keys.push_back(blk.first);
+        levelData.data.push_back(blk.second);
+      }
+    }
+
+    timer.stop();
+    SLIC_DEBUG(
+      fmt::format("\t--Generating query snapshot with {} levels took {} "
+                  "seconds.",
+                  m_levels.size(),
+                  timer.elapsed()));
+  }
+
+  /// Predicate to check whether the snapshot can be used for queries
+  bool isValid() const { return !m_levels.empty(); }
+
+  /// Returns the number of levels in the snapshot
+  int numLevels() const { return static_cast<int>(m_levels.size()); }
+
+  /**
+   * \brief Batched point containment query
+   *
+   * \param [in] pts The query points
+   * \param [out] containment Set to 1 for points inside the surface,
+   * and to 0 otherwise
+   *
+   * \pre isValid() is true
+   * \pre containment.size() >= pts.size()
+   */
+  void within(axom::ArrayView<const SpacePt> pts,
+              axom::ArrayView<int> containment) const
+  {
+    SLIC_ASSERT(isValid());
+    SLIC_ASSERT(containment.size() >= pts.size());
+
+    const IndexType npts = pts.size();
+    const int finestLevel = numLevels() - 1;
+
+    // Quantize the points at the finest level and sort them along the Morton
+    // curve. Points outside the octree are assigned the largest key
+    using KeyIndexPair = std::pair<MortonIndexType, IndexType>;
+    std::vector<KeyIndexPair> order(npts);
+    const auto& bbox = m_octree.boundingBox();
+    constexpr MortonIndexType OUTSIDE_KEY = ~MortonIndexType(0);
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+    for(IndexType i = 0; i < npts; ++i)
+    {
+      const SpacePt& pt = pts[i];
+      order[i].first = bbox.contains(pt)
+        ? Mortonizer::mortonize(m_octree.findGridCellAtLevel(pt, finestLevel))
+        : OUTSIDE_KEY;
+      order[i].second = i;
+    }
+
+    std::sort(order.begin(), order.end());
+
+    // Process the sorted points in chunks, caching the most recent leaf,
+    // and scatter the results back to the original ordering
+    const IndexType numChunks = (npts + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic)
+#endif
+    for(IndexType c = 0; c < numChunks; ++c)
+    {
+      const IndexType chunkEnd = std::min(npts, (c + 1) * CHUNK_SIZE);
+
+      CachedLeaf cache;
+      for(IndexType s = c * CHUNK_SIZE; s < chunkEnd; ++s)
+      {
+        const MortonIndexType key = order[s].first;
+        const IndexType idx = order[s].second;
+
+        if(key == OUTSIDE_KEY)
+        {
+          containment[idx] = 0;
+          continue;
+        }
+
+        if(cache.level < 0 ||
+           (key >> (DIM * (finestLevel - cache.level))) != cache.key)
+        {
+          findLeaf(key, cache);
+        }
+
+        containment[idx] = withinLeaf(pts[idx], cache) ? 1 : 0;
+      }
+    }
+  }
+
+private:
+  /**
+   * \brief Finds the leaf block covering the point with Morton key \a key
+   *
+   * Uses a binary search over the levels, starting from the level of the
+   * previously found leaf, if available.
+   *
+   * \param [in] key The Morton key of the query point at the finest level
+   * \param [inout] cache The most recently found leaf, updated to the new leaf
+   */
+  void findLeaf(MortonIndexType key, CachedLeaf& cache) const
+  {
+    const int finestLevel = numLevels() - 1;
+
+    int minLev = 0;
+    int maxLev = finestLevel;
+    int lev = cache.level >= 0 ? cache.level : (maxLev >> 1);
+
+    while(minLev <= maxLev)
+    {
+      const LevelData& levelData = m_levels[lev];
+      const MortonIndexType levKey = key >> (DIM * (finestLevel - lev));
+
+      auto it =
+        std::lower_bound(levelData.keys.begin(), levelData.keys.end(), levKey);
+
+      if(it == levelData.keys.end() || *it != levKey)
+      {
+        // Block must be in coarser levels -- update upper bound
+        maxLev = lev - 1;
+      }
+      else
+      {
+        const InOutBlockData& data = levelData.data[it - levelData.keys.begin()];
+        if(data.isLeaf())
+        {
+          cache.level = lev;
+          cache.key = levKey;
+          cache.data = data;
+          return;
+        }
+
+        // Block must be in deeper levels -- update lower bound
+        minLev = lev + 1;
+      }
+      lev = (maxLev + minLev) >> 1;
+    }
+
+    SLIC_ASSERT_MSG(false, "Query point not found in a leaf block of the octree");
+    cache = CachedLeaf {};
+  }
+
+  /// Containment query for point \a pt within the (cached) leaf block
+  bool withinLeaf(const SpacePt& pt, const CachedLeaf& leaf) const
+  {
+    if(leaf.level < 0)
+    {
+      return false;
+    }
+
+    switch(leaf.data.color())
+    {
+    case InOutBlockData::Black:
+      return true;
+    case InOutBlockData::White:
+      return false;
+    case InOutBlockData::Gray:
+    {
+      const BlockIndex block(Mortonizer::demortonize(leaf.key), leaf.level);
+      return m_octree.template withinGrayBlock<DIM>(pt, block, leaf.data);
+    }
+    case InOutBlockData::Undetermined:
+      SLIC_ASSERT_MSG(false,
+                      "Error -- All leaf blocks must have a color. The color "
+                      "of a leaf block was 'Undetermined' in the snapshot");
+      break;
+    }
+
+    return false;
+  }
+
+private:
+  const InOutOctreeType& m_octree;
+  std::vector<LevelData> m_levels;
+};
+
+}  // namespace detail
+}  // namespace quest
+}  // namespace axom
+
+#endif  // AXOM_QUEST_INOUT_OCTREE_SNAPSHOT__HPP_
@@ -21,6 +21,10 @@
 
 #include "axom/fmt.hpp"
 
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
 namespace axom
 {
 namespace quest
@@ -277,6 +281,97 @@ public:
     return false;
   }
 
+  /**
+   * \brief Computes a hash of the vertex positions and cell connectivity
+   * of the wrapped surface mesh
+   *
+   * The hash is used to validate cached InOutOctree data against the
+   * input mesh, so it must be computed before the mesh is reindexed.
+   *
+   * \pre The mesh has not yet been reindexed
+   */
+  std::uint64_t computeMeshHash() const
+  {
+    SLIC_ASSERT(!m_meshWasReindexed);
+
+    // 64-bit FNV-1a hash, applied to 64-bit words of the mesh data
+    constexpr std::uint64_t FNV_OFFSET = 14695981039346656037ULL;
+    constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+    std::uint64_t hash = FNV_OFFSET;
+    auto mix = [&hash](std::uint64_t word) {
+      hash ^= word;
+      hash *= FNV_PRIME;
+    };
+
+    const int numVerts = numMeshVertices();
+    const int numCells = numMeshCells();
+    mix(static_cast<std::uint64_t>(numVerts));
+    mix(static_cast<std::uint64_t>(numCells));
+
+    for(int i = 0; i < numVerts; ++i)
+    {
+      const SpacePt pt = getMeshVertexPosition(i);
+      for(int d = 0; d < DIM; ++d)
+      {
+        std::uint64_t word;
+        std::memcpy(&word, &pt[d], sizeof(word));
+        mix(word);
+      }
+    }
+
+    VertexIndex cellVerts[NUM_CELL_VERTS];
+    for(int i = 0; i < numCells; ++i)
+    {
+      m_surfaceMesh->getCellNodeIDs(i, cellVerts);
+      for(int j = 0; j < NUM_CELL_VERTS; ++j)
+      {
+        mix(static_cast<std::uint64_t>(cellVerts[j]));
+      }
+    }
+
+    return hash;
+  }
+
+  /**
+   * \brief Restores the reindexed mesh from previously computed data
+   *
+   * \param numVertices The number of vertices in the reindexed mesh
+   * \param positions The vertex positions, with DIM coordinates per vertex
+   * \param cellVertices The vertex indices of the cells, with NUM_CELL_VERTS
+   * entries per cell
+   * \note Similar to reindexMesh(), this clears out the original mesh,
+   * which can be reconstructed using the regenerateSurfaceMesh() function
+   */
+  void restoreMesh(int numVertices,
+                   const std::vector<double>& positions,
+                   std::vector<VertexIndex>&& cellVertices)
+  {
+    SLIC_ASSERT(static_cast<int>(positions.size()) == DIM * numVertices);
+    SLIC_ASSERT(cellVertices.size() % NUM_CELL_VERTS == 0);
+
+    m_vertexSet = MeshVertexSet(numVertices);
+    m_vertexPositions = VertexPositionMap(&m_vertexSet);
+    for(int i = 0; i < numVertices; ++i)
+    {
+      m_vertexPositions[i] = SpacePt(&positions[DIM * i], DIM);
+    }
+
+    m_cv_data = std::move(cellVertices);
+    m_elementSet =
+      MeshElementSet(static_cast<int>(m_cv_data.size()) / NUM_CELL_VERTS);
+    m_cellToVertexRelation = CellVertexRelation(&m_elementSet, &m_vertexSet);
+    m_cellToVertexRelation.bindIndices(static_cast<int>(m_cv_data.size()),
+                                       &m_cv_data);
+
+    delete m_surfaceMesh;
+    m_surfaceMesh = nullptr;
+
+    m_meshWasReindexed = true;
+  }
+
+  /// Const accessor to the vertex indices of all cells in the reindexed mesh
+  const std::vector<VertexIndex>& cellVertexData() const { return m_cv_data; }
+
 protected:
   SurfaceMesh*& m_surfaceMesh;  // ref to pointer to allow changing the mesh
 
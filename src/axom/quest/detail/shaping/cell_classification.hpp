@@ -0,0 +1,675 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * \file cell_classification.hpp
+ *
+ * \brief Helpers to classify mesh cells as inside, outside or on the boundary
+ *  of a shape that is the union of convex primitives
+ *
+ * A shape for intersection-based shaping is a set of tetrahedra or octahedra.
+ * Faces shared by two primitives are interior to the shape, so the boundary
+ * of the shape is contained in the faces that are not shared.  A cell that
+ * does not touch any boundary face is either entirely inside or entirely
+ * outside the shape, which a single point containment query decides.
+ */
+
+#ifndef AXOM_QUEST_SHAPING_CELL_CLASSIFICATION_HPP_
+#define AXOM_QUEST_SHAPING_CELL_CLASSIFICATION_HPP_
+
+#include "axom/config.hpp"
+#include "axom/core/Array.hpp"
+#include "axom/core/ArrayView.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+#include "axom/primal/geometry/Octahedron.hpp"
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Tetrahedron.hpp"
+#include "axom/primal/geometry/Triangle.hpp"
+#include "axom/primal/geometry/Vector.hpp"
+
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace axom
+{
+namespace quest
+{
+namespace shaping
+{
+/// Classification of a mesh cell against a shape
+enum CellClass : int
+{
+  CELL_OUTSIDE = 0,
+  CELL_INSIDE = 1,
+  CELL_MIXED = 2
+};
+
+/*!
+ * \brief Traits for the triangular faces of the convex primitives
+ *
+ * Specializations provide NUM_FACES and getFace(f, a, b, c), which returns
+ * the vertex indices of face \a f.
+ */
+template <typename ShapeType>
+struct PrimitiveFaces;
+
+template <>
+struct PrimitiveFaces<primal::Tetrahedron<double, 3>>
+{
+  static constexpr int NUM_FACES = 4;
+
+  /// Face f is opposite vertex f
+  AXOM_HOST_DEVICE static void getFace(int f, int& a, int& b, int& c)
+  {
+    a = (f + 1) % 4;
+    b = (f + 2) % 4;
+    c = (f + 3) % 4;
+  }
+};
+
+template <>
+struct PrimitiveFaces<primal::Octahedron<double, 3>>
+{
+  static constexpr int NUM_FACES = 8;
+
+  /// Each face has one vertex from each of the opposite pairs PS, QT and RU
+  AXOM_HOST_DEVICE static void getFace(int f, int& a, int& b, int& c)
+  {
+    a = (f & 1) ? 3 : 0;
+    b = (f & 2) ? 4 : 1;
+    c = (f & 4) ? 5 : 2;
+  }
+};
+
+/*!
+ * \brief Tests whether a convex primitive contains a point
+ *
+ * \param [in] shape the tetrahedron or octahedron
+ * \param [in] pt the query point
+ * \param [in] eps distance tolerance for points on the face planes
+ *
+ * The test compares the side of each face plane that \a pt is on with the
+ * side of the primitive's vertex mean, so it does not depend on the
+ * orientation of the primitive.  Degenerate primitives, whose vertex mean is
+ * within \a eps of a face plane, contain no points.
+ */
+template <typename ShapeType>
+AXOM_HOST_DEVICE bool convexContains(const ShapeType& shape,
+                                     const primal::Point<double, 3>& pt,
+                                     double eps)
+{
+  using Faces = PrimitiveFaces<ShapeType>;
+  using PointType = primal::Point<double, 3>;
+  using VectorType = primal::Vector<double, 3>;
+
+  PointType mean;
+  for(int v = 0; v < ShapeType::NUM_VERTS; ++v)
+  {
+    mean.array() += shape[v].array();
+  }
+  mean.array() /= static_cast<double>(ShapeType::NUM_VERTS);
+
+  for(int f = 0; f < Faces::NUM_FACES; ++f)
+  {
+    int a, b, c;
+    Faces::getFace(f, a, b, c);
+    const VectorType normal =
+      VectorType::cross_product(VectorType(shape[a], shape[b]),
+                                VectorType(shape[a], shape[c]));
+    const double tol = eps * normal.norm();
+    const double meanSide = normal.dot(VectorType(shape[a], mean));
+    const double ptSide = normal.dot(VectorType(shape[a], pt));
+
+    if(axom::utilities::abs(meanSide) <= tol)
+    {
+      return false;
+    }
+    if(meanSide > 0. ? ptSide < -tol : ptSide > tol)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+namespace detail
+{
+using FaceKey = std::uint64_t;
+
+/// Lexicographic comparison of points
+AXOM_HOST_DEVICE inline bool lexLess(const primal::Point<double, 3>& p,
+                                     const primal::Point<double, 3>& q)
+{
+  for(int d = 0; d < 3; ++d)
+  {
+    if(p[d] != q[d])
+    {
+      return p[d] < q[d];
+    }
+  }
+  return false;
+}
+
+/// Returns face \a f of \a shape with its vertices sorted lexicographically
+template <typename ShapeType>
+AXOM_HOST_DEVICE primal::Triangle<double, 3> sortedFace(const ShapeType& shape,
+                                                        int f)
+{
+  int a, b, c;
+  PrimitiveFaces<ShapeType>::getFace(f, a, b, c);
+  primal::Point<double, 3> p[3] = {shape[a], shape[b], shape[c]};
+  for(int pass = 0; pass < 2; ++pass)
+  {
+    for(int v = 0; v < 2 - pass; ++v)
+    {
+      if(lexLess(p[v + 1], p[v]))
+      {
+        axom::utilities::swap(p[v], p[v + 1]);
+      }
+    }
+  }
+  return primal::Triangle<double, 3>(p[0], p[1], p[2]);
+}
+
+/// Hashes the coordinates of a sorted face; equal faces have equal keys
+AXOM_HOST_DEVICE inline FaceKey hashFace(const primal::Triangle<double, 3>& tri)
+{
+  FaceKey key = 0x9e3779b97f4a7c15ull;
+  for(int v = 0; v < 3; ++v)
+  {
+    for(int d = 0; d < 3; ++d)
+    {
+      // Adding zero maps -0. to 0.
+      const double coord = tri[v][d] + 0.;
+      std::uint64_t bits;
+      std::memcpy(&bits, &coord, sizeof(bits));
+
+      // splitmix64 finalizer
+      key ^= bits + 0x9e3779b97f4a7c15ull + (key << 6) + (key >> 2);
+      key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ull;
+      key = (key ^ (key >> 27)) * 0x94d049bb133111ebull;
+      key ^= key >> 31;
+    }
+  }
+  return key;
+}
+
+/// Tests whether two sorted faces have the same coordinates
+AXOM_HOST_DEVICE inline bool sameFace(const primal::Triangle<double, 3>& t1,
+                                      const primal::Triangle<double, 3>& t2)
+{
+  for(int v = 0; v < 3; ++v)
+  {
+    for(int d = 0; d < 3; ++d)
+    {
+      if(t1[v][d] != t2[v][d])
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/*!
+ * \brief Returns the signed distance, scaled by twice the face area, from the
+ *  plane of \a tri to the vertex mean of \a shape
+ */
+template <typename ShapeType>
+AXOM_HOST_DEVICE double meanSide(const ShapeType& shape,
+                                 const primal::Triangle<double, 3>& tri)
+{
+  using VectorType = primal::Vector<double, 3>;
+
+  primal::Point<double, 3> mean;
+  for(int v = 0; v < ShapeType::NUM_VERTS; ++v)
+  {
+    mean.array() += shape[v].array();
+  }
+  mean.array() /= static_cast<double>(ShapeType::NUM_VERTS);
+
+  const VectorType normal =
+    VectorType::cross_product(VectorType(tri[0], tri[1]),
+                              VectorType(tri[0], tri[2]));
+  return normal.dot(VectorType(tri[0], mean));
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Finds the faces of a set of convex primitives that are not shared
+ *  by exactly two primitives on opposite sides of the face
+ *
+ * \param [in] shapes the tetrahedra or octahedra of a shape
+ * \param [in] eps distance tolerance; degenerate primitives, as defined by
+ *  convexContains(), are skipped
+ *
+ * \return The unshared faces, which contain the boundary of the union of
+ *  the primitives
+ *
+ * Faces are matched on exact coordinates, so faces that are shared but have
+ * slightly different coordinates are returned.  Returning extra faces only
+ * makes the classification more conservative.  The faces are allocated with
+ * the default allocator.
+ */
+template <typename ExecSpace, typename ShapeType>
+axom::Array<primal::Triangle<double, 3>> findUnsharedFaces(
+  axom::ArrayView<const ShapeType> shapes,
+  double eps)
+{
+  using TriangleType = primal::Triangle<double, 3>;
+  constexpr int NUM_FACES = PrimitiveFaces<ShapeType>::NUM_FACES;
+
+  const axom::IndexType numShapes = shapes.size();
+  const axom::IndexType numFaces = numShapes * NUM_FACES;
+  if(numFaces == 0)
+  {
+    return axom::Array<TriangleType>();
+  }
+
+  // Compute the sorted faces of the non-degenerate primitives and their keys
+  axom::Array<TriangleType> faces(numFaces, numFaces);
+  axom::Array<detail::FaceKey> keys(numFaces, numFaces);
+  axom::Array<axom::IndexType> order(numFaces, numFaces);
+  axom::Array<axom::IndexType> isDegenerate(numShapes, numShapes);
+  const auto faces_v = faces.view();
+  const auto keys_v = keys.view();
+  const auto order_v = order.view();
+  const auto isDegenerate_v = isDegenerate.view();
+
+  axom::for_all<ExecSpace>(
+    numShapes,
+    AXOM_LAMBDA(axom::IndexType i) {
+      // A primitive contains its vertex mean unless it is degenerate
+      primal::Point<double, 3> mean;
+      for(int v = 0; v < ShapeType::NUM_VERTS; ++v)
+      {
+        mean.array() += shapes[i][v].array();
+      }
+      mean.array() /= static_cast<double>(ShapeType::NUM_VERTS);
+      isDegenerate_v[i] = convexContains(shapes[i], mean, eps) ? 0 : 1;
+    });
+
+  axom::for_all<ExecSpace>(
+    numFaces,
+    AXOM_LAMBDA(axom::IndexType k) {
+      const axom::IndexType i = k / NUM_FACES;
+      faces_v[k] = detail::sortedFace(shapes[i], k % NUM_FACES);
+      // Degenerate primitives get distinct keys at the end of the order
+      keys_v[k] = isDegenerate_v[i] ? ~detail::FaceKey(0)
+                                    : detail::hashFace(faces_v[k]);
+      order_v[k] = k;
+    });
+
+#ifdef AXOM_USE_RAJA
+  using LoopPolicy = typename axom::execution_space<ExecSpace>::loop_policy;
+  RAJA::sort_pairs<LoopPolicy>(RAJA::make_span(keys.data(), numFaces),
+                               RAJA::make_span(order.data(), numFaces));
+#else
+  std::sort(order.begin(),
+            order.end(),
+            [&](axom::IndexType a, axom::IndexType b) {
+              return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+            });
+  {
+    axom::Array<detail::FaceKey> sortedKeys(numFaces, numFaces);
+    for(axom::IndexType k = 0; k < numFaces; ++k)
+    {
+      sortedKeys[k] = keys[order[k]];
+    }
+    keys = std::move(sortedKeys);
+  }
+#endif
+  const auto sortedKeys_v = keys.view();
+
+  // A face is shared when exactly one neighbor in the sorted order matches it
+  axom::Array<axom::IndexType> isUnshared(numFaces, numFaces);
+  axom::Array<axom::IndexType> offsets(numFaces, numFaces);
+  const auto isUnshared_v = isUnshared.view();
+  const auto offsets_v = offsets.view();
+
+  axom::for_all<ExecSpace>(
+    numFaces,
+    AXOM_LAMBDA(axom::IndexType k) {
+      auto matches = [=](axom::IndexType k1, axom::IndexType k2) {
+        return k1 >= 0 && k2 < numFaces &&
+          sortedKeys_v[k1] == sortedKeys_v[k2] &&
+          !isDegenerate_v[order_v[k1] / NUM_FACES] &&
+          detail::sameFace(faces_v[order_v[k1]], faces_v[order_v[k2]]);
+      };
+
+      axom::IndexType partner = -1;
+      if(matches(k - 1, k))
+      {
+        partner = (matches(k, k + 1) || matches(k - 2, k - 1)) ? -1 : k - 1;
+      }
+      else if(matches(k, k + 1))
+      {
+        partner = matches(k + 1, k + 2) ? -1 : k + 1;
+      }
+
+      // Overlapping primitives on the same side do not hide the face
+      bool shared = false;
+      if(partner >= 0)
+      {
+        const TriangleType& face = faces_v[order_v[k]];
+        const double side =
+          detail::meanSide(shapes[order_v[k] / NUM_FACES], face);
+        const double partnerSide =
+          detail::meanSide(shapes[order_v[partner] / NUM_FACES], face);
+        shared = (side > 0.) != (partnerSide > 0.);
+      }
+
+      const bool degenerate = isDegenerate_v[order_v[k] / NUM_FACES];
+      isUnshared_v[k] = (shared || degenerate) ? 0 : 1;
+    });
+
+  // Compact the unshared faces
+#ifdef AXOM_USE_RAJA
+  RAJA::exclusive_scan<LoopPolicy>(
+    RAJA::make_span(isUnshared.data(), numFaces),
+    RAJA::make_span(offsets.data(), numFaces),
+    RAJA::operators::plus<axom::IndexType> {});
+#else
+  axom::IndexType sum = 0;
+  for(axom::IndexType k = 0; k < numFaces; ++k)
+  {
+    offsets[k] = sum;
+    sum += isUnshared[k];
+  }
+#endif
+
+  axom::IndexType lastOffset, lastFlag;
+  axom::copy(&lastOffset,
+             offsets.data() + numFaces - 1,
+             sizeof(axom::IndexType));
+  axom::copy(&lastFlag,
+             isUnshared.data() + numFaces - 1,
+             sizeof(axom::IndexType));
+  const axom::IndexType numUnshared = lastOffset + lastFlag;
+
+  axom::Array<TriangleType> unshared(numUnshared, numUnshared);
+  const auto unshared_v = unshared.view();
+  axom::for_all<ExecSpace>(
+    numFaces,
+    AXOM_LAMBDA(axom::IndexType k) {
+      if(isUnshared_v[k])
+      {
+        unshared_v[offsets_v[k]] = faces_v[order_v[k]];
+      }
+    });
+
+  return unshared;
+}
+
+/*!
+ * \brief Cell/shape pairs of the candidate primitives of each cell, in
+ *  compressed sparse row form
+ *
+ * The pairs of cell i are in [cellOffsets[i], cellOffsets[i + 1]), sorted by
+ * shape.  The candidate primitives of pair p are in primitives, from
+ * primitiveOffsets[p] to primitiveOffsets[p + 1].  shapeOrder lists the
+ * pairs sorted by shape, with the pairs of shape s from shapeOffsets[s] to
+ * shapeOffsets[s + 1]; shapeOffsets is on the host.
+ *
+ * \sa makeCandidatePairs()
+ */
+struct CandidatePairs
+{
+  axom::Array<axom::IndexType> cellOffsets;
+  axom::Array<axom::IndexType> cells;
+  axom::Array<int> shapes;
+  axom::Array<axom::IndexType> primitiveOffsets;
+  axom::Array<axom::IndexType> primitives;
+  axom::Array<axom::IndexType> shapeOrder;
+  std::vector<axom::IndexType> shapeOffsets;
+
+  axom::IndexType numPairs() const { return cells.size(); }
+};
+
+/*!
+ * \brief Returns the pair of cell \a cell with shape \a shape, or -1 if the
+ *  cell has no candidate primitive of the shape
+ */
+AXOM_HOST_DEVICE inline axom::IndexType findCandidatePair(
+  axom::ArrayView<const axom::IndexType> cellOffsets,
+  axom::ArrayView<const int> shapes,
+  axom::IndexType cell,
+  int shape)
+{
+  axom::IndexType lo = cellOffsets[cell];
+  axom::IndexType hi = cellOffsets[cell + 1];
+  while(lo < hi)
+  {
+    const axom::IndexType mid = lo + (hi - lo) / 2;
+    if(shapes[mid] < shape)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return (lo < cellOffsets[cell + 1] && shapes[lo] == shape) ? lo : -1;
+}
+
+/*!
+ * \brief Groups the candidate primitives of each cell by shape
+ *
+ * \param [in] numCells the number of cells
+ * \param [in] offsets offsets of the candidate primitives of each cell
+ * \param [in] counts number of candidate primitives of each cell
+ * \param [in] candidates the candidate primitives, e.g. from
+ *  spin::BVH::findBoundingBoxes()
+ * \param [in] shapeIds the shape of each primitive
+ * \param [in] numShapes the number of shapes
+ *
+ * The primitives of each shape must be contiguous, with the shapes in
+ * increasing order, so sorting the candidates of a cell groups them by
+ * shape.  The pairs take memory proportional to the number of candidates,
+ * rather than to the number of cells times the number of shapes.  The arrays
+ * are allocated with the default allocator.
+ */
+template <typename ExecSpace>
+CandidatePairs makeCandidatePairs(
+  axom::IndexType numCells,
+  axom::ArrayView<const axom::IndexType> offsets,
+  axom::ArrayView<const axom::IndexType> counts,
+  axom::ArrayView<const axom::IndexType> candidates,
+  axom::ArrayView<const int> shapeIds,
+  int numShapes)
+{
+#ifdef AXOM_USE_RAJA
+  using LoopPolicy = typename axom::execution_space<ExecSpace>::loop_policy;
+#endif
+
+  const axom::IndexType numCandidates = candidates.size();
+  const std::uint64_t numPrimitives = shapeIds.size();
+
+  // Sort the candidates of each cell.  The cells' candidates are contiguous
+  // and in cell order, so sorting on (cell, primitive) keeps them in place.
+  axom::Array<std::uint64_t> keys(numCandidates, numCandidates);
+  const auto keys_v = keys.view();
+  axom::for_all<ExecSpace>(
+    numCells,
+    AXOM_LAMBDA(axom::IndexType i) {
+      const std::uint64_t cell = i;
+      for(axom::IndexType j = 0; j < counts[i]; ++j)
+      {
+        const axom::IndexType k = offsets[i] + j;
+        keys_v[k] = cell * numPrimitives + candidates[k];
+      }
+    });
+  if(numCandidates > 0)
+  {
+#ifdef AXOM_USE_RAJA
+    RAJA::sort<LoopPolicy>(RAJA::make_span(keys.data(), numCandidates));
+#else
+    std::sort(keys.begin(), keys.end());
+#endif
+  }
+
+  CandidatePairs pairs;
+  pairs.primitives =
+    axom::Array<axom::IndexType>(numCandidates, numCandidates);
+  const auto primitives_v = pairs.primitives.view();
+  axom::for_all<ExecSpace>(
+    numCandidates,
+    AXOM_LAMBDA(axom::IndexType k) {
+      primitives_v[k] = static_cast<axom::IndexType>(keys_v[k] % numPrimitives);
+    });
+
+  // A pair starts at each candidate whose shape differs from the previous
+  // candidate of the cell
+  axom::Array<axom::IndexType> pairCounts(numCells, numCells);
+  const auto pairCounts_v = pairCounts.view();
+  axom::for_all<ExecSpace>(
+    numCells,
+    AXOM_LAMBDA(axom::IndexType i) {
+      axom::IndexType count = 0;
+      for(axom::IndexType j = 0; j < counts[i]; ++j)
+      {
+        const axom::IndexType k = offsets[i] + j;
+        if(j == 0 ||
+           shapeIds[primitives_v[k - 1]] != shapeIds[primitives_v[k]])
+        {
+          ++count;
+        }
+      }
+      pairCounts_v[i] = count;
+    });
+
+  pairs.cellOffsets =
+    axom::Array<axom::IndexType>(numCells + 1, numCells + 1);
+  axom::IndexType numPairs = 0;
+  if(numCells > 0)
+  {
+#ifdef AXOM_USE_RAJA
+    RAJA::exclusive_scan<LoopPolicy>(
+      RAJA::make_span(pairCounts.data(), numCells),
+      RAJA::make_span(pairs.cellOffsets.data(), numCells),
+      RAJA::operators::plus<axom::IndexType> {});
+#else
+    axom::IndexType sum = 0;
+    for(axom::IndexType i = 0; i < numCells; ++i)
+    {
+      pairs.cellOffsets[i] = sum;
+      sum += pairCounts[i];
+    }
+#endif
+
+    axom::IndexType lastOffset, lastCount;
+    axom::copy(&lastOffset,
+               pairs.cellOffsets.data() + numCells - 1,
+               sizeof(axom::IndexType));
+    axom::copy(&lastCount,
+               pairCounts.data() + numCells - 1,
+               sizeof(axom::IndexType));
+    numPairs = lastOffset + lastCount;
+  }
+  axom::copy(pairs.cellOffsets.data() + numCells,
+             &numPairs,
+             sizeof(axom::IndexType));
+
+  pairs.cells = axom::Array<axom::IndexType>(numPairs, numPairs);
+  pairs.shapes = axom::Array<int>(numPairs, numPairs);
+  pairs.primitiveOffsets =
+    axom::Array<axom::IndexType>(numPairs + 1, numPairs + 1);
+  const auto cellOffsets_v = pairs.cellOffsets.view();
+  const auto cells_v = pairs.cells.view();
+  const auto shapes_v = pairs.shapes.view();
+  const auto primitiveOffsets_v = pairs.primitiveOffsets.view();
+  axom::for_all<ExecSpace>(
+    numCells,
+    AXOM_LAMBDA(axom::IndexType i) {
+      axom::IndexType p = cellOffsets_v[i];
+      for(axom::IndexType j = 0; j < counts[i]; ++j)
+      {
+        const axom::IndexType k = offsets[i] + j;
+        const int shape = shapeIds[primitives_v[k]];
+        if(j == 0 || shapeIds[primitives_v[k - 1]] != shape)
+        {
+          cells_v[p] = i;
+          shapes_v[p] = shape;
+          primitiveOffsets_v[p] = k;
+          ++p;
+        }
+      }
+    });
+  axom::copy(pairs.primitiveOffsets.data() + numPairs,
+             &numCandidates,
+             sizeof(axom::IndexType));
+
+  // Order the pairs by shape
+  axom::Array<axom::IndexType> shapeKeys(numPairs, numPairs);
+  pairs.shapeOrder = axom::Array<axom::IndexType>(numPairs, numPairs);
+  const auto shapeKeys_v = shapeKeys.view();
+  const auto shapeOrder_v = pairs.shapeOrder.view();
+  axom::for_all<ExecSpace>(
+    numPairs,
+    AXOM_LAMBDA(axom::IndexType p) {
+      shapeKeys_v[p] = shapes_v[p];
+      shapeOrder_v[p] = p;
+    });
+  if(numPairs > 0)
+  {
+#ifdef AXOM_USE_RAJA
+    RAJA::stable_sort_pairs<LoopPolicy>(
+      RAJA::make_span(shapeKeys.data(), numPairs),
+      RAJA::make_span(pairs.shapeOrder.data(), numPairs));
+#else
+    std::stable_sort(pairs.shapeOrder.begin(),
+                     pairs.shapeOrder.end(),
+                     [&](axom::IndexType a, axom::IndexType b) {
+                       return shapeKeys[a] < shapeKeys[b];
+                     });
+    std::sort(shapeKeys.begin(), shapeKeys.end());
+#endif
+  }
+
+  // The pairs of shape s start at the first key that is not less than s
+  axom::Array<axom::IndexType> shapeOffsets(numShapes + 1, numShapes + 1);
+  const auto shapeOffsets_v = shapeOffsets.view();
+  axom::for_all<ExecSpace>(
+    numShapes + 1,
+    AXOM_LAMBDA(axom::IndexType s) {
+      axom::IndexType lo = 0;
+      axom::IndexType hi = numPairs;
+      while(lo < hi)
+      {
+        const axom::IndexType mid = lo + (hi - lo) / 2;
+        if(shapeKeys_v[mid] < s)
+        {
+          lo = mid + 1;
+        }
+        else
+        {
+          hi = mid;
+        }
+      }
+      shapeOffsets_v[s] = lo;
+    });
+  pairs.shapeOffsets.resize(numShapes + 1);
+  axom::copy(pairs.shapeOffsets.data(),
+             shapeOffsets.data(),
+             (numShapes + 1) * sizeof(axom::IndexType));
+
+  return pairs;
+}
+
+}  // end namespace shaping
+}  // end namespace quest
+}  // end namespace axom
+
+#endif  // AXOM_QUEST_SHAPING_CELL_CLASSIFICATION_HPP_
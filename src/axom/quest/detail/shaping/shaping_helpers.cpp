@@ -11,6 +11,9 @@
 
 #include "axom/fmt.hpp"
 
+#include <algorithm>
+#include <limits>
+
 #ifndef AXOM_USE_MFEM
   #error Shaping functionality requires Axom to be configured with MFEM and the AXOM_ENABLE_MFEM_SIDRE_DATACOLLECTION option
 #endif
@@ -141,6 +144,51 @@ void generatePositionsQFunction(mfem::Mesh* mesh,
   inoutQFuncs.Register("positions", pos_coef, true);
 }
 
+std::vector<int> coarseSampleIndices(const mfem::IntegrationRule& ir,
+                                     mfem::Geometry::Type geom)
+{
+  const int nq = ir.GetNPoints();
+  if(nq == 0)
+  {
+    return {};
+  }
+
+  // The vertices and the center of the reference element
+  const mfem::IntegrationRule* verts = mfem::Geometries.GetVertices(geom);
+  std::vector<mfem::IntegrationPoint> targets;
+  for(int v = 0; v < verts->GetNPoints(); ++v)
+  {
+    targets.push_back(verts->IntPoint(v));
+  }
+  targets.push_back(mfem::Geometries.GetCenter(geom));
+
+  std::vector<int> indices;
+  for(const auto& target : targets)
+  {
+    int closest = 0;
+    double minDist = std::numeric_limits<double>::max();
+    for(int p = 0; p < nq; ++p)
+    {
+      const auto& ip = ir.IntPoint(p);
+      const double dx = ip.x - target.x;
+      const double dy = ip.y - target.y;
+      const double dz = ip.z - target.z;
+      const double dist = dx * dx + dy * dy + dz * dz;
+      if(dist < minDist)
+      {
+        minDist = dist;
+        closest = p;
+      }
+    }
+    indices.push_back(closest);
+  }
+
+  // Points can be closest to several targets
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+  return indices;
+}
+
 /// Generate a volume fraction from a quadrature field for \a matField using FCT
 void computeVolumeFractions(const std::string& matField,
                             mfem::DataCollection* dc,
@@ -20,6 +20,8 @@
 
 #include "mfem.hpp"
 
+#include <vector>
+
 namespace axom
 {
 namespace quest
@@ -62,6 +64,19 @@ void generatePositionsQFunction(mfem::Mesh* mesh,
                                 QFunctionCollection& inoutQFuncs,
                                 int sampleRes);
 
+/**
+ * \brief Returns the indices of a coarse subset of the points of \a ir
+ *
+ * \param ir An integration rule on the reference element
+ * \param geom The geometry of the reference element
+ *
+ * The subset contains the points closest to each vertex and to the center of
+ * the reference element. Adaptive sampling queries these points first and
+ * only queries the others when the coarse samples disagree.
+ */
+std::vector<int> coarseSampleIndices(const mfem::IntegrationRule& ir,
+                                     mfem::Geometry::Type geom);
+
 /**
  * \brief Compute volume fractions for a given material using its associated quadrature function
  *
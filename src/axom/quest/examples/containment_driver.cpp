@@ -24,6 +24,8 @@
 // C/C++ includes
 #include <algorithm>
 #include <cmath>
+#include <numeric>
+#include <random>
 #include <iostream>
 #include <limits>
 #include <fstream>
@@ -145,6 +147,17 @@ public:
     SLIC_INFO("Bounding box for query points: " << m_queryBB);
   }
 
+  /**
+  * Sets options for batched queries
+  * \param useSortedQuery Use the octree's Morton-sorted batched query
+  * \param shufflePoints Randomly permute the query points before querying
+  */
+  void setBatchedQueryOptions(bool useSortedQuery, bool shufflePoints)
+  {
+    m_useSortedQuery = useSortedQuery;
+    m_shufflePoints = shufflePoints;
+  }
+
   void initializeInOutOctree()
   {
     m_octree = new InOutOctreeType(m_meshBB, m_surfaceMesh);
@@ -190,10 +203,14 @@ public:
     }
 
     SLIC_INFO(axom::fmt::format(
-      "\tQuerying {}^{} containment field took {} seconds (@ {} "
+      "\tQuerying {}^{} containment field{} took {} seconds (@ {} "
       "queries per second)",
       gridRes,
       DIM,
+      !isBatched ? ""
+        : axom::fmt::format(" ({}{} batch)",
+                            m_shufflePoints ? "shuffled, " : "",
+                            m_useSortedQuery ? "sorted" : "unsorted"),
       timer.elapsed(),
       nnodes / timer.elapsed()));
 
@@ -226,14 +243,13 @@ public:
         y[idx] = yy;
       });
 
-    // Loop through the points using ExecPolicy
+    // Query the points, optionally in a shuffled order
     int* containment =
       umesh->getFieldPtr<int>("containment", mint::NODE_CENTERED);
     SLIC_ASSERT(containment != nullptr);
 
-    axom::for_all<ExecPolicy>(0, nnodes, [&](axom::IndexType idx) {
-      const bool inside = m_octree->within(SpacePt {x[idx], y[idx]});
-      containment[idx] = inside ? 1 : 0;
+    batchedQuery(nnodes, containment, [&](axom::IndexType idx) {
+      return SpacePt {x[idx], y[idx]};
     });
 
     // Deallocate the coordinate arrays
@@ -265,14 +281,13 @@ public:
         z[idx] = zz;
       });
 
-    // Loop through the points using ExecPolicy
+    // Query the points, optionally in a shuffled order
     int* containment =
       umesh->getFieldPtr<int>("containment", mint::NODE_CENTERED);
     SLIC_ASSERT(containment != nullptr);
 
-    axom::for_all<ExecPolicy>(0, nnodes, [&](axom::IndexType idx) {
-      const bool inside = m_octree->within(SpacePt {x[idx], y[idx], z[idx]});
-      containment[idx] = inside ? 1 : 0;
+    batchedQuery(nnodes, containment, [&](axom::IndexType idx) {
+      return SpacePt {x[idx], y[idx], z[idx]};
     });
 
     // Deallocate the coordinate arrays
@@ -283,6 +298,48 @@ public:
     timer.stop();
   }
 
+private:
+  /**
+  * \brief Helper for batched queries over \a npts points
+  *
+  * Depending on the driver's options, the points are first shuffled and
+  * are queried using the octree's sorted batched query or with a for_all
+  * loop over point-wise queries.
+  * \param getPoint Functor returning the point with the given index
+  */
+  template <typename PointFunctor>
+  void batchedQuery(int npts, int* containment, PointFunctor&& getPoint)
+  {
+    axom::Array<axom::IndexType> order(npts, npts);
+    std::iota(order.begin(), order.end(), 0);
+    if(m_shufflePoints)
+    {
+      std::shuffle(order.begin(), order.end(), std::mt19937 {42});
+    }
+
+    if(m_useSortedQuery)
+    {
+      axom::Array<SpacePt> pts(npts, npts);
+      axom::Array<int> results(npts, npts);
+      axom::for_all<ExecPolicy>(0, npts, [&](axom::IndexType i) {
+        pts[i] = getPoint(order[i]);
+      });
+
+      m_octree->within(pts, results);
+
+      axom::for_all<ExecPolicy>(0, npts, [&](axom::IndexType i) {
+        containment[order[i]] = results[i];
+      });
+    }
+    else
+    {
+      axom::for_all<ExecPolicy>(0, npts, [&](axom::IndexType i) {
+        const axom::IndexType idx = order[i];
+        containment[idx] = m_octree->within(getPoint(idx)) ? 1 : 0;
+      });
+    }
+  }
+
 private:
   /**
   * \brief Extracts the vertex indices of cell \a cellIndex from the mesh
@@ -474,6 +531,8 @@ private:
   InOutOctreeType* m_octree {nullptr};
   GeometricBoundingBox m_meshBB;
   GeometricBoundingBox m_queryBB;
+  bool m_useSortedQuery {false};
+  bool m_shufflePoints {false};
 };
 
 /** Struct to parse and store the input parameters */
@@ -489,6 +548,8 @@ public:
 private:
   bool m_verboseOutput {false};
   bool m_use_batched_query {false};
+  bool m_use_sorted_query {false};
+  bool m_shuffle_points {false};
 
 public:
   Input()
@@ -516,7 +577,14 @@ public:
 
   bool isVerbose() const { return m_verboseOutput; }
 
-  bool useBatchedQuery() const { return m_use_batched_query; }
+  bool useBatchedQuery() const
+  {
+    return m_use_batched_query || m_use_sorted_query || m_shuffle_points;
+  }
+
+  bool useSortedQuery() const { return m_use_sorted_query; }
+
+  bool shufflePoints() const { return m_shuffle_points; }
 
   void parse(int argc, char** argv, axom::CLI::App& app)
   {
@@ -558,6 +626,21 @@ public:
                 "individual queries")
       ->capture_default_str();
 
+    app
+      .add_flag("--sorted",
+                m_use_sorted_query,
+                "uses the octree's Morton-sorted batched query "
+                "(implies --batched)")
+      ->capture_default_str();
+
+    app
+      .add_flag("--shuffle",
+                m_shuffle_points,
+                "randomly permutes the query points before a batched query, "
+                "e.g. to compare against grid-ordered points "
+                "(implies --batched)")
+      ->capture_default_str();
+
     app
       .add_option(
         "-n,--segments-per-knot-span",
@@ -647,6 +730,8 @@ int main(int argc, char** argv)
   if(is2D)
   {
     driver2D.initializeQueryBox(params.queryBoxMins, params.queryBoxMaxs);
+    driver2D.setBatchedQueryOptions(params.useSortedQuery(),
+                                    params.shufflePoints());
 
     // Query the mesh
     for(int i = 1; i < params.maxQueryLevel; ++i)
@@ -660,6 +745,8 @@ int main(int argc, char** argv)
   else
   {
     driver3D.initializeQueryBox(params.queryBoxMins, params.queryBoxMaxs);
+    driver3D.setBatchedQueryOptions(params.useSortedQuery(),
+                                    params.shufflePoints());
 
     // Query the mesh
     for(int i = 1; i < params.maxQueryLevel; ++i)
@@ -27,6 +27,8 @@ struct Input
   int numRandPoints {20};
   int numOutputSteps {0};
   int dimension {2};
+  bool bulkInsertion {false};
+  bool useExactPredicates {false};
   std::vector<double> boundsMin;
   std::vector<double> boundsMax;
 
@@ -51,6 +53,18 @@ public:
         "None by default; Use -1 to write one file per insterted point")
       ->capture_default_str();
 
+    app.add_flag("--bulk,!--no-bulk", bulkInsertion)
+      ->description(
+        "Insert all points in one batch, in BRIO order. "
+        "Intermediate steps are not written in this mode.")
+      ->capture_default_str();
+
+    app.add_flag("--exact,!--no-exact", useExactPredicates)
+      ->description(
+        "Use exact in-sphere predicates when inserting points. "
+        "More robust for cocircular or cospherical points.")
+      ->capture_default_str();
+
     app.add_option("-o,--outfile", outputVTKFile)
       ->description("The VTK output file")
       ->capture_default_str();
@@ -98,13 +112,15 @@ public:
       bounding box max: {{{}}}
       outfile = '{}'
       intermediate output steps: {}
+      bulk insertion: {}
     }})",
                                 dimension,
                                 numRandPoints,
                                 axom::fmt::join(boundsMin, ", "),
                                 axom::fmt::join(boundsMax, ", "),
                                 outputVTKFile,
-                                numOutputSteps));
+                                numOutputSteps,
+                                bulkInsertion));
   }
 };
 
@@ -131,14 +147,32 @@ void run_delaunay(const Input& params)
   BoundingBox bbox {PointType(params.boundsMin.data()),
                     PointType(params.boundsMax.data())};
 
+  // For bulk insertion, generate the random points up front
+  const int numBulkPoints = params.bulkInsertion ? numPoints : 0;
+  axom::Array<PointType> bulkPoints(numBulkPoints, numBulkPoints);
+  for(auto& pt : bulkPoints)
+  {
+    for(int d = 0; d < DIM; ++d)
+    {
+      pt[d] = random_real(bbox.getMin()[d], bbox.getMax()[d]);
+    }
+  }
+
   axom::utilities::Timer timer(true);
 
   // Create initial Delaunay triangulation over bounding box
   Delaunay dt;
+  dt.setUseExactPredicates(params.useExactPredicates);
   dt.initializeBoundary(bbox);
 
+  // Insert all the points within bounding box in one batch
+  if(params.bulkInsertion)
+  {
+    dt.insertPoints(bulkPoints.view());
+  }
+
   // Incrementally insert random points within bounding box
-  for(int i = 0; i < numPoints; ++i)
+  for(int i = 0; i < numPoints && !params.bulkInsertion; ++i)
   {
     PointType new_pt;
     for(int d = 0; d < DIM; ++d)
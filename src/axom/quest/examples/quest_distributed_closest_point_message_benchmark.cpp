@@ -0,0 +1,342 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file quest_distributed_closest_point_message_benchmark.cpp
+ * \brief Compares the per-hop latency of the binary message layout used by
+ * DistributedClosestPoint with sending conduit nodes along with their schema.
+ *
+ * Ranks 0 and 1 exchange a payload of packed coordinates, distances, ranks
+ * and indices back and forth.  The schema path serializes a conduit::Node
+ * and parses the schema on receipt.  The binary path packs the payload
+ * into a reused buffer and receives it through a persistent request into a
+ * buffer sized for the largest payload, reading the arrays in place.
+ */
+
+#include "axom/config.hpp"
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/primal.hpp"
+#include "axom/quest/DistributedClosestPoint.hpp"
+
+#include "axom/CLI11.hpp"
+#include "axom/fmt.hpp"
+
+#include "mpi.h"
+
+#include <vector>
+
+// namespace aliases
+namespace quest = axom::quest;
+namespace slic = axom::slic;
+
+namespace
+{
+using PointType = axom::primal::Point<double, 3>;
+
+struct Input
+{
+  axom::IndexType minPoints {1000};
+  axom::IndexType maxPoints {1000000};
+  int iterations {20};
+
+  void parse(int argc, char** argv, axom::CLI::App& app)
+  {
+    app.add_option("--min-points", minPoints)
+      ->description("Number of points in the smallest payload")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app.add_option("--max-points", maxPoints)
+      ->description("Number of points in the largest payload")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app.add_option("-i,--iterations", iterations)
+      ->description("Number of round trips for each payload size")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app.get_formatter()->column_width(50);
+
+    app.parse(argc, argv);
+  }
+};
+
+/// Payload arrays, as exchanged by the distributed closest point query
+struct Payload
+{
+  explicit Payload(axom::IndexType n)
+    : coords(n, n)
+    , sqDists(n, n)
+    , ranks(n, n)
+    , indices(n, n)
+  {
+    for(axom::IndexType i = 0; i < n; ++i)
+    {
+      coords[i] = PointType {double(i), 0.5 * i, 0.25 * i};
+      sqDists[i] = double(i);
+      ranks[i] = i % 7;
+      indices[i] = i;
+    }
+  }
+
+  axom::Array<PointType> coords;
+  axom::Array<double> sqDists;
+  axom::Array<axom::IndexType> ranks;
+  axom::Array<axom::IndexType> indices;
+};
+
+void pack(const Payload& payload, axom::Array<char>& buffer)
+{
+  const std::int64_t n = payload.coords.size();
+  quest::internal::BinaryMessageWriter writer(buffer);
+  writer.write(n);
+  writer.writeArray(payload.coords.data(), n);
+  writer.writeArray(payload.sqDists.data(), n);
+  writer.writeArray(payload.ranks.data(), n);
+  writer.writeArray(payload.indices.data(), n);
+}
+
+/// Repack a received binary message into \a buffer, reading it in place
+void echo(char* message, int nBytes, axom::Array<char>& buffer)
+{
+  quest::internal::BinaryMessageReader reader(message, nBytes);
+  const std::int64_t n = reader.read<std::int64_t>();
+  quest::internal::BinaryMessageWriter writer(buffer);
+  writer.write(n);
+  writer.writeArray(reader.readArray<PointType>(n), n);
+  writer.writeArray(reader.readArray<double>(n), n);
+  writer.writeArray(reader.readArray<axom::IndexType>(n), n);
+  writer.writeArray(reader.readArray<axom::IndexType>(n), n);
+}
+
+void toNode(const Payload& payload, conduit::Node& node)
+{
+  const axom::IndexType n = payload.coords.size();
+  node["homeRank"] = 0;
+  node["coords"].set(reinterpret_cast<const double*>(payload.coords.data()),
+                     3 * n);
+  node["cp_sqdist"].set(payload.sqDists.data(), n);
+  node["cp_rank"].set(payload.ranks.data(), n);
+  node["cp_index"].set(payload.indices.data(), n);
+}
+
+/// Average seconds per hop for messages sent with their conduit schema
+double timeSchemaPath(const Payload& payload, int iterations, int rank)
+{
+  const int tag = 1001;
+  const int peer = 1 - rank;
+  conduit::Node node;
+  if(rank == 0)
+  {
+    toNode(payload, node);
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  axom::utilities::Timer timer(true);
+  for(int it = 0; it < iterations; ++it)
+  {
+    if(rank == 0)
+    {
+      conduit::relay::mpi::Request req;
+      quest::internal::relay::mpi::isend_using_schema(node,
+                                                      peer,
+                                                      tag,
+                                                      MPI_COMM_WORLD,
+                                                      &req);
+      MPI_Wait(&req.m_request, MPI_STATUS_IGNORE);
+      node.reset();
+      quest::internal::relay::mpi::recv_using_schema(node,
+                                                     peer,
+                                                     tag,
+                                                     MPI_COMM_WORLD);
+    }
+    else
+    {
+      node.reset();
+      quest::internal::relay::mpi::recv_using_schema(node,
+                                                     peer,
+                                                     tag,
+                                                     MPI_COMM_WORLD);
+      conduit::relay::mpi::Request req;
+      quest::internal::relay::mpi::isend_using_schema(node,
+                                                      peer,
+                                                      tag,
+                                                      MPI_COMM_WORLD,
+                                                      &req);
+      MPI_Wait(&req.m_request, MPI_STATUS_IGNORE);
+    }
+  }
+  timer.stop();
+
+  return timer.elapsedTimeInSec() / (2 * iterations);
+}
+
+/// Average seconds per hop for binary messages with persistent receives
+double timeBinaryPath(const Payload& payload, int iterations, int rank)
+{
+  const int tag = 1002;
+  const int peer = 1 - rank;
+  const axom::IndexType n = payload.coords.size();
+
+  // Bound on the message size: count, then four padded arrays.
+  const axom::IndexType maxBytes = 8 + 4 * 8 +
+    n * (sizeof(PointType) + sizeof(double) + 2 * sizeof(axom::IndexType));
+  axom::Array<char> recvBuffer(maxBytes, maxBytes);
+  axom::Array<char> sendBuffer;
+
+  MPI_Request recvRequest;
+  MPI_Recv_init(recvBuffer.data(),
+                static_cast<int>(maxBytes),
+                MPI_BYTE,
+                peer,
+                tag,
+                MPI_COMM_WORLD,
+                &recvRequest);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  axom::utilities::Timer timer(true);
+  for(int it = 0; it < iterations; ++it)
+  {
+    MPI_Start(&recvRequest);
+    if(rank == 0)
+    {
+      pack(payload, sendBuffer);
+      MPI_Send(sendBuffer.data(),
+               static_cast<int>(sendBuffer.size()),
+               MPI_BYTE,
+               peer,
+               tag,
+               MPI_COMM_WORLD);
+    }
+
+    MPI_Status status;
+    MPI_Wait(&recvRequest, &status);
+    int nBytes = 0;
+    MPI_Get_count(&status, MPI_BYTE, &nBytes);
+
+    if(rank == 0)
+    {
+      // Read the echoed payload in place, as the query does with replies.
+      quest::internal::BinaryMessageReader reader(recvBuffer.data(), nBytes);
+      SLIC_ASSERT(reader.read<std::int64_t>() == n);
+    }
+    else
+    {
+      echo(recvBuffer.data(), nBytes, sendBuffer);
+      MPI_Send(sendBuffer.data(),
+               static_cast<int>(sendBuffer.size()),
+               MPI_BYTE,
+               peer,
+               tag,
+               MPI_COMM_WORLD);
+    }
+  }
+  timer.stop();
+
+  MPI_Request_free(&recvRequest);
+
+  return timer.elapsedTimeInSec() / (2 * iterations);
+}
+
+void initializeLogger()
+{
+  slic::initialize();
+  slic::setLoggingMsgLevel(slic::message::Info);
+
+  std::string fmt = "[<RANK>][<LEVEL>]: <MESSAGE>\n";
+  slic::LogStream* logStream =
+    new slic::SynchronizedStream(&std::cout, MPI_COMM_WORLD, fmt);
+  slic::addStreamToAllMsgLevels(logStream);
+}
+
+void finalizeLogger()
+{
+  if(slic::isInitialized())
+  {
+    slic::flushStreams();
+    slic::finalize();
+  }
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  MPI_Init(&argc, &argv);
+  int my_rank, num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  initializeLogger();
+
+  Input params;
+  axom::CLI::App app {
+    "Per-hop latency of DistributedClosestPoint message formats"};
+
+  try
+  {
+    params.parse(argc, argv, app);
+  }
+  catch(const axom::CLI::ParseError& e)
+  {
+    int retval = -1;
+    if(my_rank == 0)
+    {
+      retval = app.exit(e);
+    }
+
+    MPI_Bcast(&retval, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    finalizeLogger();
+    MPI_Finalize();
+
+    exit(retval);
+  }
+
+  if(num_ranks < 2)
+  {
+    SLIC_WARNING("This benchmark requires at least 2 MPI ranks");
+    finalizeLogger();
+    MPI_Finalize();
+    return 1;
+  }
+
+  // Ranks other than 0 and 1 sit out, but take part in barriers.
+  const bool isActive = my_rank < 2;
+
+  for(axom::IndexType n = params.minPoints; n <= params.maxPoints; n *= 10)
+  {
+    Payload payload(isActive ? n : 0);
+
+    double schemaTime = 0.;
+    double binaryTime = 0.;
+    if(isActive)
+    {
+      schemaTime = timeSchemaPath(payload, params.iterations, my_rank);
+      binaryTime = timeBinaryPath(payload, params.iterations, my_rank);
+    }
+    else
+    {
+      MPI_Barrier(MPI_COMM_WORLD);
+      MPI_Barrier(MPI_COMM_WORLD);
+    }
+
+    SLIC_INFO_IF(my_rank == 0,
+                 axom::fmt::format("{:>8} points: schema {:.3e} s/hop, "
+                                   "binary {:.3e} s/hop, speedup {:.2f}x",
+                                   n,
+                                   schemaTime,
+                                   binaryTime,
+                                   schemaTime / binaryTime));
+    slic::flushStreams();
+  }
+
+  finalizeLogger();
+  MPI_Finalize();
+
+  return 0;
+}
@@ -76,6 +76,9 @@ public:
 
   bool checkResults {false};
 
+  bool pipelined {false};
+  bool progressThread {false};
+
   bool randomSpacing {true};
 
   std::vector<unsigned int> objDomainCountRange {1, 1};
@@ -176,6 +179,14 @@ public:
         "Enable/disable checking results against analytical solution")
       ->capture_default_str();
 
+    app.add_flag("--pipelined,!--no-pipelined", pipelined)
+      ->description("Overlap the exchange of query points with the local search")
+      ->capture_default_str();
+
+    app.add_flag("--progress-thread,!--no-progress-thread", progressThread)
+      ->description("Drive MPI progress from a helper thread during the query")
+      ->capture_default_str();
+
     app.get_formatter()->column_width(60);
 
     // could throw an exception
@@ -1236,7 +1247,9 @@ void finalizeLogger()
 //------------------------------------------------------------------------------
 int main(int argc, char** argv)
 {
-  MPI_Init(&argc, &argv);
+  // The query's optional progress thread needs MPI_THREAD_MULTIPLE.
+  int threadSupport = MPI_THREAD_SINGLE;
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &threadSupport);
   int my_rank, num_ranks;
   MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
   MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
@@ -1459,6 +1472,8 @@ int main(int argc, char** argv)
   query.setDimension(DIM);
   query.setVerbosity(params.isVerbose());
   query.setDistanceThreshold(params.distThreshold);
+  query.setPipelined(params.pipelined);
+  query.setUseProgressThread(params.progressThread);
   // To test support for single-domain format, use single-domain when possible.
   query.setObjectMesh(
     objectMeshNode.number_of_children() == 1 ? objectMeshNode[0] : objectMeshNode,
@@ -1507,6 +1522,53 @@ int main(int argc, char** argv)
       sumQuery / num_ranks,
       minQuery,
       maxQuery));
+
+    double minBytes, maxBytes, sumBytes;
+    getDoubleMinMax(static_cast<double>(query.getSentBytes()),
+                    minBytes,
+                    maxBytes,
+                    sumBytes);
+
+    double minMsgs, maxMsgs, sumMsgs;
+    getDoubleMinMax(static_cast<double>(query.getSentMessages()),
+                    minMsgs,
+                    maxMsgs,
+                    sumMsgs);
+
+    SLIC_INFO(axom::fmt::format(
+      "Query sent {} messages with {} bytes in total"
+      " (per rank bytes: {{avg:{}, min:{}, max:{}}})",
+      sumMsgs,
+      sumBytes,
+      sumBytes / num_ranks,
+      minBytes,
+      maxBytes));
+
+    double minLocal, maxLocal, sumLocal;
+    getDoubleMinMax(query.getLocalSearchTime(), minLocal, maxLocal, sumLocal);
+
+    double minRemote, maxRemote, sumRemote;
+    getDoubleMinMax(query.getRemoteSearchTime(),
+                    minRemote,
+                    maxRemote,
+                    sumRemote);
+
+    double minIdle, maxIdle, sumIdle;
+    getDoubleMinMax(query.getIdleTime(), minIdle, maxIdle, sumIdle);
+
+    SLIC_INFO(axom::fmt::format(
+      "Query per rank seconds: local search {{avg:{}, min:{}, max:{}}},"
+      " search for other ranks {{avg:{}, min:{}, max:{}}},"
+      " idle {{avg:{}, min:{}, max:{}}}",
+      sumLocal / num_ranks,
+      minLocal,
+      maxLocal,
+      sumRemote / num_ranks,
+      minRemote,
+      maxRemote,
+      sumIdle / num_ranks,
+      minIdle,
+      maxIdle));
   }
   slic::flushStreams();
 
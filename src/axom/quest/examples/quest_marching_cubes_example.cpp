@@ -92,6 +92,10 @@ public:
 
   bool checkResults {false};
 
+  bool weldNodes {false};
+
+  bool computeNormals {false};
+
   RuntimePolicy policy {RuntimePolicy::seq};
 
 private:
@@ -149,6 +153,14 @@ public:
         "Enable/disable checking results against analytical solution")
       ->capture_default_str();
 
+    app.add_flag("--weld,!--no-weld", weldNodes)
+      ->description("Enable/disable sharing of contour nodes between cells")
+      ->capture_default_str();
+
+    app.add_flag("--normals,!--no-normals", computeNormals)
+      ->description("Enable/disable computing contour node normals")
+      ->capture_default_str();
+
     app.get_formatter()->column_width(60);
 
     // could throw an exception
@@ -653,6 +665,7 @@ struct ContourTestBase
   ContourTestBase(const ValueFunctorType& valueFunctor)
     : m_parentCellIdField("parentCellIds")
     , m_domainIdField("domainIdField")
+    , m_normalField("normals")
     , m_valueFunctor(valueFunctor)
   { }
   virtual ~ContourTestBase() { }
@@ -668,6 +681,7 @@ struct ContourTestBase
 
   const std::string m_parentCellIdField;
   const std::string m_domainIdField;
+  const std::string m_normalField;
   ValueFunctorType m_valueFunctor;
 
   int runTest(BlueprintStructuredMesh& computationalMesh, quest::MarchingCubes& mc)
@@ -769,7 +783,13 @@ struct ContourTestBase
       meshGroup,
       mc.getContourNodeCount(),
       mc.getContourCellCount());
-    mc.populateContourMesh(contourMesh, m_parentCellIdField, m_domainIdField);
+    axom::utilities::Timer populateTimer(true);
+    mc.populateContourMesh(contourMesh,
+                           m_parentCellIdField,
+                           m_domainIdField,
+                           params.computeNormals ? m_normalField : "");
+    populateTimer.stop();
+    printTimingStats(populateTimer, name() + " populate contour mesh");
 
     int localErrCount = 0;
     if(params.checkResults)
@@ -1404,6 +1424,8 @@ int testNdimInstance(BlueprintStructuredMesh& computationalMesh)
   quest::MarchingCubes mc(params.policy,
                           computationalMesh.asConduitNode(),
                           "mesh");
+  mc.setWeldNodes(params.weldNodes);
+  mc.setComputeNormals(params.computeNormals);
 
   //---------------------------------------------------------------------------
   // params specify which tests to run.
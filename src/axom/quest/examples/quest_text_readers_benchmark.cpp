@@ -0,0 +1,434 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file quest_text_readers_benchmark.cpp
+ *
+ * \brief Measures the throughput, in MB/s, of the ascii STL, Pro/E and SU2
+ *  readers, and compares it to parsing the same files with std::ifstream
+ *
+ * The example writes a tetrahedral mesh of a cube in each format, then reads
+ * it back with the readers and with a stream-based parser.
+ */
+
+#include "axom/config.hpp"
+#include "axom/core.hpp"
+#include "axom/mint.hpp"
+#include "axom/slic.hpp"
+#include "axom/quest/readers/ProEReader.hpp"
+#include "axom/quest/readers/STLReader.hpp"
+
+#include "axom/CLI11.hpp"
+#include "axom/fmt.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace mint = axom::mint;
+namespace quest = axom::quest;
+namespace slic = axom::slic;
+namespace utilities = axom::utilities;
+
+namespace
+{
+struct Arguments
+{
+  int resolution {40};
+  int repetitions {3};
+  std::vector<std::string> formats {"stl", "proe", "su2"};
+  bool keepFiles {false};
+
+  void parse(int argc, char** argv, axom::CLI::App& app)
+  {
+    app
+      .add_option("-r,--resolution",
+                  resolution,
+                  "Number of cells along each side of the cube")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app
+      .add_option("-n,--repetitions",
+                  repetitions,
+                  "Number of times each file is read")
+      ->capture_default_str()
+      ->check(axom::CLI::PositiveNumber);
+
+    app.add_option("-f,--formats", formats, "File formats to benchmark")
+      ->capture_default_str()
+      ->check(axom::CLI::IsMember({"stl", "proe", "su2"}));
+
+    app.add_flag("--keep", keepFiles, "Keep the generated files")
+      ->capture_default_str();
+
+    app.get_formatter()->column_width(40);
+
+    app.parse(argc, argv);
+  }
+};
+
+/// A tetrahedral mesh of the unit cube, with 6 tets for each cell
+struct CubeMesh
+{
+  std::vector<double> nodes;
+  std::vector<int> tets;
+
+  explicit CubeMesh(int res)
+  {
+    const int n = res + 1;
+    for(int k = 0; k < n; ++k)
+    {
+      for(int j = 0; j < n; ++j)
+      {
+        for(int i = 0; i < n; ++i)
+        {
+          // Perturb the nodes so the coordinates have many digits
+          nodes.push_back(i / double(res) + 1e-7 * j);
+          nodes.push_back(j / double(res) + 1e-7 * k);
+          nodes.push_back(k / double(res) + 1e-7 * i);
+        }
+      }
+    }
+
+    auto node = [n](int i, int j, int k) { return (k * n + j) * n + i; };
+    for(int k = 0; k < res; ++k)
+    {
+      for(int j = 0; j < res; ++j)
+      {
+        for(int i = 0; i < res; ++i)
+        {
+          const int c[8] = {node(i, j, k),
+                            node(i + 1, j, k),
+                            node(i + 1, j + 1, k),
+                            node(i, j + 1, k),
+                            node(i, j, k + 1),
+                            node(i + 1, j, k + 1),
+                            node(i + 1, j + 1, k + 1),
+                            node(i, j + 1, k + 1)};
+          const int cellTets[6][4] = {{0, 1, 2, 6},
+                                      {0, 2, 3, 6},
+                                      {0, 3, 7, 6},
+                                      {0, 7, 4, 6},
+                                      {0, 4, 5, 6},
+                                      {0, 5, 1, 6}};
+          for(const auto& t : cellTets)
+          {
+            for(int v : t)
+            {
+              tets.push_back(c[v]);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  int numNodes() const { return static_cast<int>(nodes.size() / 3); }
+  int numTets() const { return static_cast<int>(tets.size() / 4); }
+};
+
+void writeSTL(const CubeMesh& mesh, const std::string& fileName)
+{
+  // Writes the faces of the tets, which is enough text for a benchmark
+  std::ofstream ofs(fileName);
+  ofs.precision(16);
+  ofs << "solid cube\n";
+  const int faces[4][3] = {{0, 1, 2}, {0, 3, 1}, {1, 3, 2}, {0, 2, 3}};
+  for(int t = 0; t < mesh.numTets(); ++t)
+  {
+    for(const auto& f : faces)
+    {
+      ofs << "  facet normal 0 0 0\n    outer loop\n";
+      for(int v : f)
+      {
+        const double* x = &mesh.nodes[3 * mesh.tets[4 * t + v]];
+        ofs << "      vertex " << x[0] << " " << x[1] << " " << x[2] << "\n";
+      }
+      ofs << "    endloop\n  endfacet\n";
+    }
+  }
+  ofs << "endsolid cube\n";
+}
+
+void writeProE(const CubeMesh& mesh, const std::string& fileName)
+{
+  std::ofstream ofs(fileName);
+  ofs.precision(16);
+  ofs << "# Tetrahedral mesh of a cube\n";
+  ofs << mesh.numNodes() << " " << mesh.numTets() << "\n";
+  for(int i = 0; i < mesh.numNodes(); ++i)
+  {
+    ofs << i + 1 << " " << mesh.nodes[3 * i] << " " << mesh.nodes[3 * i + 1]
+        << " " << mesh.nodes[3 * i + 2] << "\n";
+  }
+  for(int t = 0; t < mesh.numTets(); ++t)
+  {
+    ofs << t + 1;
+    for(int v = 0; v < 4; ++v)
+    {
+      ofs << " " << mesh.tets[4 * t + v] + 1;
+    }
+    ofs << "\n";
+  }
+}
+
+void writeSU2(const CubeMesh& mesh, const std::string& fileName)
+{
+  constexpr int SU2_TET = 10;
+
+  std::ofstream ofs(fileName);
+  ofs.precision(16);
+  ofs << "% Tetrahedral mesh of a cube\n";
+  ofs << "NDIME= 3\n";
+  ofs << "NELEM= " << mesh.numTets() << "\n";
+  for(int t = 0; t < mesh.numTets(); ++t)
+  {
+    ofs << SU2_TET;
+    for(int v = 0; v < 4; ++v)
+    {
+      ofs << " " << mesh.tets[4 * t + v];
+    }
+    ofs << " " << t << "\n";
+  }
+  ofs << "NPOIN= " << mesh.numNodes() << "\n";
+  for(int i = 0; i < mesh.numNodes(); ++i)
+  {
+    ofs << mesh.nodes[3 * i] << " " << mesh.nodes[3 * i + 1] << " "
+        << mesh.nodes[3 * i + 2] << " " << i << "\n";
+  }
+}
+
+//------------------------------------------------------------------------------
+// Stream-based parsers, as a baseline
+//------------------------------------------------------------------------------
+axom::IndexType streamReadSTL(const std::string& fileName)
+{
+  std::ifstream ifs(fileName);
+  std::vector<double> nodes;
+  std::string token;
+  double x, y, z;
+  while(ifs >> token)
+  {
+    if(token == "vertex" && (ifs >> x >> y >> z))
+    {
+      nodes.push_back(x);
+      nodes.push_back(y);
+      nodes.push_back(z);
+    }
+  }
+  return static_cast<axom::IndexType>(nodes.size() / 3);
+}
+
+axom::IndexType streamReadProE(const std::string& fileName)
+{
+  std::ifstream ifs(fileName);
+  std::string junk;
+  while(ifs.peek() == '#')
+  {
+    std::getline(ifs, junk);
+  }
+
+  int numNodes = 0, numTets = 0, id;
+  ifs >> numNodes >> numTets;
+  std::vector<double> nodes(3 * numNodes);
+  std::vector<int> tets(4 * numTets);
+  for(int i = 0; i < numNodes; ++i)
+  {
+    ifs >> id >> nodes[3 * i] >> nodes[3 * i + 1] >> nodes[3 * i + 2];
+  }
+  for(int i = 0; i < numTets; ++i)
+  {
+    ifs >> id >> tets[4 * i] >> tets[4 * i + 1] >> tets[4 * i + 2] >>
+      tets[4 * i + 3];
+  }
+  return numNodes;
+}
+
+axom::IndexType streamReadSU2(const std::string& fileName)
+{
+  // Builds the mesh, like mint::read_su2()
+  std::ifstream ifs(fileName);
+  std::vector<double> nodes;
+  std::vector<axom::IndexType> conn;
+  std::string line;
+  int numNodes = 0, numCells = 0, ctype;
+  while(std::getline(ifs, line))
+  {
+    if(line.substr(0, 6) == "NPOIN=")
+    {
+      numNodes = std::stoi(line.substr(6));
+      nodes.resize(3 * numNodes);
+      for(int i = 0; i < numNodes; ++i)
+      {
+        ifs >> nodes[3 * i] >> nodes[3 * i + 1] >> nodes[3 * i + 2];
+        std::getline(ifs, line);
+      }
+    }
+    else if(line.substr(0, 6) == "NELEM=")
+    {
+      numCells = std::stoi(line.substr(6));
+      conn.resize(4 * numCells);
+      for(int i = 0; i < numCells; ++i)
+      {
+        ifs >> ctype >> conn[4 * i] >> conn[4 * i + 1] >> conn[4 * i + 2] >>
+          conn[4 * i + 3];
+        std::getline(ifs, line);
+      }
+    }
+  }
+
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE> mesh(3,
+                                                  mint::TET,
+                                                  numNodes,
+                                                  numCells);
+  for(int i = 0; i < numNodes; ++i)
+  {
+    mesh.appendNodes(&nodes[3 * i], 1);
+  }
+  for(int i = 0; i < numCells; ++i)
+  {
+    mesh.appendCell(&conn[4 * i]);
+  }
+  return mesh.getNumberOfNodes();
+}
+
+//------------------------------------------------------------------------------
+// Reads with the axom readers
+//------------------------------------------------------------------------------
+axom::IndexType readSTL(const std::string& fileName)
+{
+  quest::STLReader reader;
+  reader.setFileName(fileName);
+  return (reader.read() == 0) ? reader.getNumNodes() : -1;
+}
+
+axom::IndexType readProE(const std::string& fileName)
+{
+  quest::ProEReader reader;
+  reader.setFileName(fileName);
+  return (reader.read() == 0) ? reader.getNumNodes() : -1;
+}
+
+axom::IndexType readSU2(const std::string& fileName)
+{
+  mint::Mesh* mesh = nullptr;
+  const axom::IndexType numNodes =
+    (mint::read_su2(fileName, mesh) == 0) ? mesh->getNumberOfNodes() : -1;
+  delete mesh;
+  return numNodes;
+}
+
+double fileSizeMB(const std::string& fileName)
+{
+  std::ifstream ifs(fileName, std::ios::in | std::ios::binary | std::ios::ate);
+  return static_cast<double>(ifs.tellg()) / (1024. * 1024.);
+}
+
+using ReadFunction = std::function<axom::IndexType(const std::string&)>;
+
+/// Returns the best throughput of several reads of \a fileName, in MB/s
+double throughput(const ReadFunction& read,
+                  const std::string& fileName,
+                  double fileMB,
+                  int repetitions,
+                  axom::IndexType& numNodes)
+{
+  double bestTime = -1.;
+  for(int r = 0; r < repetitions; ++r)
+  {
+    utilities::Timer timer(true);
+    numNodes = read(fileName);
+    timer.stop();
+    const double time = timer.elapsedTimeInSec();
+    bestTime = (bestTime < 0. || time < bestTime) ? time : bestTime;
+  }
+  return fileMB / bestTime;
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  slic::SimpleLogger logger(slic::message::Info);
+
+  Arguments args;
+  axom::CLI::App app {
+    "Benchmark for the throughput of quest's and mint's ascii mesh readers"};
+
+  try
+  {
+    args.parse(argc, argv, app);
+  }
+  catch(const axom::CLI::ParseError& e)
+  {
+    return app.exit(e);
+  }
+
+  struct Format
+  {
+    std::string extension;
+    std::function<void(const CubeMesh&, const std::string&)> write;
+    ReadFunction read;
+    ReadFunction streamRead;
+  };
+  const std::map<std::string, Format> allFormats {
+    {"stl", {"stl", writeSTL, readSTL, streamReadSTL}},
+    {"proe", {"proe", writeProE, readProE, streamReadProE}},
+    {"su2", {"su2", writeSU2, readSU2, streamReadSU2}}};
+
+  SLIC_INFO(axom::fmt::format("Generating a mesh with {}^3 cells",
+                              args.resolution));
+  const CubeMesh mesh(args.resolution);
+
+  int numFailures = 0;
+  for(const auto& name : args.formats)
+  {
+    const Format& format = allFormats.at(name);
+    const std::string fileName = "text_readers_benchmark." + format.extension;
+    format.write(mesh, fileName);
+    const double fileMB = fileSizeMB(fileName);
+
+    axom::IndexType numNodes = 0;
+    axom::IndexType streamNumNodes = 0;
+    const double readerMBs =
+      throughput(format.read, fileName, fileMB, args.repetitions, numNodes);
+    const double streamMBs = throughput(format.streamRead,
+                                        fileName,
+                                        fileMB,
+                                        args.repetitions,
+                                        streamNumNodes);
+
+    SLIC_INFO(axom::fmt::format(
+      "{:>5}: {:8.1f} MB file | reader {:8.1f} MB/s | ifstream {:8.1f} MB/s "
+      "| speedup {:5.2f}x",
+      name,
+      fileMB,
+      readerMBs,
+      streamMBs,
+      readerMBs / streamMBs));
+
+    if(numNodes != streamNumNodes)
+    {
+      SLIC_WARNING(axom::fmt::format(
+        "{} reader found {} nodes, but the stream parser found {}",
+        name,
+        numNodes,
+        streamNumNodes));
+      ++numFailures;
+    }
+
+    if(!args.keepFiles)
+    {
+      std::remove(fileName.c_str());
+    }
+  }
+
+  return (numFailures == 0) ? 0 : 1;
+}
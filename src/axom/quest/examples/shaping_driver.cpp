@@ -79,9 +79,13 @@ public:
   ShapingMethod shapingMethod {ShapingMethod::Sampling};
   RuntimePolicy policy {RuntimePolicy::seq};
   int quadratureOrder {5};
+  double samplingErrorTarget {-1.};
   int outputOrder {2};
   int samplesPerKnotSpan {25};
   int refinementLevel {7};
+  bool classifyCells {true};
+  bool directHexClipping {true};
+  bool batchShapes {false};
   double weldThresh {1e-9};
   double percentError {-1.};
 
@@ -283,6 +287,16 @@ public:
         ->capture_default_str()
         ->check(axom::CLI::PositiveNumber);
 
+      sampling_options
+        ->add_option("--sampling-error-target", samplingErrorTarget)
+        ->description(
+          "Target error of the sampled volume fractions, relative to the "
+          "element size. \n"
+          "When positive, replaces the quadrature order and samples "
+          "adaptively: elements are first sampled at a few points and only "
+          "sampled at all the points when these disagree")
+        ->capture_default_str();
+
       std::map<std::string, VolFracSampling> vfsamplingMap {
         {"qpts", VolFracSampling::SAMPLE_AT_QPTS},
         {"dofs", VolFracSampling::SAMPLE_AT_DOFS}};
@@ -307,6 +321,27 @@ public:
         ->capture_default_str()
         ->check(axom::CLI::NonNegativeNumber);
 
+      intersection_options
+        ->add_flag("--classify-cells,!--no-classify-cells", classifyCells)
+        ->description(
+          "Classify cells as inside or outside of each shape before "
+          "clipping, so only the cells on the shape boundary are clipped")
+        ->capture_default_str();
+
+      intersection_options
+        ->add_flag("--direct-hex-clipping,!--no-direct-hex-clipping",
+                   directHexClipping)
+        ->description(
+          "Clip hexahedral cells with planar faces directly instead of "
+          "decomposing them into 24 tetrahedra")
+        ->capture_default_str();
+
+      intersection_options->add_flag("--batch-shapes", batchShapes)
+        ->description(
+          "Compute the overlap volumes of all the shapes in a single pass "
+          "over the mesh, then apply the replacement rules in order")
+        ->capture_default_str();
+
       std::stringstream pol_sstr;
       pol_sstr << "Set runtime policy for intersection-based sampling method.";
 #if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
@@ -573,6 +608,7 @@ int main(int argc, char** argv)
   {
     samplingShaper->setSamplingType(params.vfSampling);
     samplingShaper->setQuadratureOrder(params.quadratureOrder);
+    samplingShaper->setSamplingErrorTarget(params.samplingErrorTarget);
     samplingShaper->setVolumeFractionOrder(params.outputOrder);
 
     // register a point projector
@@ -592,6 +628,8 @@ int main(int argc, char** argv)
   {
     intersectionShaper->setLevel(params.refinementLevel);
     intersectionShaper->setExecPolicy(params.policy);
+    intersectionShaper->setCellClassification(params.classifyCells);
+    intersectionShaper->setDirectHexClipping(params.directHexClipping);
 
     if(!params.backgroundMaterial.empty())
     {
@@ -639,32 +677,71 @@ int main(int argc, char** argv)
   // Process each of the shapes
   //---------------------------------------------------------------------------
   SLIC_INFO(axom::fmt::format("{:=^80}", "Sampling InOut fields for shapes"));
-  for(const auto& shape : params.shapeSet.getShapes())
+  axom::utilities::Timer shapingTimer(true);
+  auto* batchShaper = params.batchShapes
+    ? dynamic_cast<quest::IntersectionShaper*>(shaper)
+    : nullptr;
+  if(batchShaper != nullptr)
   {
-    std::string shapeFormat = shape.getGeometry().getFormat();
-    SLIC_INFO(
-      axom::fmt::format("{:-^80}",
-                        axom::fmt::format("Shape format is {}", shapeFormat)));
-
-    // Load the shape from file. This also applies any transformations.
-    shaper->loadShape(shape);
+    // Shape all the shapes in a single pass over the mesh
+    batchShaper->runBatchedShapeQueries(shapeDim);
     slic::flushStreams();
+  }
+  else
+  {
+    for(const auto& shape : params.shapeSet.getShapes())
+    {
+      std::string shapeFormat = shape.getGeometry().getFormat();
+      SLIC_INFO(axom::fmt::format(
+        "{:-^80}",
+        axom::fmt::format("Shape format is {}", shapeFormat)));
 
-    // Generate a spatial index over the shape
-    shaper->prepareShapeQuery(shapeDim, shape);
-    slic::flushStreams();
+      // Load the shape from file. This also applies any transformations.
+      shaper->loadShape(shape);
+      slic::flushStreams();
 
-    // Query the mesh against this shape
-    shaper->runShapeQuery(shape);
-    slic::flushStreams();
+      // Generate a spatial index over the shape
+      shaper->prepareShapeQuery(shapeDim, shape);
+      slic::flushStreams();
 
-    // Apply the replacement rules for this shape against the existing materials
-    shaper->applyReplacementRules(shape);
-    slic::flushStreams();
+      // Query the mesh against this shape
+      shaper->runShapeQuery(shape);
+      slic::flushStreams();
 
-    // Finalize data structures associated with this shape and spatial index
-    shaper->finalizeShapeQuery();
-    slic::flushStreams();
+      // Apply the replacement rules for this shape against the existing
+      // materials
+      shaper->applyReplacementRules(shape);
+      slic::flushStreams();
+
+      // Finalize data structures associated with this shape and spatial index
+      shaper->finalizeShapeQuery();
+      slic::flushStreams();
+    }
+  }
+  shapingTimer.stop();
+  SLIC_INFO(axom::fmt::format("Shaping the {} shapes took {} s",
+                              params.shapeSet.getShapes().size(),
+                              shapingTimer.elapsedTimeInSec()));
+
+  if(auto* samplingShaper = dynamic_cast<quest::SamplingShaper*>(shaper))
+  {
+    const auto numQueries = samplingShaper->getNumSampleQueries();
+    const auto numPoints = samplingShaper->getNumSamplePoints();
+    const double samplingTime = samplingShaper->getSamplingTime();
+    if(numQueries > 0)
+    {
+      // Querying all the points would take about numPoints / numQueries
+      // times as long
+      SLIC_INFO(axom::fmt::format(
+        axom::utilities::locale(),
+        "Queried {:L} of {:L} sample points ({:.1f}% fewer) in {} s; "
+        "querying all the points would take about {:.3f} s",
+        numQueries,
+        numPoints,
+        100. * (numPoints - numQueries) / numPoints,
+        samplingTime,
+        samplingTime * numPoints / numQueries));
+    }
   }
 
   //---------------------------------------------------------------------------
@@ -13,6 +13,14 @@
 #include "axom/quest/interface/internal/QuestHelpers.hpp"
 #include "axom/quest/InOutOctree.hpp"
 
+#include <cstdio>
+
+#ifdef WIN32
+  #include <process.h>
+#else
+  #include <unistd.h>
+#endif
+
 namespace axom
 {
 namespace quest
@@ -26,6 +34,7 @@ struct InOutParameters
   int m_dimension {3};
   int m_segmentsPerKnotSpan {25};  /// Used when linearizing curves
   double m_vertexWeldThreshold {1E-9};
+  std::string m_indexCacheFile;  /// Empty when not caching the spatial index
 
   void setDefault() { *this = InOutParameters {}; }
 };
@@ -85,6 +94,11 @@ struct InOutHelper
     m_params.m_segmentsPerKnotSpan = numSegments;
   }
 
+  void setIndexCacheFile(const std::string& fileName)
+  {
+    m_params.m_indexCacheFile = fileName;
+  }
+
   /*!
    * Initializes the InOut query from an stl file
    *
@@ -116,7 +130,10 @@ struct InOutHelper
 #endif
       break;
     case 3:
-      rc = internal::read_stl_mesh(file, mesh, comm);
+      rc = internal::read_stl_mesh(file,
+                                   mesh,
+                                   comm,
+                                   m_params.m_vertexWeldThreshold);
       break;
     default:  // no-op
       break;
@@ -192,8 +209,18 @@ struct InOutHelper
     // set params
     m_inoutTree->setVertexWeldThreshold(m_params.m_vertexWeldThreshold);
 
-    // initialize the spatial index
-    m_inoutTree->generateIndex();
+    // initialize the spatial index, reusing a cached index when available
+    const std::string& cacheFile = m_params.m_indexCacheFile;
+    if(cacheFile.empty() || !m_inoutTree->loadIndex(cacheFile))
+    {
+      m_inoutTree->generateIndex();
+
+      // Only one rank writes the cache; the others keep their in-memory index
+      if(!cacheFile.empty() && getCommRank(comm) == 0)
+      {
+        saveIndexCache(cacheFile);
+      }
+    }
 
     // Update the mesh parameter since the InOutOctree modifies the mesh
     mesh = m_surfaceMesh;
@@ -204,6 +231,57 @@ struct InOutHelper
     return QUEST_INOUT_SUCCESS;
   }
 
+  /*!
+   * Saves the generated spatial index to \a cacheFile
+   *
+   * The index is written to a process-specific temporary file which is then
+   * renamed to \a cacheFile, so other processes never load a partially
+   * written index.
+   */
+  void saveIndexCache(const std::string& cacheFile) const
+  {
+    const std::string tmpFile = fmt::format("{}.{}.{}.tmp",
+                                            cacheFile,
+                                            utilities::getHostName(),
+                                            getProcessId());
+
+    if(!m_inoutTree->saveIndex(tmpFile))
+    {
+      utilities::filesystem::removeFile(tmpFile);
+      return;
+    }
+
+    if(std::rename(tmpFile.c_str(), cacheFile.c_str()) != 0)
+    {
+      SLIC_WARNING(fmt::format("Could not move InOutOctree index '{}' to '{}'",
+                               tmpFile,
+                               cacheFile));
+      utilities::filesystem::removeFile(tmpFile);
+    }
+  }
+
+  /// Returns the rank of this process in \a comm
+  static int getCommRank(MPI_Comm comm)
+  {
+    int rank = 0;
+#ifdef AXOM_USE_MPI
+    MPI_Comm_rank(comm, &rank);
+#else
+    AXOM_UNUSED_VAR(comm);
+#endif
+    return rank;
+  }
+
+  /// Returns the id of this process
+  static long getProcessId()
+  {
+#ifdef WIN32
+    return static_cast<long>(_getpid());
+#else
+    return static_cast<long>(getpid());
+#endif
+  }
+
   /*!
    * Finalizes the InOut query
    *
@@ -267,6 +345,8 @@ struct InOutHelper
              int npoints,
              int* res) const
   {
+    // Gather the query points and use the octree's batched query
+    axom::Array<SpacePt> pts(npoints, npoints);
     if(z == nullptr)
     {
 #ifdef AXOM_USE_OPENMP
@@ -274,8 +354,7 @@ struct InOutHelper
 #endif
       for(int i = 0; i < npoints; ++i)
       {
-        const bool ins = m_inoutTree->within(SpacePt {x[i], y[i]});
-        res[i] = ins ? 1 : 0;
+        pts[i] = SpacePt {x[i], y[i]};
       }
     }
     else
@@ -285,11 +364,12 @@ struct InOutHelper
 #endif
       for(int i = 0; i < npoints; ++i)
       {
-        const bool ins = m_inoutTree->within(SpacePt {x[i], y[i], z[i]});
-        res[i] = ins ? 1 : 0;
+        pts[i] = SpacePt {x[i], y[i], z[i]};
       }
     }
 
+    m_inoutTree->within(pts, axom::ArrayView<int>(res, npoints));
+
     return QUEST_INOUT_SUCCESS;
   }
 
@@ -340,6 +420,7 @@ int inout_init(const std::string& file, MPI_Comm comm)
     s_inoutHelper2D.setVerbose(s_inoutParams.m_verbose);
     s_inoutHelper2D.setSegmentsPerKnotSpan(s_inoutParams.m_segmentsPerKnotSpan);
     s_inoutHelper2D.setVertexWeldThreshold(s_inoutParams.m_vertexWeldThreshold);
+    s_inoutHelper2D.setIndexCacheFile(s_inoutParams.m_indexCacheFile);
 
     rc = s_inoutHelper2D.initialize(file, comm);
     break;
@@ -347,6 +428,7 @@ int inout_init(const std::string& file, MPI_Comm comm)
   case 3:
     s_inoutHelper3D.setVerbose(s_inoutParams.m_verbose);
     s_inoutHelper3D.setVertexWeldThreshold(s_inoutParams.m_vertexWeldThreshold);
+    s_inoutHelper3D.setIndexCacheFile(s_inoutParams.m_indexCacheFile);
 
     rc = s_inoutHelper3D.initialize(file, comm);
     break;
@@ -377,6 +459,7 @@ int inout_init(mint::Mesh*& mesh, MPI_Comm comm)
     s_inoutHelper2D.setVerbose(s_inoutParams.m_verbose);
     s_inoutHelper2D.setSegmentsPerKnotSpan(s_inoutParams.m_segmentsPerKnotSpan);
     s_inoutHelper2D.setVertexWeldThreshold(s_inoutParams.m_vertexWeldThreshold);
+    s_inoutHelper2D.setIndexCacheFile(s_inoutParams.m_indexCacheFile);
 
     rc = s_inoutHelper2D.initialize(mesh, comm);
     break;
@@ -385,6 +468,7 @@ int inout_init(mint::Mesh*& mesh, MPI_Comm comm)
     s_inoutHelper3D.setVerbose(s_inoutParams.m_verbose);
     s_inoutHelper3D.setSegmentsPerKnotSpan(s_inoutParams.m_segmentsPerKnotSpan);
     s_inoutHelper3D.setVertexWeldThreshold(s_inoutParams.m_vertexWeldThreshold);
+    s_inoutHelper3D.setIndexCacheFile(s_inoutParams.m_indexCacheFile);
 
     rc = s_inoutHelper3D.initialize(mesh, comm);
     break;
@@ -669,5 +753,20 @@ int inout_set_segments_per_knot_span(int segmentsPerKnotSpan)
   return QUEST_INOUT_SUCCESS;
 }
 
+int inout_set_index_cache_file(const std::string& fileName)
+{
+  if(inout_initialized())
+  {
+    SLIC_WARNING("quest inout query must NOT be initialized "
+                 << "prior to calling 'inout_set_index_cache_file'");
+
+    return QUEST_INOUT_FAILED;
+  }
+
+  s_inoutParams.m_indexCacheFile = fileName;
+
+  return QUEST_INOUT_SUCCESS;
+}
+
 }  // end namespace quest
 }  // end namespace axom
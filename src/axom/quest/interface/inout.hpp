@@ -226,6 +226,9 @@ int inout_set_verbose(bool verbosity);
  * while a value that is too low risks leaving gaps in meshes with tolerances
  * between vertices. The default value tends to work well in practice.
  *
+ * The vertices of STL meshes are welded with this threshold while the mesh
+ * is read, before the octree is built.
+ *
  * \param thresh Cutoff distance for welding vertices
  * \return Return code is QUEST_INOUT_SUCCESS if successful
  *  and QUEST_INOUT_FAILED otherwise.
@@ -251,6 +254,24 @@ int inout_set_vertex_weld_threshold(double thresh);
  */
 int inout_set_segments_per_knot_span(int segmentsPerKnotSpan);
 
+/*!
+ * \brief Sets a file for caching the spatial index between runs
+ *
+ * When set, inout_init() attempts to load the spatial index from this file
+ * rather than generating it. The cached index is only used when it was
+ * generated from the same surface mesh and vertex welding threshold;
+ * otherwise, the index is generated and saved to the file for later runs.
+ * When running with MPI, only rank 0 of the communicator writes the file;
+ * it is written to a temporary file and then renamed, so concurrent runs
+ * never load a partially written index. By default, the index is not cached.
+ *
+ * \param fileName Path to the cache file, or an empty string to disable caching
+ * \return Return code is QUEST_INOUT_SUCCESS if successful
+ *  and QUEST_INOUT_FAILED otherwise.
+ * \pre inout_initialized() == false
+ */
+int inout_set_index_cache_file(const std::string& fileName);
+
 /// @}
 
 }  // end namespace quest
@@ -309,7 +309,10 @@ int read_stl_mesh_shared(const std::string& file,
 /*
  * Reads in the surface mesh from the specified file.
  */
-int read_stl_mesh(const std::string& file, mint::Mesh*& m, MPI_Comm comm)
+int read_stl_mesh(const std::string& file,
+                  mint::Mesh*& m,
+                  MPI_Comm comm,
+                  double vertexWeldThreshold)
 {
   // NOTE: STL meshes are always 3D
   constexpr int DIMENSION = 3;
@@ -335,6 +338,7 @@ int read_stl_mesh(const std::string& file, mint::Mesh*& m, MPI_Comm comm)
 
   // STEP 3: read the mesh from the STL file
   reader.setFileName(file);
+  reader.setVertexWeldingThreshold(vertexWeldThreshold);
   int rc = reader.read();
   if(rc == READ_SUCCESS)
   {
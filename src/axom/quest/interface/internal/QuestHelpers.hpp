@@ -236,6 +236,8 @@ int read_stl_mesh_shared(const std::string& file,
  * \param [in] file the file consisting of the surface
  * \param [out] m user-supplied pointer to point to the mesh object.
  * \param [in] comm the MPI communicator, only applicable when MPI is available.
+ * \param [in] vertexWeldThreshold threshold for welding the vertices of
+ *  the triangles while building the mesh; vertices are not welded when zero.
  *
  * \note This method currently expects the surface mesh to be given in STL format.
  *
@@ -257,7 +259,8 @@ int read_stl_mesh_shared(const std::string& file,
  */
 int read_stl_mesh(const std::string& file,
                   mint::Mesh*& m,
-                  MPI_Comm comm = MPI_COMM_SELF);
+                  MPI_Comm comm = MPI_COMM_SELF,
+                  double vertexWeldThreshold = 0.);
 
 #ifdef AXOM_USE_C2C
 /*!
@@ -5,6 +5,13 @@
 
 #include "axom/quest/readers/PSTLReader.hpp"
 
+#include "axom/core/utilities/Utilities.hpp"
+#include "axom/slic/interface/slic.hpp"
+
+// C/C++ includes
+#include <cstdint>
+#include <vector>
+
 namespace axom
 {
 namespace quest
@@ -13,18 +20,46 @@ namespace
 {
 constexpr int READER_SUCCESS = 0;
 constexpr int READER_FAILED = -1;
+
+/// Number of triangle records read by each rank per MPI-IO call (~50MB)
+constexpr axom::IndexType IO_CHUNK_TRIS = 1 << 20;
+
+/// Returns the first triangle of part \a part out of \a numParts
+axom::IndexType partitionOffset(axom::IndexType numTris, int part, int numParts)
+{
+  return static_cast<axom::IndexType>(
+    static_cast<std::int64_t>(numTris) * part / numParts);
+}
 }  // namespace
 
 //------------------------------------------------------------------------------
 PSTLReader::PSTLReader(MPI_Comm comm) : m_comm(comm)
 {
   MPI_Comm_rank(m_comm, &m_my_rank);
+  MPI_Comm_size(m_comm, &m_num_ranks);
+}
+
+//------------------------------------------------------------------------------
+PSTLReader::~PSTLReader() { freeSharedWindow(); }
+
+//------------------------------------------------------------------------------
+void PSTLReader::freeSharedWindow()
+{
+  if(m_nodeWindow != MPI_WIN_NULL)
+  {
+    MPI_Win_free(&m_nodeWindow);
+  }
+  if(m_nodeComm != MPI_COMM_NULL)
+  {
+    MPI_Comm_free(&m_nodeComm);
+  }
+  m_sharedNodes = nullptr;
 }
 
 //------------------------------------------------------------------------------
-PSTLReader::~PSTLReader()
+const double* PSTLReader::getNodeData() const
 {
-  // TODO Auto-generated destructor stub
+  return (m_sharedNodes != nullptr) ? m_sharedNodes : STLReader::getNodeData();
 }
 
 //------------------------------------------------------------------------------
@@ -34,7 +69,33 @@ int PSTLReader::read()
 
   // Clear internal data-structures
   this->clear();
+  this->freeSharedWindow();
 
+  if(m_readMode == ReadMode::ROOT_BROADCAST)
+  {
+    return readAndBroadcast();
+  }
+
+  // Rank 0 checks the format. Ascii files, and files that cannot be read,
+  // are handled by the default mode.
+  axom::IndexType numTris = READER_FAILED;
+  if(m_my_rank == 0 && !m_fileName.empty())
+  {
+    axom::IndexType binaryTris = READER_FAILED;
+    if(!isAsciiFormat(&binaryTris))
+    {
+      numTris = binaryTris;
+    }
+  }
+  MPI_Bcast(&numTris, 1, axom::mpi_traits<axom::IndexType>::type, 0, m_comm);
+
+  return (numTris == READER_FAILED) ? readAndBroadcast()
+                                    : readCollectively(numTris);
+}
+
+//------------------------------------------------------------------------------
+int PSTLReader::readAndBroadcast()
+{
   int rc = -1;  // return code
 
   switch(m_my_rank)
@@ -45,11 +106,12 @@ int PSTLReader::read()
     if(rc == READER_SUCCESS)
     {
       MPI_Bcast(&m_num_nodes, 1, axom::mpi_traits<axom::IndexType>::type, 0, m_comm);
-      MPI_Bcast(&m_nodes[0], m_num_nodes * 3, MPI_DOUBLE, 0, m_comm);
+      MPI_Bcast(m_nodes.data(), m_num_nodes * 3, MPI_DOUBLE, 0, m_comm);
     }  // END if
     else
     {
-      MPI_Bcast(&rc, 1, MPI_INT, 0, m_comm);
+      axom::IndexType failed = READER_FAILED;
+      MPI_Bcast(&failed, 1, axom::mpi_traits<axom::IndexType>::type, 0, m_comm);
     }  // END else
     break;
 
@@ -65,7 +127,11 @@ int PSTLReader::read()
       rc = READER_SUCCESS;
       m_num_faces = m_num_nodes / 3;
       m_nodes.resize(m_num_nodes * 3);
-      MPI_Bcast(&m_nodes[0], m_num_nodes * 3, MPI_DOUBLE, 0, m_comm);
+      MPI_Bcast(m_nodes.data(), m_num_nodes * 3, MPI_DOUBLE, 0, m_comm);
+    }
+    else
+    {
+      m_num_nodes = 0;
     }
 
   }  // END switch
@@ -73,5 +139,175 @@ int PSTLReader::read()
   return (rc);
 }
 
+//------------------------------------------------------------------------------
+int PSTLReader::readCollectively(axom::IndexType numTris)
+{
+  const bool useSharedMemory = (m_readMode == ReadMode::SHARED_MEMORY);
+
+  MPI_File fh;
+  int rc = MPI_File_open(m_comm,
+                         const_cast<char*>(m_fileName.c_str()),
+                         MPI_MODE_RDONLY,
+                         MPI_INFO_NULL,
+                         &fh);
+  if(rc != MPI_SUCCESS)
+  {
+    SLIC_WARNING("Cannot open the provided STL file [" << m_fileName << "]");
+    return READER_FAILED;
+  }
+
+  // Each rank converts a contiguous range of the triangles, either of the
+  // whole file or, with shared memory, of the copy held by its node
+  int part = m_my_rank;
+  int numParts = m_num_ranks;
+  double* nodes = nullptr;
+
+  if(useSharedMemory)
+  {
+    MPI_Comm_split_type(m_comm,
+                        MPI_COMM_TYPE_SHARED,
+                        m_my_rank,
+                        MPI_INFO_NULL,
+                        &m_nodeComm);
+    MPI_Comm_rank(m_nodeComm, &part);
+    MPI_Comm_size(m_nodeComm, &numParts);
+
+    // The node's first rank owns the whole allocation
+    const MPI_Aint windowBytes =
+      (part == 0) ? MPI_Aint(9 * numTris * sizeof(double)) : 0;
+    double* localBase = nullptr;
+    MPI_Win_allocate_shared(windowBytes,
+                            sizeof(double),
+                            MPI_INFO_NULL,
+                            m_nodeComm,
+                            &localBase,
+                            &m_nodeWindow);
+
+    MPI_Aint querySize;
+    int dispUnit;
+    MPI_Win_shared_query(m_nodeWindow, 0, &querySize, &dispUnit, &nodes);
+    MPI_Win_fence(0, m_nodeWindow);
+  }
+  else
+  {
+    m_nodes.resize(9 * numTris);
+    nodes = m_nodes.data();
+  }
+
+  const axom::IndexType first = partitionOffset(numTris, part, numParts);
+  const axom::IndexType count =
+    partitionOffset(numTris, part + 1, numParts) - first;
+
+  // Collective reads need the same number of calls on every rank
+  axom::IndexType numChunks = (count + IO_CHUNK_TRIS - 1) / IO_CHUNK_TRIS;
+  MPI_Allreduce(MPI_IN_PLACE,
+                &numChunks,
+                1,
+                axom::mpi_traits<axom::IndexType>::type,
+                MPI_MAX,
+                m_comm);
+
+  rc = readTriangleRange(fh, first, count, numChunks, nodes + 9 * first);
+  MPI_File_close(&fh);
+
+  if(useSharedMemory)
+  {
+    MPI_Win_fence(0, m_nodeWindow);
+    m_sharedNodes = nodes;
+  }
+  else
+  {
+    // Gather the ranges in place, in units of whole triangles
+    MPI_Datatype triType;
+    MPI_Type_contiguous(9, MPI_DOUBLE, &triType);
+    MPI_Type_commit(&triType);
+
+    std::vector<int> counts(m_num_ranks);
+    std::vector<int> displs(m_num_ranks);
+    for(int r = 0; r < m_num_ranks; ++r)
+    {
+      displs[r] = static_cast<int>(partitionOffset(numTris, r, m_num_ranks));
+      counts[r] = static_cast<int>(
+        partitionOffset(numTris, r + 1, m_num_ranks) - displs[r]);
+    }
+
+    MPI_Allgatherv(MPI_IN_PLACE,
+                   0,
+                   MPI_DATATYPE_NULL,
+                   m_nodes.data(),
+                   counts.data(),
+                   displs.data(),
+                   triType,
+                   m_comm);
+    MPI_Type_free(&triType);
+  }
+
+  // All ranks fail if any of them failed
+  MPI_Allreduce(MPI_IN_PLACE, &rc, 1, MPI_INT, MPI_MIN, m_comm);
+  if(rc != READER_SUCCESS)
+  {
+    SLIC_WARNING("Failed to read the provided STL file [" << m_fileName << "]");
+    this->clear();
+    this->freeSharedWindow();
+    return READER_FAILED;
+  }
+
+  m_num_faces = numTris;
+  m_num_nodes = 3 * numTris;
+
+  return READER_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+int PSTLReader::readTriangleRange(MPI_File fh,
+                                  axom::IndexType first,
+                                  axom::IndexType count,
+                                  axom::IndexType numChunks,
+                                  double* nodes)
+{
+  const MPI_Offset dataOffset = BINARY_HEADER_SIZE + sizeof(std::uint32_t);
+
+  std::vector<char> buffer(
+    axom::utilities::min(count, IO_CHUNK_TRIS) * BINARY_TRI_SIZE);
+
+  int rc = READER_SUCCESS;
+  for(axom::IndexType chunk = 0; chunk < numChunks; ++chunk)
+  {
+    const axom::IndexType chunkFirst =
+      axom::utilities::min(chunk * IO_CHUNK_TRIS, count);
+    const axom::IndexType chunkCount =
+      axom::utilities::min(IO_CHUNK_TRIS, count - chunkFirst);
+
+    const MPI_Offset offset =
+      dataOffset + MPI_Offset(first + chunkFirst) * BINARY_TRI_SIZE;
+    const int numBytes = static_cast<int>(chunkCount * BINARY_TRI_SIZE);
+
+    MPI_Status status;
+    const int ioStatus = MPI_File_read_at_all(fh,
+                                              offset,
+                                              buffer.data(),
+                                              numBytes,
+                                              MPI_BYTE,
+                                              &status);
+    if(ioStatus != MPI_SUCCESS)
+    {
+      rc = READER_FAILED;
+      continue;
+    }
+
+    int bytesRead = 0;
+    MPI_Get_count(&status, MPI_BYTE, &bytesRead);
+    if(bytesRead != numBytes)
+    {
+      rc = READER_FAILED;
+      continue;
+    }
+
+    parseBinaryTriangles(buffer.data(), chunkCount, nodes + 9 * chunkFirst);
+  }
+
+  return rc;
+}
+
 }  // end namespace quest
 }  // end namespace axom
@@ -16,25 +16,101 @@ namespace axom
 {
 namespace quest
 {
+/*!
+ * \class PSTLReader
+ *
+ * \brief Reads an STL file to all ranks of an MPI communicator.
+ *
+ * By default, rank 0 reads the file and broadcasts it to the other ranks.
+ * Binary files can instead be read cooperatively with MPI-IO, where each
+ * rank reads and converts a contiguous range of the triangle records:
+ *  - ReadMode::COLLECTIVE_IO gathers the ranges to every rank.
+ *  - ReadMode::SHARED_MEMORY has the ranks of each node convert their ranges
+ *    into a single MPI-3 shared-memory window, so each node holds one copy
+ *    of the vertex positions.
+ *
+ * Ascii files are always read in the default mode.
+ */
 class PSTLReader : public STLReader
 {
+public:
+  /// Strategies for distributing the file contents to the ranks
+  enum class ReadMode
+  {
+    ROOT_BROADCAST,  ///< rank 0 reads the file and broadcasts it
+    COLLECTIVE_IO,   ///< ranks read byte ranges and gather the results
+    SHARED_MEMORY    ///< ranks on a node share one copy of the results
+  };
+
 public:
   PSTLReader() = delete;
   PSTLReader(MPI_Comm comm);
 
   virtual ~PSTLReader();
 
+  /*!
+   * \brief Sets the strategy used to read binary STL files
+   * \param [in] mode the read mode; the default is ReadMode::ROOT_BROADCAST
+   */
+  void setReadMode(ReadMode mode) { m_readMode = mode; }
+
+  /*!
+   * \brief Returns the strategy used to read binary STL files
+   */
+  ReadMode getReadMode() const { return m_readMode; }
+
   /*!
    * \brief Reads in an STL file to all ranks in the associated communicator.
    * 
-   * \note Rank 0 reads in the STL mesh file and broadcasts to the other ranks.
+   * \note In the default mode, rank 0 reads in the STL mesh file and
+   *  broadcasts to the other ranks.
    * \return status set to zero on success; set to a non-zero value otherwise.
+   *
+   * \see setReadMode()
    */
   int read() final override;
 
+protected:
+  /// Returns the positions in the shared window in ReadMode::SHARED_MEMORY
+  const double* getNodeData() const override;
+
+private:
+  /*!
+   * \brief Has rank 0 read the file and broadcast its contents
+   */
+  int readAndBroadcast();
+
+  /*!
+   * \brief Reads a binary file cooperatively with MPI-IO
+   * \param [in] numTris the number of triangles in the file
+   */
+  int readCollectively(axom::IndexType numTris);
+
+  /*!
+   * \brief Reads the triangles in [first, first+count) from \a fh
+   *
+   * The records are read in collective chunks; every rank of \a m_comm
+   * must call this with the same \a numChunks.
+   */
+  int readTriangleRange(MPI_File fh,
+                        axom::IndexType first,
+                        axom::IndexType count,
+                        axom::IndexType numChunks,
+                        double* nodes);
+
+  /// Releases the shared-memory window and its communicator, if any
+  void freeSharedWindow();
+
 private:
   MPI_Comm m_comm {MPI_COMM_NULL};
   int m_my_rank {0};
+  int m_num_ranks {1};
+
+  ReadMode m_readMode {ReadMode::ROOT_BROADCAST};
+
+  MPI_Comm m_nodeComm {MPI_COMM_NULL};
+  MPI_Win m_nodeWindow {MPI_WIN_NULL};
+  const double* m_sharedNodes {nullptr};
 
   DISABLE_COPY_AND_ASSIGNMENT(PSTLReader);
   DISABLE_MOVE_AND_ASSIGNMENT(PSTLReader);
@@ -6,12 +6,12 @@
 #include "axom/quest/readers/ProEReader.hpp"
 
 // Axom includes
+#include "axom/core/utilities/TextParsing.hpp"
 #include "axom/core/utilities/Utilities.hpp"
 #include "axom/mint/mesh/CellTypes.hpp"
 #include "axom/slic/interface/slic.hpp"
 
 // C/C++ includes
-#include <fstream>
 #include <map>
 
 //------------------------------------------------------------------------------
@@ -38,63 +38,95 @@ void ProEReader::clear()
 //------------------------------------------------------------------------------
 int ProEReader::read()
 {
+  namespace text = axom::utilities::text;
+
   constexpr int NUM_NODES_PER_TET = 4;
   constexpr int NUM_COMPS_PER_NODE = 3;
 
-  std::string junk;
-  int id;
-  int tet_nodes[NUM_NODES_PER_TET];
-
-  struct coordinate
-  {
-    double comp[NUM_COMPS_PER_NODE];
-  } cur_coord;
-
-  std::ifstream ifs(m_fileName.c_str());
+  text::ChunkedFileReader reader(m_fileName);
 
-  if(!ifs.is_open())
+  if(!reader.isOpen())
   {
     SLIC_WARNING("Cannot open the provided Pro/E file [" << m_fileName << "]");
     return (-1);
   }
 
-  // Remove any comments from header
-  while(ifs.peek() == '#')
-  {
-    std::getline(ifs, junk);
-  }
+  // Comment lines start with '#'
+  auto isDataLine = [](text::TextCursor line) {
+    line.skipWhitespace();
+    return !line.atEnd() && line.peek() != '#';
+  };
 
   // Initialize number of nodes and tetrahedra.
   // 3 components per node, 4 nodes per tet.
-  ifs >> m_num_nodes >> m_num_tets;
-
-  m_nodes.reserve(m_num_nodes * NUM_COMPS_PER_NODE);
-  m_tets.reserve(m_num_tets * NUM_NODES_PER_TET);
-
-  // Initialize nodes
-  for(int i = 0; i < m_num_nodes; i++)
+  const char* pos = nullptr;
+  text::TextCursor line;
+  bool foundCounts = false;
+  while(text::readLine(reader, pos, line))
   {
-    ifs >> id >> cur_coord.comp[0] >> cur_coord.comp[1] >> cur_coord.comp[2];
-
-    for(int j = 0; j < NUM_COMPS_PER_NODE; j++)
+    if(isDataLine(line))
     {
-      m_nodes.push_back(cur_coord.comp[j]);
+      foundCounts = line.read(m_num_nodes) && line.read(m_num_tets) &&
+        m_num_nodes >= 0 && m_num_tets >= 0;
+      break;
     }
   }
 
-  // Initialize tets
-  for(int i = 0; i < m_num_tets; i++)
+  if(!foundCounts)
   {
-    ifs >> id >> tet_nodes[0] >> tet_nodes[1] >> tet_nodes[2] >> tet_nodes[3];
+    SLIC_WARNING("Missing or invalid node and tetrahedra counts in Pro/E file ["
+                 << m_fileName << "]");
+    this->clear();
+    return (-1);
+  }
 
-    for(int j = 0; j < NUM_NODES_PER_TET; j++)
-    {
-      // Node IDs start at 1 instead of 0, adjust to 0 for indexing
-      m_tets.push_back(tet_nodes[j] - 1);
-    }
+  m_nodes.resize(m_num_nodes * NUM_COMPS_PER_NODE);
+  m_tets.resize(m_num_tets * NUM_NODES_PER_TET);
+
+  // Initialize nodes; each line has an id and the coordinates
+  double* nodes = m_nodes.data();
+  const axom::IndexType nodesRead = text::forEachLine(
+    reader,
+    pos,
+    m_num_nodes,
+    isDataLine,
+    [=](axom::IndexType i, text::TextCursor& line) {
+      int id;
+      double* node = nodes + i * NUM_COMPS_PER_NODE;
+      return line.read(id) && line.read(node[0]) && line.read(node[1]) &&
+        line.read(node[2]);
+    });
+
+  // Initialize tets; each line has an id and the node ids
+  int* tets = m_tets.data();
+  const axom::IndexType tetsRead = (nodesRead != m_num_nodes)
+    ? -1
+    : text::forEachLine(reader,
+                        pos,
+                        m_num_tets,
+                        isDataLine,
+                        [=](axom::IndexType i, text::TextCursor& line) {
+                          int id;
+                          int* tet = tets + i * NUM_NODES_PER_TET;
+                          bool valid = line.read(id);
+                          for(int j = 0; j < NUM_NODES_PER_TET; j++)
+                          {
+                            // Node IDs start at 1 instead of 0,
+                            // adjust to 0 for indexing
+                            valid = valid && line.read(tet[j]);
+                            tet[j] -= 1;
+                          }
+                          return valid;
+                        });
+
+  if(tetsRead != m_num_tets)
+  {
+    SLIC_WARNING("Could not parse the nodes and tetrahedra of Pro/E file ["
+                 << m_fileName << "]");
+    this->clear();
+    return (-1);
   }
 
-  ifs.close();
   return (0);
 }
 
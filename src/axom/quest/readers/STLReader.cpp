@@ -6,17 +6,103 @@
 #include "axom/quest/readers/STLReader.hpp"
 
 // Axom includes
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/core/utilities/TextParsing.hpp"
 #include "axom/core/utilities/Utilities.hpp"
 #include "axom/mint/mesh/CellTypes.hpp"
+#include "axom/quest/detail/VertexWelding.hpp"
 #include "axom/slic/interface/slic.hpp"
 
 // C/C++ includes
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <utility>
+
+#ifndef WIN32
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
 
 namespace
 {
-const std::size_t BINARY_HEADER_SIZE = 80;  // bytes
-const std::size_t BINARY_TRI_SIZE = 50;     // bytes
+/*!
+ * \brief Read-only view of the contents of a file
+ *
+ * The file is memory mapped on POSIX systems, so that pages are only loaded
+ * as they are touched, and is read into a buffer with a single call elsewhere.
+ */
+class FileBytes
+{
+public:
+  explicit FileBytes(const std::string& fileName)
+  {
+#ifndef WIN32
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+      return;
+    }
+
+    struct stat sb;
+    if(::fstat(fd, &sb) == 0 && sb.st_size > 0)
+    {
+      void* addr = ::mmap(nullptr, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if(addr != MAP_FAILED)
+      {
+        ::madvise(addr, sb.st_size, MADV_WILLNEED);
+        m_data = static_cast<const char*>(addr);
+        m_size = static_cast<std::size_t>(sb.st_size);
+      }
+    }
+
+    // the mapping remains valid after the descriptor is closed
+    ::close(fd);
+#else
+    std::ifstream ifs(fileName.c_str(), std::ios::in | std::ios::binary);
+    if(!ifs.is_open())
+    {
+      return;
+    }
+
+    ifs.seekg(0, ifs.end);
+    m_buffer.resize(static_cast<std::size_t>(ifs.tellg()));
+    ifs.seekg(0, ifs.beg);
+    ifs.read(m_buffer.data(), m_buffer.size());
+
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+#endif
+  }
+
+  ~FileBytes()
+  {
+#ifndef WIN32
+    if(m_data != nullptr)
+    {
+      ::munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+  }
+
+  bool isValid() const { return m_data != nullptr; }
+  const char* data() const { return m_data; }
+  std::size_t size() const { return m_size; }
+
+private:
+  const char* m_data {nullptr};
+  std::size_t m_size {0};
+#ifdef WIN32
+  std::vector<char> m_buffer;
+#endif
+
+  DISABLE_COPY_AND_ASSIGNMENT(FileBytes);
+  DISABLE_MOVE_AND_ASSIGNMENT(FileBytes);
+};
+
 }  // namespace
 
 //------------------------------------------------------------------------------
@@ -26,6 +112,10 @@ namespace axom
 {
 namespace quest
 {
+constexpr std::size_t STLReader::BINARY_HEADER_SIZE;
+constexpr std::size_t STLReader::BINARY_TRI_SIZE;
+
+//------------------------------------------------------------------------------
 STLReader::STLReader() : m_fileName(""), m_num_nodes(0), m_num_faces(0) { }
 
 //------------------------------------------------------------------------------
@@ -40,7 +130,7 @@ void STLReader::clear()
 }
 
 //------------------------------------------------------------------------------
-bool STLReader::isAsciiFormat() const
+bool STLReader::isAsciiFormat(axom::IndexType* numTris) const
 {
   // The binary format consists of
   //    a header of size BINARY_HEADER_SIZE==80 bytes
@@ -57,73 +147,95 @@ bool STLReader::isAsciiFormat() const
     return false;
   }
 
-  // Find out the file size
+  // Find out the file size; binary files can exceed 2GB
   ifs.seekg(0, ifs.end);
-  std::int32_t fileSize = static_cast<std::int32_t>(ifs.tellg());
+  const std::int64_t fileSize = static_cast<std::int64_t>(ifs.tellg());
 
-  const int totalHeaderSize = (BINARY_HEADER_SIZE + sizeof(std::int32_t));
+  const std::int64_t totalHeaderSize =
+    (BINARY_HEADER_SIZE + sizeof(std::uint32_t));
   if(fileSize < totalHeaderSize)
   {
     return true;
   }
 
   // Find the number of triangles (if the file were binary)
-  int numTris = 0;
+  std::uint32_t binaryTris = 0;
   ifs.seekg(BINARY_HEADER_SIZE, ifs.beg);
-  ifs.read((char*)&numTris, sizeof(std::int32_t));
+  ifs.read((char*)&binaryTris, sizeof(std::uint32_t));
 
   if(!utilities::isLittleEndian())
   {
-    numTris = utilities::swapEndian(numTris);
+    binaryTris = utilities::swapEndian(binaryTris);
   }
 
   // Check if the size matches our expectation
-  int expectedBinarySize = totalHeaderSize + (numTris * BINARY_TRI_SIZE);
+  const std::int64_t expectedBinarySize = totalHeaderSize +
+    (static_cast<std::int64_t>(binaryTris) * BINARY_TRI_SIZE);
 
   ifs.close();
 
+  if(numTris != nullptr)
+  {
+    *numTris = static_cast<axom::IndexType>(binaryTris);
+  }
+
   return (fileSize != expectedBinarySize);
 }
 
 //------------------------------------------------------------------------------
 int STLReader::readAsciiSTL()
 {
-  std::ifstream ifs(m_fileName.c_str());
+  namespace text = axom::utilities::text;
 
-  if(!ifs.is_open())
+  text::ChunkedFileReader reader(m_fileName);
+
+  if(!reader.isOpen())
   {
     SLIC_WARNING("Cannot open the provided STL file [" << m_fileName << "]");
     return (-1);
   }
 
-  std::string junk;
-  double x, y, z;
-
   // In an STL  file, we only care about the vertex positions
-  // Vertices are strings of the form: "vertex v_x v_y v_z"
-  while(true)
-  {
-    do
-    {
-      ifs >> junk;
-    } while(ifs.good() && junk != "vertex");
+  // Vertices are lines of the form: "vertex v_x v_y v_z"
+  auto isVertexLine = [](text::TextCursor line) {
+    return line.matchWord("vertex");
+  };
 
-    if(ifs.fail())
+  // Count the vertices of each chunk, then parse them in parallel
+  while(reader.nextChunk())
+  {
+    const char* pos = reader.begin();
+    const axom::IndexType numChunkVerts =
+      text::countLines(pos, reader.end(), isVertexLine);
+
+    const std::size_t offset = m_nodes.size();
+    m_nodes.resize(offset + 3 * numChunkVerts);
+    double* nodes = m_nodes.data() + offset;
+
+    const axom::IndexType numParsed = text::forEachLine(
+      pos,
+      reader.end(),
+      numChunkVerts,
+      isVertexLine,
+      [=](axom::IndexType i, text::TextCursor& line) {
+        line.matchWord("vertex");
+        return line.read(nodes[3 * i]) && line.read(nodes[3 * i + 1]) &&
+          line.read(nodes[3 * i + 2]);
+      });
+
+    if(numParsed != numChunkVerts)
     {
-      break;
+      SLIC_WARNING("Could not parse the vertices of STL file [" << m_fileName
+                                                               << "]");
+      this->clear();
+      return (-1);
     }
-
-    ifs >> x >> y >> z;
-    m_nodes.push_back(x);
-    m_nodes.push_back(y);
-    m_nodes.push_back(z);
   }
 
   // Set the number of nodes and faces
   m_num_nodes = static_cast<axom::IndexType>(m_nodes.size()) / 3;
   m_num_faces = m_num_nodes / 3;
 
-  ifs.close();
   return (0);
 }
 
@@ -135,60 +247,80 @@ int STLReader::readBinarySTL()
   //    followed by a 32 bit int encoding the number of faces
   //    followed by the triangles, each of which is 50 bytes (BINARY_TRI_SIZE)
 
-  // A local union data structure for triangles in a binary STL
-  union BinarySTLTri
-  {
-    std::int8_t raw[BINARY_TRI_SIZE];
-
-    struct
-    {
-      float normal[3];
-      float vert[9];
-      std::uint16_t attr;
-    } data;
-
-  } tri;
-
-  bool const isLittleEndian = axom::utilities::isLittleEndian();
-
-  // Open binary file, skip the header
-  std::ifstream ifs(m_fileName.c_str(), std::ios::in | std::ios::binary);
-  if(!ifs.is_open())
+  FileBytes file(m_fileName);
+  if(!file.isValid())
   {
     SLIC_WARNING("Cannot open the provided STL file [" << m_fileName << "]");
     return (-1);
   }
 
-  ifs.seekg(BINARY_HEADER_SIZE);
+  const std::size_t totalHeaderSize =
+    BINARY_HEADER_SIZE + sizeof(std::uint32_t);
+  if(file.size() < totalHeaderSize)
+  {
+    SLIC_WARNING("Binary STL file [" << m_fileName << "] is truncated");
+    return (-1);
+  }
 
   // read the num faces and reserve room for the vertex positions
-  ifs.read((char*)&m_num_faces, sizeof(std::int32_t));
+  std::uint32_t numTris = 0;
+  std::memcpy(&numTris,
+              file.data() + BINARY_HEADER_SIZE,
+              sizeof(std::uint32_t));
 
-  if(!isLittleEndian)
+  if(!utilities::isLittleEndian())
   {
-    m_num_faces = utilities::swapEndian(m_num_faces);
+    numTris = utilities::swapEndian(numTris);
   }
 
+  if(file.size() < totalHeaderSize + std::size_t(numTris) * BINARY_TRI_SIZE)
+  {
+    SLIC_WARNING("Binary STL file [" << m_fileName << "] is truncated");
+    return (-1);
+  }
+
+  m_num_faces = static_cast<axom::IndexType>(numTris);
   m_num_nodes = m_num_faces * 3;
-  m_nodes.reserve(m_num_nodes * 3);
+  m_nodes.resize(m_num_nodes * 3);
 
   // Read the triangles. Cast to doubles and ignore normals and attributes
-  for(axom::IndexType i = 0; i < m_num_faces; ++i)
-  {
-    ifs.read((char*)tri.raw, BINARY_TRI_SIZE);
+  parseBinaryTriangles(file.data() + totalHeaderSize,
+                       m_num_faces,
+                       m_nodes.data());
 
-    for(int j = 0; j < 9; ++j)
-    {
-      float coord = isLittleEndian ? tri.data.vert[j]
-                                   : utilities::swapEndian(tri.data.vert[j]);
+  return (0);
+}
 
-      m_nodes.push_back(static_cast<double>(coord));
-    }
-  }
+//------------------------------------------------------------------------------
+void STLReader::parseBinaryTriangles(const char* triData,
+                                     axom::IndexType numTris,
+                                     double* nodes)
+{
+#ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+  using ExecSpace = axom::OMP_EXEC;
+#else
+  using ExecSpace = axom::SEQ_EXEC;
+#endif
 
-  ifs.close();
+  // Offset of the vertex positions within a triangle record (after the normal)
+  constexpr std::size_t VERTEX_OFFSET = 3 * sizeof(float);
 
-  return (0);
+  const bool isLittleEndian = axom::utilities::isLittleEndian();
+
+  axom::for_all<ExecSpace>(numTris, [=](axom::IndexType i) {
+    // Records are 50 bytes, so the floats are not aligned; copy them out
+    float coords[9];
+    std::memcpy(coords,
+                triData + i * BINARY_TRI_SIZE + VERTEX_OFFSET,
+                sizeof(coords));
+
+    double* triNodes = nodes + 9 * i;
+    for(int j = 0; j < 9; ++j)
+    {
+      triNodes[j] = static_cast<double>(
+        isLittleEndian ? coords[j] : utilities::swapEndian(coords[j]));
+    }
+  });
 }
 
 //------------------------------------------------------------------------------
@@ -207,27 +339,61 @@ int STLReader::read()
 }
 
 //------------------------------------------------------------------------------
-void STLReader::getMesh(axom::mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh)
+void STLReader::getMesh(axom::mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh,
+                        axom::Array<axom::IndexType>* sourceTriangles)
 {
   /* Sanity checks */
   SLIC_ERROR_IF(mesh == nullptr, "supplied mesh is null!");
-  SLIC_ERROR_IF(static_cast<axom::IndexType>(m_nodes.size()) != 3 * m_num_nodes,
-                "nodes vector size doesn't match expected size!");
+  const bool ownsNodes = (getNodeData() == m_nodes.data());
+  SLIC_ERROR_IF(
+    ownsNodes &&
+      static_cast<axom::IndexType>(m_nodes.size()) != 3 * m_num_nodes,
+    "nodes vector size doesn't match expected size!");
   SLIC_ERROR_IF(mesh->getDimension() != 3, "STL reader expects a 3D mesh!");
   SLIC_ERROR_IF(mesh->getCellType() != mint::TRIANGLE,
                 "STL reader expects a triangle mesh!");
 
+  const double* nodes = getNodeData();
+
+  // Weld the vertices, if requested
+  const bool weld = (m_vertexWeldThreshold > 0.);
+  axom::Array<axom::IndexType> weldedVerts;
+  axom::Array<axom::IndexType> weldedConn;
+  axom::Array<axom::IndexType> weldedSource;
+  axom::IndexType numNodes = m_num_nodes;
+  axom::IndexType numCells = m_num_faces;
+  if(weld)
+  {
+    axom::Array<axom::IndexType> vertexMap;
+    detail::weldVertices(nodes,
+                         nodes + 1,
+                         nodes + 2,
+                         3,
+                         m_num_nodes,
+                         m_vertexWeldThreshold,
+                         vertexMap,
+                         weldedVerts);
+    detail::remapTriangles(nullptr,
+                           m_num_faces,
+                           vertexMap,
+                           weldedConn,
+                           weldedSource);
+
+    numNodes = weldedVerts.size();
+    numCells = weldedSource.size();
+  }
+
   // pre-allocate space to store the mesh
   if(!mesh->isExternal())
   {
-    mesh->resize(m_num_nodes, m_num_faces);
+    mesh->resize(numNodes, numCells);
   }
 
   SLIC_ERROR_IF(
-    mesh->getNumberOfNodes() != m_num_nodes,
+    mesh->getNumberOfNodes() != numNodes,
     "mesh number of nodes does not match the number of nodes in the STL file!");
   SLIC_ERROR_IF(
-    mesh->getNumberOfCells() != m_num_faces,
+    mesh->getNumberOfCells() != numCells,
     "mesh number of cells does not match number of triangles in the STL file!");
 
   double* x = mesh->getCoordinateArray(mint::X_COORDINATE);
@@ -235,22 +401,35 @@ void STLReader::getMesh(axom::mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh)
   double* z = mesh->getCoordinateArray(mint::Z_COORDINATE);
 
   // Load the vertices into the mesh
-  for(axom::IndexType i = 0; i < m_num_nodes; ++i)
+  for(axom::IndexType i = 0; i < numNodes; ++i)
   {
-    const axom::IndexType offset = i * 3;
-    x[i] = m_nodes[offset];
-    y[i] = m_nodes[offset + 1];
-    z[i] = m_nodes[offset + 2];
+    const axom::IndexType offset = (weld ? weldedVerts[i] : i) * 3;
+    x[i] = nodes[offset];
+    y[i] = nodes[offset + 1];
+    z[i] = nodes[offset + 2];
   }
 
-  // Load the triangles.  Note that the indices are implicitly defined.
+  // Load the triangles.  Without welding, the indices are implicitly defined.
   axom::IndexType* conn = mesh->getCellNodesArray();
-  for(axom::IndexType i = 0; i < m_num_faces; ++i)
+  for(axom::IndexType i = 0; i < 3 * numCells; ++i)
+  {
+    conn[i] = weld ? weldedConn[i] : i;
+  }
+
+  if(sourceTriangles != nullptr)
   {
-    const axom::IndexType offset = i * 3;
-    conn[offset] = offset;
-    conn[offset + 1] = offset + 1;
-    conn[offset + 2] = offset + 2;
+    if(weld)
+    {
+      *sourceTriangles = std::move(weldedSource);
+    }
+    else
+    {
+      sourceTriangles->resize(numCells);
+      for(axom::IndexType i = 0; i < numCells; ++i)
+      {
+        (*sourceTriangles)[i] = i;
+      }
+    }
   }
 }
 
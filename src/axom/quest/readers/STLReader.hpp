@@ -8,12 +8,14 @@
 
 // Axom includes
 #include "axom/config.hpp"
+#include "axom/core/Array.hpp"
 #include "axom/core/Macros.hpp"
 #include "axom/mint/mesh/UnstructuredMesh.hpp"
 
 // C/C++ includes
-#include <string>  // for std::string
-#include <vector>  // for std::vector
+#include <cstddef>  // for std::size_t
+#include <string>   // for std::string
+#include <vector>   // for std::vector
 
 namespace axom
 {
@@ -59,6 +61,24 @@ public:
    */
   int getNumFaces() const { return m_num_faces; };
 
+  /*!
+   * \brief Sets the threshold for welding vertices in getMesh()
+   *
+   * \param [in] thresh the welding threshold (under the max norm). Vertices
+   *  are not welded when this is zero, which is the default.
+   *
+   * \see getMesh()
+   */
+  void setVertexWeldingThreshold(double thresh)
+  {
+    m_vertexWeldThreshold = thresh;
+  }
+
+  /*!
+   * \brief Returns the threshold for welding vertices in getMesh()
+   */
+  double getVertexWeldingThreshold() const { return m_vertexWeldThreshold; }
+
   /*!
    * \brief Clears all internal data-structures
    */
@@ -74,11 +94,29 @@ public:
   /*!
    * \brief Stores the STL data in the supplied unstructured mesh object.
    * \param [in,out] mesh pointer to the unstructured mesh.
+   * \param [out] sourceTriangles optional, the index of the STL triangle of
+   *  each cell of \a mesh
    * \pre mesh != nullptr.
+   *
+   * Without a welding threshold, the mesh has one node per triangle corner.
+   * Otherwise, vertices that are closer than the threshold are welded, in
+   * parallel when Axom is configured with OpenMP, and triangles that lose
+   * a distinct vertex are removed, giving an indexed triangle mesh.
+   *
+   * \note When welding into a mesh with external buffers, the buffers must
+   *  match the welded sizes.
+   * \see setVertexWeldingThreshold()
    */
-  void getMesh(mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh);
+  void getMesh(mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh,
+               axom::Array<axom::IndexType>* sourceTriangles = nullptr);
+
+protected:
+  /// Size of the header of a binary STL file, in bytes
+  static constexpr std::size_t BINARY_HEADER_SIZE = 80;
+
+  /// Size of a triangle record in a binary STL file, in bytes
+  static constexpr std::size_t BINARY_TRI_SIZE = 50;
 
-private:
   /*!
    * \brief A predicate to check if the file is in ascii format
    *
@@ -88,10 +126,40 @@ private:
    * encoding the number of triangles, followed by the triangle data
    * (50 bytes per triangle).
    *
+   * \param [out] numTris optional, the number of triangles in the file
+   *  when it is binary encoded
    * \return True, if the file is ascii encoded, False if it is binary
    */
-  bool isAsciiFormat() const;
+  bool isAsciiFormat(axom::IndexType* numTris = nullptr) const;
 
+  /*!
+   * \brief Converts a contiguous run of binary STL triangle records
+   *  into vertex positions
+   *
+   * Normals and attributes are skipped and the single precision coordinates
+   * are converted to doubles.  The triangles are processed in parallel
+   * when Axom is configured with OpenMP.
+   *
+   * \param [in] triData pointer to the first triangle record (need not be
+   *  aligned)
+   * \param [in] numTris the number of triangle records to convert
+   * \param [out] nodes buffer for the vertex positions, holding at least
+   *  9 * numTris doubles
+   */
+  static void parseBinaryTriangles(const char* triData,
+                                   axom::IndexType numTris,
+                                   double* nodes);
+
+  /*!
+   * \brief Returns a pointer to the vertex positions that were read in
+   *
+   * Derived readers that keep the positions somewhere other than
+   * \a m_nodes override this.  The positions are interleaved, with
+   * 3 * getNumNodes() entries.
+   */
+  virtual const double* getNodeData() const { return m_nodes.data(); }
+
+private:
   /*!
    * \brief Reads an ascii-encoded STL file into memory
    * \note The filename should be set with STLReader::setFileName()
@@ -100,6 +168,10 @@ private:
 
   /*!
    * \brief Reads a binary-encoded STL file into memory
+   *
+   * The file is memory mapped, when supported, and its triangles
+   * are converted in parallel.
+   *
    * \note The filename should be set with STLReader::setFileName()
    */
   int readBinarySTL();
@@ -109,6 +181,7 @@ protected:
 
   axom::IndexType m_num_nodes;
   axom::IndexType m_num_faces;
+  double m_vertexWeldThreshold {0.};
 
   std::vector<double> m_nodes;
 
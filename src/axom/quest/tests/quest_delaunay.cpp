@@ -0,0 +1,375 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "gtest/gtest.h"
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/primal.hpp"
+#include "axom/quest/Delaunay.hpp"
+
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>
+#endif
+
+// C/C++ includes
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace
+{
+/// Generates \a npts random points in the unit square or cube
+template <int DIM>
+axom::Array<axom::primal::Point<double, DIM>> randomPoints(int npts,
+                                                           unsigned int seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(0., 1.);
+
+  axom::Array<axom::primal::Point<double, DIM>> pts(0, npts);
+  for(int i = 0; i < npts; ++i)
+  {
+    axom::primal::Point<double, DIM> pt;
+    for(int d = 0; d < DIM; ++d)
+    {
+      pt[d] = dist(gen);
+    }
+    pts.push_back(pt);
+  }
+  return pts;
+}
+
+/// Initializes \a dt with a boundary around the unit square or cube
+template <int DIM>
+void initializeUnitBoundary(axom::quest::Delaunay<DIM>& dt)
+{
+  using PointType = typename axom::quest::Delaunay<DIM>::PointType;
+  using BoundingBox = typename axom::quest::Delaunay<DIM>::BoundingBox;
+  dt.initializeBoundary(BoundingBox(PointType(-0.1), PointType(1.1)));
+}
+
+/*!
+ * \brief Returns the elements of \a dt, each as the sorted coordinates
+ *  of its vertices, so triangulations can be compared regardless of
+ *  their vertex and element numbering.
+ */
+template <int DIM>
+std::set<std::vector<std::array<double, DIM>>> elementSet(
+  const axom::quest::Delaunay<DIM>& dt)
+{
+  const auto& mesh = *dt.getMeshData();
+  std::set<std::vector<std::array<double, DIM>>> elems;
+  for(auto e : mesh.elements().positions())
+  {
+    if(!mesh.isValidElement(e))
+    {
+      continue;
+    }
+
+    std::vector<std::array<double, DIM>> verts;
+    for(auto v : mesh.boundaryVertices(e))
+    {
+      const auto& pos = mesh.getVertexPosition(v);
+      std::array<double, DIM> coords;
+      std::copy(pos.data(), pos.data() + DIM, coords.begin());
+      verts.push_back(coords);
+    }
+    std::sort(verts.begin(), verts.end());
+    elems.insert(verts);
+  }
+  return elems;
+}
+
+/*!
+ * \brief Checks that batched insertion gives the same valid Delaunay
+ *  triangulation as inserting the points one at a time.
+ *
+ * Random points are in general position, so their Delaunay
+ * triangulation is unique.
+ */
+template <int DIM>
+void checkInsertPoints(int npts)
+{
+  const auto pts = randomPoints<DIM>(npts, 42);
+
+  axom::quest::Delaunay<DIM> serial;
+  initializeUnitBoundary(serial);
+  for(const auto& pt : pts)
+  {
+    serial.insertPoint(pt);
+  }
+  EXPECT_TRUE(serial.isValid(true));
+
+  axom::quest::Delaunay<DIM> batched;
+  initializeUnitBoundary(batched);
+  axom::Array<axom::IndexType> order;
+  batched.insertPoints(pts.view(), &order);
+  EXPECT_TRUE(batched.isValid(true));
+
+  // The insertion order is a permutation of the points
+  ASSERT_EQ(npts, order.size());
+  std::vector<axom::IndexType> sortedOrder(order.begin(), order.end());
+  std::sort(sortedOrder.begin(), sortedOrder.end());
+  for(int i = 0; i < npts; ++i)
+  {
+    EXPECT_EQ(i, sortedOrder[i]);
+  }
+
+  const auto serialElems = elementSet(serial);
+  const auto batchedElems = elementSet(batched);
+  EXPECT_GT(serialElems.size(), 0u);
+  EXPECT_EQ(serialElems.size(), batchedElems.size());
+  EXPECT_TRUE(serialElems == batchedElems);
+
+  // Also compare without the elements attached to the boundary
+  serial.removeBoundary();
+  batched.removeBoundary();
+  EXPECT_EQ(serial.getMeshData()->vertices().size(),
+            batched.getMeshData()->vertices().size());
+  EXPECT_EQ(serial.getMeshData()->elements().size(),
+            batched.getMeshData()->elements().size());
+  EXPECT_TRUE(elementSet(serial) == elementSet(batched));
+}
+
+/*!
+ * \brief Checks that parallel insertion gives the same valid Delaunay
+ *  triangulation as serial insertion, with one and several threads
+ */
+template <int DIM>
+void checkParallelInsertPoints(int npts)
+{
+  const auto pts = randomPoints<DIM>(npts, 42);
+
+  axom::quest::Delaunay<DIM> serial;
+  initializeUnitBoundary(serial);
+  serial.insertPoints(pts.view());
+  EXPECT_TRUE(serial.isValid(true));
+  const auto serialElems = elementSet(serial);
+
+#ifdef AXOM_USE_OPENMP
+  const int maxThreads = omp_get_max_threads();
+  const std::vector<int> threadCounts {1, 4};
+#else
+  const std::vector<int> threadCounts {1};
+#endif
+  for(int numThreads : threadCounts)
+  {
+#ifdef AXOM_USE_OPENMP
+    omp_set_num_threads(numThreads);
+#endif
+    axom::quest::Delaunay<DIM> parallel;
+    initializeUnitBoundary(parallel);
+    parallel.setParallelInsertion(true);
+    axom::Array<axom::IndexType> order;
+    parallel.insertPoints(pts.view(), &order);
+    EXPECT_TRUE(parallel.isValid(true)) << numThreads << " threads";
+    EXPECT_TRUE(serialElems == elementSet(parallel))
+      << numThreads << " threads";
+
+    // Each point is inserted once, and the vertices after those of the
+    // boundary are numbered in order of insertion
+    ASSERT_EQ(npts, order.size());
+    std::vector<axom::IndexType> sortedOrder(order.begin(), order.end());
+    std::sort(sortedOrder.begin(), sortedOrder.end());
+    const auto& mesh = *parallel.getMeshData();
+    const int numBoundaryVerts = 1 << DIM;
+    for(int i = 0; i < npts; ++i)
+    {
+      EXPECT_EQ(i, sortedOrder[i]);
+      EXPECT_EQ(pts[order[i]], mesh.getVertexPosition(numBoundaryVerts + i));
+    }
+  }
+#ifdef AXOM_USE_OPENMP
+  omp_set_num_threads(maxThreads);
+#endif
+}
+
+/*!
+ * \brief Returns \a npts points in the unit square or cube, computed with
+ *  integer arithmetic so that they are the same on every platform
+ */
+template <int DIM>
+axom::Array<axom::primal::Point<double, DIM>> latticePoints(int npts)
+{
+  constexpr int MULTIPLIERS[] = {37, 59, 73};
+  constexpr int RES = 101;
+
+  axom::Array<axom::primal::Point<double, DIM>> pts(0, npts);
+  for(int i = 0; i < npts; ++i)
+  {
+    axom::primal::Point<double, DIM> pt;
+    for(int d = 0; d < DIM; ++d)
+    {
+      pt[d] = static_cast<double>((i * MULTIPLIERS[d] + d) % RES) / RES;
+    }
+    pts.push_back(pt);
+  }
+  return pts;
+}
+
+/*!
+ * \brief Checks that the BRIO insertion order only depends on the points
+ *  and the seed, i.e. not on the run or the number of threads
+ */
+template <int DIM>
+void checkInsertionOrderIsDeterministic(int npts)
+{
+  using Delaunay = axom::quest::Delaunay<DIM>;
+  using BoundingBox = typename Delaunay::BoundingBox;
+
+  const auto pts = randomPoints<DIM>(npts, 7);
+  BoundingBox bb;
+  for(const auto& pt : pts)
+  {
+    bb.addPoint(pt);
+  }
+
+  const auto order = Delaunay::computeInsertionOrder(pts, bb);
+  ASSERT_EQ(npts, order.size());
+  EXPECT_EQ(order, Delaunay::computeInsertionOrder(pts, bb));
+  EXPECT_EQ(order,
+            Delaunay::computeInsertionOrder(pts,
+                                            bb,
+                                            Delaunay::DEFAULT_BRIO_SEED));
+
+  // A different seed gives different levels, hence a different order
+  if(npts > 100)
+  {
+    EXPECT_NE(order, Delaunay::computeInsertionOrder(pts, bb, 12345));
+  }
+
+#ifdef AXOM_USE_OPENMP
+  const int maxThreads = omp_get_max_threads();
+  omp_set_num_threads(1);
+  const auto serialOrder = Delaunay::computeInsertionOrder(pts, bb);
+  omp_set_num_threads(maxThreads);
+  EXPECT_EQ(order, serialOrder);
+#endif
+
+  // insertPoints() uses the same order, with the same seed, on every call
+  for(int run = 0; run < 2; ++run)
+  {
+    Delaunay dt;
+    initializeUnitBoundary(dt);
+    axom::Array<axom::IndexType> insertionOrder;
+    dt.insertPoints(pts.view(), &insertionOrder);
+    EXPECT_EQ(order, insertionOrder) << "run " << run;
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+TEST(quest_delaunay, insertion_order_is_deterministic)
+{
+  checkInsertionOrderIsDeterministic<2>(1);
+  checkInsertionOrderIsDeterministic<2>(1000);
+  checkInsertionOrderIsDeterministic<3>(1);
+  checkInsertionOrderIsDeterministic<3>(1000);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_delaunay, insertion_order_matches_reference)
+{
+  // Pins the order for fixed points and the default seed, so that it does
+  // not change between runs, builds or platforms without notice
+  using Delaunay = axom::quest::Delaunay<2>;
+
+  const auto pts = latticePoints<2>(16);
+  Delaunay::BoundingBox bb;
+  for(const auto& pt : pts)
+  {
+    bb.addPoint(pt);
+  }
+
+  const axom::Array<axom::IndexType> expected {6, 0, 12, 11, 5, 15, 14, 9,
+                                               7, 2, 4, 1, 3, 13, 10, 8};
+  EXPECT_EQ(expected, Delaunay::computeInsertionOrder(pts, bb));
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_delaunay, radix_sort_pairs)
+{
+  std::mt19937_64 gen(42);
+
+  // Keys over the full 64 bits, with many duplicates, and all equal
+  const std::uint64_t masks[] = {~std::uint64_t(0),
+                                 (std::uint64_t(0x3F) << 58) | 0xFF,
+                                 0};
+  for(int npts : {0, 1, 2, 1000, 100000})
+  {
+    for(std::uint64_t mask : masks)
+    {
+      SCOPED_TRACE(axom::fmt::format("{} keys with mask {:#x}", npts, mask));
+
+      axom::Array<std::uint64_t> keys(npts, npts);
+      axom::Array<axom::IndexType> values(npts, npts);
+      std::vector<std::pair<std::uint64_t, axom::IndexType>> expected(npts);
+      for(int i = 0; i < npts; ++i)
+      {
+        keys[i] = gen() & mask;
+        values[i] = i;
+        expected[i] = {keys[i], i};
+      }
+      std::stable_sort(expected.begin(),
+                       expected.end(),
+                       [](const auto& a, const auto& b) {
+                         return a.first < b.first;
+                       });
+
+      axom::quest::detail::radixSortPairs(keys.data(), values.data(), npts);
+      for(int i = 0; i < npts; ++i)
+      {
+        ASSERT_EQ(expected[i].first, keys[i]) << "at " << i;
+        ASSERT_EQ(expected[i].second, values[i]) << "at " << i;
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_delaunay, insert_points_2d)
+{
+  checkInsertPoints<2>(1);
+  checkInsertPoints<2>(10);
+  checkInsertPoints<2>(1000);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_delaunay, insert_points_3d)
+{
+  checkInsertPoints<3>(1);
+  checkInsertPoints<3>(10);
+  checkInsertPoints<3>(500);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_delaunay, insert_points_parallel_2d)
+{
+  checkParallelInsertPoints<2>(1);
+  checkParallelInsertPoints<2>(10);
+  checkParallelInsertPoints<2>(2000);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_delaunay, insert_points_parallel_3d)
+{
+  checkParallelInsertPoints<3>(1);
+  checkParallelInsertPoints<3>(10);
+  checkParallelInsertPoints<3>(500);
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  axom::slic::SimpleLogger logger;
+
+  return RUN_ALL_TESTS();
+}
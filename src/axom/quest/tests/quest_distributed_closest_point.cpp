@@ -0,0 +1,618 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ \file quest_distributed_closest_point.cpp
+ \brief Tests DistributedClosestPoint against a serial brute force search.
+*/
+
+#include "axom/config.hpp"
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/primal.hpp"
+#include "axom/quest/DistributedClosestPoint.hpp"
+
+#include "conduit_blueprint.hpp"
+
+#include "gtest/gtest.h"
+
+#include "mpi.h"
+
+// C/C++ includes
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace primal = axom::primal;
+namespace quest = axom::quest;
+
+namespace
+{
+using RuntimePolicy = axom::runtime_policy::Policy;
+
+const std::string topologyName = "mesh";
+const std::string coordsetName = "coords";
+const char* axes[3] = {"x", "y", "z"};
+
+/// Object elements owned by each rank
+constexpr int ELEMS_PER_RANK = 24;
+
+/// Tolerance for comparing distances and coordinates
+constexpr double EPS = 1e-10;
+
+int getRank()
+{
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  return rank;
+}
+
+int getNumRanks()
+{
+  int nranks = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &nranks);
+  return nranks;
+}
+
+/*!
+ * \brief Object mesh shared by all ranks, from which each rank takes
+ *  ELEMS_PER_RANK consecutive elements.
+ *
+ * In 2D, the elements are the segments of a polygon inscribed in the
+ * unit circle.  In 3D, they are the triangles of a strip of the surface
+ * z = 0.2 sin(3x) cos(2y) over [-1,1]x[-1,1].
+ */
+template <int DIM>
+struct ObjectMesh;
+
+template <>
+struct ObjectMesh<2>
+{
+  static constexpr int VERTS_PER_ELEM = 2;
+  static constexpr const char* SHAPE = "line";
+  using PointType = primal::Point<double, 2>;
+  using ElementType = primal::Segment<double, 2>;
+
+  static PointType vertex(int nelems, int v)
+  {
+    const double theta = 2. * M_PI * v / nelems;
+    return PointType {std::cos(theta), std::sin(theta)};
+  }
+
+  /// Vertices of global element \a e, in connectivity order
+  static void elementVertices(int nelems, int e, PointType verts[2])
+  {
+    verts[0] = vertex(nelems, e);
+    verts[1] = vertex(nelems, (e + 1) % nelems);
+  }
+
+  /// Closest point to \a q on element \a e, and its parameter (t, 0)
+  static PointType closestPoint(int nelems,
+                                int e,
+                                const PointType& q,
+                                double param[2])
+  {
+    PointType v[2];
+    elementVertices(nelems, e, v);
+    double t;
+    const PointType cp = primal::closest_point(q, ElementType(v[0], v[1]), &t);
+    param[0] = t;
+    param[1] = 0.;
+    return cp;
+  }
+};
+
+template <>
+struct ObjectMesh<3>
+{
+  static constexpr int VERTS_PER_ELEM = 3;
+  static constexpr const char* SHAPE = "tri";
+  using PointType = primal::Point<double, 3>;
+  using ElementType = primal::Triangle<double, 3>;
+
+  /// Vertex (i, j) of a grid with 2 cells along y and nelems/4 along x
+  static PointType vertex(int nelems, int i, int j)
+  {
+    const double x = -1. + 2. * i / (nelems / 4);
+    const double y = -1. + j;
+    return PointType {x, y, 0.2 * std::sin(3. * x) * std::cos(2. * y)};
+  }
+
+  static void elementVertices(int nelems, int e, PointType verts[3])
+  {
+    // Each grid cell is split into two triangles
+    const int cell = e / 2;
+    const int i = cell / 2;
+    const int j = cell % 2;
+    if(e % 2 == 0)
+    {
+      verts[0] = vertex(nelems, i, j);
+      verts[1] = vertex(nelems, i + 1, j);
+      verts[2] = vertex(nelems, i + 1, j + 1);
+    }
+    else
+    {
+      verts[0] = vertex(nelems, i, j);
+      verts[1] = vertex(nelems, i + 1, j + 1);
+      verts[2] = vertex(nelems, i, j + 1);
+    }
+  }
+
+  /// Closest point to \a q on element \a e, and its parameters (r, s)
+  static PointType closestPoint(int nelems,
+                                int e,
+                                const PointType& q,
+                                double param[2])
+  {
+    PointType v[3];
+    elementVertices(nelems, e, v);
+    const ElementType tri(v[0], v[1], v[2]);
+    const PointType cp = primal::closest_point(q, tri);
+    const auto bary = tri.physToBarycentric(cp);
+    param[0] = bary[1];
+    param[1] = bary[2];
+    return cp;
+  }
+};
+
+/*!
+ * \brief Builds this rank's single-domain object mesh, with unshared
+ *  vertices for its ELEMS_PER_RANK elements.
+ */
+template <int DIM>
+void createObjectMesh(conduit::Node& mesh)
+{
+  using Mesh = ObjectMesh<DIM>;
+  constexpr int NV = Mesh::VERTS_PER_ELEM;
+  const int nelems = ELEMS_PER_RANK * getNumRanks();
+  const int firstElem = ELEMS_PER_RANK * getRank();
+  const int nverts = NV * ELEMS_PER_RANK;
+
+  conduit::Node& dom = mesh.append();
+  dom["state/domain_id"] = getRank();
+  dom["coordsets/coords/type"] = "explicit";
+  conduit::Node& values = dom["coordsets/coords/values"];
+  for(int d = 0; d < DIM; ++d)
+  {
+    values[axes[d]].set(conduit::DataType::float64(nverts));
+  }
+
+  dom["topologies/mesh/type"] = "unstructured";
+  dom["topologies/mesh/coordset"] = coordsetName;
+  dom["topologies/mesh/elements/shape"] = Mesh::SHAPE;
+  dom["topologies/mesh/elements/connectivity"].set(
+    conduit::DataType::int64(nverts));
+  conduit::int64* conn =
+    dom["topologies/mesh/elements/connectivity"].as_int64_ptr();
+
+  typename Mesh::PointType verts[NV];
+  for(int e = 0; e < ELEMS_PER_RANK; ++e)
+  {
+    Mesh::elementVertices(nelems, firstElem + e, verts);
+    for(int v = 0; v < NV; ++v)
+    {
+      const int iv = NV * e + v;
+      for(int d = 0; d < DIM; ++d)
+      {
+        values[axes[d]].as_float64_ptr()[iv] = verts[v][d];
+      }
+      conn[iv] = iv;
+    }
+  }
+}
+
+/*!
+ * \brief Builds this rank's query mesh, a lattice of points around the
+ *  object, shifted by rank, with the closest point fields.
+ */
+template <int DIM>
+void createQueryMesh(conduit::Node& mesh)
+{
+  constexpr int RES = 9;
+  const int npts = DIM == 2 ? RES * RES : RES * RES * RES;
+  const double shift = 0.037 * getRank();
+
+  conduit::Node& dom = mesh.append();
+  dom["state/domain_id"] = getRank();
+  dom["coordsets/coords/type"] = "explicit";
+  dom["topologies/mesh/type"] = "points";
+  dom["topologies/mesh/coordset"] = coordsetName;
+
+  conduit::Node& values = dom["coordsets/coords/values"];
+  for(int d = 0; d < DIM; ++d)
+  {
+    values[axes[d]].set(conduit::DataType::float64(npts));
+  }
+  for(int i = 0; i < npts; ++i)
+  {
+    int idx = i;
+    for(int d = 0; d < DIM; ++d)
+    {
+      const double lo = d < 2 ? -1.3 : -0.6;
+      const double hi = d < 2 ? 1.3 : 0.6;
+      values[axes[d]].as_float64_ptr()[i] =
+        lo + (hi - lo) * (idx % RES) / (RES - 1) + shift;
+      idx /= RES;
+    }
+  }
+
+  auto addField = [&](const std::string& name,
+                      const conduit::DataType& dtype,
+                      int ncomp) {
+    conduit::Node& field = dom["fields/" + name];
+    field["association"] = "vertex";
+    field["topology"] = topologyName;
+    if(ncomp == 1)
+    {
+      field["values"].set(dtype);
+    }
+    else
+    {
+      for(int c = 0; c < ncomp; ++c)
+      {
+        field["values"][axes[c]].set(dtype);
+      }
+    }
+  };
+  addField("cp_rank", conduit::DataType::int64(npts), 1);
+  addField("cp_index", conduit::DataType::int64(npts), 1);
+  addField("cp_domain_index", conduit::DataType::int64(npts), 1);
+  addField("cp_coords", conduit::DataType::float64(npts), DIM);
+  addField("cp_parametric", conduit::DataType::float64(npts), 2);
+}
+
+/*!
+ * \brief Runs the distributed closest point query of the object mesh
+ *  over the query mesh with the given policy and threshold.
+ */
+void runQuery(RuntimePolicy policy,
+              double threshold,
+              conduit::Node& objectMesh,
+              conduit::Node& queryMesh,
+              bool pipelined = false,
+              bool progressThread = false)
+{
+  quest::DistributedClosestPoint query;
+  query.setRuntimePolicy(policy);
+  query.setMpiCommunicator(MPI_COMM_WORLD, true);
+  query.setDistanceThreshold(threshold);
+  query.setPipelined(pipelined);
+  query.setUseProgressThread(progressThread);
+  query.setObjectMesh(objectMesh, topologyName);
+  EXPECT_TRUE(query.generateBVHTree());
+  query.computeClosestPoints(queryMesh, topologyName);
+}
+
+/*!
+ * \brief Checks the closest point fields of \a queryMesh against a
+ *  brute force search over the global object mesh.
+ *
+ * When the closest element is unique, cp_rank and cp_index must
+ * identify it.  Otherwise, the reported element must be one of the
+ * closest ones.  In all cases, cp_coords must be the closest point on
+ * the reported element and cp_parametric must locate it there.
+ */
+template <int DIM>
+void checkAgainstBruteForce(double threshold, const conduit::Node& queryMesh)
+{
+  using Mesh = ObjectMesh<DIM>;
+  using PointType = typename Mesh::PointType;
+  using VectorType = primal::Vector<double, DIM>;
+  const int nelems = ELEMS_PER_RANK * getNumRanks();
+
+  const conduit::Node& dom = queryMesh.child(0);
+  const conduit::Node& values = dom["coordsets/coords/values"];
+  const conduit::Node& fields = dom["fields"];
+  const conduit::int64* cpRanks = fields["cp_rank/values"].as_int64_ptr();
+  const conduit::int64* cpIndices = fields["cp_index/values"].as_int64_ptr();
+  const conduit::int64* cpDomains =
+    fields["cp_domain_index/values"].as_int64_ptr();
+  const int npts = values["x"].dtype().number_of_elements();
+
+  for(int i = 0; i < npts; ++i)
+  {
+    PointType q, cpCoords;
+    for(int d = 0; d < DIM; ++d)
+    {
+      q[d] = values[axes[d]].as_float64_ptr()[i];
+      cpCoords[d] = fields["cp_coords/values"][axes[d]].as_float64_ptr()[i];
+    }
+    const double cpParams[2] = {
+      fields["cp_parametric/values/x"].as_float64_ptr()[i],
+      fields["cp_parametric/values/y"].as_float64_ptr()[i]};
+
+    // Brute force search over all the object elements
+    double minDist = std::numeric_limits<double>::max();
+    double nextDist = std::numeric_limits<double>::max();
+    int minElem = -1;
+    double param[2];
+    for(int e = 0; e < nelems; ++e)
+    {
+      const PointType cp = Mesh::closestPoint(nelems, e, q, param);
+      const double dist = std::sqrt(primal::squared_distance(q, cp));
+      if(dist < minDist)
+      {
+        nextDist = minDist;
+        minDist = dist;
+        minElem = e;
+      }
+      else if(dist < nextDist)
+      {
+        nextDist = dist;
+      }
+    }
+
+    if(minDist > threshold + EPS)
+    {
+      EXPECT_EQ(-1, cpIndices[i]) << "Query point " << i << " at " << q;
+      EXPECT_EQ(-1, cpRanks[i]) << "Query point " << i << " at " << q;
+      continue;
+    }
+    if(minDist > threshold - EPS)
+    {
+      continue;  // Too close to the threshold to tell
+    }
+
+    ASSERT_GE(cpRanks[i], 0) << "Query point " << i << " at " << q;
+    ASSERT_GE(cpIndices[i], 0) << "Query point " << i << " at " << q;
+    ASSERT_LT(cpIndices[i], ELEMS_PER_RANK);
+    EXPECT_EQ(0, cpDomains[i]);
+
+    const int reportedElem = ELEMS_PER_RANK * cpRanks[i] + cpIndices[i];
+    if(nextDist - minDist > EPS)
+    {
+      EXPECT_EQ(minElem / ELEMS_PER_RANK, cpRanks[i])
+        << "Query point " << i << " at " << q;
+      EXPECT_EQ(minElem % ELEMS_PER_RANK, cpIndices[i])
+        << "Query point " << i << " at " << q;
+    }
+
+    // The reported element must be a closest one and hold cp_coords.
+    const PointType expectedCp =
+      Mesh::closestPoint(nelems, reportedElem, q, param);
+    EXPECT_NEAR(minDist,
+                std::sqrt(primal::squared_distance(q, expectedCp)),
+                EPS);
+    for(int d = 0; d < DIM; ++d)
+    {
+      EXPECT_NEAR(expectedCp[d], cpCoords[d], EPS);
+    }
+
+    // cp = v0 + r * (v1 - v0) + s * (v2 - v0)
+    EXPECT_NEAR(param[0], cpParams[0], 1e-8);
+    EXPECT_NEAR(param[1], cpParams[1], 1e-8);
+    PointType verts[Mesh::VERTS_PER_ELEM];
+    Mesh::elementVertices(nelems, reportedElem, verts);
+    PointType fromParams = verts[0];
+    for(int v = 1; v < Mesh::VERTS_PER_ELEM; ++v)
+    {
+      fromParams =
+        fromParams + cpParams[v - 1] * VectorType(verts[0], verts[v]);
+    }
+    for(int d = 0; d < DIM; ++d)
+    {
+      EXPECT_NEAR(cpCoords[d], fromParams[d], 1e-8);
+    }
+  }
+}
+
+template <int DIM>
+void checkElementMesh(RuntimePolicy policy, double threshold)
+{
+  conduit::Node objectMesh;
+  createObjectMesh<DIM>(objectMesh);
+
+  conduit::Node queryMesh;
+  createQueryMesh<DIM>(queryMesh);
+
+  runQuery(policy, threshold, objectMesh, queryMesh);
+  checkAgainstBruteForce<DIM>(threshold, queryMesh);
+}
+
+/*!
+ * \brief Checks that the closest points in \a queryMesh match those of
+ *  \a expectedMesh, computed by another exchange mode.
+ *
+ * Elements equally close to a query point may be chosen differently
+ * depending on the order of the searches, so the element is only
+ * compared when both report the same one.
+ */
+template <int DIM>
+void expectSameClosestPoints(const conduit::Node& expectedMesh,
+                             const conduit::Node& queryMesh)
+{
+  const conduit::Node& expected = expectedMesh.child(0)["fields"];
+  const conduit::Node& actual = queryMesh.child(0)["fields"];
+  const int npts = expected["cp_rank/values"].dtype().number_of_elements();
+  const conduit::int64* expectedRanks =
+    expected["cp_rank/values"].as_int64_ptr();
+  const conduit::int64* actualRanks = actual["cp_rank/values"].as_int64_ptr();
+  const conduit::int64* expectedIndices =
+    expected["cp_index/values"].as_int64_ptr();
+  const conduit::int64* actualIndices =
+    actual["cp_index/values"].as_int64_ptr();
+
+  for(int i = 0; i < npts; ++i)
+  {
+    ASSERT_EQ(expectedRanks[i] < 0, actualRanks[i] < 0) << "Query point " << i;
+    if(expectedRanks[i] < 0)
+    {
+      continue;
+    }
+
+    for(int d = 0; d < DIM; ++d)
+    {
+      EXPECT_NEAR(expected["cp_coords/values"][axes[d]].as_float64_ptr()[i],
+                  actual["cp_coords/values"][axes[d]].as_float64_ptr()[i],
+                  EPS)
+        << "Query point " << i;
+    }
+
+    if(expectedRanks[i] == actualRanks[i] &&
+       expectedIndices[i] == actualIndices[i])
+    {
+      for(int d = 0; d < 2; ++d)
+      {
+        EXPECT_DOUBLE_EQ(
+          expected["cp_parametric/values"][axes[d]].as_float64_ptr()[i],
+          actual["cp_parametric/values"][axes[d]].as_float64_ptr()[i])
+          << "Query point " << i;
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Checks the pipelined exchange and the progress thread, alone
+ *  and together, against the brute force search and the default mode.
+ */
+template <int DIM>
+void checkExchangeModes(RuntimePolicy policy, double threshold)
+{
+  conduit::Node objectMesh;
+  createObjectMesh<DIM>(objectMesh);
+
+  conduit::Node defaultMesh;
+  createQueryMesh<DIM>(defaultMesh);
+  runQuery(policy, threshold, objectMesh, defaultMesh);
+
+  for(const bool pipelined : {false, true})
+  {
+    for(const bool progressThread : {false, true})
+    {
+      if(!pipelined && !progressThread)
+      {
+        continue;
+      }
+      SCOPED_TRACE(axom::fmt::format("pipelined {}, progress thread {}",
+                                     pipelined,
+                                     progressThread));
+
+      conduit::Node queryMesh;
+      createQueryMesh<DIM>(queryMesh);
+      runQuery(policy,
+               threshold,
+               objectMesh,
+               queryMesh,
+               pipelined,
+               progressThread);
+      checkAgainstBruteForce<DIM>(threshold, queryMesh);
+      expectSameClosestPoints<DIM>(defaultMesh, queryMesh);
+    }
+  }
+}
+
+/*!
+ * \brief Checks repeated queries with one DistributedClosestPoint, which
+ *  reuses its receives while the exchange pattern stays the same.
+ */
+template <int DIM>
+void checkRepeatedQueries(RuntimePolicy policy)
+{
+  conduit::Node objectMesh;
+  createObjectMesh<DIM>(objectMesh);
+
+  quest::DistributedClosestPoint query;
+  query.setRuntimePolicy(policy);
+  query.setMpiCommunicator(MPI_COMM_WORLD, true);
+  query.setObjectMesh(objectMesh, topologyName);
+  EXPECT_TRUE(query.generateBVHTree());
+
+  for(const double threshold : {10., 10., 0.25, 10.})
+  {
+    SCOPED_TRACE(axom::fmt::format("threshold {}", threshold));
+    conduit::Node queryMesh;
+    createQueryMesh<DIM>(queryMesh);
+    query.setDistanceThreshold(threshold);
+    query.computeClosestPoints(queryMesh, topologyName);
+    checkAgainstBruteForce<DIM>(threshold, queryMesh);
+  }
+}
+
+std::vector<RuntimePolicy> policies()
+{
+  std::vector<RuntimePolicy> pols {RuntimePolicy::seq};
+#ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+  pols.push_back(RuntimePolicy::omp);
+#endif
+  return pols;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+TEST(quest_distributed_closest_point, segments_2d)
+{
+  for(auto policy : policies())
+  {
+    SCOPED_TRACE(axom::fmt::format("policy {}", policy));
+    checkElementMesh<2>(policy, 10.);
+    checkElementMesh<2>(policy, 0.25);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_distributed_closest_point, triangles_3d)
+{
+  for(auto policy : policies())
+  {
+    SCOPED_TRACE(axom::fmt::format("policy {}", policy));
+    checkElementMesh<3>(policy, 10.);
+    checkElementMesh<3>(policy, 0.25);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_distributed_closest_point, repeated_queries)
+{
+  for(auto policy : policies())
+  {
+    SCOPED_TRACE(axom::fmt::format("policy {}", policy));
+    checkRepeatedQueries<2>(policy);
+    checkRepeatedQueries<3>(policy);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_distributed_closest_point, exchange_modes_2d)
+{
+  for(auto policy : policies())
+  {
+    SCOPED_TRACE(axom::fmt::format("policy {}", policy));
+    checkExchangeModes<2>(policy, 10.);
+    checkExchangeModes<2>(policy, 0.25);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_distributed_closest_point, exchange_modes_3d)
+{
+  for(auto policy : policies())
+  {
+    SCOPED_TRACE(axom::fmt::format("policy {}", policy));
+    checkExchangeModes<3>(policy, 10.);
+    checkExchangeModes<3>(policy, 0.25);
+  }
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // The progress thread needs MPI_THREAD_MULTIPLE.
+  int threadSupport = MPI_THREAD_SINGLE;
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &threadSupport);
+  axom::slic::SimpleLogger logger;
+
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
@@ -13,6 +13,7 @@
 // for test that reads in a mesh without the interface
 #include "axom/quest/interface/internal/QuestHelpers.hpp"
 
+#include <cstdio>
 #include <string>
 
 /// Helper class to wrap a template for the dimension.
@@ -243,6 +244,7 @@ TYPED_TEST(InOutInterfaceTest, set_params)
     EXPECT_EQ(successCode, axom::quest::inout_set_dimension(DIM));
     // The following is not used in 3D, but we can still invoke it
     EXPECT_EQ(successCode, axom::quest::inout_set_segments_per_knot_span(10));
+    EXPECT_EQ(successCode, axom::quest::inout_set_index_cache_file(""));
   }
 
   // Initialize the query
@@ -262,6 +264,7 @@ TYPED_TEST(InOutInterfaceTest, set_params)
     EXPECT_EQ(failCode, axom::quest::inout_set_dimension(DIM));
     // The following is not used in 3D, but we can still invoke it, and get a warning
     EXPECT_EQ(failCode, axom::quest::inout_set_segments_per_knot_span(10));
+    EXPECT_EQ(failCode, axom::quest::inout_set_index_cache_file(""));
 
     SLIC_INFO("--]==]");
   }
@@ -269,6 +272,31 @@ TYPED_TEST(InOutInterfaceTest, set_params)
   axom::quest::inout_finalize();
 }
 
+TYPED_TEST(InOutInterfaceTest, index_cache)
+{
+  const int DIM = TestFixture::DIM;
+  const std::string cacheFile =
+    axom::fmt::format("quest_inout_interface_{}D.index", DIM);
+  std::remove(cacheFile.c_str());
+
+  // The first initialization generates the index and saves it to the cache;
+  // the second one loads the index from the cache
+  for(int i = 0; i < 2; ++i)
+  {
+    EXPECT_EQ(0, axom::quest::inout_set_dimension(DIM));
+    EXPECT_EQ(0, axom::quest::inout_set_index_cache_file(cacheFile));
+    EXPECT_EQ(0, axom::quest::inout_init(this->meshfile));
+    EXPECT_TRUE(axom::utilities::filesystem::pathExists(cacheFile));
+
+    EXPECT_TRUE(axom::quest::inout_evaluate(0, 0, 0));
+    EXPECT_FALSE(axom::quest::inout_evaluate(10, 10, 10));
+
+    axom::quest::inout_finalize();
+  }
+
+  std::remove(cacheFile.c_str());
+}
+
 TYPED_TEST(InOutInterfaceTest, query)
 {
   using PointType = typename TestFixture::InOutPoint;
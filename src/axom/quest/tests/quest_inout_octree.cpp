@@ -33,8 +33,13 @@ using SpaceVector = Octree3D::SpaceVector;
 using GridPt = Octree3D::GridPt;
 using BlockIndex = Octree3D::BlockIndex;
 
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <limits>
+#include <string>
 
 // Uncomment the line below for true randomized points
 #ifndef INOUT_OCTREE_TESTER_SHOULD_SEED
@@ -240,6 +245,275 @@ TEST(quest_inout_octree, tetrahedron_mesh)
   }
 }
 
+TEST(quest_inout_octree, batched_query)
+{
+  SLIC_INFO("*** Checks that batched queries match point-wise queries.\n");
+
+  namespace mint = axom::mint;
+  namespace quest = axom::quest;
+
+  mint::Mesh* mesh = quest::utilities::make_octahedron_mesh();
+  GeometricBoundingBox bbox(SpacePt(-1.), SpacePt(1.));
+
+  Octree3D octree(bbox, mesh);
+  octree.generateIndex();
+
+  // Random points (including some outside the octree) followed by grid points
+  const int GRID_RES = 16;
+  const int NUM_RANDOM_PTS = NUM_PT_TESTS / 10;
+  axom::Array<SpacePt> pts;
+  pts.reserve(NUM_RANDOM_PTS + GRID_RES * GRID_RES * GRID_RES);
+  for(int i = 0; i < NUM_RANDOM_PTS; ++i)
+  {
+    pts.push_back(quest::utilities::randomSpacePt<DIM>(-1.25, 1.25));
+  }
+  for(int k = 0; k < GRID_RES; ++k)
+  {
+    for(int j = 0; j < GRID_RES; ++j)
+    {
+      for(int i = 0; i < GRID_RES; ++i)
+      {
+        const double h = 2. / (GRID_RES - 1);
+        pts.push_back(SpacePt {-1. + i * h, -1. + j * h, -1. + k * h});
+      }
+    }
+  }
+
+  axom::Array<int> containment(pts.size(), pts.size());
+  octree.within(pts, containment);
+
+  for(int i = 0; i < pts.size(); ++i)
+  {
+    EXPECT_EQ(octree.within(pts[i]) ? 1 : 0, containment[i])
+      << "Batched and point-wise queries differ for point " << pts[i];
+  }
+
+  delete mesh;
+}
+
+TEST(quest_inout_octree, exact_predicates)
+{
+  SLIC_INFO("*** Checks queries with exact orientation predicates.\n");
+
+  namespace mint = axom::mint;
+  namespace quest = axom::quest;
+
+  mint::Mesh* mesh = quest::utilities::make_octahedron_mesh();
+  GeometricBoundingBox bbox(SpacePt(-1.), SpacePt(1.));
+
+  Octree3D octree(bbox, mesh);
+  octree.generateIndex();
+  octree.setUseExactPredicates(true);
+
+  for(int i = 0; i < NUM_PT_TESTS; ++i)
+  {
+    const SpacePt pt = quest::utilities::randomSpacePt<DIM>(-1.25, 1.25);
+
+    // Points are inside the unit octahedron when the sum of the magnitudes of
+    // their coordinates is less than one
+    const double absCoordSum =
+      std::abs(pt[0]) + std::abs(pt[1]) + std::abs(pt[2]);
+    if(axom::utilities::isNearlyEqual(absCoordSum, 1.))
+    {
+      continue;
+    }
+
+    EXPECT_EQ(absCoordSum < 1., octree.within(pt))
+      << "Point " << pt << " has sum of absolute values of coords "
+      << absCoordSum;
+  }
+
+  // Points on either side of the center of a face
+  EXPECT_TRUE(octree.within(SpacePt {0.33, 0.33, 0.33}));
+  EXPECT_FALSE(octree.within(SpacePt {0.34, 0.34, 0.34}));
+
+  delete mesh;
+}
+
+TEST(quest_inout_octree, save_and_load_index)
+{
+  SLIC_INFO("*** Checks that a saved InOutOctree can be reloaded.\n");
+
+  namespace mint = axom::mint;
+  namespace quest = axom::quest;
+
+  const std::string fileName = "quest_inout_octree_index.bin";
+  GeometricBoundingBox bbox(SpacePt(-1.), SpacePt(1.));
+
+  // Generate and save the index
+  mint::Mesh* mesh = quest::utilities::make_octahedron_mesh();
+  Octree3D octree(bbox, mesh);
+  EXPECT_FALSE(octree.saveIndex(fileName));
+  octree.generateIndex();
+  EXPECT_TRUE(octree.saveIndex(fileName));
+
+  // Reload the index over a new copy of the same mesh
+  mint::Mesh* loadedMesh = quest::utilities::make_octahedron_mesh();
+  Octree3D loadedOctree(bbox, loadedMesh);
+  EXPECT_TRUE(loadedOctree.loadIndex(fileName));
+  EXPECT_EQ(mesh->getNumberOfNodes(), loadedMesh->getNumberOfNodes());
+  EXPECT_EQ(mesh->getNumberOfCells(), loadedMesh->getNumberOfCells());
+
+  axom::Array<SpacePt> pts;
+  for(int i = 0; i < NUM_PT_TESTS / 10; ++i)
+  {
+    pts.push_back(quest::utilities::randomSpacePt<DIM>(-1.25, 1.25));
+  }
+  axom::Array<int> containment(pts.size(), pts.size());
+  loadedOctree.within(pts, containment);
+
+  for(int i = 0; i < pts.size(); ++i)
+  {
+    EXPECT_EQ(octree.within(pts[i]), loadedOctree.within(pts[i]))
+      << "Saved and loaded octrees differ for point " << pts[i];
+    EXPECT_EQ(octree.within(pts[i]) ? 1 : 0, containment[i]);
+  }
+
+  // The index should be rejected for a different mesh or welding threshold
+  mint::Mesh* otherMesh = quest::utilities::make_octahedron_mesh();
+  otherMesh->getCoordinateArray(mint::X_COORDINATE)[0] = 0.5;
+  Octree3D otherOctree(bbox, otherMesh);
+  EXPECT_FALSE(otherOctree.loadIndex(fileName));
+
+  mint::Mesh* weldMesh = quest::utilities::make_octahedron_mesh();
+  Octree3D weldOctree(bbox, weldMesh);
+  weldOctree.setVertexWeldThreshold(1E-5);
+  EXPECT_FALSE(weldOctree.loadIndex(fileName));
+
+  // A rejected index leaves the octree ready to generate its index
+  otherOctree.generateIndex();
+  EXPECT_TRUE(otherOctree.within(SpacePt(0.)));
+  EXPECT_FALSE(otherOctree.within(SpacePt::make_point(0.75, 0., 0.)));
+
+  std::remove(fileName.c_str());
+
+  delete mesh;
+  delete loadedMesh;
+  delete otherMesh;
+  delete weldMesh;
+}
+
+TEST(quest_inout_octree, load_corrupt_index)
+{
+  SLIC_INFO("*** Checks that an InOutOctree rejects corrupt indices.\n");
+
+  namespace mint = axom::mint;
+  namespace quest = axom::quest;
+  using VertexIndex = Octree3D::VertexIndex;
+  using CoordType = GridPt::CoordType;
+
+  const std::string fileName = "quest_inout_octree_index.bin";
+  const std::string corruptName = "quest_inout_octree_corrupt.bin";
+  GeometricBoundingBox bbox(SpacePt(-1.), SpacePt(1.));
+
+  mint::Mesh* mesh = quest::utilities::make_octahedron_mesh();
+  Octree3D octree(bbox, mesh);
+  octree.generateIndex();
+  ASSERT_TRUE(octree.saveIndex(fileName));
+
+  std::vector<char> bytes;
+  {
+    std::ifstream ifs(fileName, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(ifs),
+                 std::istreambuf_iterator<char>());
+  }
+
+  // Walk the file layout: a header (magic, four int32s, a hash and
+  // 2 + 2 * DIM doubles), the reindexed mesh, the levels of the octree
+  // and the blocks of the mesh vertices
+  std::size_t offset = 8 + 4 * sizeof(std::int32_t) + sizeof(std::uint64_t) +
+    (2 + 2 * DIM) * sizeof(double);
+  auto skipVector = [&](std::size_t elemSize, std::uint64_t& size) {
+    std::memcpy(&size, &bytes[offset], sizeof(size));
+    const std::size_t dataOffset = offset + sizeof(size);
+    offset = dataOffset + size * elemSize;
+    return dataOffset;
+  };
+
+  std::uint64_t numCoords, numCellVerts, size;
+  skipVector(sizeof(double), numCoords);
+  const std::size_t cellVertsOffset =
+    skipVector(sizeof(VertexIndex), numCellVerts);
+  const VertexIndex numVerts = numCoords / DIM;
+  const VertexIndex numCells = numCellVerts / DIM;
+
+  std::int32_t numLevels;
+  std::memcpy(&numLevels, &bytes[offset], sizeof(numLevels));
+  offset += sizeof(numLevels);
+
+  // Find a level with at least two gray leaves
+  std::size_t blockDataOffset = 0, grayVertsOffset = 0, grayOffsetsOffset = 0,
+              grayCellsOffset = 0;
+  VertexIndex numGrayLeaves = 0, numGrayCells = 0;
+  for(int lev = 0; lev < numLevels; ++lev)
+  {
+    std::uint64_t numBlocks, numGray, numOffsets, numLevelCells;
+    skipVector(sizeof(CoordType), size);
+    const std::size_t dataOffset = skipVector(sizeof(std::int32_t), numBlocks);
+    const std::size_t vertsOffset = skipVector(sizeof(VertexIndex), numGray);
+    const std::size_t offsOffset = skipVector(sizeof(VertexIndex), numOffsets);
+    const std::size_t cellsOffset =
+      skipVector(sizeof(VertexIndex), numLevelCells);
+    if(numGrayLeaves == 0 && numGray > 1 && numLevelCells > 0)
+    {
+      for(std::uint64_t i = 0; i < numBlocks; ++i)
+      {
+        std::int32_t data;
+        std::memcpy(&data, &bytes[dataOffset + i * sizeof(data)], sizeof(data));
+        if(data >= 0)
+        {
+          blockDataOffset = dataOffset + i * sizeof(data);
+          break;
+        }
+      }
+      grayVertsOffset = vertsOffset;
+      grayOffsetsOffset = offsOffset;
+      grayCellsOffset = cellsOffset;
+      numGrayLeaves = numGray;
+      numGrayCells = numLevelCells;
+    }
+  }
+  const std::size_t vertexBlocksOffset = skipVector(sizeof(CoordType), size);
+  ASSERT_EQ(bytes.size(), offset);
+  ASSERT_GT(numGrayLeaves, 1);
+  ASSERT_GT(blockDataOffset, 0);
+
+  // Loads the index after overwriting the value at byteOffset
+  auto loadCorrupted = [&](std::size_t byteOffset, auto value) {
+    std::vector<char> corrupt(bytes);
+    std::memcpy(&corrupt[byteOffset], &value, sizeof(value));
+    {
+      std::ofstream ofs(corruptName, std::ios::binary);
+      ofs.write(corrupt.data(), corrupt.size());
+    }
+    mint::Mesh* loadedMesh = quest::utilities::make_octahedron_mesh();
+    Octree3D loadedOctree(bbox, loadedMesh);
+    const bool loaded = loadedOctree.loadIndex(corruptName);
+    delete loadedMesh;
+    return loaded;
+  };
+
+  // The unmodified contents load
+  EXPECT_TRUE(loadCorrupted(cellVertsOffset, VertexIndex {0}));
+
+  EXPECT_FALSE(loadCorrupted(cellVertsOffset, numVerts));
+  EXPECT_FALSE(loadCorrupted(cellVertsOffset, VertexIndex {-1}));
+  EXPECT_FALSE(loadCorrupted(blockDataOffset, std::int32_t(numGrayLeaves)));
+  EXPECT_FALSE(loadCorrupted(grayVertsOffset, numVerts));
+  EXPECT_FALSE(loadCorrupted(grayOffsetsOffset, VertexIndex {1}));
+  EXPECT_FALSE(loadCorrupted(grayOffsetsOffset + sizeof(VertexIndex),
+                             VertexIndex(numGrayCells + 1)));
+  EXPECT_FALSE(loadCorrupted(grayCellsOffset, numCells));
+  EXPECT_FALSE(loadCorrupted(vertexBlocksOffset + DIM * sizeof(CoordType),
+                             CoordType(numLevels)));
+  EXPECT_FALSE(loadCorrupted(vertexBlocksOffset, CoordType {-1}));
+
+  std::remove(fileName.c_str());
+  std::remove(corruptName.c_str());
+
+  delete mesh;
+}
+
 //----------------------------------------------------------------------
 
 int main(int argc, char* argv[])
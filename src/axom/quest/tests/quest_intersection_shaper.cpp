@@ -21,13 +21,12 @@
 #include "axom/quest/IntersectionShaper.hpp"
 #include "axom/quest/util/mesh_helpers.hpp"
 
-#ifndef AXOM_USE_MFEM
-  #error "Quest's IntersectionShaper tests on mfem meshes require mfem library."
-#endif
 #ifdef AXOM_USE_MPI
   #include <mpi.h>
 #endif
 #include <cmath>
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -116,6 +115,7 @@ std::string yamlRoot(const std::string &filepath)
   return retval;
 }
 
+#if defined(AXOM_USE_MFEM)
 // The caller is responsible for freeing the returned grid function.
 mfem::GridFunction *newGridFunction(mfem::Mesh *mesh)
 {
@@ -222,6 +222,24 @@ void dcToConduit(sidre::MFEMSidreDataCollection &dc, conduit::Node &n)
   }
 }
 
+#endif  // defined(AXOM_USE_MFEM)
+
+// Turn the volume fraction fields of a mint mesh into a Conduit node that
+// can be compared with the baselines.
+void meshToConduit(const mint::Mesh *mesh, conduit::Node &n)
+{
+  const mint::FieldData *fd = mesh->getFieldData(mint::CELL_CENTERED);
+  for(int i = 0; i < fd->getNumFields(); i++)
+  {
+    const std::string &name = fd->getField(i)->getName();
+    if(name.find("vol_frac_") != std::string::npos)
+    {
+      n[name].set(mesh->getFieldPtr<double>(name, mint::CELL_CENTERED),
+                  mesh->getNumberOfCells());
+    }
+  }
+}
+
 bool compareConduit(const conduit::Node &n1,
                     const conduit::Node &n2,
                     double tolerance,
@@ -283,11 +301,119 @@ bool loadBaseline(const std::string &filename, conduit::Node &n)
   return loaded;
 }
 
+// Makes a mint mesh with the same cells as makeTestMesh. It is a uniform mesh,
+// or an unstructured hexahedral mesh when a sidre group is given.
+// The caller is responsible for freeing the returned mesh.
+mint::Mesh *makeTestMintMesh(sidre::Group *group = nullptr)
+{
+  const double lo[3] = {0., 0., 0.};
+  const double hi[3] = {1., 1., .25};
+  auto *uniform = new mint::UniformMesh(lo, hi, 21, 21, 2);
+  if(group == nullptr)
+  {
+    return uniform;
+  }
+
+  auto *hexMesh =
+    new mint::UnstructuredMesh<mint::SINGLE_SHAPE>(3, mint::HEX, group);
+  for(axom::IndexType n = 0; n < uniform->getNumberOfNodes(); n++)
+  {
+    double pt[3];
+    uniform->getNode(n, pt);
+    hexMesh->appendNode(pt[0], pt[1], pt[2]);
+  }
+  for(axom::IndexType c = 0; c < uniform->getNumberOfCells(); c++)
+  {
+    axom::IndexType nodes[8];
+    uniform->getCellNodeIDs(c, nodes);
+    hexMesh->appendCell(nodes);
+  }
+  delete uniform;
+  return hexMesh;
+}
+
+// Runs the stages of the shaping driver for all of the shapes.
+void runShaper(quest::IntersectionShaper &shaper,
+               const klee::ShapeSet &shapeSet,
+               bool batched = false)
+{
+  const klee::Dimensions shapeDim = shapeSet.getDimensions();
+  if(batched)
+  {
+    shaper.runBatchedShapeQueries(shapeDim);
+    slic::flushStreams();
+    return;
+  }
+
+  for(const auto &shape : shapeSet.getShapes())
+  {
+    SLIC_INFO(axom::fmt::format("\tshape {} -> material {}",
+                                shape.getName(),
+                                shape.getMaterial()));
+
+    // Load the shape from file
+    shaper.loadShape(shape);
+    slic::flushStreams();
+
+    // Generate a spatial index over the shape
+    shaper.prepareShapeQuery(shapeDim, shape);
+    slic::flushStreams();
+
+    // Query the mesh against this shape
+    shaper.runShapeQuery(shape);
+    slic::flushStreams();
+
+    // Apply the replacement rules for this shape against the existing
+    // materials
+    shaper.applyReplacementRules(shape);
+    slic::flushStreams();
+
+    // Finalize data structures associated with this shape and spatial index
+    shaper.finalizeShapeQuery();
+    slic::flushStreams();
+  }
+}
+
+// Compares the fields in \a current to the first baseline that can be loaded.
+bool compareToBaselines(const std::string &baselineName,
+                        const std::vector<std::string> &baselinePaths,
+                        const conduit::Node &current,
+                        double tolerance)
+{
+  bool success = false;
+  for(const auto &path : baselinePaths)
+  {
+    try
+    {
+      // Load the baseline file.
+      conduit::Node info, baselineNode;
+      std::string filename(pjoin(path, baselineName));
+      if(loadBaseline(filename, baselineNode))
+      {
+        // Compare the baseline to the current DC.
+        SLIC_INFO(axom::fmt::format("Comparing to baseline ", filename));
+        success = compareConduit(baselineNode, current, tolerance, info);
+        info.print();
+        break;
+      }
+    }
+    catch(...)
+    {
+      SLIC_INFO(
+        axom::fmt::format("Could not load {} from {}!", baselineName, path));
+    }
+  }
+  return success;
+}
+
+#if defined(AXOM_USE_MFEM)
 void replacementRuleTest(const std::string &shapeFile,
                          const std::string &policyName,
                          RuntimePolicy policy,
                          double tolerance,
-                         bool initialMats = false)
+                         bool initialMats = false,
+                         bool classifyCells = true,
+                         bool batched = false)
 {
   // Make potential baseline filenames for this test. Make a policy-specific
   // baseline that we can check first. If it is not present, the next baseline
@@ -325,35 +451,10 @@ void replacementRuleTest(const std::string &shapeFile,
   quest::IntersectionShaper shaper(shapeSet, &dc);
   shaper.setLevel(refinementLevel);
   shaper.setExecPolicy(policy);
+  shaper.setCellClassification(classifyCells);
 
   // Borrowed from shaping_driver.
-  const klee::Dimensions shapeDim = shapeSet.getDimensions();
-  for(const auto &shape : shapeSet.getShapes())
-  {
-    SLIC_INFO(axom::fmt::format("\tshape {} -> material {}",
-                                shape.getName(),
-                                shape.getMaterial()));
-
-    // Load the shape from file
-    shaper.loadShape(shape);
-    slic::flushStreams();
-
-    // Generate a spatial index over the shape
-    shaper.prepareShapeQuery(shapeDim, shape);
-    slic::flushStreams();
-
-    // Query the mesh against this shape
-    shaper.runShapeQuery(shape);
-    slic::flushStreams();
-
-    // Apply the replacement rules for this shape against the existing materials
-    shaper.applyReplacementRules(shape);
-    slic::flushStreams();
-
-    // Finalize data structures associated with this shape and spatial index
-    shaper.finalizeShapeQuery();
-    slic::flushStreams();
-  }
+  runShaper(shaper, shapeSet, batched);
 
   // Wrap the parts of the dc data we want in the baseline as a conduit node.
   conduit::Node current;
@@ -375,41 +476,192 @@ void replacementRuleTest(const std::string &shapeFile,
   // TODO: I might want an auto compare for generating baselines so I know if I need a policy-specific baseline.
 
   // Need to get the MFEM mesh out and compare to expected results
-  bool success = false;
-  for(const auto &path : baselinePaths)
+  bool success =
+    compareToBaselines(baselineName, baselinePaths, current, tolerance);
+  EXPECT_EQ(success, true);
+}
+
+#endif  // defined(AXOM_USE_MFEM)
+
+// Shapes a mint mesh, or a blueprint mesh in sidre, without a data collection
+// and returns its volume fractions in \a current.
+void shapeMintMesh(const klee::ShapeSet &shapeSet,
+                   RuntimePolicy policy,
+                   bool blueprint,
+                   conduit::Node &current)
+{
+  const int refinementLevel = 7;
+#ifdef AXOM_USE_MPI
+  MPI_Comm comm = MPI_COMM_WORLD;
+#else
+  MPI_Comm comm = MPI_COMM_SELF;
+#endif
+
+  if(blueprint)
   {
-    try
-    {
-      // Load the baseline file.
-      conduit::Node info, baselineNode;
-      std::string filename(pjoin(path, baselineName));
-      if(loadBaseline(filename, baselineNode))
-      {
-        // Compare the baseline to the current DC.
-        SLIC_INFO(axom::fmt::format("Comparing to baseline ", filename));
-        success = compareConduit(baselineNode, current, tolerance, info);
-        info.print();
-        break;
-      }
-    }
-    catch(...)
+    // The mint mesh only sets up the blueprint; the shaper reads it back
+    // from the group.
+    sidre::DataStore ds;
+    sidre::Group *meshGroup = ds.getRoot()->createGroup("mesh");
+    delete makeTestMintMesh(meshGroup);
+
     {
-      SLIC_INFO(
-        axom::fmt::format("Could not load {} from {}!", baselineName, path));
+      quest::IntersectionShaper shaper(shapeSet, meshGroup, "", comm);
+      shaper.setLevel(refinementLevel);
+      shaper.setExecPolicy(policy);
+      runShaper(shaper, shapeSet);
     }
+
+    // The volume fractions remain in the blueprint after the shaper is gone.
+    std::unique_ptr<mint::Mesh> mesh(mint::getMesh(meshGroup));
+    EXPECT_TRUE(meshGroup->hasView("fields/vol_frac_free/values"));
+    meshToConduit(mesh.get(), current);
+  }
+  else
+  {
+    std::unique_ptr<mint::Mesh> mesh(makeTestMintMesh());
+    quest::IntersectionShaper shaper(shapeSet, mesh.get(), comm);
+    shaper.setLevel(refinementLevel);
+    shaper.setExecPolicy(policy);
+    runShaper(shaper, shapeSet);
+    meshToConduit(mesh.get(), current);
   }
+}
+
+// Shapes a mint mesh, or a blueprint mesh in sidre, without a data collection
+// and compares its volume fractions to the baselines of the MFEM mesh.
+void mintMeshTest(const std::string &shapeFile,
+                  const std::string &policyName,
+                  RuntimePolicy policy,
+                  double tolerance,
+                  bool blueprint)
+{
+  std::string baselineName(yamlRoot(shapeFile));
+  std::vector<std::string> baselinePaths;
+  baselinePaths.push_back(pjoin(baselineDirectory(), policyName));
+  baselinePaths.push_back(baselineDirectory());
+
+  SLIC_INFO(axom::fmt::format("Reading shape set from {}", shapeFile));
+  klee::ShapeSet shapeSet(klee::readShapeSet(shapeFile));
+
+  conduit::Node current;
+  shapeMintMesh(shapeSet, policy, blueprint, current);
+
+  bool success =
+    compareToBaselines(baselineName, baselinePaths, current, tolerance);
   EXPECT_EQ(success, true);
 }
 
+#if defined(AXOM_USE_MFEM)
+// Shapes the MFEM test mesh, one shape at a time or in a single batch, with
+// a shaper set up by \a configure, and returns its volume fractions in
+// \a result.
+void shapeTestMesh(
+  const std::string &shapeFile,
+  const klee::ShapeSet &shapeSet,
+  RuntimePolicy policy,
+  bool initialMats,
+  bool batched,
+  const std::function<void(quest::IntersectionShaper &)> &configure,
+  conduit::Node &result)
+{
+  const int refinementLevel = 7;
+
+  sidre::MFEMSidreDataCollection dc(yamlRoot(shapeFile), nullptr, true);
+  makeTestMesh(dc, initialMats);
+#ifdef AXOM_USE_MPI
+  dc.SetComm(MPI_COMM_WORLD);
+#endif
+  quest::IntersectionShaper shaper(shapeSet, &dc);
+  shaper.setLevel(refinementLevel);
+  shaper.setExecPolicy(policy);
+  configure(shaper);
+
+  runShaper(shaper, shapeSet, batched);
+  dcToConduit(dc, result);
+}
+
+// Leaves a shaper in its default mode
+void defaultMode(quest::IntersectionShaper &) {}
+
+// Shapes the test mesh one shape at a time with a shaper in its default mode,
+// then with a shaper set up by \a configure, in a single batch if \a batched,
+// and compares the volume fractions of the two.
+void compareShaperModes(
+  const std::string &shapeFile,
+  RuntimePolicy policy,
+  double tolerance,
+  const std::function<void(quest::IntersectionShaper &)> &configure,
+  bool batched = false,
+  bool initialMats = false)
+{
+  klee::ShapeSet shapeSet(klee::readShapeSet(shapeFile));
+
+  conduit::Node expected, current;
+  shapeTestMesh(shapeFile,
+                shapeSet,
+                policy,
+                initialMats,
+                false,
+                defaultMode,
+                expected);
+  shapeTestMesh(shapeFile,
+                shapeSet,
+                policy,
+                initialMats,
+                batched,
+                configure,
+                current);
+
+  conduit::Node info;
+  EXPECT_TRUE(compareConduit(expected, current, tolerance, info))
+    << shapeFile;
+  info.print();
+}
+
+// Compares the volume fractions of a mint or blueprint mesh with those of
+// the MFEM test mesh, shaped one shape at a time.
+void compareMintMesh(const std::string &shapeFile,
+                     RuntimePolicy policy,
+                     double tolerance,
+                     bool blueprint)
+{
+  klee::ShapeSet shapeSet(klee::readShapeSet(shapeFile));
+
+  conduit::Node expected, current;
+  shapeTestMesh(shapeFile,
+                shapeSet,
+                policy,
+                false,
+                false,
+                defaultMode,
+                expected);
+  shapeMintMesh(shapeSet, policy, blueprint, current);
+
+  // The mint mesh has the volume fractions of the MFEM mesh
+  conduit::Node info;
+  EXPECT_TRUE(compareConduit(current, expected, tolerance, info))
+    << shapeFile;
+  info.print();
+}
+
 void replacementRuleTestSet(const std::vector<std::string> &cases,
                             const std::string &policyName,
                             RuntimePolicy policy,
                             double tolerance,
-                            bool initialMats = false)
+                            bool initialMats = false,
+                            bool classifyCells = true,
+                            bool batched = false)
 {
   for(const auto &c : cases)
   {
-    replacementRuleTest(testData(c), policyName, policy, tolerance, initialMats);
+    replacementRuleTest(testData(c),
+                        policyName,
+                        policy,
+                        tolerance,
+                        initialMats,
+                        classifyCells,
+                        batched);
   }
 }
 
@@ -771,9 +1023,11 @@ shapes:
   }
 }
 
+#endif  // defined(AXOM_USE_MFEM)
+
 //---------------------------------------------------------------------------
 // Define testing functions for different modes.
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
   #if defined(RUN_AXOM_SEQ_TESTS)
 TEST(IntersectionShaperTest, case1_seq)
 {
@@ -789,6 +1043,23 @@ TEST(IntersectionShaperTest, case1_omp)
 
   // Include a version that has some initial materials.
   replacementRuleTestSet(case1, "omp", RuntimePolicy::omp, tolerance, true);
+
+  // Clipping every element against the shapes gives the same results
+  replacementRuleTestSet(case1,
+                         "omp",
+                         RuntimePolicy::omp,
+                         tolerance,
+                         false,
+                         false);
+
+  // Shaping all the shapes in one pass gives the same results
+  replacementRuleTestSet(case1,
+                         "omp",
+                         RuntimePolicy::omp,
+                         tolerance,
+                         true,
+                         true,
+                         true);
 }
   #endif
   #if defined(AXOM_USE_CUDA)
@@ -808,12 +1079,21 @@ TEST(IntersectionShaperTest, case1_hip)
 #endif
 
 // case2
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
   #if defined(RUN_AXOM_SEQ_TESTS)
 TEST(IntersectionShaperTest, case2_seq)
 {
   constexpr double tolerance = 1.e-10;
   replacementRuleTestSet(case2, "seq", RuntimePolicy::seq, tolerance);
+
+  // Shaping all the shapes in one pass gives the same results
+  replacementRuleTestSet(case2,
+                         "seq",
+                         RuntimePolicy::seq,
+                         tolerance,
+                         false,
+                         true,
+                         true);
 }
   #endif
   #if defined(AXOM_USE_OPENMP)
@@ -840,7 +1120,7 @@ TEST(IntersectionShaperTest, case2_hip)
 #endif
 
 // case3
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
   #if defined(RUN_AXOM_SEQ_TESTS)
 TEST(IntersectionShaperTest, case3_seq)
 {
@@ -872,7 +1152,7 @@ TEST(IntersectionShaperTest, case3_hip)
 #endif
 
 // case4
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
   #if defined(RUN_AXOM_SEQ_TESTS)
 TEST(IntersectionShaperTest, case4_seq)
 {
@@ -903,9 +1183,132 @@ TEST(IntersectionShaperTest, case4_hip)
   #endif
 #endif
 
-// proeCase
+// mint and blueprint meshes
 #if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
   #if defined(RUN_AXOM_SEQ_TESTS)
+TEST(IntersectionShaperTest, mint_mesh_seq)
+{
+  constexpr double tolerance = 1.e-10;
+  mintMeshTest(testData(case1[0]),
+               "seq",
+               RuntimePolicy::seq,
+               tolerance,
+               false);
+}
+  #endif
+  #if defined(AXOM_USE_OPENMP)
+TEST(IntersectionShaperTest, mint_mesh_omp)
+{
+  constexpr double tolerance = 1.e-10;
+  mintMeshTest(testData(case1[0]),
+               "omp",
+               RuntimePolicy::omp,
+               tolerance,
+               false);
+}
+
+TEST(IntersectionShaperTest, blueprint_mesh_omp)
+{
+  constexpr double tolerance = 1.e-10;
+  for(const auto &c : case2)
+  {
+    mintMeshTest(testData(c), "omp", RuntimePolicy::omp, tolerance, true);
+  }
+}
+  #endif
+#endif
+
+// The batched, mint and blueprint modes against shaping the MFEM mesh one
+// shape at a time in the same run
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+  #if defined(RUN_AXOM_SEQ_TESTS)
+TEST(IntersectionShaperTest, batched_vs_per_shape_seq)
+{
+  constexpr double tolerance = 1.e-10;
+  constexpr bool batched = true;
+  compareShaperModes(testData(case1[0]),
+                     RuntimePolicy::seq,
+                     tolerance,
+                     defaultMode,
+                     batched);
+}
+  #endif
+  #if defined(AXOM_USE_OPENMP)
+TEST(IntersectionShaperTest, batched_vs_per_shape_omp)
+{
+  constexpr double tolerance = 1.e-10;
+  constexpr bool batched = true;
+  for(const auto &cases : {case1, case2, case4})
+  {
+    for(const auto &c : cases)
+    {
+      compareShaperModes(testData(c),
+                         RuntimePolicy::omp,
+                         tolerance,
+                         defaultMode,
+                         batched);
+    }
+  }
+
+  // With initial materials, which the replacement rules must respect
+  for(const auto &c : case1)
+  {
+    compareShaperModes(testData(c),
+                       RuntimePolicy::omp,
+                       tolerance,
+                       defaultMode,
+                       batched,
+                       true);
+  }
+}
+
+TEST(IntersectionShaperTest, mint_vs_per_shape_omp)
+{
+  constexpr double tolerance = 1.e-10;
+  for(const auto &c : case1)
+  {
+    compareMintMesh(testData(c), RuntimePolicy::omp, tolerance, false);
+    compareMintMesh(testData(c), RuntimePolicy::omp, tolerance, true);
+  }
+}
+  #endif
+#endif
+
+// Clipping the hexahedra directly gives the same volume fractions as
+// clipping their 24 tetrahedra, against octahedra (case1) and tetrahedra
+// (proeCase)
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+  #if defined(RUN_AXOM_SEQ_TESTS)
+TEST(IntersectionShaperTest, direct_hex_clipping_seq)
+{
+  constexpr double tolerance = 1.e-10;
+  auto decompose = [](quest::IntersectionShaper &shaper) {
+    shaper.setDirectHexClipping(false);
+  };
+  for(const auto &c : {case1[0], proeCase[0]})
+  {
+    compareShaperModes(testData(c), RuntimePolicy::seq, tolerance, decompose);
+  }
+}
+  #endif
+  #if defined(AXOM_USE_OPENMP)
+TEST(IntersectionShaperTest, direct_hex_clipping_omp)
+{
+  constexpr double tolerance = 1.e-10;
+  auto decompose = [](quest::IntersectionShaper &shaper) {
+    shaper.setDirectHexClipping(false);
+  };
+  for(const auto &c : {case1[0], case1[1], proeCase[0], proeCase[1]})
+  {
+    compareShaperModes(testData(c), RuntimePolicy::omp, tolerance, decompose);
+  }
+}
+  #endif
+#endif
+
+// proeCase
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+  #if defined(RUN_AXOM_SEQ_TESTS)
 TEST(IntersectionShaperTest, proeCase_seq)
 {
   constexpr double tolerance = 1.e-10;
@@ -937,7 +1340,7 @@ TEST(IntersectionShaperTest, proeCase_hip)
 
 //---------------------------------------------------------------------------
 // Line
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
   #if defined(RUN_AXOM_SEQ_TESTS)
 TEST(IntersectionShaperTest, line_seq)
 {
@@ -966,7 +1369,7 @@ TEST(IntersectionShaperTest, line_hip)
 
 //---------------------------------------------------------------------------
 // Cone
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
   #if defined(RUN_AXOM_SEQ_TESTS)
 TEST(IntersectionShaperTest, cone_seq)
 {
@@ -995,7 +1398,7 @@ TEST(IntersectionShaperTest, cone_hip)
 
 //---------------------------------------------------------------------------
 // Spline
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
   #if defined(RUN_AXOM_SEQ_TESTS)
 TEST(IntersectionShaperTest, spline_seq)
 {
@@ -1024,7 +1427,7 @@ TEST(IntersectionShaperTest, spline_hip)
 
 //---------------------------------------------------------------------------
 // Circle
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
   #if defined(RUN_AXOM_SEQ_TESTS)
 TEST(IntersectionShaperTest, circle_seq)
 {
@@ -1053,7 +1456,7 @@ TEST(IntersectionShaperTest, circle_hip)
 
 //---------------------------------------------------------------------------
 // LineTranslate
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
   #if defined(RUN_AXOM_SEQ_TESTS)
 TEST(IntersectionShaperTest, line_translate_seq)
 {
@@ -1082,7 +1485,7 @@ TEST(IntersectionShaperTest, line_translate_hip)
 
 //---------------------------------------------------------------------------
 // LineScale
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
   #if defined(RUN_AXOM_SEQ_TESTS)
 TEST(IntersectionShaperTest, line_scale_seq)
 {
@@ -1111,7 +1514,7 @@ TEST(IntersectionShaperTest, line_scale_hip)
 
 //---------------------------------------------------------------------------
 // LineRotate
-#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
+#if defined(AXOM_USE_MFEM) && defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
   #if defined(RUN_AXOM_SEQ_TESTS)
 TEST(IntersectionShaperTest, line_rotate_seq)
 {
@@ -0,0 +1,683 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ \file quest_marching_cubes.cpp
+ \brief Tests for the MarchingCubes execution paths.
+*/
+
+#include "axom/config.hpp"
+
+// Implementation requires Conduit.
+#ifdef AXOM_USE_CONDUIT
+
+  #include "gtest/gtest.h"
+
+  // Axom includes
+  #include "axom/core.hpp"
+  #include "axom/slic.hpp"
+  #include "axom/mint.hpp"
+  #include "axom/quest/MarchingCubes.hpp"
+
+  #include "conduit_blueprint.hpp"
+
+  #ifdef AXOM_USE_OPENMP
+    #include <omp.h>
+  #endif
+
+  // C/C++ includes
+  #include <algorithm>
+  #include <cmath>
+  #include <map>
+  #include <string>
+  #include <utility>
+  #include <vector>
+
+namespace
+{
+using ContourMesh = axom::mint::UnstructuredMesh<axom::mint::SINGLE_SHAPE>;
+using RuntimePolicy = axom::runtime_policy::Policy;
+
+const std::string topologyName = "mesh";
+const std::string functionName = "dist";
+const std::string cellIdField = "cellIds";
+const std::string domainIdField = "domainIds";
+const std::string normalField = "normals";
+const std::string valueIdField = "valueIds";
+
+/*!
+ * \brief Creates a multi-domain blueprint mesh of \a domainCount
+ *  structured domains with \a res nodes along each axis.
+ *
+ * Each domain gets a nodal field holding the distance to a point that
+ * depends on the domain, so the domains have different contours.
+ */
+template <int DIM>
+void createMultidomainMesh(int domainCount, int res, conduit::Node& mesh)
+{
+  const char* axes[3] = {"x", "y", "z"};
+  for(int n = 0; n < domainCount; ++n)
+  {
+    conduit::Node& dom = mesh.append();
+    conduit::blueprint::mesh::examples::braid("structured",
+                                              res,
+                                              res,
+                                              DIM == 3 ? res : 0,
+                                              dom);
+    dom["state/domain_id"] = 100 + n;
+
+    const double center[3] = {-2.0 + 0.5 * n, 1.0, 0.5};
+    const double* coords[DIM];
+    for(int d = 0; d < DIM; ++d)
+    {
+      coords[d] = dom["coordsets/coords/values"][axes[d]].as_float64_ptr();
+    }
+    const conduit::index_t nodeCount =
+      dom["coordsets/coords/values/x"].dtype().number_of_elements();
+
+    conduit::Node& fcn = dom["fields/" + functionName];
+    fcn["association"] = "vertex";
+    fcn["topology"] = topologyName;
+    fcn["values"].set(conduit::DataType::float64(nodeCount));
+    double* fcnValues = fcn["values"].as_float64_ptr();
+    for(conduit::index_t i = 0; i < nodeCount; ++i)
+    {
+      double dist2 = 0.0;
+      for(int d = 0; d < DIM; ++d)
+      {
+        dist2 += (coords[d][i] - center[d]) * (coords[d][i] - center[d]);
+      }
+      fcnValues[i] = std::sqrt(dist2);
+    }
+  }
+}
+
+/*!
+ * \brief Creates a multi-domain blueprint mesh of \a domainCount
+ *  structured domains, each with \a res nodes along each axis, placed
+ *  side by side along the x axis.
+ *
+ * Neighboring domains have the same coordinates on their common face.
+ * The nodal field is the distance to \a center, which is computed
+ * from the coordinates, so it also agrees on the common faces.
+ */
+template <int DIM>
+void createTiledMesh(int domainCount,
+                     int res,
+                     const double center[DIM],
+                     conduit::Node& mesh)
+{
+  const char* axes[3] = {"x", "y", "z"};
+  const double h = 20.0 / (res - 1);
+  for(int n = 0; n < domainCount; ++n)
+  {
+    conduit::Node& dom = mesh.append();
+    conduit::blueprint::mesh::examples::braid("structured",
+                                              res,
+                                              res,
+                                              DIM == 3 ? res : 0,
+                                              dom);
+    dom["state/domain_id"] = n;
+
+    double* coords[DIM];
+    for(int d = 0; d < DIM; ++d)
+    {
+      coords[d] = dom["coordsets/coords/values"][axes[d]].as_float64_ptr();
+    }
+    const conduit::index_t nodeCount =
+      dom["coordsets/coords/values/x"].dtype().number_of_elements();
+
+    conduit::Node& fcn = dom["fields/" + functionName];
+    fcn["association"] = "vertex";
+    fcn["topology"] = topologyName;
+    fcn["values"].set(conduit::DataType::float64(nodeCount));
+    double* fcnValues = fcn["values"].as_float64_ptr();
+    for(conduit::index_t i = 0; i < nodeCount; ++i)
+    {
+      // Use global logical indices, so shared nodes get the same values.
+      conduit::index_t idx = i;
+      double dist2 = 0.0;
+      for(int d = 0; d < DIM; ++d)
+      {
+        const conduit::index_t logical =
+          (idx % res) + (d == 0 ? n * (res - 1) : 0);
+        idx /= res;
+        coords[d][i] = -10.0 + h * logical;
+        dist2 += (coords[d][i] - center[d]) * (coords[d][i] - center[d]);
+      }
+      fcnValues[i] = std::sqrt(dist2);
+    }
+  }
+}
+
+/*!
+ * \brief Checks that each facet of the contour cells (a node in 2D,
+ *  an edge in 3D) is shared by exactly two cells.
+ *
+ * Degenerate cells, with repeated nodes, are skipped.
+ */
+void checkContourWatertight(const ContourMesh& contourMesh)
+{
+  const int dim = contourMesh.getDimension();
+  using FacetKey = std::pair<axom::IndexType, axom::IndexType>;
+  std::map<FacetKey, int> facetCounts;
+  for(axom::IndexType c = 0; c < contourMesh.getNumberOfCells(); ++c)
+  {
+    const axom::IndexType* cellNodeIds = contourMesh.getCellNodeIDs(c);
+    bool degenerate = false;
+    for(int i = 0; i < dim; ++i)
+    {
+      for(int j = i + 1; j < dim; ++j)
+      {
+        degenerate = degenerate || cellNodeIds[i] == cellNodeIds[j];
+      }
+    }
+    if(degenerate)
+    {
+      continue;
+    }
+
+    for(int i = 0; i < dim; ++i)
+    {
+      FacetKey key {cellNodeIds[i], -1};
+      if(dim == 3)
+      {
+        const axom::IndexType other = cellNodeIds[(i + 1) % dim];
+        key = {std::min(key.first, other), std::max(key.first, other)};
+      }
+      ++facetCounts[key];
+    }
+  }
+
+  EXPECT_FALSE(facetCounts.empty());
+  for(const auto& facetCount : facetCounts)
+  {
+    EXPECT_EQ(facetCount.second, 2)
+      << "Facet (" << facetCount.first.first << ", "
+      << facetCount.first.second << ") is used by " << facetCount.second
+      << " contour cells";
+  }
+}
+
+/*!
+ * \brief Checks that the contour normals are unit vectors pointing away
+ *  from \a center, toward increasing distance.
+ */
+template <int DIM>
+void checkContourNormals(const ContourMesh& contourMesh,
+                         const double center[DIM])
+{
+  const double* normals =
+    contourMesh.getFieldPtr<double>(normalField, axom::mint::NODE_CENTERED);
+  for(axom::IndexType n = 0; n < contourMesh.getNumberOfNodes(); ++n)
+  {
+    double norm2 = 0.0;
+    double dot = 0.0;
+    for(int d = 0; d < DIM; ++d)
+    {
+      const double normal = normals[n * DIM + d];
+      norm2 += normal * normal;
+      dot += normal * (contourMesh.getCoordinateArray(d)[n] - center[d]);
+    }
+    EXPECT_NEAR(norm2, 1.0, 1e-10) << "Normal of node " << n;
+    EXPECT_GT(dot, 0.0) << "Normal of node " << n;
+  }
+}
+
+/*!
+ * \brief Contours \a mesh with the given policy and options and
+ *  returns the contour in \a contourMesh.
+ */
+void computeContour(RuntimePolicy policy,
+                    const conduit::Node& mesh,
+                    double contourVal,
+                    bool weldNodes,
+                    ContourMesh& contourMesh)
+{
+  axom::quest::MarchingCubes mc(policy, mesh, topologyName);
+  mc.setFunctionField(functionName);
+  mc.setWeldNodes(weldNodes);
+  mc.setComputeNormals(true);
+  mc.computeIsocontour(contourVal);
+  mc.populateContourMesh(contourMesh, cellIdField, domainIdField, normalField);
+}
+
+/*!
+ * \brief Contours \a mesh at several values in one computation and
+ *  returns the contours in \a contourMesh.
+ */
+void computeContours(RuntimePolicy policy,
+                     const conduit::Node& mesh,
+                     const std::vector<double>& contourVals,
+                     bool weldNodes,
+                     ContourMesh& contourMesh)
+{
+  axom::quest::MarchingCubes mc(policy, mesh, topologyName);
+  mc.setFunctionField(functionName);
+  mc.setWeldNodes(weldNodes);
+  mc.setComputeNormals(true);
+  mc.computeIsocontours(contourVals);
+  mc.populateContourMesh(contourMesh,
+                         cellIdField,
+                         domainIdField,
+                         normalField,
+                         valueIdField);
+}
+
+/// Checks that the cells of a contour mesh only use nodes of the mesh
+void expectValidCells(const ContourMesh& contourMesh)
+{
+  const int dim = contourMesh.getDimension();
+  const axom::IndexType nodeCount = contourMesh.getNumberOfNodes();
+  for(axom::IndexType c = 0; c < contourMesh.getNumberOfCells(); ++c)
+  {
+    const axom::IndexType* cellNodeIds = contourMesh.getCellNodeIDs(c);
+    for(int i = 0; i < dim; ++i)
+    {
+      EXPECT_GE(cellNodeIds[i], 0) << "Cell " << c;
+      EXPECT_LT(cellNodeIds[i], nodeCount) << "Cell " << c;
+    }
+  }
+}
+
+/// Checks that two contour meshes have identical nodes, cells and fields
+void expectSameContours(const ContourMesh& expected, const ContourMesh& actual)
+{
+  expectValidCells(actual);
+
+  const int dim = expected.getDimension();
+  const axom::IndexType nodeCount = expected.getNumberOfNodes();
+  const axom::IndexType cellCount = expected.getNumberOfCells();
+  ASSERT_EQ(dim, actual.getDimension());
+  ASSERT_EQ(nodeCount, actual.getNumberOfNodes());
+  ASSERT_EQ(cellCount, actual.getNumberOfCells());
+
+  for(int d = 0; d < dim; ++d)
+  {
+    const double* expectedCoords = expected.getCoordinateArray(d);
+    const double* actualCoords = actual.getCoordinateArray(d);
+    const double* expectedNormals =
+      expected.getFieldPtr<double>(normalField, axom::mint::NODE_CENTERED);
+    const double* actualNormals =
+      actual.getFieldPtr<double>(normalField, axom::mint::NODE_CENTERED);
+    for(axom::IndexType n = 0; n < nodeCount; ++n)
+    {
+      EXPECT_DOUBLE_EQ(expectedCoords[n], actualCoords[n]);
+      EXPECT_DOUBLE_EQ(expectedNormals[n * dim + d],
+                       actualNormals[n * dim + d]);
+    }
+  }
+
+  const auto* expectedCellIds =
+    expected.getFieldPtr<axom::IndexType>(cellIdField,
+                                          axom::mint::CELL_CENTERED);
+  const auto* actualCellIds =
+    actual.getFieldPtr<axom::IndexType>(cellIdField, axom::mint::CELL_CENTERED);
+  const auto* expectedDomainIds =
+    expected.getFieldPtr<axom::IndexType>(domainIdField,
+                                          axom::mint::CELL_CENTERED);
+  const auto* actualDomainIds =
+    actual.getFieldPtr<axom::IndexType>(domainIdField,
+                                        axom::mint::CELL_CENTERED);
+
+  axom::IndexType expectedCell[3];
+  axom::IndexType actualCell[3];
+  for(axom::IndexType c = 0; c < cellCount; ++c)
+  {
+    expected.getCellNodeIDs(c, expectedCell);
+    actual.getCellNodeIDs(c, actualCell);
+    for(int d = 0; d < dim; ++d)
+    {
+      EXPECT_EQ(expectedCell[d], actualCell[d]);
+      EXPECT_EQ(expectedCellIds[c * dim + d], actualCellIds[c * dim + d]);
+    }
+    EXPECT_EQ(expectedDomainIds[c], actualDomainIds[c]);
+  }
+}
+
+/*!
+ * \brief Checks that the multi-domain contour, computed one domain at a
+ *  time, is the concatenation of the single-domain contours.
+ *
+ * The domains overlap without sharing contour nodes, so welding does
+ * not merge nodes of different domains.
+ */
+template <int DIM>
+void checkSerialDomains(bool weldNodes)
+{
+  const auto cellType =
+    DIM == 2 ? axom::mint::CellType::SEGMENT : axom::mint::CellType::TRIANGLE;
+  const double contourVal = 5.0;
+
+  conduit::Node mesh;
+  createMultidomainMesh<DIM>(4, 12, mesh);
+
+  ContourMesh contourMesh(DIM, cellType);
+  computeContour(RuntimePolicy::seq, mesh, contourVal, weldNodes, contourMesh);
+  EXPECT_GT(contourMesh.getNumberOfCells(), 0);
+
+  ContourMesh expectedMesh(DIM, cellType);
+  expectedMesh.createField<axom::IndexType>(domainIdField,
+                                            axom::mint::CELL_CENTERED);
+  axom::IndexType n = 0;
+  for(const auto& dom : mesh.children())
+  {
+    axom::quest::MarchingCubesSingleDomain single(RuntimePolicy::seq,
+                                                  dom,
+                                                  topologyName,
+                                                  "");
+    single.setFunctionField(functionName);
+    single.setWeldNodes(weldNodes);
+    single.setComputeNormals(true);
+    single.computeIsocontour(contourVal);
+
+    const axom::IndexType priorCellCount = expectedMesh.getNumberOfCells();
+    single.populateContourMesh(expectedMesh, cellIdField, normalField);
+
+    // Each domain's cells only use the nodes added for that domain.
+    const axom::IndexType priorNodeCount = expectedMesh.getNumberOfNodes() -
+      single.getContourNodeCount();
+    axom::IndexType* domainIds =
+      expectedMesh.getFieldPtr<axom::IndexType>(domainIdField,
+                                                axom::mint::CELL_CENTERED);
+    for(axom::IndexType c = priorCellCount; c < expectedMesh.getNumberOfCells();
+        ++c)
+    {
+      domainIds[c] = single.getDomainId(n);
+      EXPECT_GE(expectedMesh.getCellNodeIDs(c)[0], priorNodeCount);
+    }
+    ++n;
+  }
+
+  expectSameContours(expectedMesh, contourMesh);
+}
+
+/// Cells of a contour mesh, grouped by (domain id, contour value index)
+using CellGroupKey = std::pair<axom::IndexType, axom::IndexType>;
+using CellGroups = std::map<CellGroupKey, std::vector<axom::IndexType>>;
+
+/*!
+ * \brief Groups the cells of \a contourMesh by domain and by contour
+ *  value, using \a valueId for all cells if \a hasValueIds is false.
+ */
+CellGroups groupCells(const ContourMesh& contourMesh,
+                      bool hasValueIds,
+                      axom::IndexType valueId = 0)
+{
+  const auto* domainIds =
+    contourMesh.getFieldPtr<axom::IndexType>(domainIdField,
+                                             axom::mint::CELL_CENTERED);
+  const auto* valueIds = hasValueIds
+    ? contourMesh.getFieldPtr<axom::IndexType>(valueIdField,
+                                               axom::mint::CELL_CENTERED)
+    : nullptr;
+
+  CellGroups groups;
+  for(axom::IndexType c = 0; c < contourMesh.getNumberOfCells(); ++c)
+  {
+    const axom::IndexType v = hasValueIds ? valueIds[c] : valueId;
+    groups[{domainIds[c], v}].push_back(c);
+  }
+  return groups;
+}
+
+/*!
+ * \brief Checks that cell \a expectedCell of \a expected and cell
+ *  \a actualCell of \a actual have the same parent cell and the same
+ *  node coordinates and normals.
+ *
+ * Node ids are not compared, because a cell's nodes are numbered
+ * differently when the contours of other values precede it.
+ */
+void expectSameCell(const ContourMesh& expected,
+                    axom::IndexType expectedCell,
+                    const ContourMesh& actual,
+                    axom::IndexType actualCell)
+{
+  const int dim = expected.getDimension();
+  const auto* expectedCellIds =
+    expected.getFieldPtr<axom::IndexType>(cellIdField,
+                                          axom::mint::CELL_CENTERED);
+  const auto* actualCellIds =
+    actual.getFieldPtr<axom::IndexType>(cellIdField, axom::mint::CELL_CENTERED);
+  const double* expectedNormals =
+    expected.getFieldPtr<double>(normalField, axom::mint::NODE_CENTERED);
+  const double* actualNormals =
+    actual.getFieldPtr<double>(normalField, axom::mint::NODE_CENTERED);
+
+  const axom::IndexType* expectedNodes = expected.getCellNodeIDs(expectedCell);
+  const axom::IndexType* actualNodes = actual.getCellNodeIDs(actualCell);
+  for(int i = 0; i < dim; ++i)
+  {
+    EXPECT_EQ(expectedCellIds[expectedCell * dim + i],
+              actualCellIds[actualCell * dim + i]);
+    for(int d = 0; d < dim; ++d)
+    {
+      EXPECT_DOUBLE_EQ(expected.getCoordinateArray(d)[expectedNodes[i]],
+                       actual.getCoordinateArray(d)[actualNodes[i]]);
+      EXPECT_DOUBLE_EQ(expectedNormals[expectedNodes[i] * dim + d],
+                       actualNormals[actualNodes[i] * dim + d]);
+    }
+  }
+}
+
+/*!
+ * \brief Checks that contouring several values at once gives the same
+ *  cells as contouring each value separately, and that the value id
+ *  field tags each cell with the index of its contour value.
+ */
+template <int DIM>
+void checkMultipleValues(RuntimePolicy policy, bool weldNodes)
+{
+  const auto cellType =
+    DIM == 2 ? axom::mint::CellType::SEGMENT : axom::mint::CellType::TRIANGLE;
+  const std::vector<double> contourVals {3.0, 5.0, 7.5};
+
+  conduit::Node mesh;
+  createMultidomainMesh<DIM>(4, 12, mesh);
+
+  ContourMesh multiMesh(DIM, cellType);
+  computeContours(policy, mesh, contourVals, weldNodes, multiMesh);
+  expectValidCells(multiMesh);
+
+  // Within each domain, the cells are ordered by contour value.
+  const auto* domainIds =
+    multiMesh.getFieldPtr<axom::IndexType>(domainIdField,
+                                           axom::mint::CELL_CENTERED);
+  const auto* valueIds =
+    multiMesh.getFieldPtr<axom::IndexType>(valueIdField,
+                                           axom::mint::CELL_CENTERED);
+  for(axom::IndexType c = 1; c < multiMesh.getNumberOfCells(); ++c)
+  {
+    if(domainIds[c] == domainIds[c - 1])
+    {
+      EXPECT_LE(valueIds[c - 1], valueIds[c]);
+    }
+  }
+
+  const CellGroups multiGroups = groupCells(multiMesh, true);
+  axom::IndexType matchedCellCount = 0;
+  for(axom::IndexType v = 0; v < axom::IndexType(contourVals.size()); ++v)
+  {
+    ContourMesh singleMesh(DIM, cellType);
+    computeContour(policy, mesh, contourVals[v], weldNodes, singleMesh);
+    EXPECT_GT(singleMesh.getNumberOfCells(), 0);
+
+    for(const auto& group : groupCells(singleMesh, false, v))
+    {
+      const std::vector<axom::IndexType>& singleCells = group.second;
+      auto it = multiGroups.find(group.first);
+      ASSERT_TRUE(it != multiGroups.end())
+        << "No cells for domain " << group.first.first << ", value " << v;
+      const std::vector<axom::IndexType>& multiCells = it->second;
+      ASSERT_EQ(singleCells.size(), multiCells.size());
+      for(std::size_t i = 0; i < singleCells.size(); ++i)
+      {
+        expectSameCell(singleMesh, singleCells[i], multiMesh, multiCells[i]);
+      }
+      matchedCellCount += singleCells.size();
+    }
+  }
+
+  // Every cell of the multi-value contour belongs to one of the values.
+  EXPECT_EQ(matchedCellCount, multiMesh.getNumberOfCells());
+}
+
+/*!
+ * \brief Checks that a welded contour of side-by-side domains is
+ *  watertight, with the nodes on the domain boundaries shared by the
+ *  domains, and that its normals are consistently oriented.
+ */
+template <int DIM>
+void checkWatertightDomains(RuntimePolicy policy, int domainCount)
+{
+  const auto cellType =
+    DIM == 2 ? axom::mint::CellType::SEGMENT : axom::mint::CellType::TRIANGLE;
+  // A circle or sphere crossing the boundary between the first two
+  // domains, and inside the union of the domains.
+  const double center[3] = {10.3, 0.4, 0.2};
+  const double contourVal = 5.0;
+
+  conduit::Node mesh;
+  createTiledMesh<DIM>(domainCount, 12, center, mesh);
+
+  axom::quest::MarchingCubes mc(policy, mesh, topologyName);
+  mc.setFunctionField(functionName);
+  mc.setWeldNodes(true);
+  mc.setComputeNormals(true);
+  mc.computeIsocontour(contourVal);
+
+  ContourMesh contourMesh(DIM, cellType);
+  mc.populateContourMesh(contourMesh, cellIdField, domainIdField, normalField);
+  EXPECT_EQ(contourMesh.getNumberOfCells(), mc.getContourCellCount());
+  EXPECT_LT(contourMesh.getNumberOfNodes(), mc.getContourNodeCount());
+
+  // The contour crosses the boundary between the first two domains.
+  const auto* domainIds =
+    contourMesh.getFieldPtr<axom::IndexType>(domainIdField,
+                                             axom::mint::CELL_CENTERED);
+  EXPECT_EQ(*std::min_element(domainIds,
+                              domainIds + contourMesh.getNumberOfCells()),
+            0);
+  EXPECT_EQ(*std::max_element(domainIds,
+                              domainIds + contourMesh.getNumberOfCells()),
+            1);
+
+  checkContourWatertight(contourMesh);
+  checkContourNormals<DIM>(contourMesh, center);
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+TEST(quest_marching_cubes, watertight_2d)
+{
+  checkWatertightDomains<2>(RuntimePolicy::seq, 2);
+  checkWatertightDomains<2>(RuntimePolicy::seq, 3);
+  #ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+  checkWatertightDomains<2>(RuntimePolicy::omp,
+                            std::max(2, omp_get_max_threads()));
+  #endif
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_marching_cubes, watertight_3d)
+{
+  checkWatertightDomains<3>(RuntimePolicy::seq, 2);
+  checkWatertightDomains<3>(RuntimePolicy::seq, 3);
+  #ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+  checkWatertightDomains<3>(RuntimePolicy::omp,
+                            std::max(2, omp_get_max_threads()));
+  #endif
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_marching_cubes, multiple_values_2d)
+{
+  checkMultipleValues<2>(RuntimePolicy::seq, false);
+  checkMultipleValues<2>(RuntimePolicy::seq, true);
+  #ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+  checkMultipleValues<2>(RuntimePolicy::omp, true);
+  #endif
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_marching_cubes, multiple_values_3d)
+{
+  checkMultipleValues<3>(RuntimePolicy::seq, false);
+  checkMultipleValues<3>(RuntimePolicy::seq, true);
+  #ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+  checkMultipleValues<3>(RuntimePolicy::omp, true);
+  #endif
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_marching_cubes, serial_domains_2d)
+{
+  checkSerialDomains<2>(false);
+  checkSerialDomains<2>(true);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_marching_cubes, serial_domains_3d)
+{
+  checkSerialDomains<3>(false);
+  checkSerialDomains<3>(true);
+}
+
+  #ifdef AXOM_RUNTIME_POLICY_USE_OPENMP
+/*!
+ * \brief Checks that processing the domains concurrently gives the same
+ *  contour as processing them one at a time.
+ *
+ * MarchingCubes processes domains concurrently with the omp policy when
+ * there are at least as many domains as threads.
+ */
+template <int DIM>
+void checkDomainParallel(bool weldNodes)
+{
+  const auto cellType =
+    DIM == 2 ? axom::mint::CellType::SEGMENT : axom::mint::CellType::TRIANGLE;
+  const double contourVal = 5.0;
+  const int domainCount = std::max(2, omp_get_max_threads());
+
+  conduit::Node mesh;
+  createMultidomainMesh<DIM>(domainCount, 10, mesh);
+
+  ContourMesh serialMesh(DIM, cellType);
+  computeContour(RuntimePolicy::seq, mesh, contourVal, weldNodes, serialMesh);
+  EXPECT_GT(serialMesh.getNumberOfCells(), 0);
+
+  ContourMesh parallelMesh(DIM, cellType);
+  computeContour(RuntimePolicy::omp, mesh, contourVal, weldNodes, parallelMesh);
+
+  expectSameContours(serialMesh, parallelMesh);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_marching_cubes, domain_parallel_2d)
+{
+  checkDomainParallel<2>(false);
+  checkDomainParallel<2>(true);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_marching_cubes, domain_parallel_3d)
+{
+  checkDomainParallel<3>(false);
+  checkDomainParallel<3>(true);
+}
+  #endif  // AXOM_RUNTIME_POLICY_USE_OPENMP
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  axom::slic::SimpleLogger logger;
+
+  return RUN_ALL_TESTS();
+}
+
+#endif  // AXOM_USE_CONDUIT
@@ -432,6 +432,83 @@ TEST(quest_mesh_tester, surfacemesh_watertight_intrinsic)
 
     delete surface_mesh;
   }
+
+  {
+    SCOPED_TRACE("Tetrahedron with a fin on one of its edges");
+    surface_mesh = static_cast<UMesh*>(quest::utilities::make_tetrahedron_mesh());
+    surface_mesh->appendNode(0., 0., 30.);
+    const axom::IndexType fin[3] = {0, 1, surface_mesh->getNumberOfNodes() - 1};
+    surface_mesh->appendCell(fin);
+    EXPECT_EQ(quest::WatertightStatus::CHECK_FAILED,
+              quest::isSurfaceMeshWatertight(surface_mesh));
+    EXPECT_FALSE(surface_mesh->hasField("boundary", mint::CELL_CENTERED));
+
+    delete surface_mesh;
+  }
+
+  {
+    // The degenerate triangle's other two edges match each other, so only
+    // its repeated vertex makes the check fail
+    SCOPED_TRACE("Tetrahedron and a triangle with a repeated vertex");
+    surface_mesh = static_cast<UMesh*>(quest::utilities::make_tetrahedron_mesh());
+    surface_mesh->appendNode(10., 10., 10.);
+    surface_mesh->appendNode(20., 10., 10.);
+    const axom::IndexType n = surface_mesh->getNumberOfNodes();
+    const axom::IndexType degen[3] = {n - 2, n - 2, n - 1};
+    surface_mesh->appendCell(degen);
+    EXPECT_EQ(quest::WatertightStatus::CHECK_FAILED,
+              quest::isSurfaceMeshWatertight(surface_mesh, true));
+    EXPECT_FALSE(surface_mesh->hasField("boundary", mint::CELL_CENTERED));
+    EXPECT_FALSE(surface_mesh->hasField("bndry_face", mint::FACE_CENTERED));
+
+    delete surface_mesh;
+  }
+}
+
+TEST(quest_mesh_tester, surfacemesh_watertight_face_relation)
+{
+  constexpr int ON_BOUNDARY = 1;
+
+  {
+    SCOPED_TRACE("Cracked tetrahedron, computing the face relation");
+    UMesh* surface_mesh =
+      static_cast<UMesh*>(quest::utilities::make_crackedtet_mesh());
+    EXPECT_EQ(quest::WatertightStatus::NOT_WATERTIGHT,
+              quest::isSurfaceMeshWatertight(surface_mesh, true));
+
+    // The face relation stays cached, and its boundary faces are marked
+    const axom::IndexType numFaces = surface_mesh->getNumberOfFaces();
+    EXPECT_GT(numFaces, 0);
+    ASSERT_TRUE(surface_mesh->hasField("bndry_face", mint::FACE_CENTERED));
+    const int* bndry_face =
+      surface_mesh->getFieldPtr<int>("bndry_face", mint::FACE_CENTERED);
+    int numBndryFaces = 0;
+    for(axom::IndexType iface = 0; iface < numFaces; ++iface)
+    {
+      axom::IndexType c1, c2;
+      surface_mesh->getFaceCellIDs(iface, c1, c2);
+      const bool onBoundary =
+        (c2 == static_cast<axom::IndexType>(mint::UNDEFINED_CELL));
+      EXPECT_EQ(onBoundary, bndry_face[iface] == ON_BOUNDARY);
+      numBndryFaces += onBoundary ? 1 : 0;
+    }
+    EXPECT_GT(numBndryFaces, 0);
+
+    delete surface_mesh;
+  }
+
+  {
+    SCOPED_TRACE("Cracked tetrahedron, without the face relation");
+    UMesh* surface_mesh =
+      static_cast<UMesh*>(quest::utilities::make_crackedtet_mesh());
+    EXPECT_EQ(quest::WatertightStatus::NOT_WATERTIGHT,
+              quest::isSurfaceMeshWatertight(surface_mesh));
+    EXPECT_TRUE(surface_mesh->hasField("boundary", mint::CELL_CENTERED));
+    EXPECT_FALSE(surface_mesh->hasField("bndry_face", mint::FACE_CENTERED));
+    EXPECT_EQ(0, surface_mesh->getNumberOfFaces());
+
+    delete surface_mesh;
+  }
 }
 
 TEST(quest_mesh_tester, surfacemesh_watertight_ondisk)
@@ -490,8 +567,10 @@ TEST(quest_mesh_tester, surfacemesh_watertight_ondisk)
           // First weld vertices
           quest::weldTriMeshVertices(&surface_mesh, EPS);
 
-          // Then check for holes (for STL, only meaningful after welding)
-          EXPECT_EQ(expwatertight, quest::isSurfaceMeshWatertight(surface_mesh));
+          // Then check for holes (for STL, only meaningful after welding).
+          // The face relation gives the edge count for the Euler characteristic
+          EXPECT_EQ(expwatertight,
+                    quest::isSurfaceMeshWatertight(surface_mesh, true));
 
           /// Perform some additional checks on the welded mesh
           int numWeldedVerts = surface_mesh->getNumberOfNodes();
@@ -552,6 +552,74 @@ shapes:
   }
 }
 
+TEST_F(SamplingShaperTest2D, adaptive_circle)
+{
+  const auto& testname =
+    ::testing::UnitTest::GetInstance()->current_test_info()->name();
+
+  const std::string shape_template = R"(
+dimensions: 2
+
+shapes:
+- name: circle_shape
+  material: {}
+  geometry:
+    format: c2c
+    path: {}
+)";
+
+  const std::string circle_material = "circleMat";
+
+  ScopedTemporaryFile contour_file(axom::fmt::format("{}.contour", testname),
+                                   unit_circle_contour);
+
+  ScopedTemporaryFile shape_file(axom::fmt::format("{}.yaml", testname),
+                                 axom::fmt::format(shape_template,
+                                                   circle_material,
+                                                   contour_file.getFileName()));
+
+  this->validateShapeFile(shape_file.getFileName());
+  this->initializeShaping(shape_file.getFileName());
+
+  // Sample 4 points per dimension, but only refine the elements on the
+  // boundary of the circle
+  m_shaper->setSamplingErrorTarget(0.25);
+  this->runShaping();
+
+  constexpr double expected_volume = M_PI;
+  this->checkExpectedVolumeFractions(circle_material, expected_volume);
+
+  const auto numQueries = m_shaper->getNumSampleQueries();
+  const auto numPoints = m_shaper->getNumSamplePoints();
+  SLIC_INFO(axom::fmt::format("Queried {} of {} sample points",
+                              numQueries,
+                              numPoints));
+  EXPECT_EQ(this->getMesh().GetNE() * 16, numPoints);
+  EXPECT_GT(numQueries, 0);
+  EXPECT_LT(numQueries, numPoints);
+}
+
+TEST_F(SamplingShaperTest2D, coarse_sample_indices)
+{
+  // 5 points per dimension
+  const auto geom = mfem::Geometry::SQUARE;
+  const auto& ir = mfem::IntRules.Get(geom, 9);
+  ASSERT_EQ(25, ir.GetNPoints());
+
+  // The points closest to the four corners and the center
+  const auto coarse = quest::shaping::coarseSampleIndices(ir, geom);
+  EXPECT_EQ(5, static_cast<int>(coarse.size()));
+  for(int p : coarse)
+  {
+    const auto& ip = ir.IntPoint(p);
+    const bool isCorner = (ip.x < .1 || ip.x > .9) && (ip.y < .1 || ip.y > .9);
+    const bool isCenter =
+      axom::utilities::isNearlyEqual(ip.x, .5, 1e-12) &&
+      axom::utilities::isNearlyEqual(ip.y, .5, 1e-12);
+    EXPECT_TRUE(isCorner || isCenter);
+  }
+}
+
 TEST_F(SamplingShaperTest2D, basic_circle_projector)
 {
   using Point2D = primal::Point<double, 2>;
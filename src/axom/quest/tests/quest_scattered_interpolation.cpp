@@ -0,0 +1,224 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "gtest/gtest.h"
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/quest/Delaunay.hpp"
+#include "axom/quest/ScatteredInterpolation.hpp"
+
+#include "conduit.hpp"
+
+// C/C++ includes
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+const char* const COMPONENT_NAMES[] = {"x", "y", "z"};
+
+/// Value returned for query points that are not in the triangulation
+constexpr double INVALID_VALUE = -1e30;
+
+/// A nonlinear scalar field; index \a f selects one of several fields
+template <int DIM>
+double fieldValue(int f, const double* xyz)
+{
+  double val = 1. + f;
+  for(int d = 0; d < DIM; ++d)
+  {
+    val += std::sin((d + 1 + f) * xyz[d]) * xyz[(d + 1) % DIM];
+  }
+  return val;
+}
+
+/*!
+ * \brief Adds a blueprint point mesh to \a mesh with separate coordinate
+ *  arrays for \a coords, stored as DIM consecutive values per point.
+ */
+template <int DIM>
+void addPointMesh(conduit::Node& mesh, const std::vector<double>& coords)
+{
+  const int npts = static_cast<int>(coords.size()) / DIM;
+
+  mesh["coordsets/coords/type"] = "explicit";
+  for(int d = 0; d < DIM; ++d)
+  {
+    std::vector<double> vals(npts);
+    for(int i = 0; i < npts; ++i)
+    {
+      vals[i] = coords[i * DIM + d];
+    }
+    mesh["coordsets/coords/values"][COMPONENT_NAMES[d]].set(vals);
+  }
+
+  mesh["topologies/mesh/type"] = "points";
+  mesh["topologies/mesh/coordset"] = "coords";
+}
+
+/// Adds a vertex-associated field named \a name to the point mesh \a mesh
+template <typename T>
+void addField(conduit::Node& mesh,
+              const std::string& name,
+              const std::vector<T>& values)
+{
+  conduit::Node& fld = mesh["fields"][name];
+  fld["association"] = "vertex";
+  fld["topology"] = "mesh";
+  fld["values"].set(values);
+}
+
+/*!
+ * \brief Checks that interpolating with the weights precomputed by
+ *  computeInterpolationWeights() gives the same values as interpolateField()
+ *
+ * The query points lie on a lattice over a box that is twice as wide as
+ * the box containing the input points, so many of them are outside the
+ * triangulation and must get the invalid value in both cases.
+ */
+template <int DIM>
+void checkInterpolationWeights(int numInputPts, int queryRes)
+{
+  constexpr int NUM_FIELDS = 3;
+
+  // Random input points in the unit square or cube, with several fields
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(0., 1.);
+  std::vector<double> inputCoords(numInputPts * DIM);
+  for(auto& c : inputCoords)
+  {
+    c = dist(gen);
+  }
+
+  conduit::Node input_mesh;
+  addPointMesh<DIM>(input_mesh, inputCoords);
+  for(int f = 0; f < NUM_FIELDS; ++f)
+  {
+    std::vector<double> vals(numInputPts);
+    for(int i = 0; i < numInputPts; ++i)
+    {
+      vals[i] = fieldValue<DIM>(f, &inputCoords[i * DIM]);
+    }
+    addField(input_mesh, "f" + std::to_string(f), vals);
+  }
+
+  // Query points on a lattice over [-0.5, 1.5]^DIM
+  int numQueryPts = 1;
+  for(int d = 0; d < DIM; ++d)
+  {
+    numQueryPts *= queryRes;
+  }
+  std::vector<double> queryCoords(numQueryPts * DIM);
+  for(int i = 0; i < numQueryPts; ++i)
+  {
+    for(int d = 0, idx = i; d < DIM; ++d, idx /= queryRes)
+    {
+      queryCoords[i * DIM + d] = -0.5 + 2. * (idx % queryRes) / (queryRes - 1);
+    }
+  }
+
+  conduit::Node query_mesh;
+  addPointMesh<DIM>(query_mesh, queryCoords);
+  addField(query_mesh,
+           "cell_idx",
+           std::vector<axom::IndexType>(numQueryPts, 0));
+  for(int f = 0; f < NUM_FIELDS; ++f)
+  {
+    const std::vector<double> zeros(numQueryPts, 0.);
+    addField(query_mesh, "direct_f" + std::to_string(f), zeros);
+    addField(query_mesh, "weighted_f" + std::to_string(f), zeros);
+  }
+
+  axom::quest::ScatteredInterpolation<DIM> scattered;
+  scattered.buildTriangulation(input_mesh, "coords");
+  scattered.locatePoints(query_mesh, "coords");
+  scattered.computeInterpolationWeights(query_mesh, "coords");
+
+  const auto* cell_idx = static_cast<const axom::IndexType*>(
+    query_mesh["fields/cell_idx/values"].data_ptr());
+
+  int numInside = 0;
+  for(int i = 0; i < numQueryPts; ++i)
+  {
+    if(cell_idx[i] != axom::quest::Delaunay<DIM>::INVALID_INDEX)
+    {
+      ++numInside;
+    }
+  }
+  // The lattice has points both inside and outside the triangulation
+  EXPECT_GT(numInside, 0);
+  EXPECT_LT(numInside, numQueryPts);
+
+  // The same weights are reused for every field
+  for(int f = 0; f < NUM_FIELDS; ++f)
+  {
+    const std::string in_name = "f" + std::to_string(f);
+    const std::string direct_name = "direct_" + in_name;
+    const std::string weighted_name = "weighted_" + in_name;
+
+    scattered.interpolateField(query_mesh,
+                               "coords",
+                               input_mesh,
+                               in_name,
+                               direct_name,
+                               INVALID_VALUE);
+    scattered.interpolateFieldWithWeights(query_mesh,
+                                          input_mesh,
+                                          in_name,
+                                          weighted_name,
+                                          INVALID_VALUE);
+
+    const double* direct = static_cast<const double*>(
+      query_mesh["fields"][direct_name]["values"].data_ptr());
+    const double* weighted = static_cast<const double*>(
+      query_mesh["fields"][weighted_name]["values"].data_ptr());
+
+    for(int i = 0; i < numQueryPts; ++i)
+    {
+      const double* xyz = &queryCoords[i * DIM];
+      if(cell_idx[i] == axom::quest::Delaunay<DIM>::INVALID_INDEX)
+      {
+        EXPECT_EQ(INVALID_VALUE, direct[i]) << "query point " << i;
+        EXPECT_EQ(INVALID_VALUE, weighted[i]) << "query point " << i;
+        continue;
+      }
+
+      EXPECT_NEAR(direct[i], weighted[i], 1e-12) << "query point " << i;
+
+      // Points outside the unit box cannot be in the triangulation
+      for(int d = 0; d < DIM; ++d)
+      {
+        EXPECT_GE(xyz[d], 0.) << "query point " << i;
+        EXPECT_LE(xyz[d], 1.) << "query point " << i;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+TEST(quest_scattered_interpolation, weights_match_interpolate_field_2d)
+{
+  checkInterpolationWeights<2>(500, 41);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_scattered_interpolation, weights_match_interpolate_field_3d)
+{
+  checkInterpolationWeights<3>(300, 17);
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  axom::slic::SimpleLogger logger;
+
+  return RUN_ALL_TESTS();
+}
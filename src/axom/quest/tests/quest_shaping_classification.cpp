@@ -0,0 +1,384 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "gtest/gtest.h"
+#include "axom/slic.hpp"
+
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/Hexahedron.hpp"
+#include "axom/primal/operators/compute_bounding_box.hpp"
+#include "axom/primal/operators/intersection_volume.hpp"
+#include "axom/quest/detail/shaping/cell_classification.hpp"
+
+#include <array>
+#include <vector>
+
+namespace shaping = axom::quest::shaping;
+
+namespace
+{
+using Point3 = axom::primal::Point<double, 3>;
+using Tet = axom::primal::Tetrahedron<double, 3>;
+using Oct = axom::primal::Octahedron<double, 3>;
+using Hex = axom::primal::Hexahedron<double, 3>;
+using BBox = axom::primal::BoundingBox<double, 3>;
+
+constexpr double EPS = 1e-10;
+
+/// Returns the corners of the cube with side \a h and lower corner \a lo
+std::array<Point3, 8> cubeCorners(const Point3& lo, double h)
+{
+  const double x = lo[0], y = lo[1], z = lo[2];
+  return {Point3 {x, y, z},
+          Point3 {x + h, y, z},
+          Point3 {x + h, y + h, z},
+          Point3 {x, y + h, z},
+          Point3 {x, y, z + h},
+          Point3 {x + h, y, z + h},
+          Point3 {x + h, y + h, z + h},
+          Point3 {x, y + h, z + h}};
+}
+
+/// Splits a cube into six tetrahedra around its diagonal from corner 0 to 6
+void appendCubeTets(const Point3& lo, double h, axom::Array<Tet>& result)
+{
+  const auto c = cubeCorners(lo, h);
+  const int tets[6][4] = {{0, 1, 2, 6},
+                          {0, 2, 3, 6},
+                          {0, 3, 7, 6},
+                          {0, 7, 4, 6},
+                          {0, 4, 5, 6},
+                          {0, 5, 1, 6}};
+  for(const auto& t : tets)
+  {
+    result.push_back(Tet(c[t[0]], c[t[1]], c[t[2]], c[t[3]]));
+  }
+}
+
+/// Splits the unit cube into six tetrahedra around the diagonal (0,0,0)-(1,1,1)
+axom::Array<Tet> cubeTets()
+{
+  axom::Array<Tet> result;
+  appendCubeTets(Point3 {0, 0, 0}, 1., result);
+  return result;
+}
+
+/// Tiles the cube [0, n * h]^3 with n^3 cubes of side \a h, six tets each
+void appendBlockTets(int n, double h, axom::Array<Tet>& result)
+{
+  for(int i = 0; i < n; ++i)
+  {
+    for(int j = 0; j < n; ++j)
+    {
+      for(int k = 0; k < n; ++k)
+      {
+        appendCubeTets(Point3 {i * h, j * h, k * h}, h, result);
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Classifies \a hex against the union of \a tets, the same way as
+ *  IntersectionShaper does
+ */
+shaping::CellClass classifyHex(const Hex& hex, const axom::Array<Tet>& tets)
+{
+  using ExecSpace = axom::SEQ_EXEC;
+
+  BBox hexBox = axom::primal::compute_bounding_box(hex);
+  hexBox.expand(EPS);
+  for(const auto& face :
+      shaping::findUnsharedFaces<ExecSpace, Tet>(tets.view(), EPS))
+  {
+    if(hexBox.intersectsWith(axom::primal::compute_bounding_box(face)))
+    {
+      return shaping::CELL_MIXED;
+    }
+  }
+
+  const Point3 mean = hex.vertexMean();
+  for(const auto& tet : tets)
+  {
+    if(shaping::convexContains(tet, mean, EPS))
+    {
+      return shaping::CELL_INSIDE;
+    }
+  }
+  return shaping::CELL_OUTSIDE;
+}
+
+/// Sums the overlap volumes of \a hex with each of the \a tets
+double summedOverlapVolume(const Hex& hex, const axom::Array<Tet>& tets)
+{
+  constexpr bool tryFixOrientation = true;
+  double volume = 0.;
+  for(const auto& tet : tets)
+  {
+    volume +=
+      axom::primal::intersection_volume(hex, tet, EPS, tryFixOrientation);
+  }
+  return volume;
+}
+
+/// Returns an octahedron centered at \a center with the given radius
+Oct makeOct(const Point3& center, double r)
+{
+  const double x = center[0], y = center[1], z = center[2];
+  // P, S; Q, T; R, U are the opposite pairs
+  return Oct(Point3 {x + r, y, z},
+             Point3 {x, y + r, z},
+             Point3 {x, y, z + r},
+             Point3 {x - r, y, z},
+             Point3 {x, y - r, z},
+             Point3 {x, y, z - r});
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+TEST(quest_shaping_classification, tet_contains)
+{
+  const Tet tet(Point3 {0, 0, 0},
+                Point3 {1, 0, 0},
+                Point3 {0, 1, 0},
+                Point3 {0, 0, 1});
+  const Tet flipped(tet[1], tet[0], tet[2], tet[3]);
+
+  for(const Tet& t : {tet, flipped})
+  {
+    EXPECT_TRUE(shaping::convexContains(t, Point3 {.1, .1, .1}, EPS));
+    EXPECT_TRUE(shaping::convexContains(t, Point3 {0, 0, 0}, EPS));
+    EXPECT_TRUE(shaping::convexContains(t, Point3 {.5, .5, 0}, EPS));
+    EXPECT_FALSE(shaping::convexContains(t, Point3 {.5, .5, .5}, EPS));
+    EXPECT_FALSE(shaping::convexContains(t, Point3 {-.1, .1, .1}, EPS));
+  }
+
+  // Degenerate tetrahedra do not contain points
+  const Tet flat(Point3 {0, 0, 0},
+                 Point3 {1, 0, 0},
+                 Point3 {0, 1, 0},
+                 Point3 {1, 1, 0});
+  EXPECT_FALSE(shaping::convexContains(flat, Point3 {.1, .1, 0}, EPS));
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_shaping_classification, oct_contains)
+{
+  const Oct oct = makeOct(Point3 {1, 2, 3}, 1.);
+
+  EXPECT_TRUE(shaping::convexContains(oct, Point3 {1, 2, 3}, EPS));
+  EXPECT_TRUE(shaping::convexContains(oct, Point3 {1.3, 2.3, 3.3}, EPS));
+  EXPECT_TRUE(shaping::convexContains(oct, Point3 {2, 2, 3}, EPS));
+  EXPECT_FALSE(shaping::convexContains(oct, Point3 {1.4, 2.4, 3.4}, EPS));
+  EXPECT_FALSE(shaping::convexContains(oct, Point3 {1, 2, 4.1}, EPS));
+
+  EXPECT_FALSE(shaping::convexContains(Oct(), Point3 {0, 0, 0}, EPS));
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_shaping_classification, unshared_faces_cube)
+{
+  using ExecSpace = axom::SEQ_EXEC;
+
+  axom::Array<Tet> tets = cubeTets();
+  auto faces = shaping::findUnsharedFaces<ExecSpace, Tet>(tets.view(), EPS);
+
+  // Each face of the cube is split into two triangles
+  EXPECT_EQ(12, faces.size());
+  for(const auto& face : faces)
+  {
+    // Each boundary face lies on a face of the cube
+    bool onCubeFace = false;
+    for(int d = 0; d < 3; ++d)
+    {
+      for(double side : {0., 1.})
+      {
+        onCubeFace = onCubeFace ||
+          (face[0][d] == side && face[1][d] == side && face[2][d] == side);
+      }
+    }
+    EXPECT_TRUE(onCubeFace);
+  }
+
+  // Degenerate tetrahedra are skipped
+  tets.push_back(Tet(Point3 {0, 0, 0},
+                     Point3 {1, 1, 1},
+                     Point3 {1, 1, 0},
+                     Point3 {0, 0, 0}));
+  faces = shaping::findUnsharedFaces<ExecSpace, Tet>(tets.view(), EPS);
+  EXPECT_EQ(12, faces.size());
+
+  // Faces of overlapping tetrahedra are not matched:  the two boundary faces
+  // of the duplicated tetrahedron are in two primitives on the same side,
+  // and its two interior faces are in three primitives
+  tets.push_back(tets[0]);
+  faces = shaping::findUnsharedFaces<ExecSpace, Tet>(tets.view(), EPS);
+  EXPECT_EQ(12 + 2 + 2 * 3, faces.size());
+
+  // Any face in two primitives on the same side is unshared
+  axom::Array<Tet> pair;
+  pair.push_back(tets[0]);
+  pair.push_back(Tet(tets[0][1], tets[0][0], tets[0][2], tets[0][3]));
+  faces = shaping::findUnsharedFaces<ExecSpace, Tet>(pair.view(), EPS);
+  EXPECT_EQ(8, faces.size());
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_shaping_classification, unshared_faces_octs)
+{
+  using ExecSpace = axom::SEQ_EXEC;
+
+  // The second octahedron is the reflection of the first one
+  // across the plane of its face PQR
+  axom::Array<Oct> octs;
+  octs.push_back(makeOct(Point3 {0, 0, 0}, 1.));
+  octs.push_back(Oct(octs[0][0],
+                     octs[0][1],
+                     octs[0][2],
+                     Point3 {1. / 3., 4. / 3., 4. / 3.},
+                     Point3 {4. / 3., 1. / 3., 4. / 3.},
+                     Point3 {4. / 3., 4. / 3., 1. / 3.}));
+
+  EXPECT_TRUE(
+    shaping::convexContains(octs[1], Point3 {2. / 3., 2. / 3., 2. / 3.}, EPS));
+  EXPECT_FALSE(shaping::convexContains(octs[1], Point3 {.2, .2, .2}, EPS));
+
+  auto faces = shaping::findUnsharedFaces<ExecSpace, Oct>(octs.view(), EPS);
+  EXPECT_EQ(14, faces.size());
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_shaping_classification, inside_volume)
+{
+  // IntersectionShaper gives hexahedra inside a shape their whole volume,
+  // and sums the overlaps with each primitive of the shape for mixed ones
+  const auto corners = cubeCorners(Point3 {1.25, 1.25, 1.25}, 1.5);
+  const Hex hex(corners[0],
+                corners[1],
+                corners[2],
+                corners[3],
+                corners[4],
+                corners[5],
+                corners[6],
+                corners[7]);
+  const double hexVolume = 1.5 * 1.5 * 1.5;
+  EXPECT_NEAR(hexVolume, hex.volume(), 1e-12);
+
+  // When the primitives do not overlap, e.g. for a tiling of the shape,
+  // both give the same volume for a hex inside the shape
+  axom::Array<Tet> tiling;
+  appendBlockTets(4, 1., tiling);
+  EXPECT_EQ(shaping::CELL_INSIDE, classifyHex(hex, tiling));
+  EXPECT_NEAR(hexVolume, summedOverlapVolume(hex, tiling), 1e-10);
+
+  // When they overlap, the inside hex still gets its volume once, but the
+  // sum counts the overlapping region once per primitive.  Here a second
+  // tiling of the same cube shares no faces with the first, so only the
+  // faces on the boundary of the cube are unshared.
+  axom::Array<Tet> twoTilings = tiling;
+  appendBlockTets(2, 2., twoTilings);
+  EXPECT_EQ(shaping::CELL_INSIDE, classifyHex(hex, twoTilings));
+  EXPECT_NEAR(2. * hexVolume, summedOverlapVolume(hex, twoTilings), 1e-10);
+
+  // Hexahedra on the boundary are mixed and clipped in both cases
+  const auto boundaryCorners = cubeCorners(Point3 {3.5, 1.25, 1.25}, 1.);
+  const Hex boundaryHex(boundaryCorners[0],
+                        boundaryCorners[1],
+                        boundaryCorners[2],
+                        boundaryCorners[3],
+                        boundaryCorners[4],
+                        boundaryCorners[5],
+                        boundaryCorners[6],
+                        boundaryCorners[7]);
+  EXPECT_EQ(shaping::CELL_MIXED, classifyHex(boundaryHex, tiling));
+  EXPECT_NEAR(.5, summedOverlapVolume(boundaryHex, tiling), 1e-10);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_shaping_classification, candidate_pairs)
+{
+  using ExecSpace = axom::SEQ_EXEC;
+  using IndexArray = axom::Array<axom::IndexType>;
+
+  // Four shapes with primitives {0, 1}, {2, 3, 4}, {5} and none
+  const axom::Array<int> shapeIds {0, 0, 1, 1, 1, 2};
+  const int numShapes = 4;
+
+  // Unsorted candidates of three cells, the second one without candidates
+  const IndexArray offsets {0, 4, 4};
+  const IndexArray counts {4, 0, 2};
+  const IndexArray candidates {4, 0, 2, 1, 5, 3};
+
+  const auto pairs =
+    shaping::makeCandidatePairs<ExecSpace>(3,
+                                           offsets.view(),
+                                           counts.view(),
+                                           candidates.view(),
+                                           shapeIds.view(),
+                                           numShapes);
+
+  EXPECT_EQ(4, pairs.numPairs());
+  EXPECT_EQ(IndexArray({0, 2, 2, 4}), pairs.cellOffsets);
+  EXPECT_EQ(IndexArray({0, 0, 2, 2}), pairs.cells);
+  EXPECT_EQ(axom::Array<int>({0, 1, 1, 2}), pairs.shapes);
+  EXPECT_EQ(IndexArray({0, 2, 4, 5, 6}), pairs.primitiveOffsets);
+  EXPECT_EQ(IndexArray({0, 1, 2, 4, 3, 5}), pairs.primitives);
+  EXPECT_EQ(IndexArray({0, 1, 2, 3}), pairs.shapeOrder);
+  EXPECT_EQ(std::vector<axom::IndexType>({0, 1, 3, 4, 4}), pairs.shapeOffsets);
+
+  const auto cellOffsets = pairs.cellOffsets.view();
+  const auto shapes = pairs.shapes.view();
+  EXPECT_EQ(0, shaping::findCandidatePair(cellOffsets, shapes, 0, 0));
+  EXPECT_EQ(1, shaping::findCandidatePair(cellOffsets, shapes, 0, 1));
+  EXPECT_EQ(-1, shaping::findCandidatePair(cellOffsets, shapes, 0, 2));
+  EXPECT_EQ(-1, shaping::findCandidatePair(cellOffsets, shapes, 1, 0));
+  EXPECT_EQ(-1, shaping::findCandidatePair(cellOffsets, shapes, 2, 0));
+  EXPECT_EQ(2, shaping::findCandidatePair(cellOffsets, shapes, 2, 1));
+  EXPECT_EQ(3, shaping::findCandidatePair(cellOffsets, shapes, 2, 2));
+
+  // The pairs of a shape are ordered by cell
+  const IndexArray offsets2 {0, 1};
+  const IndexArray counts2 {1, 2};
+  const IndexArray candidates2 {3, 5, 0};
+  const auto pairs2 =
+    shaping::makeCandidatePairs<ExecSpace>(2,
+                                           offsets2.view(),
+                                           counts2.view(),
+                                           candidates2.view(),
+                                           shapeIds.view(),
+                                           numShapes);
+  EXPECT_EQ(axom::Array<int>({1, 0, 2}), pairs2.shapes);
+  EXPECT_EQ(IndexArray({1, 0, 2}), pairs2.shapeOrder);
+  EXPECT_EQ(std::vector<axom::IndexType>({0, 1, 2, 3, 3}),
+            pairs2.shapeOffsets);
+
+  // No cells
+  const auto empty =
+    shaping::makeCandidatePairs<ExecSpace>(0,
+                                           IndexArray().view(),
+                                           IndexArray().view(),
+                                           IndexArray().view(),
+                                           shapeIds.view(),
+                                           numShapes);
+  EXPECT_EQ(0, empty.numPairs());
+  EXPECT_EQ(IndexArray({0}), empty.cellOffsets);
+  EXPECT_EQ(std::vector<axom::IndexType>(numShapes + 1, 0),
+            empty.shapeOffsets);
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+  axom::slic::SimpleLogger logger;
+
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
@@ -11,6 +11,7 @@
 #include "gtest/gtest.h"
 
 // C/C++ includes
+#include <cstdint>
 #include <cstdio>
 #include <string>
 #include <fstream>
@@ -50,6 +51,40 @@ void generate_stl_file(const std::string& file)
   ofs.close();
 }
 
+/*!
+ * \brief Generates a binary STL file with \a numTris triangles
+ *
+ * Triangle i has vertices (i,0,0), (i+1,0,0) and (i,1,0).
+ *
+ * \param [in] file the name of the file to generate.
+ * \param [in] numTris the number of triangles
+ * \pre file.empty() == false
+ * \note Assumes a little endian machine
+ */
+void generate_binary_stl_file(const std::string& file, std::uint32_t numTris)
+{
+  EXPECT_FALSE(file.empty());
+
+  std::ofstream ofs(file.c_str(), std::ios::out | std::ios::binary);
+  EXPECT_TRUE(ofs.is_open());
+
+  const std::string header(80, ' ');
+  ofs.write(header.data(), header.size());
+  ofs.write(reinterpret_cast<const char*>(&numTris), sizeof(numTris));
+
+  for(std::uint32_t i = 0; i < numTris; ++i)
+  {
+    const float f = static_cast<float>(i);
+    const float data[12] =
+      {0.f, 0.f, 1.f, f, 0.f, 0.f, f + 1.f, 0.f, 0.f, f, 1.f, 0.f};
+    const std::uint16_t attr = 0;
+    ofs.write(reinterpret_cast<const char*>(data), sizeof(data));
+    ofs.write(reinterpret_cast<const char*>(&attr), sizeof(attr));
+  }
+
+  ofs.close();
+}
+
 } /* end anonymous namespace */
 
 //------------------------------------------------------------------------------
@@ -205,6 +240,149 @@ TEST(quest_stl_reader, read_stl_external)
   axom::utilities::filesystem::removeFile(filename);
 }
 
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader, read_binary_stl)
+{
+  if(!axom::utilities::isLittleEndian())
+  {
+    GTEST_SKIP() << "Test file generation assumes a little endian machine";
+  }
+
+  constexpr std::uint32_t N_FACES = 17;
+  const std::string filename = "triangles_binary.stl";
+
+  // STEP 0: generate a temporary binary STL file for testing
+  generate_binary_stl_file(filename, N_FACES);
+
+  // STEP 1: create an STL reader and read-in the mesh data
+  quest::STLReader reader;
+  reader.setFileName(filename);
+  int status = reader.read();
+  EXPECT_EQ(status, 0);
+  EXPECT_EQ(reader.getNumFaces(), N_FACES);
+  EXPECT_EQ(reader.getNumNodes(), 3 * N_FACES);
+
+  // STEP 2: reading the STL mesh data into a mint::Mesh
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE> mesh(3, mint::TRIANGLE);
+  reader.getMesh(&mesh);
+  EXPECT_EQ(mesh.getNumberOfCells(), N_FACES);
+
+  // STEP 3: ensure the vertices are what is expected
+  const double* x = mesh.getCoordinateArray(mint::X_COORDINATE);
+  const double* y = mesh.getCoordinateArray(mint::Y_COORDINATE);
+  const double* z = mesh.getCoordinateArray(mint::Z_COORDINATE);
+  for(axom::IndexType i = 0; i < N_FACES; ++i)
+  {
+    const double x_expected[] = {double(i), double(i + 1), double(i)};
+    const double y_expected[] = {0.0, 0.0, 1.0};
+    for(int j = 0; j < 3; ++j)
+    {
+      EXPECT_DOUBLE_EQ(x[3 * i + j], x_expected[j]);
+      EXPECT_DOUBLE_EQ(y[3 * i + j], y_expected[j]);
+      EXPECT_DOUBLE_EQ(z[3 * i + j], 0.0);
+    }
+  }
+
+  // STEP 4: remove temporary STL file
+  axom::utilities::filesystem::removeFile(filename);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader, read_binary_stl_welded)
+{
+  if(!axom::utilities::isLittleEndian())
+  {
+    GTEST_SKIP() << "Test file generation assumes a little endian machine";
+  }
+
+  // Adjacent triangles share their vertices on the x-axis
+  constexpr std::uint32_t N_FACES = 17;
+  const std::string filename = "triangles_binary_welded.stl";
+  generate_binary_stl_file(filename, N_FACES);
+
+  quest::STLReader reader;
+  reader.setFileName(filename);
+  reader.setVertexWeldingThreshold(1e-6);
+  EXPECT_EQ(reader.read(), 0);
+
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE> mesh(3, mint::TRIANGLE);
+  axom::Array<axom::IndexType> sourceTriangles;
+  reader.getMesh(&mesh, &sourceTriangles);
+
+  EXPECT_EQ(mesh.getNumberOfCells(), N_FACES);
+  EXPECT_EQ(mesh.getNumberOfNodes(), 2 * N_FACES + 1);
+  EXPECT_EQ(sourceTriangles.size(), N_FACES);
+
+  // Welded vertices are numbered in the order they first appear
+  const double* x = mesh.getCoordinateArray(mint::X_COORDINATE);
+  const double* y = mesh.getCoordinateArray(mint::Y_COORDINATE);
+  for(axom::IndexType i = 0; i < N_FACES; ++i)
+  {
+    EXPECT_EQ(sourceTriangles[i], i);
+
+    const axom::IndexType* tri = mesh.getCellNodeIDs(i);
+    const double x_expected[] = {double(i), double(i + 1), double(i)};
+    const double y_expected[] = {0.0, 0.0, 1.0};
+    for(int j = 0; j < 3; ++j)
+    {
+      EXPECT_DOUBLE_EQ(x[tri[j]], x_expected[j]);
+      EXPECT_DOUBLE_EQ(y[tri[j]], y_expected[j]);
+    }
+  }
+  EXPECT_EQ(mesh.getCellNodeIDs(0)[0], 0);
+  EXPECT_EQ(mesh.getCellNodeIDs(1)[0], mesh.getCellNodeIDs(0)[1]);
+
+  axom::utilities::filesystem::removeFile(filename);
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader, read_stl_welded_degenerate)
+{
+  const std::string filename = "triangles_degenerate.stl";
+
+  // The second triangle collapses to a segment after welding
+  {
+    std::ofstream ofs(filename.c_str());
+    ofs << "solid triangles" << std::endl;
+    ofs << "facet normal 0 0 1\n outer loop" << std::endl;
+    ofs << "  vertex 0.0 0.0 0.0\n  vertex 1.0 0.0 0.0\n  vertex 0.0 1.0 0.0";
+    ofs << "\n endloop\nendfacet" << std::endl;
+    ofs << "facet normal 0 0 1\n outer loop" << std::endl;
+    ofs << "  vertex 1.0 0.0 0.0\n  vertex 1.0 1E-12 0.0\n  vertex 0.0 1.0 0.0";
+    ofs << "\n endloop\nendfacet" << std::endl;
+    ofs << "facet normal 0 0 1\n outer loop" << std::endl;
+    ofs << "  vertex 1.0 0.0 0.0\n  vertex 1.0 1.0 0.0\n  vertex 0.0 1.0 0.0";
+    ofs << "\n endloop\nendfacet" << std::endl;
+    ofs << "endsolid triangles" << std::endl;
+  }
+
+  quest::STLReader reader;
+  reader.setFileName(filename);
+  reader.setVertexWeldingThreshold(1e-9);
+  EXPECT_EQ(reader.read(), 0);
+  EXPECT_EQ(reader.getNumFaces(), 3);
+
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE> mesh(3, mint::TRIANGLE);
+  axom::Array<axom::IndexType> sourceTriangles;
+  reader.getMesh(&mesh, &sourceTriangles);
+
+  EXPECT_EQ(mesh.getNumberOfNodes(), 4);
+  EXPECT_EQ(mesh.getNumberOfCells(), 2);
+  ASSERT_EQ(sourceTriangles.size(), 2);
+  EXPECT_EQ(sourceTriangles[0], 0);
+  EXPECT_EQ(sourceTriangles[1], 2);
+
+  // Without a threshold, each corner has its own node
+  reader.setVertexWeldingThreshold(0.);
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE> soup(3, mint::TRIANGLE);
+  reader.getMesh(&soup, &sourceTriangles);
+  EXPECT_EQ(soup.getNumberOfNodes(), 9);
+  EXPECT_EQ(soup.getNumberOfCells(), 3);
+  EXPECT_EQ(sourceTriangles.size(), 3);
+
+  axom::utilities::filesystem::removeFile(filename);
+}
+
 //------------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -0,0 +1,230 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+
+#include "axom/core/utilities/FileUtilities.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+#include "axom/slic.hpp"
+
+#include "axom/quest/readers/PSTLReader.hpp"
+
+#include "gtest/gtest.h"
+
+#include "mpi.h"
+
+// C/C++ includes
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace mint = axom::mint;
+namespace quest = axom::quest;
+
+//------------------------------------------------------------------------------
+// HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/*!
+ * \brief Generates a binary STL file with \a numTris triangles
+ *
+ * Triangle i has vertices (i,0,0), (i+1,0,0) and (i,1,0).
+ *
+ * \param [in] file the name of the file to generate.
+ * \param [in] numTris the number of triangles
+ * \pre file.empty() == false
+ * \note Assumes a little endian machine
+ */
+void generate_binary_stl_file(const std::string& file, std::uint32_t numTris)
+{
+  EXPECT_FALSE(file.empty());
+
+  std::ofstream ofs(file.c_str(), std::ios::out | std::ios::binary);
+  EXPECT_TRUE(ofs.is_open());
+
+  const std::string header(80, ' ');
+  ofs.write(header.data(), header.size());
+  ofs.write(reinterpret_cast<const char*>(&numTris), sizeof(numTris));
+
+  for(std::uint32_t i = 0; i < numTris; ++i)
+  {
+    const float f = static_cast<float>(i);
+    const float data[12] =
+      {0.f, 0.f, 1.f, f, 0.f, 0.f, f + 1.f, 0.f, 0.f, f, 1.f, 0.f};
+    const std::uint16_t attr = 0;
+    ofs.write(reinterpret_cast<const char*>(data), sizeof(data));
+    ofs.write(reinterpret_cast<const char*>(&attr), sizeof(attr));
+  }
+
+  ofs.close();
+}
+
+/*!
+ * \brief Generates an ascii STL file consisting of a single triangle
+ * \param [in] file the name of the file to generate.
+ * \pre file.empty() == false
+ */
+void generate_ascii_stl_file(const std::string& file)
+{
+  EXPECT_FALSE(file.empty());
+
+  std::ofstream ofs(file.c_str());
+  EXPECT_TRUE(ofs.is_open());
+
+  ofs << "solid triangle" << std::endl;
+  ofs << "\t facet normal 0.0 0.0 1.0" << std::endl;
+  ofs << "\t\t outer loop" << std::endl;
+  ofs << "\t\t\t vertex 0.0 0.0 0.0" << std::endl;
+  ofs << "\t\t\t vertex 1.0 0.0 0.0" << std::endl;
+  ofs << "\t\t\t vertex 0.0 1.0 0.0" << std::endl;
+  ofs << "\t\t endloop" << std::endl;
+  ofs << "\t endfacet" << std::endl;
+  ofs << "endsolid triangle" << std::endl;
+
+  ofs.close();
+}
+
+/// Reads \a file in \a mode and checks it against generate_binary_stl_file()
+void check_binary_read(const std::string& file,
+                       std::uint32_t numTris,
+                       quest::PSTLReader::ReadMode mode)
+{
+  quest::PSTLReader reader(MPI_COMM_WORLD);
+  reader.setFileName(file);
+  reader.setReadMode(mode);
+  EXPECT_EQ(reader.getReadMode(), mode);
+
+  int status = reader.read();
+  EXPECT_EQ(status, 0);
+  EXPECT_EQ(reader.getNumFaces(), numTris);
+  EXPECT_EQ(reader.getNumNodes(), 3 * numTris);
+
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE> mesh(3, mint::TRIANGLE);
+  reader.getMesh(&mesh);
+  EXPECT_EQ(mesh.getNumberOfCells(), numTris);
+
+  const double* x = mesh.getCoordinateArray(mint::X_COORDINATE);
+  const double* y = mesh.getCoordinateArray(mint::Y_COORDINATE);
+  const double* z = mesh.getCoordinateArray(mint::Z_COORDINATE);
+  for(axom::IndexType i = 0; i < numTris; ++i)
+  {
+    const double x_expected[] = {double(i), double(i + 1), double(i)};
+    const double y_expected[] = {0.0, 0.0, 1.0};
+    for(int j = 0; j < 3; ++j)
+    {
+      EXPECT_DOUBLE_EQ(x[3 * i + j], x_expected[j]);
+      EXPECT_DOUBLE_EQ(y[3 * i + j], y_expected[j]);
+      EXPECT_DOUBLE_EQ(z[3 * i + j], 0.0);
+    }
+  }
+}
+
+const quest::PSTLReader::ReadMode ALL_MODES[] = {
+  quest::PSTLReader::ReadMode::ROOT_BROADCAST,
+  quest::PSTLReader::ReadMode::COLLECTIVE_IO,
+  quest::PSTLReader::ReadMode::SHARED_MEMORY};
+
+} /* end anonymous namespace */
+
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader_parallel, missing_file)
+{
+  const std::string INVALID_FILE = "foo.stl";
+  for(auto mode : ALL_MODES)
+  {
+    quest::PSTLReader reader(MPI_COMM_WORLD);
+    reader.setFileName(INVALID_FILE);
+    reader.setReadMode(mode);
+    int status = reader.read();
+    EXPECT_TRUE(status != 0);
+    EXPECT_EQ(reader.getNumNodes(), 0);
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader_parallel, read_binary_file)
+{
+  if(!axom::utilities::isLittleEndian())
+  {
+    GTEST_SKIP() << "Test file generation assumes a little endian machine";
+  }
+
+  int rank = -1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  const std::string filename = "triangles_binary_parallel.stl";
+
+  // Include triangle counts smaller than the number of ranks
+  for(std::uint32_t numTris : {0u, 1u, 2u, 37u})
+  {
+    if(rank == 0)
+    {
+      generate_binary_stl_file(filename, numTris);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    for(auto mode : ALL_MODES)
+    {
+      check_binary_read(filename, numTris, mode);
+    }
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    if(rank == 0)
+    {
+      axom::utilities::filesystem::removeFile(filename);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_stl_reader_parallel, read_ascii_file)
+{
+  int rank = -1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  const std::string filename = "triangle_ascii_parallel.stl";
+  if(rank == 0)
+  {
+    generate_ascii_stl_file(filename);
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  // Ascii files are read by rank 0 and broadcast in every mode
+  for(auto mode : ALL_MODES)
+  {
+    quest::PSTLReader reader(MPI_COMM_WORLD);
+    reader.setFileName(filename);
+    reader.setReadMode(mode);
+    int status = reader.read();
+    EXPECT_EQ(status, 0);
+    EXPECT_EQ(reader.getNumFaces(), 1);
+    EXPECT_EQ(reader.getNumNodes(), 3);
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  if(rank == 0)
+  {
+    axom::utilities::filesystem::removeFile(filename);
+  }
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+  axom::slic::SimpleLogger logger;
+
+  MPI_Init(&argc, &argv);
+
+  // finalized when exiting main scope
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
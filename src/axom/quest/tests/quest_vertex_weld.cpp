@@ -223,6 +223,67 @@ TEST(quest_vertex_weld, fuzzWeld)
   mesh = nullptr;
 }
 
+//------------------------------------------------------------------------------
+TEST(quest_vertex_weld, farFromOrigin)
+{
+  SLIC_INFO("*** Tests welding function on a pair of triangles"
+            << " whose coordinates are large compared to the threshold");
+
+  // The coordinates divided by the threshold do not fit a 64-bit integer
+  const double offset = 1e15;
+  const double eps = 1e-6;
+
+  UMesh* mesh = new UMesh(DIM, axom::mint::TRIANGLE);
+  insertVertex(mesh, offset + 1, offset, offset);
+  insertVertex(mesh, offset + 1, offset + 1, offset);
+  insertVertex(mesh, offset + 1, offset + 1, offset + 1);
+  insertVertex(mesh, offset + 1, offset + 1, offset);  // welds with 2nd
+  insertVertex(mesh, offset + 1, offset + 1, offset + 1);  // welds with 3rd
+  insertVertex(mesh, offset, offset + 1, offset);
+
+  insertTriangle(mesh, 0, 1, 2);
+  insertTriangle(mesh, 3, 4, 5);
+
+  axom::quest::weldTriMeshVertices(&mesh, eps);
+
+  EXPECT_EQ(4, mesh->getNumberOfNodes());
+  EXPECT_EQ(2, mesh->getNumberOfCells());
+
+  delete mesh;
+  mesh = nullptr;
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_vertex_weld, wideBoundingBox)
+{
+  SLIC_INFO("*** Tests welding function on triangles whose bounding box"
+            << " is too wide for a lattice with the given threshold");
+
+  // The bounding box spans more than 2^62 lattice cells, so welding
+  // falls back to a coarser lattice; coincident vertices are still welded
+  const double far = 1e30;
+  const double eps = 1e-6;
+
+  UMesh* mesh = new UMesh(DIM, axom::mint::TRIANGLE);
+  insertVertex(mesh, 0, 0, 0);
+  insertVertex(mesh, far, 0, 0);
+  insertVertex(mesh, far, far, 0);
+  insertVertex(mesh, far, far, 0);  // welds with 3rd vert
+  insertVertex(mesh, 0, 0, 0);      // welds with 1st vert
+  insertVertex(mesh, 0, far, far);
+
+  insertTriangle(mesh, 0, 1, 2);
+  insertTriangle(mesh, 3, 4, 5);
+
+  axom::quest::weldTriMeshVertices(&mesh, eps);
+
+  EXPECT_EQ(4, mesh->getNumberOfNodes());
+  EXPECT_EQ(2, mesh->getNumberOfCells());
+
+  delete mesh;
+  mesh = nullptr;
+}
+
 //------------------------------------------------------------------------------
 TEST(quest_vertex_weld, disconnectedTrianglePair)
 {
@@ -107,6 +107,7 @@ struct Input
   double weldThreshold {1e-6};
   double intersectionThreshold {1e-08};
   bool skipWeld {false};
+  bool useExactPredicates {false};
   bool verboseOutput {false};
 
   Input() = default;
@@ -219,6 +220,11 @@ void Input::parse(int argc, char** argv, axom::CLI::App& app)
     skipWeld,
     "Don't weld vertices (useful for testing, not helpful otherwise).");
 
+  app.add_flag("--exactPredicates",
+               useExactPredicates,
+               "Use filtered exact predicates instead of the intersection "
+               "tolerance when testing for intersecting triangles.");
+
   app.add_flag("-v,--verbose", verboseOutput, "Increase logging verbosity.")
     ->capture_default_str();
 
@@ -258,6 +264,7 @@ void Input::parse(int argc, char** argv, axom::CLI::App& app)
     << "\n  weld threshold = " << weldThreshold << "\n  "
     << (skipWeld ? "" : "not ") << "skipping weld"
     << "\n  intersection tolerance = " << intersectionThreshold
+    << (useExactPredicates ? " (unused: exact predicates)" : "")
     << "\n  infile = " << stlInput << "\n  collisions outfile = "
     << collisionsMeshName() << "\n  weld outfile = " << weldMeshName());
 }
@@ -294,12 +301,16 @@ void Input::fixOutfilePath()
 
 inline bool pointIsNearlyEqual(Point3& p1, Point3& p2, double EPS);
 
-AXOM_HOST_DEVICE bool checkTT(Triangle3& t1, Triangle3& t2, double EPS);
+AXOM_HOST_DEVICE bool checkTT(Triangle3& t1,
+                              Triangle3& t2,
+                              double EPS,
+                              bool useExactPredicates);
 
 std::vector<std::pair<int, int>> naiveIntersectionAlgorithm(
   mint::Mesh* surface_mesh,
   std::vector<int>& degenerate,
-  double EPS);
+  double EPS,
+  bool useExactPredicates);
 
 void announceMeshProblems(int triangleCount,
                           int intersectPairCount,
@@ -323,7 +334,7 @@ inline bool pointIsNearlyEqual(Point3& p1, Point3& p2, double EPS = 1.0e-9)
 }
 
 AXOM_HOST_DEVICE
-bool checkTT(Triangle3& t1, Triangle3& t2, double EPS)
+bool checkTT(Triangle3& t1, Triangle3& t2, double EPS, bool useExactPredicates)
 {
   if(t2.degenerate())
   {
@@ -331,7 +342,7 @@ bool checkTT(Triangle3& t1, Triangle3& t2, double EPS)
   }
 
   const bool includeBoundaries = false;  // only check internal intersections
-  if(primal::intersect(t1, t2, includeBoundaries, EPS))
+  if(primal::intersect(t1, t2, includeBoundaries, EPS, useExactPredicates))
   {
     return true;
   }
@@ -355,7 +366,8 @@ inline Triangle3 getMeshTriangle(int i, mint::Mesh* surface_mesh)
 std::vector<std::pair<int, int>> naiveIntersectionAlgorithm(
   mint::Mesh* surface_mesh,
   std::vector<int>& degenerate,
-  double EPS)
+  double EPS,
+  bool useExactPredicates)
 {
   SLIC_INFO("Running naive intersection algorithm.");
 
@@ -387,7 +399,7 @@ std::vector<std::pair<int, int>> naiveIntersectionAlgorithm(
     for(int j = i + 1; j < ncells; j++)
     {
       t2 = getMeshTriangle(j, surface_mesh);
-      if(checkTT(t1, t2, EPS))
+      if(checkTT(t1, t2, EPS, useExactPredicates))
       {
         retval.push_back(std::make_pair(i, j));
       }
@@ -402,7 +414,8 @@ template <typename ExecSpace>
 std::vector<std::pair<int, int>> naiveIntersectionAlgorithm(
   mint::Mesh* surface_mesh,
   std::vector<int>& degenerate,
-  double EPS)
+  double EPS,
+  bool useExactPredicates)
 {
   SLIC_INFO("Running naive intersection algorithm "
             << " in execution Space: "
@@ -446,7 +459,7 @@ std::vector<std::pair<int, int>> naiveIntersectionAlgorithm(
     AXOM_LAMBDA(int col, int row) {
       if(row > col)
       {
-        if(checkTT(tris[row], tris[col], EPS))
+        if(checkTT(tris[row], tris[col], EPS, useExactPredicates))
         {
           numIntersect += 1;
         }
@@ -465,7 +478,7 @@ std::vector<std::pair<int, int>> naiveIntersectionAlgorithm(
     AXOM_LAMBDA(int col, int row) {
       if(row > col)
       {
-        if(checkTT(tris[row], tris[col], EPS))
+        if(checkTT(tris[row], tris[col], EPS, useExactPredicates))
         {
           auto idx = RAJA::atomicAdd<ATOMIC_POL>(counter, 2);
           intersections[idx] = row;
@@ -565,6 +578,34 @@ bool writeCollisions(const std::vector<std::pair<int, int>>& c,
   return true;
 }
 
+/// Accumulates the wall time of each phase of the mesh tester
+class PhaseTimings
+{
+public:
+  void record(const std::string& phase, double seconds)
+  {
+    m_phases.push_back(std::make_pair(phase, seconds));
+  }
+
+  /// Logs the time of each recorded phase and the total
+  void report() const
+  {
+    double total = 0.;
+    SLIC_INFO("Phase timings:");
+    for(const auto& phase : m_phases)
+    {
+      SLIC_INFO("  " << std::left << std::setw(24) << phase.first << " "
+                     << phase.second << " seconds");
+      total += phase.second;
+    }
+    SLIC_INFO("  " << std::left << std::setw(24) << "total"
+                   << " " << total << " seconds");
+  }
+
+private:
+  std::vector<std::pair<std::string, double>> m_phases;
+};
+
 void initializeLogger()
 {
   // Initialize the SLIC logger
@@ -634,6 +675,9 @@ int main(int argc, char** argv)
   }
 #endif
 
+  PhaseTimings phaseTimings;
+  axom::utilities::Timer readTimer(true);
+
   // _read_stl_file_start
   // Read file
   SLIC_INFO("Reading file: '" << params.stlInput << "'...\n");
@@ -652,6 +696,8 @@ int main(int argc, char** argv)
   SLIC_INFO("Mesh has " << surface_mesh->getNumberOfNodes() << " vertices and "
                         << surface_mesh->getNumberOfCells() << " triangles.");
   // _read_stl_file_end
+  readTimer.stop();
+  phaseTimings.record("read", readTimer.elapsedTimeInSec());
 
   // Vertex welding
   if(!params.skipWeld)
@@ -664,6 +710,7 @@ int main(int argc, char** argv)
 
     timer.stop();
     SLIC_INFO("Vertex welding took " << timer.elapsedTimeInSec() << " seconds.");
+    phaseTimings.record("vertex welding", timer.elapsedTimeInSec());
     SLIC_INFO("After welding, mesh has "
               << surface_mesh->getNumberOfNodes() << " vertices and "
               << surface_mesh->getNumberOfCells() << " triangles.");
@@ -684,21 +731,24 @@ int main(int argc, char** argv)
       case seq:
         collisions = naiveIntersectionAlgorithm(surface_mesh,
                                                 degenerate,
-                                                params.intersectionThreshold);
+                                                params.intersectionThreshold,
+                                                params.useExactPredicates);
         break;
 #if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
       case raja_seq:
         collisions =
           naiveIntersectionAlgorithm<seq_exec>(surface_mesh,
                                                degenerate,
-                                               params.intersectionThreshold);
+                                               params.intersectionThreshold,
+                                               params.useExactPredicates);
         break;
   #ifdef AXOM_USE_OPENMP
       case raja_omp:
         collisions =
           naiveIntersectionAlgorithm<omp_exec>(surface_mesh,
                                                degenerate,
-                                               params.intersectionThreshold);
+                                               params.intersectionThreshold,
+                                               params.useExactPredicates);
         break;
   #endif
   #ifdef AXOM_USE_CUDA
@@ -706,7 +756,8 @@ int main(int argc, char** argv)
         collisions =
           naiveIntersectionAlgorithm<cuda_exec>(surface_mesh,
                                                 degenerate,
-                                                params.intersectionThreshold);
+                                                params.intersectionThreshold,
+                                                params.useExactPredicates);
         break;
   #endif
   #if defined(AXOM_USE_HIP) && defined(NDEBUG)
@@ -714,7 +765,8 @@ int main(int argc, char** argv)
         collisions =
           naiveIntersectionAlgorithm<hip_exec>(surface_mesh,
                                                degenerate,
-                                               params.intersectionThreshold);
+                                               params.intersectionThreshold,
+                                               params.useExactPredicates);
         break;
   #endif
 #endif  // AXOM_USE_RAJA && AXOM_USE_UMPIRE
@@ -738,7 +790,8 @@ int main(int argc, char** argv)
           surface_mesh,
           collisions,
           degenerate,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
 #if defined(AXOM_USE_RAJA) && defined(AXOM_USE_UMPIRE)
       case raja_seq:
@@ -746,7 +799,8 @@ int main(int argc, char** argv)
           surface_mesh,
           collisions,
           degenerate,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
   #ifdef AXOM_USE_OPENMP
       case raja_omp:
@@ -754,7 +808,8 @@ int main(int argc, char** argv)
           surface_mesh,
           collisions,
           degenerate,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
   #endif
   #ifdef AXOM_USE_CUDA
@@ -763,7 +818,8 @@ int main(int argc, char** argv)
           surface_mesh,
           collisions,
           degenerate,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
   #endif
   #if defined(AXOM_USE_HIP) && defined(NDEBUG)
@@ -772,7 +828,8 @@ int main(int argc, char** argv)
           surface_mesh,
           collisions,
           degenerate,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
   #endif
 #endif  // AXOM_USE_RAJA && AXOM_USE_UMPIRE
@@ -796,7 +853,8 @@ int main(int argc, char** argv)
           collisions,
           degenerate,
           params.resolution,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
 #ifdef AXOM_USE_RAJA
       case raja_seq:
@@ -805,7 +863,8 @@ int main(int argc, char** argv)
           collisions,
           degenerate,
           params.resolution,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
   #ifdef AXOM_USE_OPENMP
       case raja_omp:
@@ -814,7 +873,8 @@ int main(int argc, char** argv)
           collisions,
           degenerate,
           params.resolution,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
   #endif
   #if defined(AXOM_USE_CUDA) && defined(AXOM_USE_UMPIRE)
@@ -824,7 +884,8 @@ int main(int argc, char** argv)
           collisions,
           degenerate,
           params.resolution,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
   #endif
   #if defined(AXOM_USE_HIP) && defined(AXOM_USE_UMPIRE) && defined(NDEBUG)
@@ -834,7 +895,8 @@ int main(int argc, char** argv)
           collisions,
           degenerate,
           params.resolution,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
   #endif
 #endif  // AXOM_USE_RAJA
@@ -854,7 +916,8 @@ int main(int argc, char** argv)
                                         collisions,
                                         degenerate,
                                         params.resolution,
-                                        params.intersectionThreshold);
+                                        params.intersectionThreshold,
+                                        params.useExactPredicates);
         // _check_repair_intersections_end
         break;
 #ifdef AXOM_USE_RAJA
@@ -864,7 +927,8 @@ int main(int argc, char** argv)
           collisions,
           degenerate,
           params.resolution,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
   #ifdef AXOM_USE_OPENMP
       case raja_omp:
@@ -873,7 +937,8 @@ int main(int argc, char** argv)
           collisions,
           degenerate,
           params.resolution,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
   #endif
   #if defined(AXOM_USE_CUDA) && defined(AXOM_USE_UMPIRE)
@@ -883,7 +948,8 @@ int main(int argc, char** argv)
           collisions,
           degenerate,
           params.resolution,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
   #endif
   #if defined(AXOM_USE_HIP) && defined(AXOM_USE_UMPIRE) && defined(NDEBUG)
@@ -893,7 +959,8 @@ int main(int argc, char** argv)
           collisions,
           degenerate,
           params.resolution,
-          params.intersectionThreshold);
+          params.intersectionThreshold,
+          params.useExactPredicates);
         break;
   #endif
 #endif  // AXOM_USE_RAJA
@@ -905,11 +972,13 @@ int main(int argc, char** argv)
     timer.stop();
     SLIC_INFO("Detecting intersecting triangles took "
               << timer.elapsedTimeInSec() << " seconds.");
+    phaseTimings.record("intersection detection", timer.elapsedTimeInSec());
 
     announceMeshProblems(surface_mesh->getNumberOfCells(),
                          static_cast<int>(collisions.size()),
                          static_cast<int>(degenerate.size()));
 
+    axom::utilities::Timer writeTimer(true);
     saveProblemFlagsToMesh(surface_mesh, collisions, degenerate);
 
     if(!writeAnnotatedMesh(surface_mesh, params.collisionsMeshName()))
@@ -921,6 +990,8 @@ int main(int argc, char** argv)
     {
       SLIC_ERROR("Couldn't write results to " << params.collisionsTextName());
     }
+    writeTimer.stop();
+    phaseTimings.record("intersection output", writeTimer.elapsedTimeInSec());
 
     if(params.verboseOutput && !collisions.empty())
     {
@@ -964,16 +1035,23 @@ int main(int argc, char** argv)
       break;
     default:
       std::cout << "An error was encountered while checking." << std::endl
-                << "This may be due to a non-manifold mesh." << std::endl;
+                << "This may be due to a non-manifold mesh or to "
+                << "degenerate triangles." << std::endl;
       break;
     }
     // _report_watertight_end
     SLIC_INFO("Testing for watertightness took " << timer2.elapsedTimeInSec()
                                                  << " seconds.");
+    phaseTimings.record("watertight check", timer2.elapsedTimeInSec());
 
+    axom::utilities::Timer writeTimer(true);
     mint::write_vtk(surface_mesh, params.weldMeshName());
+    writeTimer.stop();
+    phaseTimings.record("welded mesh output", writeTimer.elapsedTimeInSec());
   }
 
+  phaseTimings.report();
+
   // Delete the mesh
   delete surface_mesh;
   surface_mesh = nullptr;